@@ -67,11 +67,11 @@ const  uint32_t Obj1A00_01_20 = CO_LINK(0x2100, 0x01, 32);
 const  uint32_t Obj1A00_02_20 = CO_LINK(0x2100, 0x02,  8);
 const  uint32_t Obj1A00_03_20 = CO_LINK(0x2100, 0x03,  8);
 
-/* allocate the dynamic object dictionary */
+/* allocate the memory arena of the dynamic object dictionary */
 static CO_OBJ ClockOD[APP_OBJ_N];
 
 /* allocate the dynamic dictionary management structure */
-static OD_DYN DynDict;
+static CO_DICT_DYN DynDict;
 
 /* Each software timer needs some memory for managing
  * the lists and states of the timed action events.
@@ -91,7 +91,8 @@ static uint8_t SdoSrvMem[CO_SSDO_N * CO_SDO_BUF_BYTE];
 static struct CO_IF_DRV_T AppDriver = {
     &SimCanDriver,
     &SwCycleTimerDriver,
-    &SimNvmDriver
+    &SimNvmDriver,
+    NULL
 };
 
 /* Specify the EMCY error codes with the corresponding
@@ -129,49 +130,49 @@ struct CO_NODE_SPEC_T AppSpec = {
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
-static void ODCreateSDOServer(OD_DYN *self, uint8_t srv, CO_DATA request, CO_DATA response)
+static void ODCreateSDOServer(CO_DICT_DYN *self, uint8_t srv, CO_DATA request, CO_DATA response)
 {
     if (srv == 0) {
         request  = (uint32_t)0x600;
         response = (uint32_t)0x580;
     }
-    ODAddUpdate(self, CO_KEY(0x1200+srv, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(2));
-    ODAddUpdate(self, CO_KEY(0x1200+srv, 1, CO_OBJ_DN__R_), CO_TUNSIGNED32, request);
-    ODAddUpdate(self, CO_KEY(0x1200+srv, 2, CO_OBJ_DN__R_), CO_TUNSIGNED32, response);
+    CODictDynAdd(self, CO_KEY(0x1200+srv, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(2));
+    CODictDynAdd(self, CO_KEY(0x1200+srv, 1, CO_OBJ_DN__R_), CO_TUNSIGNED32, request);
+    CODictDynAdd(self, CO_KEY(0x1200+srv, 2, CO_OBJ_DN__R_), CO_TUNSIGNED32, response);
 }
 
-static void ODCreateTPDOCom(OD_DYN *self, uint8_t num, CO_DATA id, uint8_t type)
+static void ODCreateTPDOCom(CO_DICT_DYN *self, uint8_t num, CO_DATA id, uint8_t type)
 {
-    ODAddUpdate(self, CO_KEY(0x1800+num, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(2));
-    ODAddUpdate(self, CO_KEY(0x1800+num, 1, CO_OBJ__N__R_), CO_TUNSIGNED32, id);
-    ODAddUpdate(self, CO_KEY(0x1800+num, 2, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(type));
+    CODictDynAdd(self, CO_KEY(0x1800+num, 0, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(2));
+    CODictDynAdd(self, CO_KEY(0x1800+num, 1, CO_OBJ__N__R_), CO_TUNSIGNED32, id);
+    CODictDynAdd(self, CO_KEY(0x1800+num, 2, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(type));
 }
 
-static void ODCreateTPdoMap(OD_DYN *self, uint8_t num, uint32_t *map, uint8_t len)
+static void ODCreateTPdoMap(CO_DICT_DYN *self, uint8_t num, uint32_t *map, uint8_t len)
 {
     uint8_t n;
 
-    ODAddUpdate(self, CO_KEY(0x1A00+num, 0, CO_OBJ_D___R_), CO_TUNSIGNED8, (CO_DATA)(len));
+    CODictDynAdd(self, CO_KEY(0x1A00+num, 0, CO_OBJ_D___R_), CO_TUNSIGNED8, (CO_DATA)(len));
     for (n = 0; n < len; n++) {
-        ODAddUpdate(self, CO_KEY(0x1A00+num, 1+n, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(map[n]));
+        CODictDynAdd(self, CO_KEY(0x1A00+num, 1+n, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(map[n]));
     }
 }
 
 /* function to setup the quickstart object dictionary */
-static void ODCreateDict(OD_DYN *self)
+static void ODCreateDict(CO_DICT_DYN *self)
 {
     uint32_t map[3];
 
-    ODAddUpdate(self, CO_KEY(0x1000, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(&Obj1000_00_20));
-    ODAddUpdate(self, CO_KEY(0x1001, 0, CO_OBJ____PR_), CO_TUNSIGNED8,  (CO_DATA)(&Obj1001_00_08));
-    ODAddUpdate(self, CO_KEY(0x1014, 0, CO_OBJ_D___R_), CO_TEMCY_ID,    (CO_DATA)(&Obj1014_00_20));
-    ODAddUpdate(self, CO_KEY(0x1017, 0, CO_OBJ_D___R_), CO_THB_PROD,    (CO_DATA)(&Obj1017_00_10));
+    CODictDynAdd(self, CO_KEY(0x1000, 0, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(&Obj1000_00_20));
+    CODictDynAdd(self, CO_KEY(0x1001, 0, CO_OBJ____PR_), CO_TUNSIGNED8,  (CO_DATA)(&Obj1001_00_08));
+    CODictDynAdd(self, CO_KEY(0x1014, 0, CO_OBJ_D___R_), CO_TEMCY_ID,    (CO_DATA)(&Obj1014_00_20));
+    CODictDynAdd(self, CO_KEY(0x1017, 0, CO_OBJ_D___R_), CO_THB_PROD,    (CO_DATA)(&Obj1017_00_10));
 
-    ODAddUpdate(self, CO_KEY(0x1018, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(4));
-    ODAddUpdate(self, CO_KEY(0x1018, 1, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(&Obj1018_01_20));
-    ODAddUpdate(self, CO_KEY(0x1018, 2, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(&Obj1018_02_20));
-    ODAddUpdate(self, CO_KEY(0x1018, 3, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(&Obj1018_03_20));
-    ODAddUpdate(self, CO_KEY(0x1018, 4, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(&Obj1018_04_20));
+    CODictDynAdd(self, CO_KEY(0x1018, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(4));
+    CODictDynAdd(self, CO_KEY(0x1018, 1, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(&Obj1018_01_20));
+    CODictDynAdd(self, CO_KEY(0x1018, 2, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(&Obj1018_02_20));
+    CODictDynAdd(self, CO_KEY(0x1018, 3, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(&Obj1018_03_20));
+    CODictDynAdd(self, CO_KEY(0x1018, 4, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(&Obj1018_04_20));
 
     ODCreateSDOServer(self, 0, (CO_DATA)&Obj1200_01_20, (CO_DATA)&Obj1200_02_20);
 
@@ -182,10 +183,10 @@ static void ODCreateDict(OD_DYN *self)
     map[2] = (CO_DATA)&Obj1A00_03_20;
     ODCreateTPdoMap(self, 0, map, 3);
 
-    ODAddUpdate(self, CO_KEY(0x2100, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(3));
-    ODAddUpdate(self, CO_KEY(0x2100, 1, CO_OBJ____PR_), CO_TUNSIGNED32, (CO_DATA)(&Obj2100_01_20));
-    ODAddUpdate(self, CO_KEY(0x2100, 2, CO_OBJ____PR_), CO_TUNSIGNED8 , (CO_DATA)(&Obj2100_02_08));
-    ODAddUpdate(self, CO_KEY(0x2100, 3, CO_OBJ___APR_), CO_TUNSIGNED8 , (CO_DATA)(&Obj2100_03_08));
+    CODictDynAdd(self, CO_KEY(0x2100, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(3));
+    CODictDynAdd(self, CO_KEY(0x2100, 1, CO_OBJ____PR_), CO_TUNSIGNED32, (CO_DATA)(&Obj2100_01_20));
+    CODictDynAdd(self, CO_KEY(0x2100, 2, CO_OBJ____PR_), CO_TUNSIGNED8 , (CO_DATA)(&Obj2100_02_08));
+    CODictDynAdd(self, CO_KEY(0x2100, 3, CO_OBJ___APR_), CO_TUNSIGNED8 , (CO_DATA)(&Obj2100_03_08));
 }
 
 /******************************************************************************
@@ -195,11 +196,16 @@ static void ODCreateDict(OD_DYN *self)
 void ClkStartNode(CO_NODE *node)
 {
     /* Clear all entries in object dictionary */
-    ODInit(&DynDict, &ClockOD[0], APP_OBJ_N);
+    (void)CODictDynInit(&DynDict, &ClockOD[0], sizeof(ClockOD));
 
-    /* Setup the object dictionary during runtime */
+    /* Collect the object entries during runtime and sort them once */
     ODCreateDict(&DynDict);
+    (void)CODictDynBuild(&DynDict);
 
     /* Create a node with generated object dictionary */
+    CODictDynSetSpec(&DynDict, &AppSpec);
     CONodeInit(node, &AppSpec);
+
+    /* Further object entries may be inserted or removed at runtime */
+    (void)CODictDynLink(&DynDict, &node->Dict);
 }
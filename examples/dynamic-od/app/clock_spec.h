@@ -25,7 +25,7 @@ extern "C" {
 * INCLUDES
 ******************************************************************************/
 
-#include "clock_dict.h"
+#include "co_core.h"
 
 /******************************************************************************
 * PUBLIC DEFINES
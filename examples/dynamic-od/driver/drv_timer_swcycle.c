@@ -30,12 +30,12 @@ static uint32_t TimerCounter = 0u;
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
-static void     DrvTimerInit   (uint32_t freq);
-static void     DrvTimerStart  (void);
-static uint8_t  DrvTimerUpdate (void);
-static uint32_t DrvTimerDelay  (void);
-static void     DrvTimerReload (uint32_t reload);
-static void     DrvTimerStop   (void);
+static void     DrvTimerInit   (CO_IF *cif, uint32_t freq);
+static void     DrvTimerStart  (CO_IF *cif);
+static uint8_t  DrvTimerUpdate (CO_IF *cif);
+static uint32_t DrvTimerDelay  (CO_IF *cif);
+static void     DrvTimerReload (CO_IF *cif, uint32_t reload);
+static void     DrvTimerStop   (CO_IF *cif);
 
 /******************************************************************************
 * PUBLIC VARIABLE
@@ -54,20 +54,24 @@ const CO_IF_TIMER_DRV SwCycleTimerDriver = {
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
-static void DrvTimerInit(uint32_t freq)
+static void DrvTimerInit(CO_IF *cif, uint32_t freq)
 {
+    (void)cif;
     (void)freq;
     TimerCounter = 0u;
 }
 
-static void DrvTimerStart(void)
+static void DrvTimerStart(CO_IF *cif)
 {
+    (void)cif;
 }
 
-static uint8_t DrvTimerUpdate(void)
+static uint8_t DrvTimerUpdate(CO_IF *cif)
 {
     uint8_t result = 0u;
 
+    (void)cif;
+
     if (TimerCounter > 0u) {
         TimerCounter--;
         if (TimerCounter == 0u) {
@@ -78,17 +82,23 @@ static uint8_t DrvTimerUpdate(void)
     return (result);
 }
 
-static uint32_t DrvTimerDelay(void)
+static uint32_t DrvTimerDelay(CO_IF *cif)
 {
+    (void)cif;
+
     return (TimerCounter);
 }
 
-static void DrvTimerReload(uint32_t reload)
+static void DrvTimerReload(CO_IF *cif, uint32_t reload)
 {
+    (void)cif;
+
     TimerCounter = reload;
 }
 
-static void DrvTimerStop(void)
+static void DrvTimerStop(CO_IF *cif)
 {
+    (void)cif;
+
     TimerCounter = 0u;
 }
@@ -102,6 +102,13 @@ int main(void)
         while(1);
     }
 
+    /* Search the object entries with the generated lookup table
+     * of the static object dictionary.
+     */
+    if (CODictUseTbl(&Clk.Dict, &ClockTbl) != CO_ERR_NONE) {
+        while(1);
+    }
+
     /* Use CANopen software timer to create a cyclic function
      * call to the callback function 'AppClock()' with a period
      * of 1s (equal: 1000ms).
@@ -119,7 +119,8 @@ static uint8_t SdoSrvMem[CO_SSDO_N * CO_SDO_BUF_BYTE];
 static struct CO_IF_DRV_T AppDriver = {
     &SimCanDriver,
     &SwCycleTimerDriver,
-    &SimNvmDriver
+    &SimNvmDriver,
+    NULL
 };
 
 /* Specify the EMCY error codes with the corresponding
@@ -45,6 +45,11 @@ enum EMCY_CODES {
 
 extern struct CO_NODE_SPEC_T AppSpec;
 
+/* The lookup table of the object dictionary is generated during the build
+ * (see canopen_dict_table() in CMakeLists.txt).
+ */
+extern const CO_DICT_TBL ClockTbl;
+
 #ifdef __cplusplus               /* for compatibility with C++ environments  */
 }
 #endif
@@ -60,12 +60,12 @@ static SIM_CAN_BUS CanBus = { 0u };
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
-static void    DrvCanInit   (void);
-static void    DrvCanEnable (uint32_t baudrate);
-static int16_t DrvCanSend   (CO_IF_FRM *frm);
-static int16_t DrvCanRead   (CO_IF_FRM *frm);
-static void    DrvCanReset  (void);
-static void    DrvCanClose  (void);
+static void    DrvCanInit   (CO_IF *cif);
+static void    DrvCanEnable (CO_IF *cif, uint32_t baudrate);
+static int16_t DrvCanSend   (CO_IF *cif, CO_IF_FRM *frm);
+static int16_t DrvCanRead   (CO_IF *cif, CO_IF_FRM *frm);
+static void    DrvCanReset  (CO_IF *cif);
+static void    DrvCanClose  (CO_IF *cif);
 
 /******************************************************************************
 * PUBLIC VARIABLE
@@ -77,17 +77,21 @@ const CO_IF_CAN_DRV SimCanDriver = {
     DrvCanRead,
     DrvCanSend,
     DrvCanReset,
-    DrvCanClose
+    DrvCanClose,
+    0,
+    0
 };
 
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
-static void DrvCanInit(void)
+static void DrvCanInit(CO_IF *cif)
 {
     SIM_CAN_BUS *bus = &CanBus;
 
+    (void)cif;
+
     if (bus->Addr == bus) {                           /* reset init state    */
         bus->Status = SIM_CAN_STAT_INIT; 
     } else {                                          /* initialize bus      */
@@ -103,21 +107,25 @@ static void DrvCanInit(void)
     bus->TxRd     = &bus->TxQ[0u];
 }
 
-static void DrvCanEnable(uint32_t baudrate)
+static void DrvCanEnable(CO_IF *cif, uint32_t baudrate)
 {
     SIM_CAN_BUS *bus = &CanBus;
 
+    (void)cif;
+
     bus->Status   |= SIM_CAN_STAT_ACTIVE;
     bus->Baudrate  = baudrate;
 }
 
-static int16_t DrvCanSend(CO_IF_FRM *frm)
+static int16_t DrvCanSend(CO_IF *cif, CO_IF_FRM *frm)
 {
     int16_t       result = 0u;
     SIM_CAN_BUS  *bus    = &CanBus;;
     CO_IF_FRM    *tx;
     uint8_t       byte;
     
+    (void)cif;
+
     if ((bus->Status & SIM_CAN_STAT_ACTIVE) == 0u) {   /* CAN bus is passive */
         return ((int16_t)-1u);
     }
@@ -145,13 +153,15 @@ static int16_t DrvCanSend(CO_IF_FRM *frm)
     return (result);
 }
 
-static int16_t DrvCanRead (CO_IF_FRM *frm)
+static int16_t DrvCanRead (CO_IF *cif, CO_IF_FRM *frm)
 {
     int16_t       result = 0u;
     SIM_CAN_BUS  *bus    = &CanBus;
     CO_IF_FRM    *rx;
     uint8_t       byte;
 
+    (void)cif;
+
     if ((bus->Status & SIM_CAN_STAT_ACTIVE) == 0u) {   /* CAN bus is passive */
         return ((int16_t)-1u);
     }
@@ -177,19 +187,21 @@ static int16_t DrvCanRead (CO_IF_FRM *frm)
     return (result);
 }
 
-static void DrvCanReset(void)
+static void DrvCanReset(CO_IF *cif)
 {
     SIM_CAN_BUS *bus      = &CanBus;
     uint32_t     baudrate = bus->Baudrate;
 
-    DrvCanInit();
-    DrvCanEnable(baudrate);
+    DrvCanInit(cif);
+    DrvCanEnable(cif, baudrate);
 }
 
-static void DrvCanClose(void)
+static void DrvCanClose(CO_IF *cif)
 {
     SIM_CAN_BUS *bus = &CanBus;
 
+    (void)cif;
+
     bus->Status &= ~SIM_CAN_STAT_ACTIVE;
 }
 
@@ -20,8 +20,8 @@
 
 #include "co_core.h"
 
-void COTmrLock  (void);
-void COTmrUnlock(void);
+void COTmrLock  (CO_TMR *tmr);
+void COTmrUnlock(CO_TMR *tmr);
 
 /******************************************************************************
 * MANDATORY CALLBACK FUNCTIONS
@@ -40,8 +40,10 @@ void CONodeFatalError(void)
 }
 
 WEAK
-void COTmrLock(void)
+void COTmrLock(CO_TMR *tmr)
 {
+    (void)tmr;
+
     /* This function helps to guarantee the consistancy
      * of the internal timer management while interrupted
      * by the used timer interrupt. Most likely you need
@@ -53,8 +55,10 @@ void COTmrLock(void)
 }
 
 WEAK
-void COTmrUnlock(void)
+void COTmrUnlock(CO_TMR *tmr)
 {
+    (void)tmr;
+
     /* This function helps to guarantee the consistancy
      * of the internal timer management while interrupted
      * by the used timer interrupt. Most likely you need
@@ -117,8 +121,9 @@ void CONmtHbConsChange(CO_NMT *nmt, uint8_t nodeId, CO_MODE mode)
 }
 
 WEAK
-CO_ERR COLssLoad(uint32_t *baudrate, uint8_t *nodeId)
+CO_ERR COLssLoad(CO_NODE *node, uint32_t *baudrate, uint8_t *nodeId)
 {
+    (void)node;
     (void)baudrate;
     (void)nodeId;
 
@@ -130,8 +135,9 @@ CO_ERR COLssLoad(uint32_t *baudrate, uint8_t *nodeId)
 }
 
 WEAK
-CO_ERR COLssStore(uint32_t baudrate, uint8_t nodeId)
+CO_ERR COLssStore(CO_NODE *node, uint32_t baudrate, uint8_t nodeId)
 {
+    (void)node;
     (void)baudrate;
     (void)nodeId;
 
@@ -143,8 +149,9 @@ CO_ERR COLssStore(uint32_t baudrate, uint8_t nodeId)
 }
 
 WEAK
-void COIfCanReceive(CO_IF_FRM *frm)
+void COIfCanReceive(CO_IF *cif, CO_IF_FRM *frm)
 {
+    (void)cif;
     (void)frm;
 
     /* Optional: place here some code, which is called
@@ -154,8 +161,9 @@ void COIfCanReceive(CO_IF_FRM *frm)
 }
 
 WEAK
-void COPdoTransmit(CO_IF_FRM *frm)
+void COPdoTransmit(CO_TPDO *pdo, CO_IF_FRM *frm)
 {
+    (void)pdo;
     (void)frm;
 
     /* Optional: place here some code, which is called
@@ -165,8 +173,9 @@ void COPdoTransmit(CO_IF_FRM *frm)
 }
 
 WEAK
-int16_t COPdoReceive(CO_IF_FRM *frm)
+int16_t COPdoReceive(CO_RPDO *pdo, CO_IF_FRM *frm)
 {
+    (void)pdo;
     (void)frm;
 
     /* Optional: place here some code, which is called
@@ -190,9 +199,23 @@ void COPdoSyncUpdate(CO_RPDO *pdo)
 }
 
 WEAK
-int16_t COParaDefault(struct CO_PARA_T *pg)
+uint32_t COSdoStatTime(CO_NODE *node)
+{
+    (void)node;
+
+    /* Optional: place here some code, which returns a
+     * free running time in microseconds, when the SDO
+     * statistics are enabled (USE_SDO_STAT). The time
+     * is used for the transfer duration histogram.
+     */
+    return (0u);
+}
+
+WEAK
+int16_t COParaDefault(struct CO_PARA_T *pg, CO_NODE *node)
 {
     (void)pg;
+    (void)node;
 
     /* Optional: place here some code, which is called
      * when a parameter group is restored to factory
@@ -202,8 +225,9 @@ int16_t COParaDefault(struct CO_PARA_T *pg)
 }
 
 WEAK
-void CORpdoWriteData(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
+void CORpdoWriteData(CO_RPDO *pdo, CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
 {
+    (void)pdo;
     (void)frm;
     (void)pos;
     (void)size;
@@ -216,8 +240,9 @@ void CORpdoWriteData(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
 }
 
 WEAK
-void COTpdoReadData(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
+void COTpdoReadData(CO_TPDO *pdo, CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
 {
+    (void)pdo;
     (void)frm;
     (void)pos;
     (void)size;
@@ -228,3 +253,16 @@ void COTpdoReadData(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
      * needs a mapped values with a size larger than 4 byte.
      */
 }
+
+#if USE_EXEC
+WEAK
+void COExecIdle(CO_EXEC *exec)
+{
+    (void)exec;
+
+    /* Optional: place here some code, which is called
+     * when an executor thread has nothing to do, e.g.
+     * yield or sleep the calling thread.
+     */
+}
+#endif
@@ -62,6 +62,50 @@
 #define CO_TPDO_N               4
 #endif
 
+/*! \brief DEFAULT TPDO TRIGGER HASH SIZE
+*
+*    This configuration define specifies the number of hash buckets used to
+*    find the TPDOs, which map a changed object. The value must be a power
+*    of 2. When not defined, the number of buckets is the next power of 2
+*    of the number of TPDO mapping links (CO_TPDO_N * 8), so the chains
+*    stay short with all TPDOs fully mapped. A smaller value saves memory
+*    when the TPDOs map only a few objects.
+*/
+#ifndef CO_TPDO_HASH_N
+/* next power of 2 of the number of links: set all bits below the MSB */
+#define CO_TPDO_LINK_P0         ((CO_TPDO_N * 8) - 1)
+#define CO_TPDO_LINK_P1         (CO_TPDO_LINK_P0 | (CO_TPDO_LINK_P0 >> 1))
+#define CO_TPDO_LINK_P2         (CO_TPDO_LINK_P1 | (CO_TPDO_LINK_P1 >> 2))
+#define CO_TPDO_LINK_P4         (CO_TPDO_LINK_P2 | (CO_TPDO_LINK_P2 >> 4))
+#define CO_TPDO_LINK_P8         (CO_TPDO_LINK_P4 | (CO_TPDO_LINK_P4 >> 8))
+#define CO_TPDO_HASH_N          (CO_TPDO_LINK_P8 + 1)
+#endif
+
+/*! \brief DEFAULT DICTIONARY INDEX DIRECTORY
+*
+*    This configuration define specifies the number of different object
+*    indices, which are held in the index directory of the object
+*    dictionary. The directory is built during the node initialization and
+*    holds the position and the number of the subindex entries of each
+*    index, so a subindex is found with a direct array offset instead of a
+*    search. When the dictionary holds more indices, the binary search over
+*    all entries is used. The value 0 disables the directory.
+*/
+#ifndef CO_DICT_DIR_N
+#define CO_DICT_DIR_N           0
+#endif
+
+/*! \brief DEFAULT DICTIONARY LOOKUP CACHE
+*
+*    This configuration define specifies the number of recently found
+*    object entries, which are held in a direct-mapped cache of the object
+*    dictionary. The value must be a power of 2; the value 0 disables the
+*    cache.
+*/
+#ifndef CO_DICT_CACHE_N
+#define CO_DICT_CACHE_N         0
+#endif
+
 /*! \brief DEFAULT ENABLE LSS
 *
 *    This configuration define specifies whether the LSS functionality will
@@ -80,4 +124,329 @@
 #define USE_CSDO                1
 #endif
 
+/*! \brief DEFAULT SDO CLIENT BLOCK TRANSFER
+*
+*    This configuration define specifies the minimal transfer size in bytes,
+*    which is transfered by the SDO client with the block protocol. Smaller
+*    transfers are using the expedited or segmented protocol. The value 0
+*    disables the block protocol in the SDO client.
+*/
+#ifndef CO_CSDO_BLK_MIN
+#define CO_CSDO_BLK_MIN         64
+#endif
+
+/*! \brief DEFAULT SDO CLIENT BLOCK SIZE
+*
+*    This configuration define specifies the number of segments per block
+*    (1..127), which the SDO client requests for block uploads.
+*/
+#ifndef CO_CSDO_BLK_SIZE
+#define CO_CSDO_BLK_SIZE        127
+#endif
+
+/*! \brief DEFAULT SDO CLIENT BLOCK CRC
+*
+*    This configuration define specifies whether the SDO client offers the
+*    CRC checksum in block transfers. The checksum is used, when the SDO
+*    server supports it, too.
+*/
+#ifndef CO_CSDO_BLK_CRC
+#define CO_CSDO_BLK_CRC         1
+#endif
+
+/*! \brief DEFAULT SDO SERVER BLOCK CRC
+*
+*    This configuration define specifies whether the SDO server supports the
+*    CRC checksum in block transfers. The checksum is used, when the SDO
+*    client requests it.
+*/
+#ifndef CO_SSDO_BLK_CRC
+#define CO_SSDO_BLK_CRC         1
+#endif
+
+/*! \brief DEFAULT SDO SERVER BLOCK SIZE
+*
+*    This configuration define specifies the number of segments per block
+*    (1..127), which the SDO servers request for block downloads. The block
+*    size of a single SDO server is changed with \ref COSdoSetBlock().
+*/
+#ifndef CO_SSDO_BLK_SIZE
+#define CO_SSDO_BLK_SIZE        127
+#endif
+
+/*! \brief DEFAULT SDO SERVER DEFERRED BLOCK WRITE
+*
+*    This configuration define specifies whether the SDO servers write the
+*    received blocks of a block download deferred into the object entry.
+*    The transfer buffer is divided into two halves: a completed block is
+*    acknowledged at once and written by a timer action, while the next
+*    block is received into the other half. The block size is limited to
+*    the half transfer buffer (63 segments).
+*
+* \note
+*    Each active block download uses a second timer action of the node.
+*/
+#ifndef CO_SSDO_BLK_DEFER
+#define CO_SSDO_BLK_DEFER       0
+#endif
+
+/*! \brief DEFAULT SDO SERVER TIMEOUT
+*
+*    This configuration define specifies the SDO server protocol timeout in
+*    milliseconds. A segmented or block transfer is aborted with the abort
+*    code 0x05040000, when the SDO client sends no request within this time.
+*    The value 0 disables the timeout.
+*
+* \note
+*    Each active transfer uses one timer action of the node.
+*/
+#ifndef CO_SSDO_TMO
+#define CO_SSDO_TMO          1000
+#endif
+
+/*! \brief DEFAULT SDO SERVER TRANSFER BUFFERS
+*
+*    This configuration define specifies how many transfer buffers are shared
+*    by the SDO servers. A buffer of CO_SDO_BUF_BYTE bytes is taken from the
+*    pool, when a segmented or block transfer starts, and is released at the
+*    end of the transfer. A transfer, which finds no free buffer, is aborted
+*    with the abort code 0x05040005. Expedited transfers need no buffer.
+*
+* \note
+*    The SDO transfer buffer of the node specification must hold
+*    CO_SSDO_BUF_N * CO_SDO_BUF_BYTE bytes.
+*/
+#ifndef CO_SSDO_BUF_N
+#define CO_SSDO_BUF_N           CO_SSDO_N
+#endif
+
+/*! \brief DEFAULT SDO SERVER EXPEDITED BURST
+*
+*    This configuration define specifies whether the SDO responses of a
+*    received batch are sent in a burst. When a batch of
+*    \ref CONodeProcessBatch() holds more than one expedited request to
+*    the same SDO server, the transmission is deferred until the batch is
+*    processed, so all responses are handed over to the CAN driver with a
+*    single call.
+*/
+#ifndef CO_SSDO_BURST
+#define CO_SSDO_BURST           1
+#endif
+
+/*! \brief DEFAULT SDO SERVER RESPONSE CACHE
+*
+*    This configuration define specifies the number of expedited upload
+*    responses, which are cached by the node. Only read-only object entries
+*    of the basic integer types are cached; a repeated upload of a cached
+*    entry is answered without searching and reading the object entry. The
+*    cache is cleared with each write to an object entry and after
+*    CO_SSDO_CACHE_TMO milliseconds. The value 0 disables the cache.
+*
+* \note
+*    The cache uses one timer action of the node. Changes of an object
+*    value, which are not written with the object functions (e.g. the
+*    application changes the linked variable), are visible after the
+*    cache timeout.
+*/
+#ifndef CO_SSDO_CACHE_N
+#define CO_SSDO_CACHE_N         0
+#endif
+
+/*! \brief DEFAULT SDO SERVER RESPONSE CACHE TIMEOUT
+*
+*    This configuration define specifies the time in milliseconds, for
+*    which the cached expedited upload responses are valid.
+*/
+#ifndef CO_SSDO_CACHE_TMO
+#define CO_SSDO_CACHE_TMO       10
+#endif
+
+/*! \brief DEFAULT ENABLE SDO STATISTICS
+*
+*    This configuration define specifies whether the SDO servers and SDO
+*    clients count their transfers, transfered bytes, aborts and timeouts
+*    and sort the duration of the finished transfers into a histogram. The
+*    time is taken with the callback function COSdoStatTime().
+*/
+#ifndef USE_SDO_STAT
+#define USE_SDO_STAT            0
+#endif
+
+/*! \brief DEFAULT SDO STATISTICS ABORT CODES
+*
+*    This configuration define specifies the number of different abort
+*    codes, which are counted separately. Further abort codes are counted
+*    together.
+*/
+#ifndef CO_SDO_STAT_CODE_N
+#define CO_SDO_STAT_CODE_N      8
+#endif
+
+/*! \brief DEFAULT SDO STATISTICS HISTOGRAM
+*
+*    These configuration defines specify the number of histogram buckets
+*    and the upper limit of the first bucket in microseconds. The limit is
+*    doubled with each bucket; the last bucket holds all longer transfers.
+*    The default buckets are: 125us, 250us, 500us, 1ms, .. 128ms, more.
+* \{
+*/
+#ifndef CO_SDO_STAT_HIST_N
+#define CO_SDO_STAT_HIST_N      12
+#endif
+
+#ifndef CO_SDO_STAT_HIST_RES
+#define CO_SDO_STAT_HIST_RES    125
+#endif
+/*! \} */
+
+/*! \brief DEFAULT SDO CRC CARRY-LESS MULTIPLICATION
+*
+*    This configuration define specifies whether the SDO block CRC may be
+*    calculated with the carry-less multiplication (PCLMULQDQ) of x86 CPUs.
+*    The instruction is used, when the CPU supports it (checked at runtime).
+*    The default is enabled for GCC compatible compilers on x86 targets.
+*/
+#ifndef CO_SDO_CRC_CLMUL
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define CO_SDO_CRC_CLMUL        1
+#else
+#define CO_SDO_CRC_CLMUL        0
+#endif
+#endif
+
+/*! \brief DEFAULT CPU BYTE ORDER
+*
+*    This configuration define specifies whether the CPU stores values in
+*    little endian byte order (same as CANopen). When set, the PDO values of
+*    basic objects are copied with memcpy() into and out of the CAN frame.
+*    The default is detected with the compiler predefined byte order.
+*/
+#ifndef CO_CPU_LITTLE_ENDIAN
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define CO_CPU_LITTLE_ENDIAN    1
+#else
+#define CO_CPU_LITTLE_ENDIAN    0
+#endif
+#endif
+
+/*! \brief DEFAULT RECEIVE BATCH SIZE
+*
+*    This configuration define specifies how many CAN frames are read from
+*    the CAN driver with a single call in \ref CONodeProcessBatch(). The
+*    frames are buffered on the stack of the caller.
+*/
+#ifndef CO_IF_RX_BATCH_N
+#define CO_IF_RX_BATCH_N        8
+#endif
+
+/*! \brief DEFAULT TRANSMIT BATCH SIZE
+*
+*    This configuration define specifies how many CAN frames are collected
+*    in the transmit queue of a node, while the transmission is deferred
+*    (e.g. during the SYNC handling). A full queue is flushed to the CAN
+*    driver immediately.
+*/
+#ifndef CO_IF_TX_BATCH_N
+#define CO_IF_TX_BATCH_N        8
+#endif
+
+/*! \brief DEFAULT ENABLE TIMING WHEEL
+*
+*    This configuration define specifies the timer management engine. When
+*    enabled, the timer actions are kept in a hierarchical timing wheel with
+*    constant time for creating and deleting a timer. When disabled, the
+*    timer events are kept in a sorted delta list.
+*
+* \note
+*    The timing wheel needs 128 list pointers in each node.
+*/
+#ifndef USE_TMR_WHEEL
+#define USE_TMR_WHEEL           0
+#endif
+
+/*! \brief DEFAULT ENABLE CAN-ID DISPATCH TABLE
+*
+*    This configuration define specifies whether received CAN frames are
+*    routed to the services with a per-node CAN-ID lookup table. When
+*    disabled, each frame is checked against the services one after another.
+*
+* \note
+*    The table for 11-bit identifiers needs 2048 bytes in each node.
+*/
+#ifndef USE_DISP
+#define USE_DISP                1
+#endif
+
+/*! \brief DEFAULT DISPATCH HEARTBEAT CONSUMERS
+*
+*    This configuration define specifies how many heartbeat consumers are
+*    expected to be routed by the CAN-ID dispatch table.
+*/
+#ifndef CO_DISP_HBC_N
+#define CO_DISP_HBC_N          16
+#endif
+
+/*! \brief DEFAULT DISPATCH SLOTS
+*
+*    This configuration define specifies how many receive services can be
+*    registered in the CAN-ID dispatch table (maximum is 65535). When more
+*    services are configured, the node falls back to the sequential checks.
+*
+* \note
+*    Up to 255 slots, the table for 11-bit identifiers uses one byte per
+*    identifier; with more slots it uses two bytes per identifier.
+*/
+#ifndef CO_DISP_SLOT_N
+#define CO_DISP_SLOT_N          (2 + CO_SSDO_N + CO_CSDO_N + CO_RPDO_N + CO_DISP_HBC_N)
+#endif
+
+/*! \brief DEFAULT DISPATCH EXTENDED IDENTIFIERS
+*
+*    This configuration define specifies the size of the hash table for
+*    29-bit CAN identifiers in the CAN-ID dispatch table (power of 2).
+*/
+#ifndef CO_DISP_EXT_N
+#define CO_DISP_EXT_N           8
+#endif
+
+/*! \brief DEFAULT ENABLE NODE EXECUTOR
+*
+*    This configuration define specifies whether the multithreaded node
+*    executor is available. The executor runs each node in a worker thread
+*    and exchanges the CAN frames with lock-free mailboxes.
+*
+* \note
+*    The executor needs atomic load and store operations (see co_exec.h).
+*/
+#ifndef USE_EXEC
+#define USE_EXEC                0
+#endif
+
+/*! \brief DEFAULT EXECUTOR NODES
+*
+*    This configuration define specifies how many nodes can be added to a
+*    single executor.
+*/
+#ifndef CO_EXEC_NODE_N
+#define CO_EXEC_NODE_N         32
+#endif
+
+/*! \brief DEFAULT EXECUTOR FRAME MAILBOX
+*
+*    This configuration define specifies the number of CAN frames in each
+*    receive and transmit mailbox of a node (power of 2).
+*/
+#ifndef CO_EXEC_MBX_N
+#define CO_EXEC_MBX_N          64
+#endif
+
+/*! \brief DEFAULT EXECUTOR REQUEST MAILBOX
+*
+*    This configuration define specifies the number of posted object writes
+*    in the request mailbox of a node (power of 2).
+*/
+#ifndef CO_EXEC_REQ_N
+#define CO_EXEC_REQ_N          32
+#endif
+
 #endif  /* #ifndef CO_CFG_H_ */
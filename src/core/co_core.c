@@ -20,6 +20,12 @@
 
 #include "co_core.h"
 
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void CONodeRx(CO_NODE *node, CO_IF_FRM *frm);
+
 /******************************************************************************
 * FUNCTIONS
 ******************************************************************************/
@@ -38,8 +44,9 @@ void CONodeInit(CO_NODE *node, CO_NODE_SPEC *spec)
     node->NodeId   = spec->NodeId;
     node->Error    = CO_ERR_NONE;
     node->Nmt.Tmr  = -1;
+    CODispInit(&node->Disp, node);
 #if USE_LSS
-    err = COLssLoad(&node->Baudrate, &node->NodeId);
+    err = COLssLoad(node, &node->Baudrate, &node->NodeId);
     if (err != CO_ERR_NONE) {
         node->Error = CO_ERR_LSS_LOAD;
     }
@@ -112,81 +119,100 @@ CO_ERR CONodeGetErr(CO_NODE *node)
 void CONodeProcess(CO_NODE *node)
 {
     CO_IF_FRM frm;
-    CO_ERR    err;
-    CO_SDO   *srv;
-#if USE_CSDO
-    CO_CSDO  *csdo;
-#endif
-    CO_RPDO  *rpdo;
     int16_t   result;
-    uint8_t   allowed;
 
     result = COIfCanRead(&node->If, &frm);
-    if (result <= 0) {
-        allowed = 0;
-    } else {
-        allowed = node->Nmt.Allowed;
-#if USE_LSS
-        result  = COLssCheck(&node->Lss, &frm);
-        if (result != 0) {
-            if (result > 0) {
-                (void)COIfCanSend(&node->If, &frm);
-            }
-            allowed = 0;
-        }
-#endif //USE_LSS
+    if (result > 0) {
+        CONodeRx(node, &frm);
     }
+}
 
-    if ((allowed & CO_SDO_ALLOWED) != (uint8_t)0) {
-        srv = COSdoCheck(node->Sdo, &frm);
-        if (srv != NULL) {
-            err = COSdoResponse(srv);
-            if ((err == CO_ERR_NONE     ) ||
-                (err == CO_ERR_SDO_ABORT)) {
-                (void)COIfCanSend(&node->If, &frm);
-            }
-            allowed = 0;
-#if USE_CSDO
-        } else {
-            csdo = COCSdoCheck(node->CSdo, &frm);
-            if (csdo != NULL) {
-                err = COCSdoResponse(csdo);
-                if ((err == CO_ERR_NONE) ||
-                    (err == CO_ERR_SDO_ABORT)) {
-                    (void)COIfCanSend(&node->If, &frm);
-                }
-                allowed = 0;
-            }
+/*
+* see function definition
+*/
+uint16_t CONodeProcessBatch(CO_NODE *node, uint16_t max)
+{
+    CO_IF_FRM frm[CO_IF_RX_BATCH_N];
+    uint16_t  handled = 0;
+    uint16_t  req;
+    int16_t   num;
+    int16_t   n;
+#if CO_SSDO_BURST
+    uint8_t   burst;
 #endif
-        }
-    }
 
-    if ((allowed & CO_NMT_ALLOWED) != (uint8_t)0) {
-        if (CONmtCheck(&node->Nmt, &frm) >= 0) {
-            allowed = 0;
+    while (handled < max) {
+        req = max - handled;
+        if (req > (uint16_t)CO_IF_RX_BATCH_N) {
+            req = (uint16_t)CO_IF_RX_BATCH_N;
+        }
+        num = COIfCanReadBatch(&node->If, &frm[0], req);
+        if (num <= 0) {
+            break;
         }
-        if (CONmtHbConsCheck(&node->Nmt, &frm) >= 0) {
-            allowed = 0;
+#if CO_SSDO_BURST
+        /* send the responses of an expedited burst in a single batch */
+        burst = COSdoBurst(node->Sdo, &frm[0], (uint16_t)num);
+        if (burst != 0u) {
+            COIfCanSendDefer(&node->If);
+        }
+#endif
+        for (n = 0; n < num; n++) {
+            CONodeRx(node, &frm[n]);
+        }
+#if CO_SSDO_BURST
+        if (burst != 0u) {
+            (void)COIfCanSendFlush(&node->If);
+        }
+#endif
+        handled += (uint16_t)num;
+        if ((uint16_t)num < req) {
+            break;
         }
     }
 
-    if ((allowed & CO_PDO_ALLOWED) != (uint8_t)0) {
-        rpdo = CORPdoCheck(node->RPdo, &frm);
-        if (rpdo != NULL) {
-            CORPdoRx(rpdo, &frm);
-            allowed = 0;
+    return (handled);
+}
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  PROCESS RECEIVED CAN FRAME
+*
+*    This function initiates the protocol activity for a single received
+*    CAN frame. If the CAN frame is not handled by the stack, the frame is
+*    given to the (optional) callback function \ref COIfCanReceive().
+*
+* \param node
+*    pointer to the CANopen node object
+*
+* \param frm
+*    received CAN frame
+*/
+static void CONodeRx(CO_NODE *node, CO_IF_FRM *frm)
+{
+    uint8_t   allowed;
+#if USE_LSS
+    int16_t   result;
+#endif //USE_LSS
+
+    allowed = node->Nmt.Allowed;
+#if USE_LSS
+    result  = COLssCheck(&node->Lss, frm);
+    if (result != 0) {
+        if (result > 0) {
+            (void)COIfCanSend(&node->If, frm);
         }
+        allowed = 0;
     }
+#endif //USE_LSS
 
-    if ((allowed & CO_SYNC_ALLOWED) != (uint8_t)0) {
-        result = COSyncUpdate(&node->Sync, &frm);
-        if (result >= 0) {
-            COSyncHandler(&node->Sync);
-            allowed = 0;
-        }
+    if (allowed != (uint8_t)0) {
+        allowed = CODispProcess(&node->Disp, frm, allowed);
     }
 
     if (allowed != (uint8_t)0) {
-        COIfCanReceive(&frm);
+        COIfCanReceive(&node->If, frm);
     }
 }
@@ -31,9 +31,13 @@ extern "C" {
 /* basic types */
 #include "co_domain.h"
 #include "co_string.h"
+#include "co_stream.h"
+#include "co_cdcf.h"
 #include "co_integer8.h"
 #include "co_integer16.h"
+#include "co_integer24.h"
 #include "co_integer32.h"
+#include "co_integer64.h"
 
 /* cia301 types */
 #include "co_emcy_hist.h"
@@ -49,10 +53,12 @@ extern "C" {
 #include "co_pdo_num.h"
 #include "co_pdo_type.h"
 #include "co_sdo_id.h"
+#include "co_sdo_stat.h"
 #include "co_sync_cycle.h"
 #include "co_sync_id.h"
 
 #include "co_dict.h"
+#include "co_dict_dyn.h"
 #include "co_if.h"
 #include "co_emcy.h"
 #include "co_nmt.h"
@@ -60,6 +66,7 @@ extern "C" {
 #include "co_sdo.h"
 #include "co_ssdo.h"
 #include "co_csdo.h"
+#include "co_csdo_queue.h"
 #include "co_pdo.h"
 #include "co_sync.h"
 #if USE_LSS
@@ -67,6 +74,8 @@ extern "C" {
 #endif //USE_LSS
 #include "co_err.h"
 #include "co_obj.h"
+#include "co_disp.h"
+#include "co_exec.h"
 
 
 /******************************************************************************
@@ -86,13 +95,18 @@ typedef struct CO_NODE_T {
     struct CO_TMR_T        Tmr;                  /*!< Timer manager          */
     struct CO_SDO_T        Sdo[CO_SSDO_N];       /*!< SDO Server Array       */
     uint8_t               *SdoBuf;               /*!< SDO Transfer Buffer    */
+    struct CO_SDO_POOL_T   SdoPool;              /*!< SDO Buffer Pool        */
+#if CO_SSDO_CACHE_N > 0
+    struct CO_SDO_CACHE_T  SdoCache;             /*!< SDO Response Cache     */
+#endif
 #if USE_CSDO
     struct CO_CSDO_T       CSdo[CO_CSDO_N];      /*!< SDO client array       */
 #endif
     struct CO_RPDO_T       RPdo[CO_RPDO_N];      /*!< RPDO Array             */
     struct CO_TPDO_T       TPdo[CO_TPDO_N];      /*!< TPDO Array             */
-    struct CO_TPDO_LINK_T  TMap[CO_TPDO_N * 8];  /*!< TPDO mapping links     */
+    struct CO_TPDO_LINK_MAP_T TMap;              /*!< TPDO mapping links     */
     struct CO_SYNC_T       Sync;                 /*!< SYNC management        */
+    struct CO_DISP_T       Disp;                 /*!< CAN-ID dispatcher      */
 #if USE_LSS
     struct CO_LSS_T        Lss;                  /*!< LSS slave handling     */
 #endif //USE_LSS
@@ -193,6 +207,27 @@ CO_ERR CONodeGetErr(CO_NODE *node);
 */
 void CONodeProcess(CO_NODE *node);
 
+/*! \brief  CAN RECEIVE BATCH PROCESSING
+*
+*    This function processes up to max received CAN frames from the given
+*    CAN node in a single call. The frames are read from the CAN driver in
+*    blocks of up to CO_IF_RX_BATCH_N frames (see \ref COIfCanReadBatch())
+*    and dispatched one after another like in \ref CONodeProcess(). The
+*    function returns early, when the CAN driver delivers less frames than
+*    requested. The responses to a block with more than one expedited SDO
+*    request to the same SDO server are sent in a burst (see CO_SSDO_BURST).
+*
+* \param node
+*    Ptr to node info
+*
+* \param max
+*    maximal number of CAN frames to process
+*
+* \return
+*    number of processed CAN frames
+*/
+uint16_t CONodeProcessBatch(CO_NODE *node, uint16_t max);
+
 /******************************************************************************
 * CALLBACK FUNCTIONS
 ******************************************************************************/
@@ -20,44 +20,153 @@
 
 #include "co_dict.h"
 
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 #include "co_obj.h"
 #include "co_core.h"
 
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* The cache line of a key mixes the subindex with both bytes of the index,
+ * so the subindex entries of neighboured indices use different lines.
+ */
+#define CO_DICT_HASH(dev)  \
+    ((((dev) >> 8) ^ ((dev) >> 16)) & (uint32_t)(CO_DICT_CACHE_N - 1))
+
+/* The tree search in the lookup table ends with a sequence of right turns
+ * behind a final left turn at the found key. Removing the trailing 1-bits
+ * and the next 0-bit of the position returns to the found key.
+ */
+#if defined(__GNUC__) || defined(__clang__)
+#define CO_DICT_TBL_BACK(pos)  ((pos) >> (uint32_t)__builtin_ffs(~(int)(pos)))
+#endif
+
+/* The search in the key array narrows the range down to a block of keys,
+ * which fits into a single cache line, and compares the whole block.
+ */
+#define CO_DICT_KEY_BLK    16u
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static CO_OBJ *CODictSearch(CO_DICT *cod, uint32_t pattern);
+static CO_OBJ *CODictTblSearch(CO_DICT *cod, uint32_t pattern);
+static void    CODictKeyBuild (CO_DICT *cod);
+static CO_OBJ *CODictKeySearch(CO_DICT *cod, uint32_t pattern);
+
+#if CO_DICT_DIR_N > 0
+static void    CODictDirBuild (CO_DICT *cod);
+static CO_OBJ *CODictDirSearch(CO_DICT *cod, uint32_t pattern);
+#endif
+
 /******************************************************************************
 * PUBLIC API FUNCTIONS
 ******************************************************************************/
 
 CO_OBJ *CODictFind(CO_DICT *cod, uint32_t key)
 {
-    CO_OBJ  *result = NULL;
-    CO_OBJ  *obj;
-    uint32_t pattern;
-    int32_t  start = 0;
-    int32_t  end;
-    int32_t  center;
+    CO_OBJ        *result;
+    uint32_t       pattern;
+#if CO_DICT_CACHE_N > 0
+    CO_DICT_CACHE *cache;
+#endif
 
     ASSERT_PTR_ERR(cod, NULL);
     ASSERT_NOT_ERR(key, 0, NULL);
     ASSERT_PTR_ERR(cod->Root, NULL);
 
     pattern = CO_GET_DEV(key);
-    end = cod->Num;
-    while (start <= end) {
-        center = start + ((end - start) / 2);
-        obj    = &(cod->Root[center]);
-        if (CO_GET_DEV(obj->Key) == pattern) {
-            result = obj;
-            break;
-        }
-        if (CO_GET_DEV(obj->Key) > pattern) {
-            end    = center - 1;
-        } else {
-            start  = center + 1;
-        }
+#if CO_DICT_CACHE_N > 0
+    cache = &cod->Cache[CO_DICT_HASH(pattern)];
+    if ((cache->Key == pattern) && (cache->Obj != NULL)) {
+        return (cache->Obj);
+    }
+#endif
+
+    if (cod->Tbl != NULL) {
+        result = CODictTblSearch(cod, pattern);
+    } else if (cod->Key != NULL) {
+        result = CODictKeySearch(cod, pattern);
+#if CO_DICT_DIR_N > 0
+    } else if (cod->DirNum > 0u) {
+        result = CODictDirSearch(cod, pattern);
+#endif
+    } else {
+        result = CODictSearch(cod, pattern);
+    }
+
+#if CO_DICT_CACHE_N > 0
+    if (result != NULL) {
+        cache->Key = pattern;
+        cache->Obj = result;
     }
+#endif
     return(result);
 }
 
+uint16_t CODictReindex(CO_DICT *cod)
+{
+    CO_OBJ   *obj;
+    uint16_t  num = 0;
+#if CO_DICT_CACHE_N > 0
+    uint16_t  n;
+#endif
+
+    ASSERT_PTR_ERR(cod, 0);
+    ASSERT_PTR_ERR(cod->Root, 0);
+
+    cod->Tbl = NULL;
+    obj = cod->Root;
+    while ((num < cod->Max) && (obj->Key != 0)) {
+        num++;
+        obj++;
+    }
+    cod->Num = num;
+
+    CODictKeyBuild(cod);
+#if CO_DICT_DIR_N > 0
+    CODictDirBuild(cod);
+#endif
+#if CO_DICT_CACHE_N > 0
+    for (n = 0; n < (uint16_t)CO_DICT_CACHE_N; n++) {
+        cod->Cache[n].Key = 0;
+        cod->Cache[n].Obj = NULL;
+    }
+#endif
+    return (num);
+}
+
+CO_ERR CODictUseTbl(CO_DICT *cod, const CO_DICT_TBL *tbl)
+{
+    ASSERT_PTR_ERR(cod, CO_ERR_BAD_ARG);
+
+    if ((tbl != NULL) && (tbl->Num != cod->Num)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    cod->Tbl = tbl;
+    return (CO_ERR_NONE);
+}
+
+CO_ERR CODictUseKeys(CO_DICT *cod, uint32_t *key, uint16_t max)
+{
+    ASSERT_PTR_ERR(cod, CO_ERR_BAD_ARG);
+
+    if ((key != NULL) && (max < cod->Num)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    cod->Key    = key;
+    cod->KeyMax = max;
+    CODictKeyBuild(cod);
+    return (CO_ERR_NONE);
+}
+
 CO_ERR CODictRdByte(CO_DICT *cod, uint32_t key, uint8_t *val)
 {
     CO_ERR   result = CO_ERR_OBJ_NOT_FOUND;
@@ -213,23 +322,19 @@ CO_ERR CODictWrBuffer(CO_DICT *cod, uint32_t key, uint8_t *buf, uint32_t len)
 
 int16_t CODictInit(CO_DICT *cod, CO_NODE *node, CO_OBJ *root, uint16_t max)
 {
-    CO_OBJ   *obj;
-    uint16_t  num = 0;
+    uint16_t  num;
 
     ASSERT_PTR_ERR(cod,  -1);
     ASSERT_PTR_ERR(node, -1);
     ASSERT_PTR_ERR(root, -1);
     ASSERT_NOT_ERR(max, (uint16_t)0, -1);
 
-    obj = root;
-    while ((obj->Key != 0) && (num < max)) {
-        num++;
-        obj++;
-    }
-    cod->Root  = root;
-    cod->Num   = num;
-    cod->Max   = max;
-    cod->Node  = node;
+    cod->Root   = root;
+    cod->Max    = max;
+    cod->Node   = node;
+    cod->Key    = NULL;
+    cod->KeyMax = 0;
+    num        = CODictReindex(cod);
     return ((int16_t)num);
 }
 
@@ -254,3 +359,293 @@ CO_ERR CODictObjInit(CO_DICT *cod, CO_NODE *node)
     }
     return (result);
 }
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+
+/*! \brief  BINARY SEARCH OF OBJECT ENTRY
+*
+*    This function searches the object entry with the given key within all
+*    object entries of the object dictionary.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param pattern
+*    object entry key without flags (CO_DEV)
+*
+* \retval  >0    The pointer to the identified object entry
+* \retval  =0    Addressed object was not found
+*/
+static CO_OBJ *CODictSearch(CO_DICT *cod, uint32_t pattern)
+{
+    CO_OBJ  *result = NULL;
+    CO_OBJ  *obj;
+    int32_t  start = 0;
+    int32_t  end;
+    int32_t  center;
+
+    end = cod->Num;
+    while (start <= end) {
+        center = start + ((end - start) / 2);
+        obj    = &(cod->Root[center]);
+        if (CO_GET_DEV(obj->Key) == pattern) {
+            result = obj;
+            break;
+        }
+        if (CO_GET_DEV(obj->Key) > pattern) {
+            end    = center - 1;
+        } else {
+            start  = center + 1;
+        }
+    }
+    return(result);
+}
+
+#if CO_DICT_DIR_N > 0
+
+/*! \brief  BUILD INDEX DIRECTORY
+*
+*    This function collects the position and the number of the subindex
+*    entries of each index. The directory is disabled, when the dictionary
+*    holds more than CO_DICT_DIR_N indices.
+*
+* \param cod
+*    pointer to the object dictionary
+*/
+static void CODictDirBuild(CO_DICT *cod)
+{
+    CO_DICT_DIR *dir = NULL;
+    CO_OBJ      *obj;
+    uint16_t     pos;
+    uint16_t     num = 0;
+    uint16_t     idx;
+    uint8_t      sub;
+
+    for (pos = 0; pos < cod->Num; pos++) {
+        obj = &cod->Root[pos];
+        idx = CO_GET_IDX(obj->Key);
+        sub = CO_GET_SUB(obj->Key);
+        if ((dir != NULL) && (dir->Index == idx)) {
+            if ((uint16_t)sub != ((uint16_t)dir->Sub + dir->Num)) {
+                dir->Dense = 0;
+            }
+            dir->Num++;
+        } else {
+            if (num >= (uint16_t)CO_DICT_DIR_N) {
+                num = 0;
+                break;
+            }
+            dir        = &cod->Dir[num];
+            dir->Index = idx;
+            dir->First = pos;
+            dir->Num   = 1;
+            dir->Sub   = sub;
+            dir->Dense = 1;
+            num++;
+        }
+    }
+    cod->DirNum = num;
+}
+
+/*! \brief  DIRECTORY SEARCH OF OBJECT ENTRY
+*
+*    This function searches the index of the given key within the index
+*    directory. The subindex entry is addressed with a direct offset, when
+*    the subindex entries of the index are without gaps. Otherwise the few
+*    subindex entries of the index are compared.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param pattern
+*    object entry key without flags (CO_DEV)
+*
+* \retval  >0    The pointer to the identified object entry
+* \retval  =0    Addressed object was not found
+*/
+static CO_OBJ *CODictDirSearch(CO_DICT *cod, uint32_t pattern)
+{
+    CO_OBJ      *result = NULL;
+    CO_OBJ      *obj;
+    CO_DICT_DIR *dir;
+    int32_t      start = 0;
+    int32_t      end;
+    int32_t      center;
+    uint16_t     idx;
+    uint16_t     n;
+
+    idx = (uint16_t)(pattern >> 16);
+    end = (int32_t)cod->DirNum - 1;
+    while (start <= end) {
+        center = start + ((end - start) / 2);
+        dir    = &cod->Dir[center];
+        if (dir->Index == idx) {
+            if (dir->Dense != 0u) {
+                /* a subindex below the first wraps around to a large offset */
+                n = (uint8_t)((uint8_t)(pattern >> 8) - dir->Sub);
+                if (n < dir->Num) {
+                    result = &cod->Root[dir->First + n];
+                }
+            } else {
+                for (n = 0; n < dir->Num; n++) {
+                    obj = &cod->Root[dir->First + n];
+                    if (CO_GET_DEV(obj->Key) == pattern) {
+                        result = obj;
+                        break;
+                    }
+                }
+            }
+            break;
+        }
+        if (dir->Index > idx) {
+            end    = center - 1;
+        } else {
+            start  = center + 1;
+        }
+    }
+    return (result);
+}
+
+#endif
+
+/*! \brief  LOOKUP TABLE SEARCH OF OBJECT ENTRY
+*
+*    This function searches the given key in the generated lookup table.
+*    The tree of the table is descended without a comparison for equality,
+*    so the loop has no data dependent branch; the found key is checked
+*    once at the end.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param pattern
+*    object entry key without flags (CO_DEV)
+*
+* \retval  >0    The pointer to the identified object entry
+* \retval  =0    Addressed object was not found
+*/
+static CO_OBJ *CODictTblSearch(CO_DICT *cod, uint32_t pattern)
+{
+    const CO_DICT_TBL *tbl = cod->Tbl;
+    CO_OBJ            *result = NULL;
+    uint32_t           pos = 1;
+
+    while (pos <= tbl->Num) {
+        pos = (2u * pos) + (uint32_t)(tbl->Key[pos] < pattern);
+    }
+#ifdef CO_DICT_TBL_BACK
+    pos = CO_DICT_TBL_BACK(pos);
+#else
+    while ((pos & 1u) != 0u) {
+        pos >>= 1;
+    }
+    pos >>= 1;
+#endif
+    if ((pos != 0u) && (tbl->Key[pos] == pattern)) {
+        result = &cod->Root[tbl->Pos[pos]];
+    }
+    return (result);
+}
+
+/*! \brief  BUILD KEY ARRAY
+*
+*    This function copies the keys (CO_DEV) of all object entries into the
+*    selected key array. The key array is released, when the object
+*    dictionary holds more entries than the key array.
+*
+* \param cod
+*    pointer to the object dictionary
+*/
+static void CODictKeyBuild(CO_DICT *cod)
+{
+    uint16_t pos;
+
+    if (cod->Key == NULL) {
+        return;
+    }
+    if (cod->Num > cod->KeyMax) {
+        cod->Key    = NULL;
+        cod->KeyMax = 0;
+        return;
+    }
+    for (pos = 0; pos < cod->Num; pos++) {
+        cod->Key[pos] = CO_GET_DEV(cod->Root[pos].Key);
+    }
+}
+
+/*! \brief  KEY ARRAY SEARCH OF OBJECT ENTRY
+*
+*    This function searches the given key in the key array. The binary
+*    search keeps the last key, which is not above the searched key, in the
+*    range without a comparison for equality, until the range fits into a
+*    block. The keys of the block are compared with SIMD instructions, four
+*    keys at once, so the object entry array is touched for the found
+*    entry only.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param pattern
+*    object entry key without flags (CO_DEV)
+*
+* \retval  >0    The pointer to the identified object entry
+* \retval  =0    Addressed object was not found
+*/
+static CO_OBJ *CODictKeySearch(CO_DICT *cod, uint32_t pattern)
+{
+    const uint32_t *key  = cod->Key;
+    uint32_t        base = 0;
+    uint32_t        num  = cod->Num;
+    uint32_t        half;
+    uint32_t        n    = 0;
+#if defined(__SSE2__)
+    __m128i         pat;
+    uint32_t        mask;
+#elif defined(__ARM_NEON)
+    uint32x4_t      pat;
+    uint64_t        mask;
+#endif
+
+    while (num > CO_DICT_KEY_BLK) {
+        half = num / 2u;
+        base = (key[base + half] <= pattern) ? (base + half) : base;
+        num -= half;
+    }
+    key = &key[base];
+
+#if defined(__SSE2__)
+    pat = _mm_set1_epi32((int)pattern);
+    for (; (n + 4u) <= num; n += 4u) {
+        mask = (uint32_t)_mm_movemask_ps(_mm_castsi128_ps(
+                   _mm_cmpeq_epi32(_mm_loadu_si128((const __m128i *)&key[n]), pat)));
+        if (mask != 0u) {
+            while ((mask & 1u) == 0u) {
+                mask >>= 1;
+                n++;
+            }
+            return (&cod->Root[base + n]);
+        }
+    }
+#elif defined(__ARM_NEON)
+    pat = vdupq_n_u32(pattern);
+    for (; (n + 4u) <= num; n += 4u) {
+        mask = vget_lane_u64(vreinterpret_u64_u16(
+                   vmovn_u32(vceqq_u32(vld1q_u32(&key[n]), pat))), 0);
+        if (mask != 0u) {
+            while ((mask & 0xFFFFu) == 0u) {
+                mask >>= 16;
+                n++;
+            }
+            return (&cod->Root[base + n]);
+        }
+    }
+#endif
+    for (; n < num; n++) {
+        if (key[n] == pattern) {
+            return (&cod->Root[base + n]);
+        }
+    }
+    return (NULL);
+}
@@ -26,8 +26,17 @@ extern "C" {
 ******************************************************************************/
 
 #include "co_types.h"
+#include "co_cfg.h"
 #include "co_err.h"
 
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#if (CO_DICT_CACHE_N & (CO_DICT_CACHE_N - 1)) != 0
+#error "CO_DICT_CACHE_N: the number of cached entries must be a power of 2"
+#endif
+
 /******************************************************************************
 * PUBLIC TYPES
 ******************************************************************************/
@@ -35,6 +44,51 @@ extern "C" {
 struct CO_NODE_T;              /* Declaration of canopen node structure      */
 struct CO_OBJ_T;               /* Declaration of object entry structure      */
 
+#if CO_DICT_DIR_N > 0
+/*! \brief OBJECT DICTIONARY INDEX DIRECTORY ENTRY
+*
+*    This data structure holds the position of all subindex entries of a
+*    single index within the object entry array. When the subindex entries
+*    are without gaps, the entry of a subindex is found with a direct offset
+*    to the first subindex entry.
+*/
+typedef struct CO_DICT_DIR_T {
+    uint16_t          Index;    /*!< object index                            */
+    uint16_t          First;    /*!< position of first subindex entry        */
+    uint16_t          Num;      /*!< number of subindex entries              */
+    uint8_t           Sub;      /*!< subindex of first subindex entry        */
+    uint8_t           Dense;    /*!< subindex entries are without gaps       */
+
+} CO_DICT_DIR;
+#endif
+
+#if CO_DICT_CACHE_N > 0
+/*! \brief OBJECT DICTIONARY LOOKUP CACHE ENTRY
+*
+*    This data structure holds a recently found object entry.
+*/
+typedef struct CO_DICT_CACHE_T {
+    uint32_t          Key;      /*!< object entry key (CO_DEV, 0: unused)    */
+    struct CO_OBJ_T  *Obj;      /*!< Ptr to found object entry               */
+
+} CO_DICT_CACHE;
+#endif
+
+/*! \brief GENERATED DICTIONARY LOOKUP TABLE
+*
+*    This data structure holds the keys of a static object dictionary in
+*    Eytzinger order (the implicit binary tree of a heap: the children of
+*    the key at position i are at 2i and 2i+1), starting at position 1.
+*    The table is generated during the build with the CMake function
+*    canopen_dict_table(), which rejects unsorted and duplicate keys.
+*/
+typedef struct CO_DICT_TBL_T {
+    const uint32_t   *Key;      /*!< object entry keys (CO_DEV) in tree order*/
+    const uint16_t   *Pos;      /*!< position of the object entries          */
+    uint16_t          Num;      /*!< number of object entries                */
+
+} CO_DICT_TBL;
+
 /*! \brief OBJECT dictionary
 *
 *    This data structure holds all informations, which represents the
@@ -45,6 +99,16 @@ typedef struct CO_DICT_T {
     struct CO_OBJ_T  *Root;     /*!< Ptr to root object of dictionary        */
     uint16_t          Num;      /*!< Current number of objects in dictionary */
     uint16_t          Max;      /*!< Maximal number of objects in dictionary */
+    const CO_DICT_TBL *Tbl;      /*!< generated lookup table (0: search)     */
+    uint32_t         *Key;      /*!< dense key array (0: search in entries)  */
+    uint16_t          KeyMax;   /*!< size of key array                       */
+#if CO_DICT_DIR_N > 0
+    CO_DICT_DIR       Dir[CO_DICT_DIR_N]; /*!< index directory               */
+    uint16_t          DirNum;   /*!< number of indices (0: binary search)    */
+#endif
+#if CO_DICT_CACHE_N > 0
+    CO_DICT_CACHE     Cache[CO_DICT_CACHE_N]; /*!< lookup cache              */
+#endif
 
 } CO_DICT;
 
@@ -67,6 +131,69 @@ typedef struct CO_DICT_T {
 */
 struct CO_OBJ_T *CODictFind(CO_DICT *cod, uint32_t key);
 
+/*! \brief  REBUILD DICTIONARY LOOKUP
+*
+*    This function counts the object entries of the object dictionary
+*    again, rebuilds the index directory and the key array and clears the
+*    lookup cache. The
+*    function must be called after object entries are inserted, removed or
+*    moved within the object entry array of an initialized dictionary.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \return
+*    identified number of object dictionary entries
+*/
+uint16_t CODictReindex(CO_DICT *cod);
+
+/*! \brief  USE GENERATED LOOKUP TABLE
+*
+*    This function selects the generated lookup table for all following
+*    searches in the object dictionary. The table must be generated for the
+*    object entry array of the dictionary. The table is released with
+*    \ref CODictReindex(), so the table must be selected after the node
+*    initialization.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param tbl
+*    pointer to the generated lookup table (0: search without table)
+*
+* \retval   =CO_ERR_NONE     the lookup table is used
+* \retval   =CO_ERR_BAD_ARG  the lookup table doesn't match the dictionary
+*/
+CO_ERR CODictUseTbl(CO_DICT *cod, const CO_DICT_TBL *tbl);
+
+/*! \brief  USE DENSE KEY ARRAY
+*
+*    This function selects a key array for all following searches in the
+*    object dictionary. The key array holds the keys (CO_DEV) of the object
+*    entries in a contiguous array parallel to the object entry array, so
+*    a search touches the keys only and fetches the found object entry
+*    once. The keys are compared in blocks with SIMD instructions (SSE2 or
+*    NEON), when the compiler supports them.
+*
+*    The key array is filled with this function and refreshed with
+*    \ref CODictReindex(). When the object dictionary grows beyond the size
+*    of the key array, the key array is released. The key array must be
+*    selected after the node initialization.
+*
+* \param cod
+*    pointer to the object dictionary
+*
+* \param key
+*    pointer to the key array memory (0: search without key array)
+*
+* \param max
+*    size of the key array (number of keys)
+*
+* \retval   =CO_ERR_NONE     the key array is used
+* \retval   =CO_ERR_BAD_ARG  the key array is too small for the dictionary
+*/
+CO_ERR CODictUseKeys(CO_DICT *cod, uint32_t *key, uint16_t max);
+
 /*! \brief  READ BYTE FROM OBJECT DICTIONARY
 *
 *    This function reads a 8bit value from the given object dictionary. The
@@ -0,0 +1,424 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <string.h>
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_DICT_DYN_ALIGN  8u          /* alignment of object value memory   */
+#define CO_DICT_DYN_MAX    0xFFFEu     /* max. number of entries (uint16 Max)*/
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint16_t CODictDynCap   (CO_DICT_DYN *dyn);
+static uint16_t CODictDynPos   (CO_DICT_DYN *dyn, uint32_t dev);
+static void     CODictDynSet   (CO_OBJ *obj, uint32_t key, const CO_OBJ_TYPE *type, CO_DATA data);
+static void     CODictDynSift  (CO_OBJ *obj, uint32_t pos, uint32_t num);
+static void     CODictDynSort  (CO_OBJ *obj, uint32_t num);
+static CO_ERR   CODictDynUpdate(CO_DICT_DYN *dyn, CO_OBJ *obj);
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+CO_ERR CODictDynInit(CO_DICT_DYN *dyn, void *mem, uint32_t size)
+{
+    uintptr_t start;
+    uintptr_t end;
+
+    ASSERT_PTR_ERR(dyn, CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(mem, CO_ERR_BAD_ARG);
+
+    start = (uintptr_t)mem;
+    end   = start + size;
+    start = (start + (sizeof(CO_DATA) - 1u)) & ~(uintptr_t)(sizeof(CO_DATA) - 1u);
+    if ((start > end) || ((end - start) < sizeof(CO_OBJ))) {
+        return (CO_ERR_BAD_ARG);
+    }
+    dyn->Dict   = NULL;
+    dyn->Root   = (CO_OBJ *)start;
+    dyn->Top    = (uint8_t *)end;
+    dyn->Num    = 0;
+    dyn->Sorted = 0;
+    CODictDynSet(&dyn->Root[0], 0, NULL, 0);
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+void *CODictDynAlloc(CO_DICT_DYN *dyn, uint32_t size)
+{
+    uintptr_t top;
+    uintptr_t low;
+
+    ASSERT_PTR_ERR(dyn, NULL);
+
+    top = (uintptr_t)dyn->Top;
+    low = (uintptr_t)&dyn->Root[dyn->Num + 1u];
+    if ((size == 0u) || (size > (top - low))) {
+        return (NULL);
+    }
+    top = (top - size) & ~(uintptr_t)(CO_DICT_DYN_ALIGN - 1u);
+    if (top < low) {
+        return (NULL);
+    }
+    dyn->Top = (uint8_t *)top;
+    (void)memset(dyn->Top, 0, size);
+    if (dyn->Dict != NULL) {
+        dyn->Dict->Max = (uint16_t)(CODictDynCap(dyn) + 1u);
+    }
+    return ((void *)dyn->Top);
+}
+
+/*
+* see function definition
+*/
+CO_ERR CODictDynAdd(CO_DICT_DYN *dyn,
+                    uint32_t key,
+                    const CO_OBJ_TYPE *type,
+                    CO_DATA data)
+{
+    ASSERT_PTR_ERR(dyn,  CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(type, CO_ERR_BAD_ARG);
+
+    if (dyn->Sorted != 0u) {
+        return (CO_ERR_DICT_INIT);
+    }
+    if ((CO_GET_DEV(key) == 0u) || (dyn->Num >= CODictDynCap(dyn))) {
+        return (CO_ERR_BAD_ARG);
+    }
+    CODictDynSet(&dyn->Root[dyn->Num], key, type, data);
+    dyn->Num++;
+    CODictDynSet(&dyn->Root[dyn->Num], 0, NULL, 0);
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+CO_ERR CODictDynBuild(CO_DICT_DYN *dyn)
+{
+    CO_OBJ   *obj;
+    uint16_t  n;
+    uint8_t   sorted = 1;
+
+    ASSERT_PTR_ERR(dyn, CO_ERR_BAD_ARG);
+
+    /* entries of a device description are often in order already */
+    obj = dyn->Root;
+    for (n = 1; n < dyn->Num; n++) {
+        if (CO_GET_DEV(obj[n].Key) < CO_GET_DEV(obj[n - 1u].Key)) {
+            sorted = 0;
+            break;
+        }
+    }
+    if (sorted == 0u) {
+        CODictDynSort(obj, dyn->Num);
+    }
+    for (n = 1; n < dyn->Num; n++) {
+        if (CO_GET_DEV(obj[n].Key) == CO_GET_DEV(obj[n - 1u].Key)) {
+            return (CO_ERR_DICT_INIT);
+        }
+    }
+    dyn->Sorted = 1;
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+void CODictDynSetSpec(CO_DICT_DYN *dyn, CO_NODE_SPEC *spec)
+{
+    ASSERT_PTR(dyn);
+    ASSERT_PTR(spec);
+
+    spec->Dict    = dyn->Root;
+    spec->DictLen = (uint16_t)(CODictDynCap(dyn) + 1u);
+}
+
+/*
+* see function definition
+*/
+CO_ERR CODictDynLink(CO_DICT_DYN *dyn, CO_DICT *cod)
+{
+    ASSERT_PTR_ERR(dyn, CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(cod, CO_ERR_BAD_ARG);
+
+    if ((cod->Root != dyn->Root) || (dyn->Sorted == 0u)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    dyn->Dict = cod;
+    return (CODictDynUpdate(dyn, NULL));
+}
+
+/*
+* see function definition
+*/
+CO_ERR CODictDynInsert(CO_DICT_DYN *dyn,
+                       uint32_t key,
+                       const CO_OBJ_TYPE *type,
+                       CO_DATA data)
+{
+    CO_OBJ   *obj;
+    uint32_t  dev;
+    uint16_t  pos;
+
+    ASSERT_PTR_ERR(dyn,  CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(type, CO_ERR_BAD_ARG);
+
+    if (dyn->Sorted == 0u) {
+        return (CO_ERR_DICT_INIT);
+    }
+    dev = CO_GET_DEV(key);
+    if (dev == 0u) {
+        return (CO_ERR_BAD_ARG);
+    }
+    pos = CODictDynPos(dyn, dev);
+    obj = &dyn->Root[pos];
+    if ((pos >= dyn->Num) || (CO_GET_DEV(obj->Key) != dev)) {
+        if (dyn->Num >= CODictDynCap(dyn)) {
+            return (CO_ERR_BAD_ARG);
+        }
+        /* move the following entries and the end marker in a single block */
+        (void)memmove(&obj[1], &obj[0], (size_t)(dyn->Num - pos + 1u) * sizeof(CO_OBJ));
+        dyn->Num++;
+    }
+    CODictDynSet(obj, key, type, data);
+    return (CODictDynUpdate(dyn, obj));
+}
+
+/*
+* see function definition
+*/
+CO_ERR CODictDynRemove(CO_DICT_DYN *dyn, uint32_t key)
+{
+    CO_OBJ   *obj;
+    uint32_t  dev;
+    uint16_t  pos;
+
+    ASSERT_PTR_ERR(dyn, CO_ERR_BAD_ARG);
+
+    if (dyn->Sorted == 0u) {
+        return (CO_ERR_DICT_INIT);
+    }
+    dev = CO_GET_DEV(key);
+    pos = CODictDynPos(dyn, dev);
+    obj = &dyn->Root[pos];
+    if ((dev == 0u) || (pos >= dyn->Num) || (CO_GET_DEV(obj->Key) != dev)) {
+        return (CO_ERR_OBJ_NOT_FOUND);
+    }
+    (void)memmove(&obj[0], &obj[1], (size_t)(dyn->Num - pos) * sizeof(CO_OBJ));
+    dyn->Num--;
+    return (CODictDynUpdate(dyn, NULL));
+}
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+
+/*! \brief  OBJECT ENTRY CAPACITY
+*
+*    This function returns the number of object entries, which fit into
+*    the free memory of the arena in front of the allocated object values.
+*    One object entry is reserved for the end marker.
+*
+* \param dyn
+*    pointer to the dynamic object dictionary
+*
+* \return
+*    max. number of object entries
+*/
+static uint16_t CODictDynCap(CO_DICT_DYN *dyn)
+{
+    uint32_t cap;
+
+    cap = (uint32_t)((uintptr_t)dyn->Top - (uintptr_t)dyn->Root) / (uint32_t)sizeof(CO_OBJ);
+    cap--;
+    if (cap > CO_DICT_DYN_MAX) {
+        cap = CO_DICT_DYN_MAX;
+    }
+    return ((uint16_t)cap);
+}
+
+/*! \brief  SEARCH OBJECT ENTRY POSITION
+*
+*    This function searches the position of the first object entry, which
+*    is not lower than the given key (binary search).
+*
+* \param dyn
+*    pointer to the dynamic object dictionary
+*
+* \param dev
+*    object entry key without flags (CO_DEV)
+*
+* \return
+*    position of the object entry (Num: behind all object entries)
+*/
+static uint16_t CODictDynPos(CO_DICT_DYN *dyn, uint32_t dev)
+{
+    uint32_t start = 0;
+    uint32_t end   = dyn->Num;
+    uint32_t center;
+
+    while (start < end) {
+        center = start + ((end - start) / 2u);
+        if (CO_GET_DEV(dyn->Root[center].Key) < dev) {
+            start = center + 1u;
+        } else {
+            end   = center;
+        }
+    }
+    return ((uint16_t)start);
+}
+
+/*! \brief  SET OBJECT ENTRY
+*
+*    This function sets all members of the given object entry.
+*/
+static void CODictDynSet(CO_OBJ *obj, uint32_t key, const CO_OBJ_TYPE *type, CO_DATA data)
+{
+    obj->Key  = key;
+    obj->Type = type;
+    obj->Data = data;
+}
+
+/*! \brief  SIFT DOWN HEAP ENTRY
+*
+*    This function moves the object entry at the given position down in the
+*    heap of object entries, until both children have lower keys.
+*/
+static void CODictDynSift(CO_OBJ *obj, uint32_t pos, uint32_t num)
+{
+    CO_OBJ   tmp = obj[pos];
+    uint32_t child;
+
+    child = (2u * pos) + 1u;
+    while (child < num) {
+        if (((child + 1u) < num) &&
+            (CO_GET_DEV(obj[child + 1u].Key) > CO_GET_DEV(obj[child].Key))) {
+            child++;
+        }
+        if (CO_GET_DEV(obj[child].Key) <= CO_GET_DEV(tmp.Key)) {
+            break;
+        }
+        obj[pos] = obj[child];
+        pos      = child;
+        child    = (2u * pos) + 1u;
+    }
+    obj[pos] = tmp;
+}
+
+/*! \brief  SORT OBJECT ENTRIES
+*
+*    This function sorts the object entries with a heap sort: O(n log n)
+*    without recursion and without additional memory.
+*/
+static void CODictDynSort(CO_OBJ *obj, uint32_t num)
+{
+    CO_OBJ   tmp;
+    uint32_t n = num / 2u;
+
+    while (n > 0u) {
+        n--;
+        CODictDynSift(obj, n, num);
+    }
+    while (num > 1u) {
+        num--;
+        tmp      = obj[0];
+        obj[0]   = obj[num];
+        obj[num] = tmp;
+        CODictDynSift(obj, 0, num);
+    }
+}
+
+/*! \brief  UPDATE LINKED OBJECT DICTIONARY
+*
+*    This function rebuilds the lookup of the linked object dictionary and
+*    initializes the given (changed) object entry. The node keeps pointers
+*    to the object entries, which are moved by an insert or remove: the
+*    active SDO server transfers are aborted and the PDO mappings with the
+*    TPDO trigger links are resolved again. A PDO mapping, which refers to
+*    a removed object entry, is cleared.
+*
+* \param dyn
+*    pointer to the dynamic object dictionary
+*
+* \param obj
+*    pointer to the changed object entry (or 0)
+*
+* \retval   =CO_ERR_NONE          the object dictionary is updated
+* \retval   =CO_ERR_OBJ_INIT      the type initialization failed
+* \retval   =CO_ERR_TPDO_MAP_OBJ  a TPDO mapping is cleared
+* \retval   =CO_ERR_RPDO_MAP_OBJ  a RPDO mapping is cleared
+*/
+static CO_ERR CODictDynUpdate(CO_DICT_DYN *dyn, CO_OBJ *obj)
+{
+    CO_DICT  *cod = dyn->Dict;
+    CO_NODE  *node;
+    CO_ERR    err = CO_ERR_NONE;
+    uint16_t  num;
+
+    if (cod == NULL) {
+        return (CO_ERR_NONE);
+    }
+    node     = cod->Node;
+    cod->Max = (uint16_t)(CODictDynCap(dyn) + 1u);
+    (void)CODictReindex(cod);
+    for (num = 0; num < CO_SSDO_N; num++) {
+        COSdoStop(&node->Sdo[num], CO_SDO_ERR_TOS_STATE);
+    }
+    CO_SDO_CACHE_INVALIDATE(node);
+    if ((obj != NULL) && (COObjInit(obj, node) != CO_ERR_NONE)) {
+        err = CO_ERR_OBJ_INIT;
+    }
+
+    for (num = 0; num < CO_TPDO_N; num++) {
+        if ((node->TPdo[num].ObjNum > 0u) &&
+            (COTPdoGetMap(node->TPdo, num) != CO_ERR_NONE)) {
+            COTPdoMapDelNum(&node->TMap, num);
+            node->TPdo[num].ObjNum = 0;
+            if (err == CO_ERR_NONE) {
+                err = CO_ERR_TPDO_MAP_OBJ;
+            }
+        }
+    }
+    for (num = 0; num < CO_RPDO_N; num++) {
+        if ((node->RPdo[num].ObjNum > 0u) &&
+            (CORPdoGetMap(node->RPdo, num) != CO_ERR_NONE)) {
+            node->RPdo[num].ObjNum = 0;
+            node->RPdo[num].Fast   = 0;
+            if (err == CO_ERR_NONE) {
+                err = CO_ERR_RPDO_MAP_OBJ;
+            }
+        }
+    }
+    return (err);
+}
@@ -0,0 +1,247 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+#ifndef CO_DICT_DYN_H_
+#define CO_DICT_DYN_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_err.h"
+#include "co_obj.h"
+#include "co_dict.h"
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+struct CO_NODE_SPEC_T;         /* Declaration of node specification          */
+
+/*! \brief DYNAMIC OBJECT DICTIONARY
+*
+*    This data structure holds the management of an object dictionary,
+*    which is built at runtime within a memory arena of the application.
+*    The object entries are placed at the start of the arena, the memory
+*    for the object values is allocated from the end of the arena.
+*
+*    The dictionary is built in two steps: the object entries are collected
+*    in any order with \ref CODictDynAdd() and sorted once with
+*    \ref CODictDynBuild(). Afterwards, single object entries are inserted
+*    or removed with \ref CODictDynInsert() and \ref CODictDynRemove().
+*/
+typedef struct CO_DICT_DYN_T {
+    CO_DICT          *Dict;     /*!< linked object dictionary (0: not linked)*/
+    struct CO_OBJ_T  *Root;     /*!< first object entry in arena             */
+    uint8_t          *Top;      /*!< start of allocated value memory         */
+    uint16_t          Num;      /*!< number of object entries                */
+    uint8_t           Sorted;   /*!< object entries are sorted (built)       */
+
+} CO_DICT_DYN;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  INIT DYNAMIC OBJECT DICTIONARY
+*
+*    This function prepares an empty dynamic object dictionary within the
+*    given memory arena. The object entries and the allocated object values
+*    share the arena.
+*
+* \param dyn
+*    pointer to the dynamic object dictionary
+*
+* \param mem
+*    start of the memory arena
+*
+* \param size
+*    size of the memory arena in bytes
+*
+* \retval   =CO_ERR_NONE     the dynamic object dictionary is empty
+* \retval   =CO_ERR_BAD_ARG  the arena can't hold an object entry
+*/
+CO_ERR CODictDynInit(CO_DICT_DYN *dyn, void *mem, uint32_t size);
+
+/*! \brief  ALLOCATE OBJECT VALUE MEMORY
+*
+*    This function allocates memory for an object value from the end of
+*    the arena. The memory is aligned for all basic types and stays in use
+*    until the dynamic object dictionary is initialized again.
+*
+* \param dyn
+*    pointer to the dynamic object dictionary
+*
+* \param size
+*    size of the object value in bytes
+*
+* \retval  >0    start of the allocated (cleared) memory
+* \retval  =0    not enough free memory in the arena
+*/
+void *CODictDynAlloc(CO_DICT_DYN *dyn, uint32_t size);
+
+/*! \brief  COLLECT OBJECT ENTRY
+*
+*    This function appends an object entry to the collected object entries
+*    of the bulk build. The order of the object entries is not relevant.
+*
+* \param dyn
+*    pointer to the dynamic object dictionary
+*
+* \param key
+*    object entry key; should be generated with the macro CO_KEY()
+*
+* \param type
+*    object entry type
+*
+* \param data
+*    object entry data
+*
+* \retval   =CO_ERR_NONE       the object entry is collected
+* \retval   =CO_ERR_BAD_ARG    invalid key or no free memory in the arena
+* \retval   =CO_ERR_DICT_INIT  the bulk build is already finished
+*/
+CO_ERR CODictDynAdd(CO_DICT_DYN *dyn,
+                    uint32_t key,
+                    const CO_OBJ_TYPE *type,
+                    CO_DATA data);
+
+/*! \brief  FINISH BULK BUILD
+*
+*    This function sorts the collected object entries once. Afterwards the
+*    object entries can be used as object dictionary of a node (see
+*    \ref CODictDynSetSpec()).
+*
+* \param dyn
+*    pointer to the dynamic object dictionary
+*
+* \retval   =CO_ERR_NONE       the object entries are sorted
+* \retval   =CO_ERR_DICT_INIT  a key is collected twice
+*/
+CO_ERR CODictDynBuild(CO_DICT_DYN *dyn);
+
+/*! \brief  SET NODE SPECIFICATION
+*
+*    This function sets the object dictionary of the given node
+*    specification to the object entries of the dynamic object dictionary.
+*
+* \param dyn
+*    pointer to the dynamic object dictionary
+*
+* \param spec
+*    pointer to the node specification
+*/
+void CODictDynSetSpec(CO_DICT_DYN *dyn, struct CO_NODE_SPEC_T *spec);
+
+/*! \brief  LINK OBJECT DICTIONARY
+*
+*    This function links the object dictionary of an initialized node with
+*    the dynamic object dictionary. The object dictionary of the node is
+*    updated with each following insert or remove of an object entry.
+*
+* \param dyn
+*    pointer to the dynamic object dictionary
+*
+* \param cod
+*    pointer to the object dictionary of the node
+*
+* \retval   =CO_ERR_NONE     the object dictionary is linked
+* \retval   =CO_ERR_BAD_ARG  the object dictionary uses other object entries
+*/
+CO_ERR CODictDynLink(CO_DICT_DYN *dyn, CO_DICT *cod);
+
+/*! \brief  INSERT OBJECT ENTRY
+*
+*    This function inserts an object entry into the sorted object entries,
+*    or changes the existing object entry with the same index and subindex.
+*    The position is searched with a binary search and the following object
+*    entries are moved with a single block move. When the object dictionary
+*    of a node is linked, the object entry is initialized and the lookup of
+*    the object dictionary is rebuilt (see \ref CODictReindex()).
+*
+* \note
+*    The positions of the following object entries change, so pointers of
+*    the application to these object entries (e.g. found with
+*    \ref CODictFind()) are invalid. The linked node is updated: the PDO
+*    mappings and the TPDO trigger links are resolved again and an active
+*    SDO server transfer is aborted (abort code 0x08000022).
+*
+* \param dyn
+*    pointer to the dynamic object dictionary
+*
+* \param key
+*    object entry key; should be generated with the macro CO_KEY()
+*
+* \param type
+*    object entry type
+*
+* \param data
+*    object entry data
+*
+* \retval   =CO_ERR_NONE       the object entry is inserted or changed
+* \retval   =CO_ERR_BAD_ARG    invalid key or no free memory in the arena
+* \retval   =CO_ERR_DICT_INIT  the bulk build is not finished
+* \retval   =CO_ERR_OBJ_INIT   the object entry is inserted, but the type
+*                              initialization failed
+* \retval   =CO_ERR_TPDO_MAP_OBJ  the object entry is inserted, but a TPDO
+*                                mapping is invalid now and cleared
+* \retval   =CO_ERR_RPDO_MAP_OBJ  the object entry is inserted, but a RPDO
+*                                mapping is invalid now and cleared
+*/
+CO_ERR CODictDynInsert(CO_DICT_DYN *dyn,
+                       uint32_t key,
+                       const CO_OBJ_TYPE *type,
+                       CO_DATA data);
+
+/*! \brief  REMOVE OBJECT ENTRY
+*
+*    This function removes the object entry with the given index and
+*    subindex from the sorted object entries. When the object dictionary
+*    of a node is linked, the lookup of the object dictionary is rebuilt.
+*
+* \note
+*    The linked node is updated like with \ref CODictDynInsert(). A PDO
+*    mapping, which refers to the removed object entry, is cleared: the
+*    PDO is sent without data or ignores the received data until the PDO
+*    mapping is written again.
+*
+* \param dyn
+*    pointer to the dynamic object dictionary
+*
+* \param key
+*    object entry key; should be generated with the macro CO_DEV()
+*
+* \retval   =CO_ERR_NONE           the object entry is removed
+* \retval   =CO_ERR_OBJ_NOT_FOUND  the object entry doesn't exist
+* \retval   =CO_ERR_DICT_INIT      the bulk build is not finished
+* \retval   =CO_ERR_TPDO_MAP_OBJ   the object entry is removed, but was mapped
+*                                  into a TPDO
+* \retval   =CO_ERR_RPDO_MAP_OBJ   the object entry is removed, but was mapped
+*                                  into a RPDO
+*/
+CO_ERR CODictDynRemove(CO_DICT_DYN *dyn, uint32_t key);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif  /* #ifndef CO_DICT_DYN_H_ */
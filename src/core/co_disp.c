@@ -0,0 +1,499 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_DISP_STD_MAX   ((uint32_t)0x7FF)
+#define CO_DISP_HB_COBID  ((uint32_t)0x700)
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void    CODispSdoSend(CO_DISP *disp, CO_IF_FRM *frm, CO_ERR err);
+static uint8_t CODispScan   (CO_DISP *disp, CO_IF_FRM *frm, uint8_t allowed);
+static void    CODispPutId  (uint32_t *id, uint16_t max, uint16_t *num, uint32_t cobid);
+
+#if USE_DISP
+static void          CODispAdd  (CO_DISP *disp, uint32_t id, uint8_t type, void *obj);
+static CO_DISP_SLOT *CODispFind (CO_DISP *disp, uint32_t id);
+static uint8_t       CODispRoute(CO_DISP *disp, CO_IF_FRM *frm, uint8_t allowed);
+#endif
+
+/******************************************************************************
+* PROTECTED API FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void CODispInit(CO_DISP *disp, CO_NODE *node)
+{
+    ASSERT_PTR_FATAL(disp);
+    ASSERT_PTR_FATAL(node);
+
+    disp->Node     = node;
+#if USE_DISP
+    disp->Num      = 0;
+    disp->Overflow = 0;
+    disp->Dirty    = 1;
+#endif
+}
+
+/*
+* see function definition
+*/
+void CODispBuild(CO_DISP *disp)
+{
+#if USE_DISP
+    CO_NODE   *node;
+    CO_HBCONS *hbc;
+    uint32_t   n;
+
+    ASSERT_PTR(disp);
+
+    node = disp->Node;
+    for (n = 0; n < CO_DISP_STD_N; n++) {
+        disp->Std[n] = 0;
+    }
+    for (n = 0; n < CO_DISP_EXT_N; n++) {
+        disp->Ext[n].Id   = 0;
+        disp->Ext[n].Slot = 0;
+    }
+    disp->Num      = 0;
+    disp->Overflow = 0;
+    disp->Dirty    = 0;
+
+    for (n = 0; n < CO_SSDO_N; n++) {
+        if (node->Sdo[n].RxId != CO_SDO_ID_OFF) {
+            CODispAdd(disp, node->Sdo[n].RxId, CO_DISP_SSDO, &node->Sdo[n]);
+        }
+    }
+#if USE_CSDO
+    for (n = 0; n < CO_CSDO_N; n++) {
+        if (node->CSdo[n].State != CO_CSDO_STATE_INVALID) {
+            CODispAdd(disp, node->CSdo[n].RxId, CO_DISP_CSDO, &node->CSdo[n]);
+        }
+    }
+#endif
+    CODispAdd(disp, 0, CO_DISP_NMT, &node->Nmt);
+    hbc = node->Nmt.HbCons;
+    while (hbc != NULL) {
+        CODispAdd(disp, CO_DISP_HB_COBID + hbc->NodeId, CO_DISP_HBC, hbc);
+        hbc = hbc->Next;
+    }
+    for (n = 0; n < CO_RPDO_N; n++) {
+        if ((node->RPdo[n].Flag & CO_RPDO_FLG__E) != 0) {
+            CODispAdd(disp, node->RPdo[n].Identifier, CO_DISP_RPDO, &node->RPdo[n]);
+        }
+    }
+    CODispAdd(disp, node->Sync.CobId & CO_SYNC_COBID_MASK, CO_DISP_SYNC, &node->Sync);
+#else
+    CO_UNUSED(disp);
+#endif
+}
+
+/*
+* see function definition
+*/
+uint8_t CODispProcess(CO_DISP *disp, CO_IF_FRM *frm, uint8_t allowed)
+{
+#if USE_DISP
+    if (disp->Dirty != 0) {
+        CODispBuild(disp);
+    }
+    if (disp->Overflow == 0) {
+        return (CODispRoute(disp, frm, allowed));
+    }
+#endif
+    return (CODispScan(disp, frm, allowed));
+}
+
+/*
+* see function definition
+*/
+uint16_t CODispGetIds(CO_DISP *disp, uint32_t *id, uint16_t max)
+{
+    CO_NODE   *node;
+    CO_HBCONS *hbc;
+    uint16_t   num = 0;
+    uint32_t   n;
+
+    ASSERT_PTR_ERR(disp, 0);
+    ASSERT_PTR_ERR(id, 0);
+
+    node = disp->Node;
+    for (n = 0; n < CO_SSDO_N; n++) {
+        if (node->Sdo[n].RxId != CO_SDO_ID_OFF) {
+            CODispPutId(id, max, &num, node->Sdo[n].RxId);
+        }
+    }
+#if USE_CSDO
+    for (n = 0; n < CO_CSDO_N; n++) {
+        if (node->CSdo[n].State != CO_CSDO_STATE_INVALID) {
+            CODispPutId(id, max, &num, node->CSdo[n].RxId);
+        }
+    }
+#endif
+    CODispPutId(id, max, &num, 0);
+    hbc = node->Nmt.HbCons;
+    while (hbc != NULL) {
+        CODispPutId(id, max, &num, CO_DISP_HB_COBID + hbc->NodeId);
+        hbc = hbc->Next;
+    }
+    for (n = 0; n < CO_RPDO_N; n++) {
+        if ((node->RPdo[n].Flag & CO_RPDO_FLG__E) != 0) {
+            CODispPutId(id, max, &num, node->RPdo[n].Identifier);
+        }
+    }
+    CODispPutId(id, max, &num, node->Sync.CobId & CO_SYNC_COBID_MASK);
+#if USE_LSS
+    CODispPutId(id, max, &num, CO_LSS_RX_ID);
+#endif
+
+    return (num);
+}
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+
+/*! \brief  PUT CAN-ID INTO ARRAY
+*
+*    This function appends the CAN-ID to the array, if the CAN-ID is not
+*    already in the array and the array is not full. The number of CAN-IDs
+*    is counted in any case.
+*
+* \param id
+*    pointer to the CAN-ID array
+*
+* \param max
+*    maximal number of CAN-IDs in the array
+*
+* \param num
+*    pointer to the number of collected CAN-IDs
+*
+* \param cobid
+*    CAN-ID to add
+*/
+static void CODispPutId(uint32_t *id, uint16_t max, uint16_t *num, uint32_t cobid)
+{
+    uint16_t n;
+
+    for (n = 0; (n < *num) && (n < max); n++) {
+        if (id[n] == cobid) {
+            return;
+        }
+    }
+    if (*num < max) {
+        id[*num] = cobid;
+    }
+    (*num)++;
+}
+
+/*! \brief  SEND SDO RESPONSE
+*
+*    This function transmits the prepared SDO frame, when the SDO server or
+*    client requests a response.
+*
+* \param disp
+*    pointer to the CAN-ID dispatcher
+*
+* \param frm
+*    prepared SDO response frame
+*
+* \param err
+*    result of the SDO protocol handling
+*/
+static void CODispSdoSend(CO_DISP *disp, CO_IF_FRM *frm, CO_ERR err)
+{
+    if ((err == CO_ERR_NONE     ) ||
+        (err == CO_ERR_SDO_ABORT)) {
+        (void)COIfCanSend(&disp->Node->If, frm);
+    }
+}
+
+/*! \brief  SEQUENTIAL CHECK OF CAN FRAME
+*
+*    This function checks the received CAN frame against all services one
+*    after another. This is used when the dispatch table is disabled or not
+*    large enough for the configured services.
+*
+* \param disp
+*    pointer to the CAN-ID dispatcher
+*
+* \param frm
+*    received CAN frame
+*
+* \param allowed
+*    allowed objects in current NMT mode
+*
+* \retval  =0    CAN frame is consumed by a service
+* \retval  >0    CAN frame is not handled (given allowed objects)
+*/
+static uint8_t CODispScan(CO_DISP *disp, CO_IF_FRM *frm, uint8_t allowed)
+{
+    CO_NODE  *node = disp->Node;
+    CO_SDO   *srv;
+#if USE_CSDO
+    CO_CSDO  *csdo;
+#endif
+    CO_RPDO  *rpdo;
+    int16_t   result;
+
+    if ((allowed & CO_SDO_ALLOWED) != (uint8_t)0) {
+        srv = COSdoCheck(node->Sdo, frm);
+        if (srv != NULL) {
+            CODispSdoSend(disp, frm, COSdoResponse(srv));
+            allowed = 0;
+#if USE_CSDO
+        } else {
+            csdo = COCSdoCheck(node->CSdo, frm);
+            if (csdo != NULL) {
+                CODispSdoSend(disp, frm, COCSdoResponse(csdo));
+                allowed = 0;
+            }
+#endif
+        }
+    }
+
+    if ((allowed & CO_NMT_ALLOWED) != (uint8_t)0) {
+        if (CONmtCheck(&node->Nmt, frm) >= 0) {
+            allowed = 0;
+        }
+        if (CONmtHbConsCheck(&node->Nmt, frm) >= 0) {
+            allowed = 0;
+        }
+    }
+
+    if ((allowed & CO_PDO_ALLOWED) != (uint8_t)0) {
+        rpdo = CORPdoCheck(node->RPdo, frm);
+        if (rpdo != NULL) {
+            CORPdoRx(rpdo, frm);
+            allowed = 0;
+        }
+    }
+
+    if ((allowed & CO_SYNC_ALLOWED) != (uint8_t)0) {
+        result = COSyncUpdate(&node->Sync, frm);
+        if (result >= 0) {
+            COSyncHandler(&node->Sync);
+            allowed = 0;
+        }
+    }
+
+    return (allowed);
+}
+
+#if USE_DISP
+
+/*! \brief  ADD SERVICE TO DISPATCH TABLE
+*
+*    This function registers a service for the given CAN identifier. An
+*    already registered CAN identifier is kept unchanged. When no slot is
+*    available, the dispatch table is marked as not usable.
+*
+* \param disp
+*    pointer to the CAN-ID dispatcher
+*
+* \param id
+*    CAN identifier (11-bit or 29-bit)
+*
+* \param type
+*    service type (see CO_DISP_TYPE)
+*
+* \param obj
+*    service object
+*/
+static void CODispAdd(CO_DISP *disp, uint32_t id, uint8_t type, void *obj)
+{
+    CO_DISP_EXT *ext = NULL;
+    uint32_t     hash;
+    uint32_t     n;
+
+    if (id <= CO_DISP_STD_MAX) {
+        if (disp->Std[id] != 0) {
+            return;
+        }
+    } else {
+        hash = (id ^ (id >> 11) ^ (id >> 22)) & (CO_DISP_EXT_N - 1);
+        for (n = 0; n < CO_DISP_EXT_N; n++) {
+            ext = &disp->Ext[(hash + n) & (CO_DISP_EXT_N - 1)];
+            if (ext->Slot == 0) {
+                break;
+            }
+            if (ext->Id == id) {
+                return;
+            }
+        }
+        if (ext->Slot != 0) {
+            disp->Overflow = 1;
+            return;
+        }
+    }
+
+    if (disp->Num >= CO_DISP_SLOT_N) {
+        disp->Overflow = 1;
+        return;
+    }
+    disp->Slot[disp->Num].Obj  = obj;
+    disp->Slot[disp->Num].Type = type;
+    disp->Num++;
+
+    if (ext == NULL) {
+        disp->Std[id] = disp->Num;
+    } else {
+        ext->Id   = id;
+        ext->Slot = disp->Num;
+    }
+}
+
+/*! \brief  FIND SERVICE IN DISPATCH TABLE
+*
+*    This function looks up the registered service for the given CAN
+*    identifier.
+*
+* \param disp
+*    pointer to the CAN-ID dispatcher
+*
+* \param id
+*    CAN identifier (11-bit or 29-bit)
+*
+* \retval  >0    pointer to the registered slot
+* \retval  =0    no service registered for this CAN identifier
+*/
+static CO_DISP_SLOT *CODispFind(CO_DISP *disp, uint32_t id)
+{
+    CO_DISP_EXT *ext;
+    uint32_t     hash;
+    uint32_t     n;
+    CO_DISP_IDX  slot = 0;
+
+    if (id <= CO_DISP_STD_MAX) {
+        slot = disp->Std[id];
+    } else {
+        hash = (id ^ (id >> 11) ^ (id >> 22)) & (CO_DISP_EXT_N - 1);
+        for (n = 0; n < CO_DISP_EXT_N; n++) {
+            ext = &disp->Ext[(hash + n) & (CO_DISP_EXT_N - 1)];
+            if (ext->Slot == 0) {
+                break;
+            }
+            if (ext->Id == id) {
+                slot = ext->Slot;
+                break;
+            }
+        }
+    }
+    if (slot == 0) {
+        return (NULL);
+    }
+    return (&disp->Slot[slot - 1]);
+}
+
+/*! \brief  ROUTE CAN FRAME
+*
+*    This function routes the received CAN frame with a single lookup in
+*    the dispatch table to the registered service.
+*
+* \param disp
+*    pointer to the CAN-ID dispatcher
+*
+* \param frm
+*    received CAN frame
+*
+* \param allowed
+*    allowed objects in current NMT mode
+*
+* \retval  =0    CAN frame is consumed by a service
+* \retval  >0    CAN frame is not handled (given allowed objects)
+*/
+static uint8_t CODispRoute(CO_DISP *disp, CO_IF_FRM *frm, uint8_t allowed)
+{
+    CO_DISP_SLOT *slot;
+    CO_SDO       *srv;
+#if USE_CSDO
+    CO_CSDO      *csdo;
+#endif
+    CO_SYNC      *sync;
+
+    slot = CODispFind(disp, CO_GET_ID(frm));
+    if (slot == NULL) {
+        return (allowed);
+    }
+
+    switch (slot->Type) {
+        case CO_DISP_SSDO:
+            if ((allowed & CO_SDO_ALLOWED) != (uint8_t)0) {
+                srv = COSdoAccept((CO_SDO *)slot->Obj, frm);
+                CODispSdoSend(disp, frm, COSdoResponse(srv));
+                allowed = 0;
+            }
+            break;
+#if USE_CSDO
+        case CO_DISP_CSDO:
+            if ((allowed & CO_SDO_ALLOWED) != (uint8_t)0) {
+                csdo = COCSdoAccept((CO_CSDO *)slot->Obj, frm);
+                if (csdo != NULL) {
+                    CODispSdoSend(disp, frm, COCSdoResponse(csdo));
+                    allowed = 0;
+                }
+            }
+            break;
+#endif
+        case CO_DISP_NMT:
+            if ((allowed & CO_NMT_ALLOWED) != (uint8_t)0) {
+                if (CONmtCheck((CO_NMT *)slot->Obj, frm) >= 0) {
+                    allowed = 0;
+                }
+            }
+            break;
+        case CO_DISP_HBC:
+            if ((allowed & CO_NMT_ALLOWED) != (uint8_t)0) {
+                (void)CONmtHbConsUpdate((CO_HBCONS *)slot->Obj, frm);
+                allowed = 0;
+            }
+            break;
+        case CO_DISP_RPDO:
+            if ((allowed & CO_PDO_ALLOWED) != (uint8_t)0) {
+                CORPdoRx((CO_RPDO *)slot->Obj, frm);
+                allowed = 0;
+            }
+            break;
+        case CO_DISP_SYNC:
+            if ((allowed & CO_SYNC_ALLOWED) != (uint8_t)0) {
+                sync = (CO_SYNC *)slot->Obj;
+                if (COSyncUpdate(sync, frm) >= 0) {
+                    COSyncHandler(sync);
+                    allowed = 0;
+                }
+            }
+            break;
+        default:
+            break;
+    }
+
+    return (allowed);
+}
+
+#endif
@@ -0,0 +1,216 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_DISP_H_
+#define CO_DISP_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_cfg.h"
+#include "co_if.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_DISP_STD_N     2048u  /*!< number of 11-bit CAN identifiers       */
+
+#if USE_DISP
+#if CO_DISP_SLOT_N > 65535
+#error "CO_DISP_SLOT_N: the dispatch table supports up to 65535 slots"
+#endif
+#if (CO_DISP_EXT_N & (CO_DISP_EXT_N - 1)) != 0
+#error "CO_DISP_EXT_N: the size of the hash table must be a power of 2"
+#endif
+#endif
+
+/*! \brief INVALIDATE DISPATCH TABLE
+*
+*    This macro marks the CAN-ID dispatch table of the given node as
+*    outdated. The table is rebuilt with the next received CAN frame. The
+*    macro must be used by all services, which change a receive CAN-ID.
+*
+* \param node
+*    pointer to the CANopen node object
+*/
+#if USE_DISP
+#define CO_DISP_INVALIDATE(node)    ((node)->Disp.Dirty = 1u)
+#else
+#define CO_DISP_INVALIDATE(node)
+#endif
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+struct CO_NODE_T;             /* Declaration of canopen node structure       */
+
+/*! \brief DISPATCH SLOT TYPE
+*
+*    This enumeration holds the receive services, which can be registered
+*    in the CAN-ID dispatch table.
+*/
+typedef enum CO_DISP_TYPE_T {
+    CO_DISP_NONE = 0,            /*!< no service registered                  */
+    CO_DISP_SSDO,                /*!< SDO server request                     */
+    CO_DISP_CSDO,                /*!< SDO client response                    */
+    CO_DISP_NMT,                 /*!< NMT command                            */
+    CO_DISP_HBC,                 /*!< heartbeat of a consumed node           */
+    CO_DISP_RPDO,                /*!< receive PDO                            */
+    CO_DISP_SYNC,                /*!< SYNC message                           */
+    CO_DISP_TYPE_NUM             /*!< number of slot types                   */
+
+} CO_DISP_TYPE;
+
+#if USE_DISP
+
+/*! \brief DISPATCH SLOT NUMBER
+*
+*    This type holds a slot number + 1 (0 = unused). The smallest type for
+*    the configured number of slots is used to keep the 11-bit table small.
+*/
+#if CO_DISP_SLOT_N > 255
+typedef uint16_t CO_DISP_IDX;
+#else
+typedef uint8_t CO_DISP_IDX;
+#endif
+
+/*! \brief DISPATCH SLOT
+*
+*    This structure holds a single receive service registered in the CAN-ID
+*    dispatch table.
+*/
+typedef struct CO_DISP_SLOT_T {
+    void                  *Obj;  /*!< service object (e.g. SDO server)       */
+    uint8_t                Type; /*!< service type (see CO_DISP_TYPE)        */
+
+} CO_DISP_SLOT;
+
+/*! \brief DISPATCH EXTENDED ENTRY
+*
+*    This structure holds a single hashed 29-bit CAN identifier.
+*/
+typedef struct CO_DISP_EXT_T {
+    uint32_t               Id;   /*!< 29-bit CAN identifier                  */
+    CO_DISP_IDX            Slot; /*!< slot number + 1 (0 = unused)           */
+
+} CO_DISP_EXT;
+
+#endif
+
+/*! \brief CAN-ID DISPATCHER
+*
+*    This structure holds the CAN-ID to service lookup table. The 11-bit
+*    identifiers are indexed directly, the 29-bit identifiers are hashed
+*    with linear probing.
+*/
+typedef struct CO_DISP_T {
+    struct CO_NODE_T      *Node;                 /*!< link to parent node    */
+#if USE_DISP
+    CO_DISP_IDX            Std[CO_DISP_STD_N];   /*!< slot number + 1        */
+    CO_DISP_EXT            Ext[CO_DISP_EXT_N];   /*!< hashed 29-bit ids      */
+    CO_DISP_SLOT           Slot[CO_DISP_SLOT_N]; /*!< registered services    */
+    CO_DISP_IDX            Num;                  /*!< number of used slots   */
+    uint8_t                Dirty;                /*!< rebuild table needed   */
+    uint8_t                Overflow;             /*!< table is not usable    */
+#endif
+
+} CO_DISP;
+
+/******************************************************************************
+* PROTECTED API FUNCTIONS
+******************************************************************************/
+
+/*! \brief  INIT DISPATCHER
+*
+*    This function initializes the CAN-ID dispatcher. The lookup table is
+*    built with the first received CAN frame.
+*
+* \param disp
+*    pointer to the CAN-ID dispatcher
+*
+* \param node
+*    pointer to the parent node
+*/
+void CODispInit(CO_DISP *disp, struct CO_NODE_T *node);
+
+/*! \brief  BUILD DISPATCH TABLE
+*
+*    This function collects the receive CAN-IDs of all enabled services
+*    and rebuilds the lookup table. If a CAN-ID is used by more than one
+*    service, the first service in the order SDO server, SDO client, NMT,
+*    heartbeat consumer, RPDO and SYNC is registered.
+*
+* \param disp
+*    pointer to the CAN-ID dispatcher
+*/
+void CODispBuild(CO_DISP *disp);
+
+/*! \brief  DISPATCH CAN FRAME
+*
+*    This function routes the received CAN frame to the responsible service
+*    and executes the protocol activity. Only services, which are allowed in
+*    the current NMT mode are considered.
+*
+* \param disp
+*    pointer to the CAN-ID dispatcher
+*
+* \param frm
+*    received CAN frame
+*
+* \param allowed
+*    allowed objects in current NMT mode
+*
+* \retval  =0    CAN frame is consumed by a service
+* \retval  >0    CAN frame is not handled (given allowed objects)
+*/
+uint8_t CODispProcess(CO_DISP *disp, CO_IF_FRM *frm, uint8_t allowed);
+
+/*! \brief  GET RECEIVE CAN-IDS
+*
+*    This function collects the receive CAN-IDs of all enabled services in
+*    the order SDO server, SDO client, NMT, heartbeat consumer, RPDO, SYNC
+*    and LSS request. The function works with and without the dispatch
+*    table and is intended for CAN drivers, which support acceptance
+*    filters.
+*
+* \param disp
+*    pointer to the CAN-ID dispatcher
+*
+* \param id
+*    pointer to the CAN-ID array (filled with the receive CAN-IDs)
+*
+* \param max
+*    maximal number of CAN-IDs in the array
+*
+* \return
+*    number of receive CAN-IDs of the node (may be greater than max, the
+*    array contains the first max CAN-IDs in this case)
+*/
+uint16_t CODispGetIds(CO_DISP *disp, uint32_t *id, uint16_t max);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif /* CO_DISP_H_ */
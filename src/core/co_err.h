@@ -139,7 +139,11 @@ typedef enum CO_ERR_T {
     CO_ERR_TYPE_INIT,            /*!< error during type initialization       */
     CO_ERR_TYPE_RD,              /*!< error during reading type              */
     CO_ERR_TYPE_WR,              /*!< error during writing type              */
-    CO_ERR_TYPE_RESET            /*!< error during reset type                */
+    CO_ERR_TYPE_RESET,           /*!< error during reset type                */
+
+    CO_ERR_EXEC_FULL,            /*!< executor mailbox is full               */
+
+    CO_ERR_CSDO_QUEUE            /*!< SDO client request queue is full       */
 
 } CO_ERR;
 
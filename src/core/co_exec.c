@@ -0,0 +1,568 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+#if USE_EXEC
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_EXEC_MBX_MASK  ((uint32_t)CO_EXEC_MBX_N - 1u)
+#define CO_EXEC_REQ_MASK  ((uint32_t)CO_EXEC_REQ_N - 1u)
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint8_t COExecMbxPush (CO_EXEC_MBX *mbx, CO_IF_FRM *frm);
+static uint8_t COExecMbxPop  (CO_EXEC_MBX *mbx, CO_IF_FRM *frm);
+static uint8_t COExecReqPop  (CO_EXEC_REQ_MBX *mbx, CO_EXEC_REQ *req);
+static void    COExecDeliver (CO_EXEC *exec, CO_IF_FRM *frm, CO_EXEC_WORKER *from);
+static void    COExecWrite   (CO_NODE *node, CO_EXEC_REQ *req);
+
+static void     COExecCanInit     (CO_IF *cif);
+static void     COExecCanEnable   (CO_IF *cif, uint32_t baudrate);
+static int16_t  COExecCanRead     (CO_IF *cif, CO_IF_FRM *frm);
+static int16_t  COExecCanSend     (CO_IF *cif, CO_IF_FRM *frm);
+static void     COExecCanReset    (CO_IF *cif);
+static void     COExecCanClose    (CO_IF *cif);
+static int16_t  COExecCanReadBatch(CO_IF *cif, CO_IF_FRM *frm, uint16_t max);
+
+static void     COExecTmrInit     (CO_IF *cif, uint32_t freq);
+static void     COExecTmrReload   (CO_IF *cif, uint32_t reload);
+static uint32_t COExecTmrDelay    (CO_IF *cif);
+static void     COExecTmrStop     (CO_IF *cif);
+static void     COExecTmrStart    (CO_IF *cif);
+static uint8_t  COExecTmrUpdate   (CO_IF *cif);
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+/* CAN driver of a node: frames are exchanged via the worker mailboxes */
+static const CO_IF_CAN_DRV COExecCanDriver = {
+    COExecCanInit,
+    COExecCanEnable,
+    COExecCanRead,
+    COExecCanSend,
+    COExecCanReset,
+    COExecCanClose,
+    COExecCanReadBatch,
+    0
+};
+
+/* timer driver of a node: the timer is clocked with the executor ticks */
+static const CO_IF_TIMER_DRV COExecTmrDriver = {
+    COExecTmrInit,
+    COExecTmrReload,
+    COExecTmrDelay,
+    COExecTmrStop,
+    COExecTmrStart,
+    COExecTmrUpdate
+};
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void COExecInit(CO_EXEC *exec, CO_IF_DRV *bus, uint32_t baudrate)
+{
+    const CO_IF_CAN_DRV *can;
+
+    ASSERT_PTR_FATAL(exec);
+    ASSERT_PTR_FATAL(bus);
+
+    exec->Bus.Node    = NULL;
+    exec->Bus.Drv     = bus;
+    exec->Bus.TxNum   = 0;
+    exec->Bus.TxDefer = 0;
+    exec->Num         = 0;
+    exec->Tick        = 0;
+    exec->Stop        = 0;
+
+    can = bus->Can;
+    can->Init(&exec->Bus);
+    can->Enable(&exec->Bus, baudrate);
+}
+
+/*
+* see function definition
+*/
+CO_EXEC_WORKER *COExecAdd(CO_EXEC *exec, CO_NODE *node, CO_NODE_SPEC *spec)
+{
+    CO_EXEC_WORKER *worker;
+    CO_NODE_SPEC    wspec;
+
+    ASSERT_PTR_ERR(exec, NULL);
+    ASSERT_PTR_ERR(node, NULL);
+    ASSERT_PTR_ERR(spec, NULL);
+
+    if (exec->Num >= (uint16_t)CO_EXEC_NODE_N) {
+        return (NULL);
+    }
+    worker = &exec->Worker[exec->Num];
+
+    worker->Exec      = exec;
+    worker->Node      = node;
+    worker->Ctx       = spec->Drv->Ctx;
+    worker->Drv.Can   = &COExecCanDriver;
+    worker->Drv.Timer = &COExecTmrDriver;
+    worker->Drv.Nvm   = spec->Drv->Nvm;
+    worker->Drv.Ctx   = worker;
+    worker->Rx.Head   = 0;
+    worker->Rx.Tail   = 0;
+    worker->Tx.Head   = 0;
+    worker->Tx.Tail   = 0;
+    worker->Req.Head  = 0;
+    worker->Req.Tail  = 0;
+    worker->Tick      = CO_EXEC_LOAD(exec->Tick);
+    worker->Counter   = 0;
+    worker->RxOvr     = 0;
+
+    wspec     = *spec;
+    wspec.Drv = &worker->Drv;
+    CONodeInit(node, &wspec);
+
+    exec->Num++;
+    return (worker);
+}
+
+/*
+* see function definition
+*/
+CO_ERR COExecPost(CO_EXEC_WORKER *worker, uint32_t key, uint32_t val)
+{
+    CO_EXEC_REQ_MBX *mbx;
+    uint32_t         head;
+    uint32_t         tail;
+
+    ASSERT_PTR_ERR(worker, CO_ERR_BAD_ARG);
+
+    mbx  = &worker->Req;
+    head = mbx->Head;
+    tail = CO_EXEC_LOAD(mbx->Tail);
+    if ((head - tail) >= (uint32_t)CO_EXEC_REQ_N) {
+        return (CO_ERR_EXEC_FULL);
+    }
+    mbx->Req[head & CO_EXEC_REQ_MASK].Key = key;
+    mbx->Req[head & CO_EXEC_REQ_MASK].Val = val;
+    CO_EXEC_STORE(mbx->Head, head + 1u);
+
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+void COExecTick(CO_EXEC *exec)
+{
+    ASSERT_PTR_FATAL(exec);
+
+    CO_EXEC_INC(exec->Tick);
+}
+
+/*
+* see function definition
+*/
+uint16_t COExecBusProcess(CO_EXEC *exec)
+{
+    const CO_IF_CAN_DRV *can;
+    CO_EXEC_WORKER      *worker;
+    CO_IF_FRM            frm;
+    uint16_t             num = 0;
+    uint16_t             n;
+    int16_t              err;
+
+    ASSERT_PTR_ERR(exec, 0);
+
+    /* distribute received frames, limited to allow transmissions */
+    can = exec->Bus.Drv->Can;
+    while (num < (uint16_t)CO_EXEC_MBX_N) {
+        err = can->Read(&exec->Bus, &frm);
+        if (err <= (int16_t)0) {
+            break;
+        }
+        COExecDeliver(exec, &frm, NULL);
+        num++;
+    }
+
+    /* send the frames of all nodes to the bus and the other nodes */
+    for (n = 0; n < exec->Num; n++) {
+        worker = &exec->Worker[n];
+        while (COExecMbxPop(&worker->Tx, &frm) != 0) {
+            (void)can->Send(&exec->Bus, &frm);
+            COExecDeliver(exec, &frm, worker);
+            num++;
+        }
+    }
+
+    return (num);
+}
+
+/*
+* see function definition
+*/
+uint16_t COExecWorkerProcess(CO_EXEC_WORKER *worker)
+{
+    CO_NODE     *node;
+    CO_EXEC_REQ  req;
+    uint32_t     tick;
+    uint16_t     num = 0;
+
+    ASSERT_PTR_ERR(worker, 0);
+
+    node = worker->Node;
+    while (COExecReqPop(&worker->Req, &req) != 0) {
+        COExecWrite(node, &req);
+        num++;
+    }
+
+    num += CONodeProcessBatch(node, (uint16_t)CO_EXEC_MBX_N);
+
+    /* catch up missed ticks; cyclic actions are restarted after expiry */
+    tick = CO_EXEC_LOAD(worker->Exec->Tick);
+    while (worker->Tick != tick) {
+        worker->Tick++;
+        if (COTmrService(&node->Tmr) > 0) {
+            COTmrProcess(&node->Tmr);
+        }
+        num++;
+    }
+
+    return (num);
+}
+
+/*
+* see function definition
+*/
+void COExecBusRun(CO_EXEC *exec)
+{
+    uint16_t num;
+
+    ASSERT_PTR_FATAL(exec);
+
+    while (CO_EXEC_LOAD(exec->Stop) == 0u) {
+        num = COExecBusProcess(exec);
+        if (num == 0) {
+            COExecIdle(exec);
+        }
+    }
+}
+
+/*
+* see function definition
+*/
+void COExecWorkerRun(CO_EXEC_WORKER *worker)
+{
+    CO_EXEC  *exec;
+    uint16_t  num;
+
+    ASSERT_PTR_FATAL(worker);
+
+    exec = worker->Exec;
+    while (CO_EXEC_LOAD(exec->Stop) == 0u) {
+        num = COExecWorkerProcess(worker);
+        if (num == 0) {
+            COExecIdle(exec);
+        }
+    }
+}
+
+/*
+* see function definition
+*/
+void COExecStop(CO_EXEC *exec)
+{
+    ASSERT_PTR_FATAL(exec);
+
+    CO_EXEC_STORE(exec->Stop, 1u);
+}
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+
+/*! \brief  PUSH FRAME INTO MAILBOX
+*
+*    This function appends the given frame to the mailbox. The function
+*    must be called by the producer thread of the mailbox only.
+*
+* \param mbx
+*    pointer to the frame mailbox
+*
+* \param frm
+*    pointer to the CAN frame
+*
+* \retval  =1    frame is added
+* \retval  =0    mailbox is full
+*/
+static uint8_t COExecMbxPush(CO_EXEC_MBX *mbx, CO_IF_FRM *frm)
+{
+    uint32_t head = mbx->Head;
+    uint32_t tail = CO_EXEC_LOAD(mbx->Tail);
+
+    if ((head - tail) >= (uint32_t)CO_EXEC_MBX_N) {
+        return (0u);
+    }
+    mbx->Frm[head & CO_EXEC_MBX_MASK] = *frm;
+    CO_EXEC_STORE(mbx->Head, head + 1u);
+    return (1u);
+}
+
+/*! \brief  POP FRAME FROM MAILBOX
+*
+*    This function removes the oldest frame from the mailbox. The function
+*    must be called by the consumer thread of the mailbox only.
+*
+* \param mbx
+*    pointer to the frame mailbox
+*
+* \param frm
+*    pointer to the CAN frame (filled with the removed frame)
+*
+* \retval  =1    frame is removed
+* \retval  =0    mailbox is empty
+*/
+static uint8_t COExecMbxPop(CO_EXEC_MBX *mbx, CO_IF_FRM *frm)
+{
+    uint32_t tail = mbx->Tail;
+    uint32_t head = CO_EXEC_LOAD(mbx->Head);
+
+    if (head == tail) {
+        return (0u);
+    }
+    *frm = mbx->Frm[tail & CO_EXEC_MBX_MASK];
+    CO_EXEC_STORE(mbx->Tail, tail + 1u);
+    return (1u);
+}
+
+/*! \brief  POP WRITE REQUEST FROM MAILBOX
+*
+*    This function removes the oldest write request from the mailbox. The
+*    function must be called by the worker thread only.
+*
+* \param mbx
+*    pointer to the request mailbox
+*
+* \param req
+*    pointer to the request (filled with the removed request)
+*
+* \retval  =1    request is removed
+* \retval  =0    mailbox is empty
+*/
+static uint8_t COExecReqPop(CO_EXEC_REQ_MBX *mbx, CO_EXEC_REQ *req)
+{
+    uint32_t tail = mbx->Tail;
+    uint32_t head = CO_EXEC_LOAD(mbx->Head);
+
+    if (head == tail) {
+        return (0u);
+    }
+    *req = mbx->Req[tail & CO_EXEC_REQ_MASK];
+    CO_EXEC_STORE(mbx->Tail, tail + 1u);
+    return (1u);
+}
+
+/*! \brief  DELIVER FRAME TO NODES
+*
+*    This function adds the given frame to the receive mailbox of all nodes
+*    except the sending node. Frames for a full mailbox are dropped.
+*
+* \param exec
+*    pointer to the executor
+*
+* \param frm
+*    pointer to the CAN frame
+*
+* \param from
+*    pointer to the sending worker (or NULL for frames from the bus)
+*/
+static void COExecDeliver(CO_EXEC *exec, CO_IF_FRM *frm, CO_EXEC_WORKER *from)
+{
+    CO_EXEC_WORKER *worker;
+    uint16_t        n;
+
+    for (n = 0; n < exec->Num; n++) {
+        worker = &exec->Worker[n];
+        if (worker != from) {
+            if (COExecMbxPush(&worker->Rx, frm) == 0u) {
+                worker->RxOvr++;
+            }
+        }
+    }
+}
+
+/*! \brief  EXECUTE WRITE REQUEST
+*
+*    This function writes the requested value into the object entry with
+*    the size of the object entry. A failed write is reported as node error.
+*
+* \param node
+*    pointer to the CANopen node object
+*
+* \param req
+*    pointer to the write request
+*/
+static void COExecWrite(CO_NODE *node, CO_EXEC_REQ *req)
+{
+    CO_ERR   err = CO_ERR_OBJ_NOT_FOUND;
+    CO_OBJ  *obj;
+    uint32_t sz;
+    uint8_t  val08;
+    uint16_t val16;
+    uint32_t val32;
+
+    obj = CODictFind(&node->Dict, req->Key);
+    if (obj != NULL) {
+        sz = COObjGetSize(obj, node, 0);
+        if (sz == 1u) {
+            val08 = (uint8_t)req->Val;
+            err   = COObjWrValue(obj, node, (void *)&val08, 1u);
+        } else if (sz == 2u) {
+            val16 = (uint16_t)req->Val;
+            err   = COObjWrValue(obj, node, (void *)&val16, 2u);
+        } else if (sz == 4u) {
+            val32 = req->Val;
+            err   = COObjWrValue(obj, node, (void *)&val32, 4u);
+        } else {
+            err   = CO_ERR_OBJ_SIZE;
+        }
+    }
+    if (err != CO_ERR_NONE) {
+        node->Error = err;
+    }
+}
+
+/******************************************************************************
+* PRIVATE DRIVER FUNCTIONS
+******************************************************************************/
+
+static void COExecCanInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void COExecCanEnable(CO_IF *cif, uint32_t baudrate)
+{
+    (void)cif;
+    (void)baudrate;
+}
+
+static int16_t COExecCanRead(CO_IF *cif, CO_IF_FRM *frm)
+{
+    CO_EXEC_WORKER *worker = (CO_EXEC_WORKER *)CO_IF_CTX(cif);
+    int16_t         result = 0;
+
+    if (COExecMbxPop(&worker->Rx, frm) != 0u) {
+        result = (int16_t)sizeof(CO_IF_FRM);
+    }
+    return (result);
+}
+
+static int16_t COExecCanReadBatch(CO_IF *cif, CO_IF_FRM *frm, uint16_t max)
+{
+    CO_EXEC_WORKER *worker = (CO_EXEC_WORKER *)CO_IF_CTX(cif);
+    uint16_t        num    = 0;
+
+    while ((num < max) && (COExecMbxPop(&worker->Rx, &frm[num]) != 0u)) {
+        num++;
+    }
+    return ((int16_t)num);
+}
+
+static int16_t COExecCanSend(CO_IF *cif, CO_IF_FRM *frm)
+{
+    CO_EXEC_WORKER *worker = (CO_EXEC_WORKER *)CO_IF_CTX(cif);
+    CO_EXEC        *exec   = worker->Exec;
+
+    /* wait for a free slot, like a CAN controller with busy mailboxes */
+    while (COExecMbxPush(&worker->Tx, frm) == 0u) {
+        if (CO_EXEC_LOAD(exec->Stop) != 0u) {
+            return ((int16_t)-1);
+        }
+        COExecIdle(exec);
+    }
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static void COExecCanReset(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void COExecCanClose(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void COExecTmrInit(CO_IF *cif, uint32_t freq)
+{
+    CO_EXEC_WORKER *worker = (CO_EXEC_WORKER *)CO_IF_CTX(cif);
+
+    (void)freq;
+    worker->Counter = 0;
+}
+
+static void COExecTmrReload(CO_IF *cif, uint32_t reload)
+{
+    CO_EXEC_WORKER *worker = (CO_EXEC_WORKER *)CO_IF_CTX(cif);
+
+    worker->Counter = reload;
+}
+
+static uint32_t COExecTmrDelay(CO_IF *cif)
+{
+    CO_EXEC_WORKER *worker = (CO_EXEC_WORKER *)CO_IF_CTX(cif);
+
+    return (worker->Counter);
+}
+
+static void COExecTmrStop(CO_IF *cif)
+{
+    CO_EXEC_WORKER *worker = (CO_EXEC_WORKER *)CO_IF_CTX(cif);
+
+    worker->Counter = 0;
+}
+
+static void COExecTmrStart(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint8_t COExecTmrUpdate(CO_IF *cif)
+{
+    CO_EXEC_WORKER *worker = (CO_EXEC_WORKER *)CO_IF_CTX(cif);
+    uint8_t         result = 0u;
+
+    if (worker->Counter > 0u) {
+        worker->Counter--;
+        if (worker->Counter == 0u) {
+            result = 1u;
+        }
+    }
+    return (result);
+}
+
+#endif /* USE_EXEC */
@@ -0,0 +1,307 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_EXEC_H_
+#define CO_EXEC_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_cfg.h"
+#include "co_err.h"
+#include "co_if.h"
+
+#if USE_EXEC
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#if (CO_EXEC_MBX_N & (CO_EXEC_MBX_N - 1)) != 0
+#error "CO_EXEC_MBX_N: the size of the frame mailbox must be a power of 2"
+#endif
+#if (CO_EXEC_REQ_N & (CO_EXEC_REQ_N - 1)) != 0
+#error "CO_EXEC_REQ_N: the size of the request mailbox must be a power of 2"
+#endif
+
+/*! \brief ATOMIC ACCESS
+*
+*    These macros access the mailbox indices, which are shared between two
+*    threads. The default implementation uses the GCC atomic builtins; the
+*    macros may be defined in the configuration for other compilers.
+*/
+#ifndef CO_EXEC_LOAD
+#define CO_EXEC_LOAD(v)      __atomic_load_n(&(v), __ATOMIC_ACQUIRE)
+#endif
+#ifndef CO_EXEC_STORE
+#define CO_EXEC_STORE(v,n)   __atomic_store_n(&(v), (n), __ATOMIC_RELEASE)
+#endif
+#ifndef CO_EXEC_INC
+#define CO_EXEC_INC(v)       (void)__atomic_fetch_add(&(v), 1u, __ATOMIC_RELEASE)
+#endif
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+struct CO_NODE_T;             /* Declaration of canopen node structure       */
+struct CO_NODE_SPEC_T;        /* Declaration of node specification           */
+struct CO_EXEC_T;             /* Declaration of executor structure           */
+
+/*! \brief FRAME MAILBOX
+*
+*    This structure holds a lock-free ring buffer of CAN frames with a
+*    single producer thread and a single consumer thread.
+*/
+typedef struct CO_EXEC_MBX_T {
+    CO_IF_FRM              Frm[CO_EXEC_MBX_N]; /*!< frame buffer             */
+    uint32_t               Head;               /*!< write index (producer)   */
+    uint32_t               Tail;               /*!< read index (consumer)    */
+
+} CO_EXEC_MBX;
+
+/*! \brief OBJECT WRITE REQUEST
+*
+*    This structure holds a single object write, which is posted by an
+*    application thread into a node.
+*/
+typedef struct CO_EXEC_REQ_T {
+    uint32_t               Key;                /*!< object key (CO_DEV)      */
+    uint32_t               Val;                /*!< value to write           */
+
+} CO_EXEC_REQ;
+
+/*! \brief REQUEST MAILBOX
+*
+*    This structure holds a lock-free ring buffer of object write requests
+*    with a single producer thread and a single consumer thread.
+*/
+typedef struct CO_EXEC_REQ_MBX_T {
+    CO_EXEC_REQ            Req[CO_EXEC_REQ_N]; /*!< request buffer           */
+    uint32_t               Head;               /*!< write index (producer)   */
+    uint32_t               Tail;               /*!< read index (consumer)    */
+
+} CO_EXEC_REQ_MBX;
+
+/*! \brief EXECUTOR WORKER
+*
+*    This structure holds the execution context of a single node. All
+*    activities of the node are executed in the thread, which runs the
+*    worker.
+*/
+typedef struct CO_EXEC_WORKER_T {
+    struct CO_EXEC_T      *Exec;     /*!< link to parent executor            */
+    struct CO_NODE_T      *Node;     /*!< link to executed node              */
+    CO_IF_DRV              Drv;      /*!< driver functions of the node       */
+    void                  *Ctx;      /*!< driver context of the application  */
+    CO_EXEC_MBX            Rx;       /*!< frames from the bus to the node    */
+    CO_EXEC_MBX            Tx;       /*!< frames from the node to the bus    */
+    CO_EXEC_REQ_MBX        Req;      /*!< object writes from the application */
+    uint32_t               Tick;     /*!< processed executor ticks           */
+    uint32_t               Counter;  /*!< remaining ticks of node timer      */
+    uint32_t               RxOvr;    /*!< number of dropped received frames  */
+
+} CO_EXEC_WORKER;
+
+/*! \brief NODE EXECUTOR
+*
+*    This structure holds the nodes, which are sharing a single CAN bus.
+*    The bus is served by one thread, each node is served by a worker
+*    thread. The threads are exchanging the CAN frames via mailboxes.
+*/
+typedef struct CO_EXEC_T {
+    CO_IF                  Bus;                    /*!< shared CAN interface */
+    CO_EXEC_WORKER         Worker[CO_EXEC_NODE_N]; /*!< node workers         */
+    uint16_t               Num;                    /*!< number of workers    */
+    uint32_t               Tick;                   /*!< executor timer ticks */
+    uint32_t               Stop;                   /*!< stop request         */
+
+} CO_EXEC;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  INIT EXECUTOR
+*
+*    This function initializes the executor and enables the shared CAN bus
+*    with the given driver. Only the CAN driver of the given driver table
+*    is used.
+*
+* \param exec
+*    pointer to the executor
+*
+* \param bus
+*    pointer to the driver table of the shared CAN bus
+*
+* \param baudrate
+*    CAN baudrate of the shared CAN bus
+*/
+void COExecInit(CO_EXEC *exec, CO_IF_DRV *bus, uint32_t baudrate);
+
+/*! \brief  ADD NODE TO EXECUTOR
+*
+*    This function initializes the given node with the given specification
+*    and adds the node to the executor. The node exchanges the CAN frames
+*    via the mailboxes of the executor and the node timer is clocked with
+*    \ref COExecTick(). The NVM driver of the specification is used as it
+*    is; it gets the worker as driver context, the driver context of the
+*    specification is available in the worker member \c Ctx.
+*
+* \note
+*    Add and start all nodes before the executor threads are running.
+*
+* \param exec
+*    pointer to the executor
+*
+* \param node
+*    pointer to the CANopen node object
+*
+* \param spec
+*    pointer to the node specification
+*
+* \retval  !=0   pointer to the worker of the node
+* \retval  =0    no free worker available
+*/
+CO_EXEC_WORKER *COExecAdd(CO_EXEC *exec, struct CO_NODE_T *node, struct CO_NODE_SPEC_T *spec);
+
+/*! \brief  POST OBJECT WRITE
+*
+*    This function posts a write of the given value to an object entry of
+*    the node. The write is executed within the worker thread of the node,
+*    therefore no timer lock is needed. Each node accepts posts from a
+*    single application thread.
+*
+* \param worker
+*    pointer to the worker of the node
+*
+* \param key
+*    object entry key; should be generated with the macro CO_DEV()
+*
+* \param val
+*    value to write (converted to the size of the object entry)
+*
+* \retval  =CO_ERR_NONE       write is posted
+* \retval  =CO_ERR_EXEC_FULL  request mailbox of the node is full
+*/
+CO_ERR COExecPost(CO_EXEC_WORKER *worker, uint32_t key, uint32_t val);
+
+/*! \brief  EXECUTOR TIMER TICK
+*
+*    This function advances the timer of all nodes by a single tick. The
+*    function is intended to be called with the timer frequency of the
+*    nodes, e.g. in a timer thread.
+*
+* \param exec
+*    pointer to the executor
+*/
+void COExecTick(CO_EXEC *exec);
+
+/*! \brief  PROCESS SHARED CAN BUS
+*
+*    This function reads the received CAN frames from the shared CAN bus
+*    into the receive mailboxes of all nodes and sends the frames of the
+*    transmit mailboxes to the shared CAN bus. Transmitted frames are also
+*    delivered to the other nodes of the executor, as they would on a real
+*    CAN bus. A frame for a node with a full receive mailbox is dropped.
+*
+* \note
+*    This function must be called by a single thread (the bus thread).
+*
+* \param exec
+*    pointer to the executor
+*
+* \return
+*    number of forwarded CAN frames
+*/
+uint16_t COExecBusProcess(CO_EXEC *exec);
+
+/*! \brief  PROCESS NODE
+*
+*    This function executes the posted object writes, the received CAN
+*    frames and the elapsed timer ticks of the node.
+*
+* \note
+*    This function must be called by a single thread (the worker thread).
+*
+* \param worker
+*    pointer to the worker of the node
+*
+* \return
+*    number of executed requests, frames and ticks
+*/
+uint16_t COExecWorkerProcess(CO_EXEC_WORKER *worker);
+
+/*! \brief  RUN SHARED CAN BUS
+*
+*    This function processes the shared CAN bus until the executor is
+*    stopped. The callback \ref COExecIdle() is called, when there is
+*    nothing to do. This function is intended as the bus thread function.
+*
+* \param exec
+*    pointer to the executor
+*/
+void COExecBusRun(CO_EXEC *exec);
+
+/*! \brief  RUN NODE
+*
+*    This function processes the node until the executor is stopped. The
+*    callback \ref COExecIdle() is called, when there is nothing to do.
+*    This function is intended as the worker thread function.
+*
+* \param worker
+*    pointer to the worker of the node
+*/
+void COExecWorkerRun(CO_EXEC_WORKER *worker);
+
+/*! \brief  STOP EXECUTOR
+*
+*    This function requests the bus thread and all worker threads to leave
+*    the run functions.
+*
+* \param exec
+*    pointer to the executor
+*/
+void COExecStop(CO_EXEC *exec);
+
+/******************************************************************************
+* CALLBACK FUNCTIONS
+******************************************************************************/
+
+/*! \brief  EXECUTOR IDLE CALLBACK
+*
+*    This function is called by the run functions when there is nothing to
+*    do, and by the node transmission while the transmit mailbox is full.
+*    The function is intended to yield or sleep the calling thread.
+*
+* \param exec
+*    pointer to the executor
+*/
+extern void COExecIdle(CO_EXEC *exec);
+
+#endif /* USE_EXEC */
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif /* CO_EXEC_H_ */
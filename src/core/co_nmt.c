@@ -103,7 +103,7 @@ void CONmtReset(CO_NMT *nmt, CO_NMT_RESET type)
         }
 
 #if USE_LSS
-        err = COLssLoad(&nmt->Node->Baudrate, &nmt->Node->NodeId);
+        err = COLssLoad(nmt->Node, &nmt->Node->Baudrate, &nmt->Node->NodeId);
         if (err != CO_ERR_NONE) {
             nmt->Node->Error = CO_ERR_LSS_LOAD;
         }
@@ -128,6 +128,7 @@ void CONmtInit(CO_NMT *nmt, CO_NODE *node)
 
     nmt->Node = node;
     nmt->HbCons = NULL;
+    CO_DISP_INVALIDATE(node);
     CONmtSetMode(nmt, CO_INIT);
 }
 
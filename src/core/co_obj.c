@@ -111,6 +111,8 @@ CO_ERR COObjWrBufStart(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint8_t *bu
 
     type = obj->Type;
     if (type->Write != NULL) {
+        CO_SDO_CACHE_INVALIDATE(node);
+
         /* mandatory: reset object */
         (void)COObjReset(obj, node, 0);
 
@@ -136,6 +138,7 @@ CO_ERR COObjWrBufCont(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint8_t *buf
 
     type = obj->Type;
     if (type->Write != NULL) {
+        CO_SDO_CACHE_INVALIDATE(node);
         result = type->Write(obj, node, (void *)buffer, size);
     }
     return (result);
@@ -204,6 +207,7 @@ CO_ERR COObjWrValue(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *value, u
 
     type = obj->Type;
     if (type->Write != NULL) {
+        CO_SDO_CACHE_INVALIDATE(node);
         result = type->Write(obj, node, value, width);
     }
     return (result);
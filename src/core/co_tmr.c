@@ -25,24 +25,30 @@
 * EXTERNAL FUNCTIONS
 ******************************************************************************/
 
-extern void COTmrLock(void);
-extern void COTmrUnlock(void);
+extern void COTmrLock(CO_TMR *tmr);
+extern void COTmrUnlock(CO_TMR *tmr);
 
 /******************************************************************************
 * PRIVATE FUNCTION PROTOTYPES
 ******************************************************************************/
 
+#if USE_TMR_WHEEL == 0
+
 static void         COTmrReset  (CO_TMR *tmr);
 static CO_TMR_TIME *COTmrInsert (CO_TMR *tmr, uint32_t dTnew, CO_TMR_ACTION *action);
 static void         COTmrRemove (CO_TMR *tmr, CO_TMR_TIME *tx);
 
+#endif
+
 /******************************************************************************
 * PROTECTED FUNCTIONS
 ******************************************************************************/
 
+#if USE_TMR_WHEEL == 0
+
 void COTmrInit(CO_TMR *tmr, CO_NODE *node, CO_TMR_MEM *mem, uint16_t num, uint32_t freq)
 {
-    COTmrLock();
+    COTmrLock(tmr);
     tmr->Node  = node;
     tmr->Max   = num;
     tmr->TPool = &mem->Tmr;
@@ -50,9 +56,11 @@ void COTmrInit(CO_TMR *tmr, CO_NODE *node, CO_TMR_MEM *mem, uint16_t num, uint32
     tmr->Freq  = freq;
 
     COTmrReset(tmr);
-    COTmrUnlock();
+    COTmrUnlock(tmr);
 }
 
+#endif
+
 void COTmrClear(CO_TMR *tmr)
 {
     CO_NODE    *node = tmr->Node;
@@ -120,6 +128,8 @@ uint16_t COTmrGetMinTime(CO_TMR *tmr, uint32_t unit)
     return (time);
 }
 
+#if USE_TMR_WHEEL == 0
+
 WEAK_TEST
 int16_t COTmrCreate(CO_TMR      *tmr,
                     uint32_t     startTicks,
@@ -151,10 +161,10 @@ int16_t COTmrCreate(CO_TMR      *tmr,
         return -1;
     }
 
-    COTmrLock();
+    COTmrLock(tmr);
     if (tmr->Acts == 0) {
         tmr->Node->Error = CO_ERR_TMR_NO_ACT;
-        COTmrUnlock();
+        COTmrUnlock(tmr);
         return -1;
     }
 
@@ -178,7 +188,7 @@ int16_t COTmrCreate(CO_TMR      *tmr,
         result = (int16_t)(act->Id);
     }
 
-    COTmrUnlock();
+    COTmrUnlock(tmr);
 
     return (result);
 }
@@ -197,7 +207,7 @@ int16_t COTmrDelete(CO_TMR *tmr, int16_t actId)
         return -1;
     }
 
-    COTmrLock();
+    COTmrLock(tmr);
 
     /* search in used timer list */
     tx = tmr->Use;                     
@@ -271,7 +281,7 @@ int16_t COTmrDelete(CO_TMR *tmr, int16_t actId)
             result = 0;
         }
     }
-    COTmrUnlock();
+    COTmrUnlock(tmr);
 
     return (result);
 }
@@ -328,7 +338,7 @@ void COTmrProcess(CO_TMR *tmr)
     void          *para;
 
     while (tmr->Elapsed != 0) {
-        COTmrLock();
+        COTmrLock(tmr);
         tn            = tmr->Elapsed;
         tmr->Elapsed  = tn->Next;
 
@@ -338,7 +348,7 @@ void COTmrProcess(CO_TMR *tmr)
         tn->Delta     = 0;
         tn->Next      = tmr->Free;
         tmr->Free     = tn;
-        COTmrUnlock();
+        COTmrUnlock(tmr);
 
         /* loop through all actions of elapsed timer event */
         while (act != 0) {
@@ -350,15 +360,15 @@ void COTmrProcess(CO_TMR *tmr)
             if (act->CycleTicks == 0) {
                 act->Para = 0;
                 act->Func = (CO_TMR_FUNC)0;
-                COTmrLock();
+                COTmrLock(tmr);
                 act->Next = tmr->Acts;
                 tmr->Acts = act;
-                COTmrUnlock();
+                COTmrUnlock(tmr);
 
             } else {
-                COTmrLock();
+                COTmrLock(tmr);
                 res = COTmrInsert(tmr, act->CycleTicks, act);
-                COTmrUnlock();
+                COTmrUnlock(tmr);
                 if (res == (CO_TMR_TIME*)0) {
                     tmr->Node->Error = CO_ERR_TMR_CREATE;
                 }
@@ -370,10 +380,14 @@ void COTmrProcess(CO_TMR *tmr)
     }
 }
 
+#endif
+
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
+#if USE_TMR_WHEEL == 0
+
 static void COTmrReset(CO_TMR *tmr)
 {
     CO_TMR_MEM    *mem = (CO_TMR_MEM *)tmr->APool;
@@ -557,3 +571,5 @@ static void COTmrRemove(CO_TMR *tmr, CO_TMR_TIME *tx)
         }
     }
 }
+
+#endif
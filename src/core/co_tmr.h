@@ -35,6 +35,12 @@ extern "C" {
 #define CO_TMR_UNIT_1MS          1000
 #define CO_TMR_UNIT_100US        10000
 
+#if USE_TMR_WHEEL
+#define CO_TMR_WHEEL_BITS        4u         /*!< index bits per wheel level  */
+#define CO_TMR_WHEEL_SLOTS       (1u << CO_TMR_WHEEL_BITS)
+#define CO_TMR_WHEEL_LEVELS      (32u / CO_TMR_WHEEL_BITS)
+#endif
+
 /******************************************************************************
 * PUBLIC TYPES
 ******************************************************************************/
@@ -57,6 +63,11 @@ typedef struct CO_TMR_ACTION_T {
     CO_TMR_FUNC             Func;          /*!< pointer to callback function */
     void                   *Para;          /*!< callback function parameter  */
     uint32_t                CycleTicks;    /*!< action cycle time in ticks   */
+#if USE_TMR_WHEEL
+    struct CO_TMR_ACTION_T *Prev;          /*!< link to previous action      */
+    uint32_t                Expire;        /*!< absolute expiry in ticks     */
+    uint8_t                 List;          /*!< list holding the action      */
+#endif
 
 } CO_TMR_ACTION;
 
@@ -82,7 +93,9 @@ typedef struct CO_TMR_TIME_T {
 */
 typedef struct CO_TMR_MEM_T {
     CO_TMR_ACTION  Act;                  /*!< memory portion for action info */
+#if USE_TMR_WHEEL == 0
     CO_TMR_TIME    Tmr;                  /*!< memory portion for timer info  */
+#endif
 
 } CO_TMR_MEM;
 
@@ -90,16 +103,33 @@ typedef struct CO_TMR_MEM_T {
 *
 *    This structure holds all data, which are needed for managing the
 *    highspeed timer events.
+*
+*    With the timing wheel, the actions are kept in circular lists. Level L
+*    of the wheel holds the actions, which expire within the next 16^(L+1)
+*    ticks, in 16 slots of 16^L ticks each. The action identifier is the
+*    index in the action pool, so deleting an action needs no search.
 */
 typedef struct CO_TMR_T {
     struct CO_NODE_T       *Node;      /*!< Link to parent node              */
     uint32_t                Max;       /*!< Num. of elements in pools        */
     struct CO_TMR_ACTION_T *APool;     /*!< Timer action pool                */
+#if USE_TMR_WHEEL
+    struct CO_TMR_ACTION_T *Acts;      /*!< Timer action free list           */
+    struct CO_TMR_ACTION_T *Slot[CO_TMR_WHEEL_LEVELS * CO_TMR_WHEEL_SLOTS];
+                                       /*!< Timer action lists of wheel      */
+    uint16_t                Used[CO_TMR_WHEEL_LEVELS];
+                                       /*!< Non-empty slots of each level    */
+    struct CO_TMR_ACTION_T *Elapsed;   /*!< Timer action elapsed list        */
+    uint32_t                Time;      /*!< Current wheel time in ticks      */
+    uint32_t                Next;      /*!< Wheel time of next timer event   */
+    uint8_t                 Run;       /*!< Timer driver is started          */
+#else
     struct CO_TMR_TIME_T   *TPool;     /*!< Timer event pool                 */
     struct CO_TMR_ACTION_T *Acts;      /*!< Timer action free list           */
     struct CO_TMR_TIME_T   *Free;      /*!< Timer event free list            */
     struct CO_TMR_TIME_T   *Use;       /*!< Timer event used list            */
     struct CO_TMR_TIME_T   *Elapsed;   /*!< Timer event elapsed list         */
+#endif
     uint32_t                Freq;      /*!< Timer ticks per second           */
 
 } CO_TMR;
@@ -0,0 +1,478 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_tmr.h"
+#include "co_core.h"
+
+#if USE_TMR_WHEEL
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_TMR_LIST_ELAPSED   0xFEu   /*!< action is in elapsed list         */
+#define CO_TMR_LIST_FREE      0xFFu   /*!< action is in free list            */
+
+/*! \brief WHEEL LEVEL SHIFT
+*
+*    This macro returns the number of tick bits below the slot index of the
+*    given wheel level.
+*/
+#define CO_TMR_SHIFT(lvl)     ((uint32_t)(lvl) * CO_TMR_WHEEL_BITS)
+
+/*! \brief WHEEL LEVEL MASK
+*
+*    This macro returns the mask for the ticks within a single slot of the
+*    given wheel level.
+*/
+#define CO_TMR_MASK(lvl)      (((uint32_t)1 << CO_TMR_SHIFT(lvl)) - 1u)
+
+/******************************************************************************
+* EXTERNAL FUNCTIONS
+******************************************************************************/
+
+extern void COTmrLock(CO_TMR *tmr);
+extern void COTmrUnlock(CO_TMR *tmr);
+
+/******************************************************************************
+* PRIVATE FUNCTION PROTOTYPES
+******************************************************************************/
+
+static void            COTmrReset  (CO_TMR *tmr);
+static uint32_t        COTmrNow    (CO_TMR *tmr);
+static CO_TMR_ACTION **COTmrHead   (CO_TMR *tmr, uint8_t list);
+static void            COTmrLink   (CO_TMR *tmr, CO_TMR_ACTION *act, uint8_t list);
+static void            COTmrUnlink (CO_TMR *tmr, CO_TMR_ACTION *act);
+static void            COTmrPlace  (CO_TMR *tmr, CO_TMR_ACTION *act);
+static void            COTmrInsert (CO_TMR *tmr, uint32_t ticks, CO_TMR_ACTION *act);
+static void            COTmrAdvance(CO_TMR *tmr);
+static uint8_t         COTmrNextEvent(CO_TMR *tmr, uint32_t *delta);
+static uint8_t         COTmrFirstSlot(uint32_t used);
+
+/******************************************************************************
+* PROTECTED FUNCTIONS
+******************************************************************************/
+
+void COTmrInit(CO_TMR *tmr, CO_NODE *node, CO_TMR_MEM *mem, uint16_t num, uint32_t freq)
+{
+    COTmrLock(tmr);
+    tmr->Node  = node;
+    tmr->Max   = num;
+    tmr->APool = &mem->Act;
+    tmr->Freq  = freq;
+
+    COTmrReset(tmr);
+    COTmrUnlock(tmr);
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+WEAK_TEST
+int16_t COTmrCreate(CO_TMR      *tmr,
+                    uint32_t     startTicks,
+                    uint32_t     cycleTicks,
+                    CO_TMR_FUNC  func,
+                    void        *para)
+{
+    CO_TMR_ACTION *act;
+
+    if (tmr == 0) {
+        CONodeFatalError();
+        return -1;
+    }
+    if (startTicks == 0) {
+        startTicks = cycleTicks;
+    }
+    if ((startTicks == 0) &&
+        (cycleTicks == 0)) {
+        return -1;
+    }
+    if (tmr->Node == 0) {
+        CONodeFatalError();
+        return -1;
+    }
+    if (func == 0) {
+        tmr->Node->Error = CO_ERR_BAD_ARG;
+        return -1;
+    }
+
+    COTmrLock(tmr);
+    if (tmr->Acts == 0) {
+        tmr->Node->Error = CO_ERR_TMR_NO_ACT;
+        COTmrUnlock(tmr);
+        return -1;
+    }
+
+    act             = tmr->Acts;
+    tmr->Acts       = act->Next;
+    act->Next       = 0;
+    act->Func       = func;
+    act->Para       = para;
+    act->CycleTicks = cycleTicks;
+    COTmrInsert(tmr, startTicks, act);
+    COTmrUnlock(tmr);
+
+    return ((int16_t)act->Id);
+}
+
+WEAK_TEST
+int16_t COTmrDelete(CO_TMR *tmr, int16_t actId)
+{
+    CO_TMR_MEM    *mem;
+    CO_TMR_ACTION *act;
+    int16_t        result = -1;
+
+    if ( (actId < 0) ||
+         (actId >= (int16_t)(tmr->Max)) ) {
+        return -1;
+    }
+
+    COTmrLock(tmr);
+    mem = (CO_TMR_MEM *)tmr->APool;
+    act = &mem[actId].Act;
+    if (act->List != CO_TMR_LIST_FREE) {
+        COTmrUnlink(tmr, act);
+        act->CycleTicks = 0;
+        act->Para       = 0;
+        act->Func       = (CO_TMR_FUNC)0;
+        act->List       = CO_TMR_LIST_FREE;
+        act->Next       = tmr->Acts;
+        tmr->Acts       = act;
+        result          = 0;
+    }
+    COTmrUnlock(tmr);
+
+    return (result);
+}
+
+int16_t COTmrService(CO_TMR *tmr)
+{
+    CO_IF    *cif;
+    uint32_t  delta;
+    int16_t   result = 0;
+    int16_t   elapsed;
+
+    ASSERT_PTR_FATAL_ERR(tmr, -1);
+
+    cif = &tmr->Node->If;
+    elapsed = COIfTimerUpdate(cif);
+    if ((elapsed > 0) && (tmr->Run != 0)) {
+        /* move wheel to the time of the timer event */
+        tmr->Time = tmr->Next;
+        COTmrAdvance(tmr);
+
+        /* setup next timer event */
+        if (COTmrNextEvent(tmr, &delta) != 0) {
+            tmr->Next = tmr->Time + delta;
+            COIfTimerReload(cif, delta);
+        } else {
+            tmr->Run = 0;
+            COIfTimerStop(cif);
+        }
+        if (tmr->Elapsed != 0) {
+            result = 1;
+        }
+    }
+    return (result);
+}
+
+/*
+* see function definition
+*/
+void COTmrProcess(CO_TMR *tmr)
+{
+    CO_TMR_ACTION *act;
+    CO_TMR_FUNC    func;
+    void          *para;
+
+    while (tmr->Elapsed != 0) {
+        COTmrLock(tmr);
+        act  = tmr->Elapsed;
+        func = act->Func;
+        para = act->Para;
+        COTmrUnlink(tmr, act);
+        if (act->CycleTicks == 0) {
+            act->Para = 0;
+            act->Func = (CO_TMR_FUNC)0;
+            act->List = CO_TMR_LIST_FREE;
+            act->Next = tmr->Acts;
+            tmr->Acts = act;
+        } else {
+            COTmrInsert(tmr, act->CycleTicks, act);
+        }
+        COTmrUnlock(tmr);
+
+        /* execute callback function */
+        func(para);
+    }
+}
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void COTmrReset(CO_TMR *tmr)
+{
+    CO_TMR_MEM    *mem = (CO_TMR_MEM *)tmr->APool;
+    CO_TMR_ACTION *ap;
+    uint16_t       id;
+
+    for (id = 0; id < CO_TMR_WHEEL_LEVELS * CO_TMR_WHEEL_SLOTS; id++) {
+        tmr->Slot[id] = 0;
+    }
+    for (id = 0; id < CO_TMR_WHEEL_LEVELS; id++) {
+        tmr->Used[id] = 0;
+    }
+    tmr->Elapsed = 0;
+    tmr->Time    = 0;
+    tmr->Next    = 0;
+    tmr->Run     = 0;
+    tmr->Acts    = tmr->APool;
+
+    for (id = 0; id < tmr->Max; id++) {
+        ap = &mem[id].Act;
+        if ((uint32_t)id + 1u < tmr->Max) {
+            ap->Next = &mem[id + 1].Act;
+        } else {
+            ap->Next = 0;
+        }
+        ap->Prev       = 0;
+        ap->Id         = id;
+        ap->Func       = (CO_TMR_FUNC)0;
+        ap->Para       = 0;
+        ap->CycleTicks = 0;
+        ap->Expire     = 0;
+        ap->List       = CO_TMR_LIST_FREE;
+    }
+}
+
+static uint32_t COTmrNow(CO_TMR *tmr)
+{
+    uint32_t now = tmr->Time;
+
+    /* the driver counts down the ticks to the next timer event */
+    if (tmr->Run != 0) {
+        now = tmr->Next - COIfTimerDelay(&tmr->Node->If);
+    }
+    return (now);
+}
+
+static CO_TMR_ACTION **COTmrHead(CO_TMR *tmr, uint8_t list)
+{
+    CO_TMR_ACTION **head;
+
+    if (list == CO_TMR_LIST_ELAPSED) {
+        head = &tmr->Elapsed;
+    } else {
+        head = &tmr->Slot[list];
+    }
+    return (head);
+}
+
+static void COTmrLink(CO_TMR *tmr, CO_TMR_ACTION *act, uint8_t list)
+{
+    CO_TMR_ACTION **head;
+    CO_TMR_ACTION  *last;
+
+    head = COTmrHead(tmr, list);
+    if (*head == 0) {
+        act->Next = act;
+        act->Prev = act;
+        *head     = act;
+    } else {
+        /* append at end of circular list to keep the creation order */
+        last          = (*head)->Prev;
+        act->Next     = *head;
+        act->Prev     = last;
+        last->Next    = act;
+        (*head)->Prev = act;
+    }
+    act->List = list;
+    if (list != CO_TMR_LIST_ELAPSED) {
+        tmr->Used[list / CO_TMR_WHEEL_SLOTS] |=
+            (uint16_t)(1u << (list % CO_TMR_WHEEL_SLOTS));
+    }
+}
+
+static void COTmrUnlink(CO_TMR *tmr, CO_TMR_ACTION *act)
+{
+    CO_TMR_ACTION **head;
+
+    head = COTmrHead(tmr, act->List);
+    if (act->Next == act) {
+        *head = 0;
+        if (act->List != CO_TMR_LIST_ELAPSED) {
+            tmr->Used[act->List / CO_TMR_WHEEL_SLOTS] &=
+                (uint16_t)~(1u << (act->List % CO_TMR_WHEEL_SLOTS));
+        }
+    } else {
+        act->Prev->Next = act->Next;
+        act->Next->Prev = act->Prev;
+        if (*head == act) {
+            *head = act->Next;
+        }
+    }
+    act->Next = 0;
+    act->Prev = 0;
+}
+
+static void COTmrPlace(CO_TMR *tmr, CO_TMR_ACTION *act)
+{
+    uint32_t delta;
+    uint32_t diff;
+    uint32_t mask;
+    uint32_t shift;
+    uint32_t slot;
+    uint8_t  lvl;
+
+    /* select the lowest level, where the expiry is within one rotation */
+    delta = act->Expire - tmr->Time;
+    for (lvl = 0; lvl < CO_TMR_WHEEL_LEVELS; lvl++) {
+        shift = CO_TMR_SHIFT(lvl);
+        mask  = CO_TMR_MASK(lvl);
+        diff  = (delta >> shift) +
+                (((delta & mask) + (tmr->Time & mask)) >> shift);
+        if (diff < CO_TMR_WHEEL_SLOTS) {
+            break;
+        }
+    }
+    if (lvl == CO_TMR_WHEEL_LEVELS) {
+        /* a full rotation of the top level: expiry is in the current slot */
+        lvl   = CO_TMR_WHEEL_LEVELS - 1u;
+        shift = CO_TMR_SHIFT(lvl);
+        diff  = CO_TMR_WHEEL_SLOTS;
+    }
+    slot = ((tmr->Time >> shift) + diff) & (CO_TMR_WHEEL_SLOTS - 1u);
+    COTmrLink(tmr, act, (uint8_t)((lvl * CO_TMR_WHEEL_SLOTS) + slot));
+}
+
+static void COTmrInsert(CO_TMR *tmr, uint32_t ticks, CO_TMR_ACTION *act)
+{
+    CO_IF    *cif;
+    uint32_t  now;
+
+    cif         = &tmr->Node->If;
+    now         = COTmrNow(tmr);
+    act->Expire = now + ticks;
+    COTmrPlace(tmr, act);
+
+    if (tmr->Run == 0) {
+        tmr->Run  = 1;
+        tmr->Next = act->Expire;
+        COIfTimerReload(cif, ticks);
+        COIfTimerStart(cif);
+    } else if (ticks < (tmr->Next - now)) {
+        tmr->Next = act->Expire;
+        COIfTimerReload(cif, ticks);
+    }
+}
+
+static void COTmrAdvance(CO_TMR *tmr)
+{
+    CO_TMR_ACTION *act;
+    CO_TMR_ACTION *next;
+    uint32_t       slot;
+    uint8_t        list;
+    uint8_t        lvl;
+
+    /* cascade the slots holding the current time into lower levels; the
+     * slot of an action is given by its expiry, so each action is moved
+     * down at the latest when the wheel reaches its expiry time.
+     */
+    for (lvl = CO_TMR_WHEEL_LEVELS - 1u; lvl > 0; lvl--) {
+        slot = (tmr->Time >> CO_TMR_SHIFT(lvl)) & (CO_TMR_WHEEL_SLOTS - 1u);
+        list = (uint8_t)((lvl * CO_TMR_WHEEL_SLOTS) + slot);
+        act  = tmr->Slot[list];
+        if (act != 0) {
+            act->Prev->Next = 0;
+            tmr->Slot[list] = 0;
+            tmr->Used[lvl] &= (uint16_t)~(1u << slot);
+            while (act != 0) {
+                next = act->Next;
+                COTmrPlace(tmr, act);
+                act  = next;
+            }
+        }
+    }
+
+    /* move all actions of the current slot into the elapsed list */
+    list = (uint8_t)(tmr->Time & (CO_TMR_WHEEL_SLOTS - 1u));
+    act  = tmr->Slot[list];
+    if (act != 0) {
+        act->Prev->Next = 0;
+        tmr->Slot[list] = 0;
+        tmr->Used[0]   &= (uint16_t)~(1u << list);
+        while (act != 0) {
+            next = act->Next;
+            COTmrLink(tmr, act, CO_TMR_LIST_ELAPSED);
+            act  = next;
+        }
+    }
+}
+
+static uint8_t COTmrNextEvent(CO_TMR *tmr, uint32_t *delta)
+{
+    uint32_t used;
+    uint32_t start;
+    uint32_t dt;
+    uint32_t shift;
+    uint8_t  found = 0;
+    uint8_t  lvl;
+
+    for (lvl = 0; lvl < CO_TMR_WHEEL_LEVELS; lvl++) {
+        used = tmr->Used[lvl];
+        if (used == 0) {
+            continue;
+        }
+        /* rotate the slot after the current slot to bit 0 */
+        shift = CO_TMR_SHIFT(lvl);
+        start = ((tmr->Time >> shift) + 1u) & (CO_TMR_WHEEL_SLOTS - 1u);
+        used  = ((used >> start) | (used << (CO_TMR_WHEEL_SLOTS - start))) &
+                ((1u << CO_TMR_WHEEL_SLOTS) - 1u);
+
+        /* ticks until the start of the first used slot */
+        dt = ((uint32_t)(COTmrFirstSlot(used) + 1u) << shift) -
+             (tmr->Time & CO_TMR_MASK(lvl));
+        if ((found == 0) || (dt < *delta)) {
+            *delta = dt;
+            found  = 1;
+        }
+    }
+    return (found);
+}
+
+static uint8_t COTmrFirstSlot(uint32_t used)
+{
+#if defined(__GNUC__)
+    return ((uint8_t)__builtin_ctz(used));
+#else
+    uint8_t bit = 0;
+
+    while ((used & 1u) == 0) {
+        used >>= 1;
+        bit++;
+    }
+    return (bit);
+#endif
+}
+
+#endif /* USE_TMR_WHEEL */
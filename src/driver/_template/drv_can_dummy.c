@@ -33,12 +33,12 @@
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
-static void    DrvCanInit   (void);
-static void    DrvCanEnable (uint32_t baudrate);
-static int16_t DrvCanSend   (CO_IF_FRM *frm);
-static int16_t DrvCanRead   (CO_IF_FRM *frm);
-static void    DrvCanReset  (void);
-static void    DrvCanClose  (void);
+static void    DrvCanInit   (CO_IF *cif);
+static void    DrvCanEnable (CO_IF *cif, uint32_t baudrate);
+static int16_t DrvCanSend   (CO_IF *cif, CO_IF_FRM *frm);
+static int16_t DrvCanRead   (CO_IF *cif, CO_IF_FRM *frm);
+static void    DrvCanReset  (CO_IF *cif);
+static void    DrvCanClose  (CO_IF *cif);
 
 /******************************************************************************
 * PUBLIC VARIABLE
@@ -53,47 +53,58 @@ const CO_IF_CAN_DRV DummyCanDriver = {
     DrvCanRead,
     DrvCanSend,
     DrvCanReset,
-    DrvCanClose
+    DrvCanClose,
+    0,
+    0
 };
 
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
-static void DrvCanInit(void)
+static void DrvCanInit(CO_IF *cif)
 {
+    (void)cif;
+
     /* TODO: initialize the CAN controller (don't enable communication) */
 }
 
-static void DrvCanEnable(uint32_t baudrate)
+static void DrvCanEnable(CO_IF *cif, uint32_t baudrate)
 {
+    (void)cif;
     (void)baudrate;
 
     /* TODO: set the given baudrate to the CAN controller */
 }
 
-static int16_t DrvCanSend(CO_IF_FRM *frm)
+static int16_t DrvCanSend(CO_IF *cif, CO_IF_FRM *frm)
 {
+    (void)cif;
     (void)frm;
 
     /* TODO: wait for free CAN message slot and send the given CAN frame */
     return (0u);
 }
 
-static int16_t DrvCanRead (CO_IF_FRM *frm)
+static int16_t DrvCanRead (CO_IF *cif, CO_IF_FRM *frm)
 {
+    (void)cif;
     (void)frm;
 
     /* TODO: wait for a CAN frame and read CAN frame from the CAN controller */
     return (0u);
 }
 
-static void DrvCanReset(void)
+static void DrvCanReset(CO_IF *cif)
 {
+    (void)cif;
+
     /* TODO: reset CAN controller while keeping baudrate */
 }
 
-static void DrvCanClose(void)
+static void DrvCanClose(CO_IF *cif)
 {
+    (void)cif;
+
     /* TODO: remove CAN controller from CAN network */
 }
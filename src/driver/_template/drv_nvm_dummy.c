@@ -33,9 +33,9 @@
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
-static void     DrvNvmInit  (void);
-static uint32_t DrvNvmRead  (uint32_t start, uint8_t *buffer, uint32_t size);
-static uint32_t DrvNvmWrite (uint32_t start, uint8_t *buffer, uint32_t size);
+static void     DrvNvmInit  (CO_IF *cif);
+static uint32_t DrvNvmRead  (CO_IF *cif, uint32_t start, uint8_t *buffer, uint32_t size);
+static uint32_t DrvNvmWrite (CO_IF *cif, uint32_t start, uint8_t *buffer, uint32_t size);
 
 
 /******************************************************************************
@@ -55,13 +55,16 @@ const CO_IF_NVM_DRV DummyNvmDriver = {
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
-static void DrvNvmInit(void)
+static void DrvNvmInit(CO_IF *cif)
 {
+    (void)cif;
+
     /* TODO: initialize the non-volatile memory */
 }
 
-static uint32_t DrvNvmRead(uint32_t start, uint8_t *buffer, uint32_t size)
+static uint32_t DrvNvmRead(CO_IF *cif, uint32_t start, uint8_t *buffer, uint32_t size)
 {
+    (void)cif;
     (void)start;
     (void)buffer;
     (void)size;
@@ -70,8 +73,9 @@ static uint32_t DrvNvmRead(uint32_t start, uint8_t *buffer, uint32_t size)
     return (0u);
 }
 
-static uint32_t DrvNvmWrite(uint32_t start, uint8_t *buffer, uint32_t size)
+static uint32_t DrvNvmWrite(CO_IF *cif, uint32_t start, uint8_t *buffer, uint32_t size)
 {
+    (void)cif;
     (void)start;
     (void)buffer;
     (void)size;
@@ -33,12 +33,12 @@
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
-static void     DrvTimerInit   (uint32_t freq);
-static void     DrvTimerStart  (void);
-static uint8_t  DrvTimerUpdate (void);
-static uint32_t DrvTimerDelay  (void);
-static void     DrvTimerReload (uint32_t reload);
-static void     DrvTimerStop   (void);
+static void     DrvTimerInit   (CO_IF *cif, uint32_t freq);
+static void     DrvTimerStart  (CO_IF *cif);
+static uint8_t  DrvTimerUpdate (CO_IF *cif);
+static uint32_t DrvTimerDelay  (CO_IF *cif);
+static void     DrvTimerReload (CO_IF *cif, uint32_t reload);
+static void     DrvTimerStop   (CO_IF *cif);
 
 /******************************************************************************
 * PUBLIC VARIABLE
@@ -60,38 +60,48 @@ const CO_IF_TIMER_DRV DummyTimerDriver = {
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
-static void DrvTimerInit(uint32_t freq)
+static void DrvTimerInit(CO_IF *cif, uint32_t freq)
 {
+    (void)cif;
     (void)freq;
 
     /* TODO: initialize timer, clear counter and keep timer stopped */
 }
 
-static void DrvTimerStart(void)
+static void DrvTimerStart(CO_IF *cif)
 {
+    (void)cif;
+
     /* TODO: start hardware timer */
 }
 
-static uint8_t DrvTimerUpdate(void)
+static uint8_t DrvTimerUpdate(CO_IF *cif)
 {
+    (void)cif;
+
     /* TODO: return 1 if timer event is elapsed, otherwise 0 */
     return (0u);
 }
 
-static uint32_t DrvTimerDelay(void)
+static uint32_t DrvTimerDelay(CO_IF *cif)
 {
+    (void)cif;
+
     /* TODO: return current timer counter value */
     return (0u);
 }
 
-static void DrvTimerReload(uint32_t reload)
+static void DrvTimerReload(CO_IF *cif, uint32_t reload)
 {
+    (void)cif;
     (void)reload;
 
     /* TODO: reload timer counter value with given reload value */
 }
 
-static void DrvTimerStop(void)
+static void DrvTimerStop(CO_IF *cif)
 {
+    (void)cif;
+
     /* TODO: stop timer and clear counter value */
 }
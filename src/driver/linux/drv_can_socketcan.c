@@ -0,0 +1,476 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE                   /* recvmmsg() and sendmmsg()           */
+#endif
+
+#include <errno.h>
+#include <poll.h>
+#include <string.h>
+#include <unistd.h>
+#include <net/if.h>
+#include <sys/ioctl.h>
+#include <sys/socket.h>
+#include <linux/can/raw.h>
+#include <linux/net_tstamp.h>
+
+#include "drv_can_socketcan.h"
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define SOCKET_CAN_STD_MASK   (CAN_SFF_MASK | CAN_EFF_FLAG | CAN_RTR_FLAG)
+#define SOCKET_CAN_EXT_MASK   (CAN_EFF_MASK | CAN_EFF_FLAG | CAN_RTR_FLAG)
+#define SOCKET_CAN_STD_MAX    ((uint32_t)0x7FF)
+
+#define SOCKET_CAN_TSTAMP     (SOF_TIMESTAMPING_RX_HARDWARE | \
+                               SOF_TIMESTAMPING_RX_SOFTWARE | \
+                               SOF_TIMESTAMPING_SOFTWARE    | \
+                               SOF_TIMESTAMPING_RAW_HARDWARE)
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+/* control message buffer for the receive timestamps and the drop counter */
+typedef union SOCKET_CAN_CTL_T {
+    struct cmsghdr Align;
+    char           Buf[CMSG_SPACE(3 * sizeof(struct timespec)) +
+                       CMSG_SPACE(sizeof(uint32_t))];
+} SOCKET_CAN_CTL;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void    DrvCanInit     (CO_IF *cif);
+static void    DrvCanEnable   (CO_IF *cif, uint32_t baudrate);
+static int16_t DrvCanSend     (CO_IF *cif, CO_IF_FRM *frm);
+static int16_t DrvCanRead     (CO_IF *cif, CO_IF_FRM *frm);
+static void    DrvCanReset    (CO_IF *cif);
+static void    DrvCanClose    (CO_IF *cif);
+static int16_t DrvCanReadBatch(CO_IF *cif, CO_IF_FRM *frm, uint16_t max);
+static int16_t DrvCanSendBatch(CO_IF *cif, CO_IF_FRM *frm, uint16_t num);
+
+static int16_t SocketCanFill   (SOCKET_CAN *can);
+static uint8_t SocketCanPop    (SOCKET_CAN *can, CO_IF_FRM *frm, uint64_t *stamp);
+static int16_t SocketCanApply  (SOCKET_CAN *can);
+static int16_t SocketCanBuild  (CO_IF *cif);
+static void    SocketCanStamp  (SOCKET_CAN *can, uint16_t idx, struct msghdr *hdr);
+
+/******************************************************************************
+* PUBLIC VARIABLE
+******************************************************************************/
+
+const CO_IF_CAN_DRV SocketCanDriver = {
+    DrvCanInit,
+    DrvCanEnable,
+    DrvCanRead,
+    DrvCanSend,
+    DrvCanReset,
+    DrvCanClose,
+    DrvCanReadBatch,
+    DrvCanSendBatch
+};
+
+/******************************************************************************
+* SPECIAL PUBLIC DRIVER FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t SocketCanFilter(CO_IF *cif, const uint32_t *id, uint16_t num)
+{
+    SOCKET_CAN *can = (SOCKET_CAN *)CO_IF_CTX(cif);
+    uint16_t    n;
+
+    for (n = 0; (n < num) && (n < SOCKET_CAN_FILTER_N); n++) {
+        can->Id[n] = id[n];
+    }
+    can->IdNum   = num;
+    can->Refresh = 1u;
+    return (SocketCanBuild(cif));
+}
+
+/*
+* see function definition
+*/
+void SocketCanRefresh(CO_IF *cif)
+{
+#if USE_DISP
+    SOCKET_CAN *can = (SOCKET_CAN *)CO_IF_CTX(cif);
+
+    if ((can->Refresh != 0u) && (cif->Node->Disp.Dirty != 0u)) {
+        CODispBuild(&cif->Node->Disp);
+        (void)SocketCanBuild(cif);
+    }
+#else
+    CO_UNUSED(cif);
+#endif
+}
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void DrvCanInit(CO_IF *cif)
+{
+    SOCKET_CAN  *can = (SOCKET_CAN *)CO_IF_CTX(cif);
+    struct ifreq ifr;
+    struct sockaddr_can addr;
+    int          opt;
+    int          old = can->Fd;
+
+    can->RxNum = 0;
+    can->RxPos = 0;
+    can->Drops = 0;
+
+    /* open the new socket first, so a re-initialization gets a new file
+     * descriptor number (epoll sets are watching the number)
+     */
+    can->Fd = socket(PF_CAN, SOCK_RAW | SOCK_NONBLOCK | SOCK_CLOEXEC, CAN_RAW);
+    if (old >= 0) {
+        (void)close(old);
+    }
+    if (can->Fd < 0) {
+        can->Fd = -1;
+        return;
+    }
+
+    /* don't receive any frame until the interface is enabled */
+    (void)setsockopt(can->Fd, SOL_CAN_RAW, CAN_RAW_FILTER, NULL, 0);
+
+    opt = SOCKET_CAN_TSTAMP;
+    (void)setsockopt(can->Fd, SOL_SOCKET, SO_TIMESTAMPING, &opt, sizeof(opt));
+    opt = 1;
+    (void)setsockopt(can->Fd, SOL_SOCKET, SO_RXQ_OVFL, &opt, sizeof(opt));
+
+    memset(&ifr, 0, sizeof(ifr));
+    strncpy(ifr.ifr_name, can->Name, IFNAMSIZ - 1);
+    memset(&addr, 0, sizeof(addr));
+    addr.can_family = AF_CAN;
+    if ((ioctl(can->Fd, SIOCGIFINDEX, &ifr) < 0) ||
+        (bind(can->Fd, (struct sockaddr *)&addr, sizeof(addr)) < 0)) {
+        (void)close(can->Fd);
+        can->Fd = -1;
+        return;
+    }
+}
+
+static void DrvCanEnable(CO_IF *cif, uint32_t baudrate)
+{
+    SOCKET_CAN *can = (SOCKET_CAN *)CO_IF_CTX(cif);
+
+    /* the bitrate is a property of the network interface, which is set
+     * by the system (e.g. ip link set can0 type can bitrate 250000)
+     */
+    (void)baudrate;
+    (void)SocketCanApply(can);
+}
+
+static int16_t DrvCanSend(CO_IF *cif, CO_IF_FRM *frm)
+{
+    int16_t result;
+
+    result = DrvCanSendBatch(cif, frm, 1);
+    if (result > 0) {
+        result = (int16_t)sizeof(CO_IF_FRM);
+    } else {
+        result = (int16_t)-1;
+    }
+    return (result);
+}
+
+static int16_t DrvCanRead(CO_IF *cif, CO_IF_FRM *frm)
+{
+    SOCKET_CAN *can = (SOCKET_CAN *)CO_IF_CTX(cif);
+
+    SocketCanRefresh(cif);
+    if (can->RxPos >= can->RxNum) {
+        if (SocketCanFill(can) < 0) {
+            return ((int16_t)-1);
+        }
+    }
+    if (SocketCanPop(can, frm, &can->Stamp[0]) == 0u) {
+        return (0);
+    }
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static int16_t DrvCanReadBatch(CO_IF *cif, CO_IF_FRM *frm, uint16_t max)
+{
+    SOCKET_CAN *can = (SOCKET_CAN *)CO_IF_CTX(cif);
+    uint16_t    num = 0;
+
+    if (max > SOCKET_CAN_BATCH_N) {
+        max = SOCKET_CAN_BATCH_N;
+    }
+    SocketCanRefresh(cif);
+    if (can->RxPos >= can->RxNum) {
+        if (SocketCanFill(can) < 0) {
+            return ((int16_t)-1);
+        }
+    }
+    while ((num < max) && (SocketCanPop(can, &frm[num], &can->Stamp[num]) != 0u)) {
+        num++;
+    }
+    return ((int16_t)num);
+}
+
+static int16_t DrvCanSendBatch(CO_IF *cif, CO_IF_FRM *frm, uint16_t num)
+{
+    SOCKET_CAN      *can  = (SOCKET_CAN *)CO_IF_CTX(cif);
+    struct can_frame cf[SOCKET_CAN_BATCH_N];
+    struct iovec     vec[SOCKET_CAN_BATCH_N];
+    struct mmsghdr   msg[SOCKET_CAN_BATCH_N];
+    struct pollfd    pfd;
+    uint16_t         sent = 0;
+    uint16_t         chunk;
+    uint16_t         done;
+    uint16_t         n;
+    int              err;
+
+    if (can->Fd < 0) {
+        return ((int16_t)-1);
+    }
+    SocketCanRefresh(cif);
+    while (sent < num) {
+        chunk = num - sent;
+        if (chunk > SOCKET_CAN_BATCH_N) {
+            chunk = SOCKET_CAN_BATCH_N;
+        }
+        memset(&msg[0], 0, chunk * sizeof(struct mmsghdr));
+        for (n = 0; n < chunk; n++) {
+            memset(&cf[n], 0, sizeof(struct can_frame));
+            cf[n].can_id = frm[sent + n].Identifier;
+            if (cf[n].can_id > SOCKET_CAN_STD_MAX) {
+                cf[n].can_id |= CAN_EFF_FLAG;
+            }
+            cf[n].can_dlc = frm[sent + n].DLC;
+            memcpy(&cf[n].data[0], &frm[sent + n].Data[0], 8);
+            vec[n].iov_base           = &cf[n];
+            vec[n].iov_len            = sizeof(struct can_frame);
+            msg[n].msg_hdr.msg_iov    = &vec[n];
+            msg[n].msg_hdr.msg_iovlen = 1;
+        }
+
+        done = 0;
+        while (done < chunk) {
+            err = sendmmsg(can->Fd, &msg[done], chunk - done, MSG_DONTWAIT);
+            if (err > 0) {
+                done += (uint16_t)err;
+                continue;
+            }
+            /* transmit queue is full: wait for free space */
+            pfd.fd     = can->Fd;
+            pfd.events = POLLOUT;
+            if ((err < 0) &&
+                ((errno == EAGAIN) || (errno == ENOBUFS)) &&
+                (poll(&pfd, 1, SOCKET_CAN_TX_TIMEOUT) > 0)) {
+                continue;
+            }
+            sent += done;
+            return ((sent > 0) ? (int16_t)sent : (int16_t)-1);
+        }
+        sent += chunk;
+    }
+    return ((int16_t)sent);
+}
+
+static void DrvCanReset(CO_IF *cif)
+{
+    DrvCanInit(cif);
+    DrvCanEnable(cif, 0);
+}
+
+static void DrvCanClose(CO_IF *cif)
+{
+    SOCKET_CAN *can = (SOCKET_CAN *)CO_IF_CTX(cif);
+
+    if (can->Fd >= 0) {
+        (void)close(can->Fd);
+    }
+    can->Fd    = -1;
+    can->RxNum = 0;
+    can->RxPos = 0;
+}
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+
+/* Read all available CAN frames (up to the batch size) with a single
+ * system call into the receive buffer. The buffer must be empty.
+ */
+static int16_t SocketCanFill(SOCKET_CAN *can)
+{
+    struct iovec   vec[SOCKET_CAN_BATCH_N];
+    struct mmsghdr msg[SOCKET_CAN_BATCH_N];
+    SOCKET_CAN_CTL ctl[SOCKET_CAN_BATCH_N];
+    uint16_t       n;
+    int            num;
+
+    can->RxNum = 0;
+    can->RxPos = 0;
+    if (can->Fd < 0) {
+        return ((int16_t)-1);
+    }
+    memset(&msg[0], 0, sizeof(msg));
+    for (n = 0; n < SOCKET_CAN_BATCH_N; n++) {
+        vec[n].iov_base               = &can->RxFrm[n];
+        vec[n].iov_len                = sizeof(struct can_frame);
+        msg[n].msg_hdr.msg_iov        = &vec[n];
+        msg[n].msg_hdr.msg_iovlen     = 1;
+        msg[n].msg_hdr.msg_control    = &ctl[n].Buf[0];
+        msg[n].msg_hdr.msg_controllen = sizeof(ctl[n].Buf);
+    }
+
+    num = recvmmsg(can->Fd, &msg[0], SOCKET_CAN_BATCH_N, MSG_DONTWAIT, NULL);
+    if (num < 0) {
+        if ((errno == EAGAIN) || (errno == EWOULDBLOCK) || (errno == EINTR)) {
+            return (0);
+        }
+        return ((int16_t)-1);
+    }
+    for (n = 0; n < (uint16_t)num; n++) {
+        if (msg[n].msg_len != sizeof(struct can_frame)) {
+            can->RxFrm[n].can_id = CAN_ERR_FLAG;     /* skip incomplete frame */
+        }
+        SocketCanStamp(can, n, &msg[n].msg_hdr);
+    }
+    can->RxNum = (uint16_t)num;
+    return ((int16_t)num);
+}
+
+/* Take the next data frame out of the receive buffer. Remote and error
+ * frames are not used by CANopen and skipped.
+ */
+static uint8_t SocketCanPop(SOCKET_CAN *can, CO_IF_FRM *frm, uint64_t *stamp)
+{
+    struct can_frame *cf;
+
+    while (can->RxPos < can->RxNum) {
+        cf = &can->RxFrm[can->RxPos];
+        *stamp = can->RxTime[can->RxPos];
+        can->RxPos++;
+        if ((cf->can_id & (CAN_RTR_FLAG | CAN_ERR_FLAG)) != 0u) {
+            continue;
+        }
+        if ((cf->can_id & CAN_EFF_FLAG) != 0u) {
+            frm->Identifier = cf->can_id & CAN_EFF_MASK;
+        } else {
+            frm->Identifier = cf->can_id & CAN_SFF_MASK;
+        }
+        frm->DLC = cf->can_dlc;
+        memcpy(&frm->Data[0], &cf->data[0], 8);
+        return (1u);
+    }
+    return (0u);
+}
+
+/* Install the kernel CAN filter. Without filter table all frames are
+ * received.
+ */
+static int16_t SocketCanApply(SOCKET_CAN *can)
+{
+    struct can_filter all = { 0, 0 };
+    int               err;
+
+    if (can->Fd < 0) {
+        return ((int16_t)-1);
+    }
+    if (can->FilterNum > 0) {
+        err = setsockopt(can->Fd, SOL_CAN_RAW, CAN_RAW_FILTER,
+                         &can->Filter[0], can->FilterNum * sizeof(struct can_filter));
+    } else {
+        err = setsockopt(can->Fd, SOL_CAN_RAW, CAN_RAW_FILTER,
+                         &all, sizeof(all));
+    }
+    return ((err < 0) ? (int16_t)-1 : 0);
+}
+
+/* Collect the receive CAN-IDs of the node and the additional CAN-IDs of
+ * the application and install them as kernel filters.
+ */
+static int16_t SocketCanBuild(CO_IF *cif)
+{
+    SOCKET_CAN *can = (SOCKET_CAN *)CO_IF_CTX(cif);
+    uint32_t    cobid[SOCKET_CAN_FILTER_N];
+    uint16_t    total;
+    uint16_t    n;
+
+    total = CODispGetIds(&cif->Node->Disp, &cobid[0], SOCKET_CAN_FILTER_N);
+    for (n = 0; n < can->IdNum; n++) {
+        if ((total < SOCKET_CAN_FILTER_N) && (n < SOCKET_CAN_FILTER_N)) {
+            cobid[total] = can->Id[n];
+        }
+        total++;
+    }
+
+    can->FilterNum = 0;
+    if (total <= SOCKET_CAN_FILTER_N) {
+        for (n = 0; n < total; n++) {
+            if (cobid[n] > SOCKET_CAN_STD_MAX) {
+                can->Filter[n].can_id   = cobid[n] | CAN_EFF_FLAG;
+                can->Filter[n].can_mask = SOCKET_CAN_EXT_MASK;
+            } else {
+                can->Filter[n].can_id   = cobid[n];
+                can->Filter[n].can_mask = SOCKET_CAN_STD_MASK;
+            }
+        }
+        can->FilterNum = total;
+    }
+    if (SocketCanApply(can) < 0) {
+        return (-1);
+    }
+    return ((int16_t)can->FilterNum);
+}
+
+/* Get the receive timestamp and the drop counter of a received frame. The
+ * raw hardware timestamp is preferred, when the CAN controller supports it.
+ */
+static void SocketCanStamp(SOCKET_CAN *can, uint16_t idx, struct msghdr *hdr)
+{
+    struct cmsghdr  *cmsg;
+    struct timespec  ts[3];
+    struct timespec *use;
+
+    can->RxTime[idx] = 0;
+    for (cmsg = CMSG_FIRSTHDR(hdr); cmsg != NULL; cmsg = CMSG_NXTHDR(hdr, cmsg)) {
+        if (cmsg->cmsg_level != SOL_SOCKET) {
+            continue;
+        }
+        if (cmsg->cmsg_type == SO_TIMESTAMPING) {
+            memcpy(&ts[0], CMSG_DATA(cmsg), sizeof(ts));
+            use = &ts[0];
+            if ((ts[2].tv_sec != 0) || (ts[2].tv_nsec != 0)) {
+                use = &ts[2];
+            }
+            can->RxTime[idx] = (uint64_t)use->tv_sec * 1000000000u +
+                               (uint64_t)use->tv_nsec;
+        } else if (cmsg->cmsg_type == SO_RXQ_OVFL) {
+            memcpy(&can->Drops, CMSG_DATA(cmsg), sizeof(uint32_t));
+        }
+    }
+}
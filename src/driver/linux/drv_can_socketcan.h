@@ -0,0 +1,157 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_CAN_SOCKETCAN_H_
+#define CO_CAN_SOCKETCAN_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <linux/can.h>
+
+#include "co_if.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+/*! \brief BATCH SIZE
+*
+*    This define holds the maximal number of CAN frames, which are read or
+*    written with a single recvmmsg() or sendmmsg() system call.
+*/
+#ifndef SOCKET_CAN_BATCH_N
+#define SOCKET_CAN_BATCH_N      32u
+#endif
+
+/*! \brief KERNEL FILTER SIZE
+*
+*    This define holds the maximal number of kernel CAN filters. When more
+*    receive CAN-IDs are requested, all CAN frames are received.
+*/
+#ifndef SOCKET_CAN_FILTER_N
+#define SOCKET_CAN_FILTER_N     64u
+#endif
+
+/*! \brief TRANSMIT TIMEOUT
+*
+*    This define holds the maximal time in milliseconds to wait for free
+*    space in the transmit queue of the network interface.
+*/
+#ifndef SOCKET_CAN_TX_TIMEOUT
+#define SOCKET_CAN_TX_TIMEOUT   10
+#endif
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief SOCKETCAN INTERFACE
+*
+*    This structure holds the state of a single SocketCAN network interface.
+*    The structure is the driver context (member Ctx of CO_IF_DRV), or the
+*    first member of it (see drv_linux_io.h); the application sets the
+*    member Name and the member Fd to -1 (no socket) before the node
+*    initialization. The socket is non-blocking
+*    and can be added to an epoll set of the application with the member Fd.
+*    The member Stamp holds the kernel (or hardware, when supported by the
+*    CAN controller) receive timestamps of the CAN frames, which are returned
+*    by the last call of the driver function Read (index 0) or ReadBatch.
+*    The members Id, IdNum and Refresh keep the additional CAN-IDs of the
+*    last call of SocketCanFilter() for refreshing the kernel filter.
+*/
+typedef struct SOCKET_CAN_T {
+    const char        *Name;                         /*!< interface name     */
+    int                Fd;                           /*!< CAN_RAW socket     */
+    uint16_t           FilterNum;                    /*!< used kernel filter */
+    struct can_filter  Filter[SOCKET_CAN_FILTER_N];  /*!< kernel CAN filter  */
+    uint32_t           Id[SOCKET_CAN_FILTER_N];      /*!< additional CAN-IDs */
+    uint16_t           IdNum;                        /*!< additional CAN-IDs */
+    uint8_t            Refresh;                      /*!< follow CAN-ID chg. */
+    uint16_t           RxNum;                        /*!< buffered frames    */
+    uint16_t           RxPos;                        /*!< next buffered frame*/
+    struct can_frame   RxFrm[SOCKET_CAN_BATCH_N];    /*!< receive buffer     */
+    uint64_t           RxTime[SOCKET_CAN_BATCH_N];   /*!< receive time in ns */
+    uint64_t           Stamp[SOCKET_CAN_BATCH_N];    /*!< time of read frames*/
+    uint32_t           Drops;                        /*!< kernel dropped rx  */
+
+} SOCKET_CAN;
+
+/******************************************************************************
+* PUBLIC SYMBOLS
+******************************************************************************/
+
+extern const CO_IF_CAN_DRV SocketCanDriver;
+
+/******************************************************************************
+* SPECIAL PUBLIC DRIVER FUNCTIONS
+******************************************************************************/
+
+/*! \brief  SET KERNEL CAN FILTER
+*
+*    This function installs kernel CAN filters for the receive CAN-IDs of
+*    all enabled services of the node and the given additional CAN-IDs,
+*    e.g. for application frames handled in COIfCanReceive(). The function
+*    should be called after starting the node. Afterwards, the driver
+*    follows changes of receive CAN-IDs (e.g. RPDO communication parameters
+*    written via SDO, or COCSdoSetServer()): when the dispatch table of the
+*    node is marked for rebuild, the driver rebuilds it and re-installs the
+*    kernel filters with the same additional CAN-IDs before the next read
+*    or send (see SocketCanRefresh()). Without the dispatch table (USE_DISP = 0), the function must
+*    be called again after changing receive CAN-IDs. When the filter table
+*    is too small, the filter is removed and all CAN frames are received.
+*
+* \param cif
+*    pointer to the interface structure of the node
+*
+* \param id
+*    pointer to additional CAN-IDs (may be 0, if num is 0)
+*
+* \param num
+*    number of additional CAN-IDs
+*
+* \retval  >0    number of installed kernel filters
+* \retval  =0    all CAN frames are received
+* \retval  <0    error while installing the filters
+*/
+int16_t SocketCanFilter(CO_IF *cif, const uint32_t *id, uint16_t num);
+
+/*! \brief  REFRESH KERNEL CAN FILTER
+*
+*    This function re-installs the kernel CAN filters, when the receive
+*    CAN-IDs of the node are changed since the last call (the dispatch
+*    table is marked for rebuild; the table is rebuilt by this function).
+*    The driver calls this function before each read and send. An
+*    application, which waits for CAN frames on the socket (e.g. with
+*    LinuxIoProcess()), calls it before waiting, so a receive CAN-ID
+*    changed by the application itself is not filtered by the kernel.
+*    Nothing is done until SocketCanFilter() is called.
+*
+* \param cif
+*    pointer to the interface structure of the node
+*/
+void SocketCanRefresh(CO_IF *cif);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
@@ -0,0 +1,359 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <unistd.h>
+#include <sys/eventfd.h>
+
+#include "drv_csdo_wait.h"
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void CSdoWaitWake  (CSDO_WAIT *w);
+static void CSdoWaitDone  (CSDO_WAIT *w, CSDO_WAIT_REQ *req, uint32_t code);
+static void CSdoWaitFinish(CO_CSDO *csdo, uint16_t index, uint8_t sub, uint32_t code);
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t CSdoWaitInit(CSDO_WAIT *w, CO_CSDO_QUEUE *q)
+{
+    if (q->Ctx != NULL) {
+        return ((int16_t)-1);
+    }
+    w->Queue   = q;
+    w->Head    = NULL;
+    w->Tail    = NULL;
+    w->Act     = NULL;
+    w->ActTail = NULL;
+    w->Stall   = 0;
+    w->Closed  = 0;
+    w->Fd      = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    if (w->Fd < 0) {
+        return ((int16_t)-1);
+    }
+    if (pthread_mutex_init(&w->Lock, NULL) != 0) {
+        (void)close(w->Fd);
+        w->Fd = -1;
+        return ((int16_t)-1);
+    }
+    q->Ctx = w;
+    return (0);
+}
+
+/*
+* see function definition
+*/
+uint16_t CSdoWaitProcess(CSDO_WAIT *w)
+{
+    CSDO_WAIT_REQ *req;
+    CSDO_WAIT_REQ *next;
+    uint64_t       cnt;
+    uint16_t       result = 0;
+    CO_ERR         err;
+
+    /* clear wakeup before taking the posted requests; later posts wake again */
+    (void)read(w->Fd, &cnt, sizeof(cnt));
+
+    (void)pthread_mutex_lock(&w->Lock);
+    req     = w->Head;
+    w->Head = NULL;
+    w->Tail = NULL;
+    (void)pthread_mutex_unlock(&w->Lock);
+
+    w->Stall = 0;
+    while (req != NULL) {
+        next = req->Next;
+        if (req->Dir == CO_CSDO_QUEUE_UPLOAD) {
+            err = COCSdoQueueUpload(w->Queue, req->NodeId, req->Key, req->Buf,
+                                    req->Size, &CSdoWaitFinish, req->Tmt);
+        } else {
+            err = COCSdoQueueDownload(w->Queue, req->NodeId, req->Key, req->Buf,
+                                      req->Size, &CSdoWaitFinish, req->Tmt);
+        }
+        if (err == CO_ERR_CSDO_QUEUE) {
+            break;
+        }
+        if (err != CO_ERR_NONE) {
+            CSdoWaitDone(w, req, CO_SDO_ERR_GENERAL);
+        } else {
+            req->Next = NULL;
+            if (w->ActTail == NULL) {
+                w->Act = req;
+            } else {
+                w->ActTail->Next = req;
+            }
+            w->ActTail = req;
+            result++;
+        }
+        req = next;
+    }
+
+    /* keep the remaining requests posted in front of the newer posts */
+    if (req != NULL) {
+        w->Stall = 1;
+        (void)pthread_mutex_lock(&w->Lock);
+        next = req;
+        while (next->Next != NULL) {
+            next = next->Next;
+        }
+        next->Next = w->Head;
+        if (w->Head == NULL) {
+            w->Tail = next;
+        }
+        w->Head = req;
+        (void)pthread_mutex_unlock(&w->Lock);
+    }
+    return (result);
+}
+
+/*
+* see function definition
+*/
+CO_ERR CSdoWaitStart(CSDO_WAIT *w,
+                     CSDO_WAIT_REQ *req,
+                     uint8_t dir,
+                     uint8_t nodeId,
+                     uint32_t key,
+                     uint8_t *buf,
+                     uint32_t size,
+                     uint32_t timeout)
+{
+    if ((w    == NULL) || (req    == NULL) || (buf    == NULL) ||
+        (size == 0u  ) || (nodeId <  1u  ) || (nodeId >  127u) ||
+        ((dir != CO_CSDO_QUEUE_UPLOAD) && (dir != CO_CSDO_QUEUE_DOWNLOAD))) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if (pthread_cond_init(&req->Cond, NULL) != 0) {
+        return (CO_ERR_BAD_ARG);
+    }
+    req->Next   = NULL;
+    req->Buf    = buf;
+    req->Key    = key;
+    req->Size   = size;
+    req->Tmt    = timeout;
+    req->Code   = 0;
+    req->NodeId = nodeId;
+    req->Dir    = dir;
+    req->Done   = 0;
+
+    (void)pthread_mutex_lock(&w->Lock);
+    if (w->Closed != 0u) {
+        (void)pthread_mutex_unlock(&w->Lock);
+        (void)pthread_cond_destroy(&req->Cond);
+        return (CO_ERR_SDO_OFF);
+    }
+    if (w->Tail == NULL) {
+        w->Head = req;
+    } else {
+        w->Tail->Next = req;
+    }
+    w->Tail = req;
+    (void)pthread_mutex_unlock(&w->Lock);
+
+    CSdoWaitWake(w);
+    return (CO_ERR_NONE);
+}
+
+/*
+* see function definition
+*/
+uint32_t CSdoWaitEnd(CSDO_WAIT *w, CSDO_WAIT_REQ *req)
+{
+    uint32_t code;
+
+    (void)pthread_mutex_lock(&w->Lock);
+    while (req->Done == 0u) {
+        (void)pthread_cond_wait(&req->Cond, &w->Lock);
+    }
+    code = req->Code;
+    (void)pthread_mutex_unlock(&w->Lock);
+    (void)pthread_cond_destroy(&req->Cond);
+
+    return (code);
+}
+
+/*
+* see function definition
+*/
+CO_ERR CSdoWaitUpload(CSDO_WAIT *w,
+                      uint8_t nodeId,
+                      uint32_t key,
+                      uint8_t *buf,
+                      uint32_t size,
+                      uint32_t timeout,
+                      uint32_t *code)
+{
+    CSDO_WAIT_REQ req;
+    uint32_t      abort;
+    CO_ERR        err;
+
+    err = CSdoWaitStart(w, &req, CO_CSDO_QUEUE_UPLOAD, nodeId, key, buf, size, timeout);
+    if (err != CO_ERR_NONE) {
+        return (err);
+    }
+    abort = CSdoWaitEnd(w, &req);
+    if (code != NULL) {
+        *code = abort;
+    }
+    return ((abort == 0u) ? CO_ERR_NONE : CO_ERR_SDO_ABORT);
+}
+
+/*
+* see function definition
+*/
+CO_ERR CSdoWaitDownload(CSDO_WAIT *w,
+                        uint8_t nodeId,
+                        uint32_t key,
+                        uint8_t *buf,
+                        uint32_t size,
+                        uint32_t timeout,
+                        uint32_t *code)
+{
+    CSDO_WAIT_REQ req;
+    uint32_t      abort;
+    CO_ERR        err;
+
+    err = CSdoWaitStart(w, &req, CO_CSDO_QUEUE_DOWNLOAD, nodeId, key, buf, size, timeout);
+    if (err != CO_ERR_NONE) {
+        return (err);
+    }
+    abort = CSdoWaitEnd(w, &req);
+    if (code != NULL) {
+        *code = abort;
+    }
+    return ((abort == 0u) ? CO_ERR_NONE : CO_ERR_SDO_ABORT);
+}
+
+/*
+* see function definition
+*/
+void CSdoWaitClose(CSDO_WAIT *w)
+{
+    CSDO_WAIT_REQ *req;
+    CSDO_WAIT_REQ *next;
+
+    if (w->Queue->Ctx == w) {
+        w->Queue->Ctx = NULL;
+    }
+    (void)pthread_mutex_lock(&w->Lock);
+    w->Closed = 1;
+    req       = w->Head;
+    w->Head   = NULL;
+    w->Tail   = NULL;
+    (void)pthread_mutex_unlock(&w->Lock);
+
+    while (req != NULL) {
+        next = req->Next;
+        CSdoWaitDone(w, req, CO_SDO_ERR_GENERAL);
+        req = next;
+    }
+    req        = w->Act;
+    w->Act     = NULL;
+    w->ActTail = NULL;
+    while (req != NULL) {
+        next = req->Next;
+        CSdoWaitDone(w, req, CO_SDO_ERR_GENERAL);
+        req = next;
+    }
+    if (w->Fd >= 0) {
+        (void)close(w->Fd);
+    }
+    w->Fd = -1;
+}
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+
+/* Wake up the node thread. The eventfd counter can't overflow, because the
+ * node thread clears the counter with each processing.
+ */
+static void CSdoWaitWake(CSDO_WAIT *w)
+{
+    uint64_t one = 1;
+
+    (void)write(w->Fd, &one, sizeof(one));
+}
+
+/* Store the end of the transfer and wake up the waiting thread. The request
+ * belongs to the waiting thread again, as soon as the lock is released.
+ */
+static void CSdoWaitDone(CSDO_WAIT *w, CSDO_WAIT_REQ *req, uint32_t code)
+{
+    (void)pthread_mutex_lock(&w->Lock);
+    req->Code = code;
+    req->Done = 1;
+    (void)pthread_cond_signal(&req->Cond);
+    (void)pthread_mutex_unlock(&w->Lock);
+}
+
+/* The request queue executes the requests to a single SDO server one after
+ * the other in the order of the queue, so the finished transfer is the
+ * oldest queued request to the SDO server of the SDO client. The blocking
+ * SDO client is the context of the request queue; it is unlinked, when
+ * the blocking SDO client is closed.
+ */
+static void CSdoWaitFinish(CO_CSDO *csdo, uint16_t index, uint8_t sub, uint32_t code)
+{
+    CSDO_WAIT     *w;
+    CSDO_WAIT_REQ *prev = NULL;
+    CSDO_WAIT_REQ *req;
+
+    CO_UNUSED(index);
+    CO_UNUSED(sub);
+
+    if (csdo->Req == NULL) {
+        return;
+    }
+    w = (CSDO_WAIT *)csdo->Req->Queue->Ctx;
+    if (w == NULL) {
+        return;
+    }
+    req = w->Act;
+    while ((req != NULL) && (req->NodeId != csdo->NodeId)) {
+        prev = req;
+        req  = req->Next;
+    }
+    if (req == NULL) {
+        return;
+    }
+
+    if (prev == NULL) {
+        w->Act = req->Next;
+    } else {
+        prev->Next = req->Next;
+    }
+    if (w->ActTail == req) {
+        w->ActTail = prev;
+    }
+    CSdoWaitDone(w, req, code);
+
+    /* a request memory of the queue is free again */
+    if (w->Stall != 0u) {
+        w->Stall = 0;
+        CSdoWaitWake(w);
+    }
+}
@@ -0,0 +1,281 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_CSDO_WAIT_H_
+#define CO_CSDO_WAIT_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <pthread.h>
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief WAITING SDO CLIENT REQUEST
+*
+*    This structure holds a single SDO transfer of an application thread.
+*    The structure is the future of the transfer: it is provided by the
+*    calling thread (e.g. on the stack) and is in use from the start of the
+*    transfer with \ref CSdoWaitStart() until the end of the transfer is
+*    collected with \ref CSdoWaitEnd().
+*/
+typedef struct CSDO_WAIT_REQ_T {
+    struct CSDO_WAIT_REQ_T *Next;     /*!< next request in list              */
+    pthread_cond_t          Cond;     /*!< signaled on transfer end          */
+    uint8_t                *Buf;      /*!< reference to transfered data      */
+    uint32_t                Key;      /*!< object entry key (CO_DEV)         */
+    uint32_t                Size;     /*!< transfered data size              */
+    uint32_t                Tmt;      /*!< timeout value in milliseconds     */
+    uint32_t                Code;     /*!< abort code (0: transfer finished) */
+    uint8_t                 NodeId;   /*!< node-id of addressed SDO server   */
+    uint8_t                 Dir;      /*!< upload or download request        */
+    uint8_t                 Done;     /*!< transfer end is reached           */
+
+} CSDO_WAIT_REQ;
+
+/*! \brief BLOCKING SDO CLIENT
+*
+*    This structure connects application threads with the SDO client
+*    request queue of a node, which is executed by the node thread. The
+*    application threads post their requests and sleep until the node
+*    thread has finished the transfer, so many threads can wait for SDO
+*    transfers in parallel without spinning. The node thread is woken up
+*    with an eventfd, which is registered in the epoll instance of the node
+*    with \ref LinuxIoAdd(). The blocking SDO client is the application
+*    context (member Ctx) of the request queue.
+*/
+typedef struct CSDO_WAIT_T {
+    CO_CSDO_QUEUE      *Queue;        /*!< SDO client request queue          */
+    pthread_mutex_t     Lock;         /*!< protects posted requests and ends */
+    CSDO_WAIT_REQ      *Head;         /*!< first posted request              */
+    CSDO_WAIT_REQ      *Tail;         /*!< last posted request               */
+    CSDO_WAIT_REQ      *Act;          /*!< first queued request (node thread)*/
+    CSDO_WAIT_REQ      *ActTail;      /*!< last queued request (node thread) */
+    int                 Fd;           /*!< eventfd of the node thread        */
+    uint8_t             Stall;        /*!< request queue was full            */
+    uint8_t             Closed;       /*!< no further requests are accepted  */
+
+} CSDO_WAIT;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  INIT BLOCKING SDO CLIENT
+*
+*    This function creates the eventfd and the lock of the blocking SDO
+*    client, which executes the requests with the given request queue.
+*    The eventfd (member Fd) must be registered in the epoll instance of
+*    the node with \ref LinuxIoAdd().
+*
+* \note
+*    Initialize the blocking SDO client before the node thread and the
+*    application threads are running. A request queue is used by a single
+*    blocking SDO client until it is closed with \ref CSdoWaitClose().
+*
+* \param w
+*    pointer to the blocking SDO client
+*
+* \param q
+*    pointer to the initialized request queue of the node
+*
+* \retval  =0    blocking SDO client is ready
+* \retval  <0    request queue is used by a blocking SDO client, or error
+*                while creating the eventfd or the lock
+*/
+int16_t CSdoWaitInit(CSDO_WAIT *w, CO_CSDO_QUEUE *q);
+
+/*! \brief  PROCESS POSTED REQUESTS
+*
+*    This function appends the posted requests to the request queue of the
+*    node. Requests, which don't fit into the request queue, stay posted
+*    until a queued transfer is finished. This function is intended to be
+*    called in the node thread after each \ref LinuxIoProcess().
+*
+* \param w
+*    pointer to the blocking SDO client
+*
+* \return
+*    number of queued requests
+*/
+uint16_t CSdoWaitProcess(CSDO_WAIT *w);
+
+/*! \brief  START SDO TRANSFER
+*
+*    This function posts an SDO transfer to the node thread and returns
+*    immediately. The end of the transfer must be collected with
+*    \ref CSdoWaitEnd() before the request or the buffer is reused. This
+*    function may be called by any application thread.
+*
+* \param w
+*    pointer to the blocking SDO client
+*
+* \param req
+*    pointer to the (unused) request
+*
+* \param dir
+*    transfer direction (CO_CSDO_QUEUE_UPLOAD or CO_CSDO_QUEUE_DOWNLOAD)
+*
+* \param nodeId
+*    node-id of the SDO server (1..127)
+*
+* \param key
+*    object entry key; should be generated with the macro CO_DEV()
+*
+* \param buf
+*    reference to the transfered data
+*
+* \param size
+*    size of the transfered data
+*
+* \param timeout
+*    SDO server response timeout in milliseconds
+*
+* \retval  =CO_ERR_NONE       transfer is posted
+* \retval  =CO_ERR_BAD_ARG    invalid argument
+* \retval  =CO_ERR_SDO_OFF    blocking SDO client is closed
+*/
+CO_ERR CSdoWaitStart(CSDO_WAIT *w,
+                     CSDO_WAIT_REQ *req,
+                     uint8_t dir,
+                     uint8_t nodeId,
+                     uint32_t key,
+                     uint8_t *buf,
+                     uint32_t size,
+                     uint32_t timeout);
+
+/*! \brief  WAIT FOR END OF SDO TRANSFER
+*
+*    This function sleeps until the posted SDO transfer is finished or
+*    aborted. The request is unused afterwards.
+*
+* \param w
+*    pointer to the blocking SDO client
+*
+* \param req
+*    pointer to the request, which is started with \ref CSdoWaitStart()
+*
+* \return
+*    abort code of the transfer (0: transfer finished)
+*/
+uint32_t CSdoWaitEnd(CSDO_WAIT *w, CSDO_WAIT_REQ *req);
+
+/*! \brief  BLOCKING SDO UPLOAD
+*
+*    This function reads an object entry of the given SDO server and sleeps
+*    until the transfer is finished or aborted.
+*
+* \param w
+*    pointer to the blocking SDO client
+*
+* \param nodeId
+*    node-id of the SDO server (1..127)
+*
+* \param key
+*    object entry key; should be generated with the macro CO_DEV()
+*
+* \param buf
+*    reference to the buffer for the uploaded data
+*
+* \param size
+*    size of the buffer
+*
+* \param timeout
+*    SDO server response timeout in milliseconds
+*
+* \param code
+*    pointer to the abort code of the transfer (may be 0)
+*
+* \retval  =CO_ERR_NONE       transfer is finished
+* \retval  =CO_ERR_BAD_ARG    invalid argument
+* \retval  =CO_ERR_SDO_OFF    blocking SDO client is closed
+* \retval  =CO_ERR_SDO_ABORT  transfer is aborted
+*/
+CO_ERR CSdoWaitUpload(CSDO_WAIT *w,
+                      uint8_t nodeId,
+                      uint32_t key,
+                      uint8_t *buf,
+                      uint32_t size,
+                      uint32_t timeout,
+                      uint32_t *code);
+
+/*! \brief  BLOCKING SDO DOWNLOAD
+*
+*    This function writes an object entry of the given SDO server and
+*    sleeps until the transfer is finished or aborted.
+*
+* \param w
+*    pointer to the blocking SDO client
+*
+* \param nodeId
+*    node-id of the SDO server (1..127)
+*
+* \param key
+*    object entry key; should be generated with the macro CO_DEV()
+*
+* \param buf
+*    reference to the data to be downloaded
+*
+* \param size
+*    size of the data
+*
+* \param timeout
+*    SDO server response timeout in milliseconds
+*
+* \param code
+*    pointer to the abort code of the transfer (may be 0)
+*
+* \retval  =CO_ERR_NONE       transfer is finished
+* \retval  =CO_ERR_BAD_ARG    invalid argument
+* \retval  =CO_ERR_SDO_OFF    blocking SDO client is closed
+* \retval  =CO_ERR_SDO_ABORT  transfer is aborted
+*/
+CO_ERR CSdoWaitDownload(CSDO_WAIT *w,
+                        uint8_t nodeId,
+                        uint32_t key,
+                        uint8_t *buf,
+                        uint32_t size,
+                        uint32_t timeout,
+                        uint32_t *code);
+
+/*! \brief  CLOSE BLOCKING SDO CLIENT
+*
+*    This function rejects further requests and ends all posted and queued
+*    requests with the abort code CO_SDO_ERR_GENERAL, so no application
+*    thread is sleeping forever. The function must be called by the node
+*    thread, when the node is stopped. The request queue is released, so
+*    transfers of the request queue, which finish later, are ignored. The
+*    lock is kept, because waiting application threads may still use it.
+*
+* \param w
+*    pointer to the blocking SDO client
+*/
+void CSdoWaitClose(CSDO_WAIT *w);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
@@ -0,0 +1,167 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <errno.h>
+#include <unistd.h>
+#include <sys/epoll.h>
+
+#include "drv_linux_io.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define LINUX_IO_EVENT_N   4
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static int16_t LinuxIoWatch(LINUX_IO *io, int *reg, int fd, uint32_t tag);
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t LinuxIoOpen(LINUX_IO *io)
+{
+    io->CanFd = -1;
+    io->TmrFd = -1;
+    io->Epoll = epoll_create1(EPOLL_CLOEXEC);
+    if (io->Epoll < 0) {
+        return ((int16_t)-1);
+    }
+    return (0);
+}
+
+/*
+* see function definition
+*/
+int16_t LinuxIoAdd(LINUX_IO *io, int fd)
+{
+    struct epoll_event ev;
+
+    ev.events   = EPOLLIN;
+    ev.data.u32 = LINUX_IO_USR;
+    if (epoll_ctl(io->Epoll, EPOLL_CTL_ADD, fd, &ev) < 0) {
+        return ((int16_t)-1);
+    }
+    return (0);
+}
+
+/*
+* see function definition
+*/
+int16_t LinuxIoWait(LINUX_IO *io, int timeout)
+{
+    struct epoll_event ev[LINUX_IO_EVENT_N];
+    int16_t            result = 0;
+    int                num;
+    int                n;
+
+    /* timer events, which are started from now on, are based on now */
+    io->Timer.Chain = 0u;
+
+    if ((LinuxIoWatch(io, &io->CanFd, io->Can.Fd,   LINUX_IO_CAN) < 0) ||
+        (LinuxIoWatch(io, &io->TmrFd, io->Timer.Fd, LINUX_IO_TMR) < 0)) {
+        return ((int16_t)-1);
+    }
+
+    num = epoll_wait(io->Epoll, &ev[0], LINUX_IO_EVENT_N, timeout);
+    if (num < 0) {
+        return ((errno == EINTR) ? 0 : (int16_t)-1);
+    }
+    for (n = 0; n < num; n++) {
+        result |= (int16_t)ev[n].data.u32;
+    }
+    return (result);
+}
+
+/*
+* see function definition
+*/
+int16_t LinuxIoProcess(CO_NODE *node, int timeout)
+{
+    LINUX_IO *io = (LINUX_IO *)CO_IF_CTX(&node->If);
+    int16_t   events;
+
+    SocketCanRefresh(&node->If);
+    events = LinuxIoWait(io, timeout);
+    if (events < 0) {
+        return (events);
+    }
+    if ((events & LINUX_IO_TMR) != 0) {
+        /* catch up all elapsed events; cyclic actions restart on process */
+        while (COTmrService(&node->Tmr) > 0) {
+            COTmrProcess(&node->Tmr);
+        }
+    }
+    if ((events & LINUX_IO_CAN) != 0) {
+        while (CONodeProcessBatch(node, SOCKET_CAN_BATCH_N) > 0) {
+        }
+    }
+    return (events);
+}
+
+/*
+* see function definition
+*/
+void LinuxIoClose(LINUX_IO *io)
+{
+    if (io->Epoll >= 0) {
+        (void)close(io->Epoll);
+    }
+    io->Epoll = -1;
+    io->CanFd = -1;
+    io->TmrFd = -1;
+}
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+
+/* Keep the epoll set in sync with the file descriptor of a driver. The
+ * drivers open a new file descriptor with each re-initialization (e.g. a
+ * CAN reset) before closing the old one, so the number is changing.
+ */
+static int16_t LinuxIoWatch(LINUX_IO *io, int *reg, int fd, uint32_t tag)
+{
+    struct epoll_event ev;
+
+    if (*reg == fd) {
+        return (0);
+    }
+    if (*reg >= 0) {
+        (void)epoll_ctl(io->Epoll, EPOLL_CTL_DEL, *reg, NULL);
+        *reg = -1;
+    }
+    if (fd >= 0) {
+        ev.events   = EPOLLIN;
+        ev.data.u32 = tag;
+        if (epoll_ctl(io->Epoll, EPOLL_CTL_ADD, fd, &ev) < 0) {
+            return ((int16_t)-1);
+        }
+        *reg = fd;
+    }
+    return (0);
+}
@@ -0,0 +1,152 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_LINUX_IO_H_
+#define CO_LINUX_IO_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "drv_can_socketcan.h"
+#include "drv_timer_timerfd.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define LINUX_IO_CAN    0x01u    /*!< event: CAN frames are received         */
+#define LINUX_IO_TMR    0x02u    /*!< event: node timer is elapsed           */
+#define LINUX_IO_USR    0x04u    /*!< event: added file descriptor is ready  */
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief LINUX NODE I/O
+*
+*    This structure holds the Linux drivers of a single node and the epoll
+*    instance, which waits for both the CAN socket and the timerfd. The
+*    structure is the driver context (member Ctx of CO_IF_DRV) of the
+*    SocketCAN and the timerfd driver. The application sets the members
+*    Can.Name, Can.Fd = -1 and Timer.Fd = -1 before the node initialization.
+*
+* \note
+*    The member Can must be the first member, because the SocketCAN driver
+*    uses the driver context as SOCKET_CAN structure.
+*/
+typedef struct LINUX_IO_T {
+    SOCKET_CAN         Can;      /*!< SocketCAN interface (first member)     */
+    TIMER_FD           Timer;    /*!< node timer                             */
+    int                Epoll;    /*!< epoll instance (-1: closed)            */
+    int                CanFd;    /*!< CAN socket registered in epoll         */
+    int                TmrFd;    /*!< timerfd registered in epoll            */
+
+} LINUX_IO;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  OPEN EPOLL INSTANCE
+*
+*    This function creates the epoll instance for the node. The function
+*    must be called after the node initialization, which opens the CAN
+*    socket and the timerfd.
+*
+* \param io
+*    pointer to the Linux node I/O
+*
+* \retval  =0    epoll instance is created
+* \retval  <0    error while creating the epoll instance
+*/
+int16_t LinuxIoOpen(LINUX_IO *io);
+
+/*! \brief  ADD FILE DESCRIPTOR
+*
+*    This function adds a file descriptor of the application (e.g. an
+*    eventfd, which is written by other threads) to the epoll instance, so
+*    the node thread is woken up, when the file descriptor is readable. The
+*    event is reported as LINUX_IO_USR and must be handled (e.g. read) by
+*    the application.
+*
+* \param io
+*    pointer to the Linux node I/O
+*
+* \param fd
+*    file descriptor of the application
+*
+* \retval  =0    file descriptor is added
+* \retval  <0    error while adding the file descriptor
+*/
+int16_t LinuxIoAdd(LINUX_IO *io, int fd);
+
+/*! \brief  WAIT FOR NODE EVENTS
+*
+*    This function sleeps until CAN frames are received, the node timer is
+*    elapsed or the timeout is reached. The function updates the epoll set,
+*    when the driver file descriptors are changed (e.g. by a CAN reset).
+*
+* \param io
+*    pointer to the Linux node I/O
+*
+* \param timeout
+*    maximal waiting time in ms (-1: wait forever, 0: don't wait)
+*
+* \retval  >=0   events (LINUX_IO_CAN, LINUX_IO_TMR and/or LINUX_IO_USR)
+* \retval  <0    error while waiting
+*/
+int16_t LinuxIoWait(LINUX_IO *io, int timeout);
+
+/*! \brief  PROCESS NODE EVENTS
+*
+*    This function waits for node events and executes the elapsed timer
+*    events and the received CAN frames of the node. This function is
+*    intended to be called in the endless loop of the application, which
+*    is sleeping while there is nothing to do.
+*
+* \param node
+*    pointer to the CANopen node object
+*
+* \param timeout
+*    maximal waiting time in ms (-1: wait forever, 0: don't wait)
+*
+* \retval  >=0   handled events (LINUX_IO_CAN and/or LINUX_IO_TMR), and the
+*                events of the application (LINUX_IO_USR)
+* \retval  <0    error while waiting
+*/
+int16_t LinuxIoProcess(CO_NODE *node, int timeout);
+
+/*! \brief  CLOSE EPOLL INSTANCE
+*
+*    This function closes the epoll instance. The CAN socket and the timerfd
+*    are closed by the drivers.
+*
+* \param io
+*    pointer to the Linux node I/O
+*/
+void LinuxIoClose(LINUX_IO *io);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
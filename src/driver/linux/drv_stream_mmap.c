@@ -0,0 +1,205 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200112L       /* ftruncate(), msync()                */
+#endif
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include "drv_stream_mmap.h"
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static CO_ERR StreamMmapRead (CO_OBJ_STREAM *stream, uint32_t offset, uint8_t *buf, uint32_t len);
+static CO_ERR StreamMmapWrite(CO_OBJ_STREAM *stream, uint32_t offset, uint8_t *buf, uint32_t len);
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+int16_t StreamMmapOpen(CO_OBJ_STREAM *stream, STREAM_MMAP *map, const char *path, uint32_t size)
+{
+    struct stat st;
+    void       *base;
+    int         prot;
+    int         fd;
+
+    map->Base = 0;
+    map->Size = 0;
+    map->Fd   = -1;
+
+    if (size == 0) {
+        fd = open(path, O_RDONLY);
+        if (fd < 0) {
+            return (-1);
+        }
+        if ((fstat(fd, &st) < 0) ||
+            (st.st_size <= 0   ) ||
+            ((uint64_t)st.st_size > (uint64_t)UINT32_MAX)) {
+            (void)close(fd);
+            return (-1);
+        }
+        map->Size = (uint32_t)st.st_size;
+        prot      = PROT_READ;
+    } else {
+        fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (fd < 0) {
+            return (-1);
+        }
+        if (ftruncate(fd, (off_t)size) < 0) {
+            (void)close(fd);
+            return (-1);
+        }
+        map->Size = size;
+        prot      = PROT_READ | PROT_WRITE;
+    }
+
+    base = mmap(NULL, map->Size, prot, MAP_SHARED, fd, 0);
+    if (base == MAP_FAILED) {
+        (void)close(fd);
+        map->Size = 0;
+        return (-1);
+    }
+    map->Base = (uint8_t *)base;
+    map->Fd   = fd;
+
+    stream->Offset = 0;
+    stream->Size   = map->Size;
+    stream->Read   = StreamMmapRead;
+    stream->Write  = (size == 0) ? 0 : StreamMmapWrite;
+    stream->Ctx    = map;
+    return (0);
+}
+
+/*
+* see function definition
+*/
+int16_t StreamMmapSync(CO_OBJ_STREAM *stream)
+{
+    STREAM_MMAP *map = (STREAM_MMAP *)stream->Ctx;
+
+    if ((map == 0) || (map->Base == 0)) {
+        return (-1);
+    }
+    if (msync(map->Base, map->Size, MS_SYNC) < 0) {
+        return (-1);
+    }
+    return (0);
+}
+
+/*
+* see function definition
+*/
+void StreamMmapClose(CO_OBJ_STREAM *stream)
+{
+    STREAM_MMAP *map = (STREAM_MMAP *)stream->Ctx;
+
+    if (map != 0) {
+        if (map->Base != 0) {
+            (void)munmap(map->Base, map->Size);
+        }
+        if (map->Fd >= 0) {
+            (void)close(map->Fd);
+        }
+        map->Base = 0;
+        map->Size = 0;
+        map->Fd   = -1;
+    }
+    stream->Size  = 0;
+    stream->Read  = 0;
+    stream->Write = 0;
+    stream->Ctx   = 0;
+}
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+
+/*! \brief  READ CHUNK FROM FILE
+*
+*    This stream access function copies the requested chunk from the file
+*    pages into the SDO transfer buffer.
+*
+* \param stream
+*    pointer to the stream management structure
+*
+* \param offset
+*    byte offset of the chunk within the file
+*
+* \param buf
+*    reference to the chunk data
+*
+* \param len
+*    length of the chunk in bytes
+*
+* \retval  =CO_ERR_NONE     chunk is copied
+* \retval  =CO_ERR_BAD_ARG  chunk is outside of the mapped file
+*/
+static CO_ERR StreamMmapRead(CO_OBJ_STREAM *stream, uint32_t offset, uint8_t *buf, uint32_t len)
+{
+    STREAM_MMAP *map = (STREAM_MMAP *)stream->Ctx;
+
+    if ((map->Base == 0) || (offset > map->Size) || (len > (map->Size - offset))) {
+        return (CO_ERR_BAD_ARG);
+    }
+    memcpy(buf, &map->Base[offset], len);
+    return (CO_ERR_NONE);
+}
+
+/*! \brief  WRITE CHUNK TO FILE
+*
+*    This stream access function copies the received chunk from the SDO
+*    transfer buffer into the file pages.
+*
+* \param stream
+*    pointer to the stream management structure
+*
+* \param offset
+*    byte offset of the chunk within the file
+*
+* \param buf
+*    reference to the chunk data
+*
+* \param len
+*    length of the chunk in bytes
+*
+* \retval  =CO_ERR_NONE     chunk is copied
+* \retval  =CO_ERR_BAD_ARG  chunk is outside of the mapped file
+*/
+static CO_ERR StreamMmapWrite(CO_OBJ_STREAM *stream, uint32_t offset, uint8_t *buf, uint32_t len)
+{
+    STREAM_MMAP *map = (STREAM_MMAP *)stream->Ctx;
+
+    if ((map->Base == 0) || (offset > map->Size) || (len > (map->Size - offset))) {
+        return (CO_ERR_BAD_ARG);
+    }
+    memcpy(&map->Base[offset], buf, len);
+    return (CO_ERR_NONE);
+}
@@ -0,0 +1,106 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_STREAM_MMAP_H_
+#define CO_STREAM_MMAP_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief MEMORY MAPPED FILE
+*
+*    This structure holds a file, which is mapped into the address space
+*    of the application. The structure is the application context (member
+*    Ctx of CO_OBJ_STREAM) of a stream object, so the chunks of the SDO
+*    transfers are copied between the SDO transfer buffer and the file
+*    pages without a full-size copy of the file in memory. The kernel
+*    loads and writes back the file pages on demand.
+*/
+typedef struct STREAM_MMAP_T {
+    uint8_t           *Base;     /*!< mapped file content (0: closed)        */
+    uint32_t           Size;     /*!< mapped size in bytes                   */
+    int                Fd;       /*!< file descriptor (-1: closed)           */
+
+} STREAM_MMAP;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  OPEN MEMORY MAPPED STREAM
+*
+*    This function maps the given file and links it to the stream object.
+*    With a size of 0, an existing file is mapped read-only and the stream
+*    size is the file size. With a size greater than 0, the file is created
+*    (or truncated) to the given size and mapped read-write, so the stream
+*    object accepts SDO downloads.
+*
+* \param stream
+*    pointer to the stream management structure
+*
+* \param map
+*    pointer to the memory mapped file
+*
+* \param path
+*    path of the file
+*
+* \param size
+*    size of a writable file in bytes (0: map existing file read-only)
+*
+* \retval  =0    file is mapped and linked to the stream
+* \retval  <0    error while opening or mapping the file
+*/
+int16_t StreamMmapOpen(CO_OBJ_STREAM *stream, STREAM_MMAP *map, const char *path, uint32_t size);
+
+/*! \brief  SYNCHRONIZE MEMORY MAPPED STREAM
+*
+*    This function writes the modified file pages back to the file. The
+*    function should be called after the end of an SDO download.
+*
+* \param stream
+*    pointer to the stream management structure
+*
+* \retval  =0    file content is written
+* \retval  <0    error while writing the file content
+*/
+int16_t StreamMmapSync(CO_OBJ_STREAM *stream);
+
+/*! \brief  CLOSE MEMORY MAPPED STREAM
+*
+*    This function unmaps and closes the file of the stream object. The
+*    stream has the size 0 and is neither readable nor writable afterwards.
+*
+* \param stream
+*    pointer to the stream management structure
+*/
+void StreamMmapClose(CO_OBJ_STREAM *stream);
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif /* CO_STREAM_MMAP_H_ */
@@ -0,0 +1,206 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L       /* clock_gettime()                     */
+#endif
+
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/timerfd.h>
+
+#include "drv_linux_io.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define TIMER_FD_NS_PER_SEC   1000000000u
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void     DrvTimerInit   (CO_IF *cif, uint32_t freq);
+static void     DrvTimerStart  (CO_IF *cif);
+static uint8_t  DrvTimerUpdate (CO_IF *cif);
+static uint32_t DrvTimerDelay  (CO_IF *cif);
+static void     DrvTimerReload (CO_IF *cif, uint32_t reload);
+static void     DrvTimerStop   (CO_IF *cif);
+
+static uint64_t TimerFdNow     (void);
+static uint64_t TimerFdTick    (TIMER_FD *tmr);
+static void     TimerFdArm     (TIMER_FD *tmr, uint64_t tick);
+
+/******************************************************************************
+* PUBLIC VARIABLE
+******************************************************************************/
+
+const CO_IF_TIMER_DRV TimerFdDriver = {
+    DrvTimerInit,
+    DrvTimerReload,
+    DrvTimerDelay,
+    DrvTimerStop,
+    DrvTimerStart,
+    DrvTimerUpdate
+};
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void DrvTimerInit(CO_IF *cif, uint32_t freq)
+{
+    TIMER_FD *tmr = &((LINUX_IO *)CO_IF_CTX(cif))->Timer;
+    int       old = tmr->Fd;
+
+    if (freq == 0u) {
+        freq = 1u;
+    }
+    tmr->Period = (TIMER_FD_NS_PER_SEC + (freq / 2u)) / freq;
+    if (tmr->Period == 0u) {
+        tmr->Period = 1u;                   /* frequency above 1GHz         */
+    }
+    tmr->Origin = TimerFdNow();
+    tmr->Tick   = 0u;
+    tmr->Reload = 0u;
+    tmr->Armed  = 0u;
+    tmr->Chain  = 0u;
+    tmr->Fd     = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    if (old >= 0) {
+        (void)close(old);                   /* after create: new fd number */
+    }
+}
+
+static void DrvTimerStart(CO_IF *cif)
+{
+    TIMER_FD *tmr = &((LINUX_IO *)CO_IF_CTX(cif))->Timer;
+
+    uint64_t  base;
+
+    if (tmr->Armed == 0u) {
+        base = TimerFdTick(tmr);
+        if (tmr->Chain != 0u) {
+            base       = tmr->Tick;         /* restart after elapsed event  */
+            tmr->Chain = 0u;
+        }
+        TimerFdArm(tmr, base + tmr->Reload);
+    }
+}
+
+static uint8_t DrvTimerUpdate(CO_IF *cif)
+{
+    TIMER_FD *tmr = &((LINUX_IO *)CO_IF_CTX(cif))->Timer;
+    uint64_t  expired;
+
+    if ((tmr->Armed == 0u) || (TimerFdTick(tmr) < tmr->Tick)) {
+        return (0u);
+    }
+    /* consume the readable state of the timerfd */
+    (void)read(tmr->Fd, &expired, sizeof(expired));
+    tmr->Armed = 0u;
+    tmr->Chain = 1u;
+    return (1u);
+}
+
+static uint32_t DrvTimerDelay(CO_IF *cif)
+{
+    TIMER_FD *tmr = &((LINUX_IO *)CO_IF_CTX(cif))->Timer;
+    uint64_t  now;
+
+    if (tmr->Armed == 0u) {
+        return (0u);
+    }
+    now = TimerFdTick(tmr);
+    if (now >= tmr->Tick) {
+        return (0u);
+    }
+    return ((uint32_t)(tmr->Tick - now));
+}
+
+static void DrvTimerReload(CO_IF *cif, uint32_t reload)
+{
+    TIMER_FD *tmr = &((LINUX_IO *)CO_IF_CTX(cif))->Timer;
+    uint64_t  base;
+
+    tmr->Reload = reload;
+    if (tmr->Chain != 0u) {
+        base       = tmr->Tick;             /* next event after elapsed one */
+        tmr->Chain = 0u;
+    } else if (tmr->Armed != 0u) {
+        base       = TimerFdTick(tmr);
+    } else {
+        return;                             /* armed with the next start    */
+    }
+    TimerFdArm(tmr, base + reload);
+}
+
+static void DrvTimerStop(CO_IF *cif)
+{
+    TIMER_FD          *tmr = &((LINUX_IO *)CO_IF_CTX(cif))->Timer;
+    struct itimerspec  its;
+
+    memset(&its, 0, sizeof(its));
+    (void)timerfd_settime(tmr->Fd, 0, &its, NULL);
+    tmr->Reload = 0u;
+    tmr->Armed  = 0u;
+}
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+
+static uint64_t TimerFdNow(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * TIMER_FD_NS_PER_SEC + (uint64_t)ts.tv_nsec);
+}
+
+/* Get the current tick. The ticks are counted on a fixed grid since the
+ * initialization, so timer events, which are restarted shortly after the
+ * previous event, are not drifting with the processing latency.
+ */
+static uint64_t TimerFdTick(TIMER_FD *tmr)
+{
+    return ((TimerFdNow() - tmr->Origin) / tmr->Period);
+}
+
+/* Program the timerfd as one-shot timer to the given tick. A tick in the
+ * past lets the timerfd expire immediately.
+ */
+static void TimerFdArm(TIMER_FD *tmr, uint64_t tick)
+{
+    struct itimerspec its;
+    uint64_t          deadline;
+
+    deadline = tmr->Origin + tick * tmr->Period;
+    if (deadline == 0u) {
+        deadline = 1u;                      /* zero would disarm the timer  */
+    }
+    memset(&its, 0, sizeof(its));
+    its.it_value.tv_sec  = (time_t)(deadline / TIMER_FD_NS_PER_SEC);
+    its.it_value.tv_nsec = (long)(deadline % TIMER_FD_NS_PER_SEC);
+    (void)timerfd_settime(tmr->Fd, TFD_TIMER_ABSTIME, &its, NULL);
+    tmr->Tick  = tick;
+    tmr->Armed = 1u;
+}
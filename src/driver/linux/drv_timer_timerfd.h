@@ -0,0 +1,72 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_TIMER_TIMERFD_H_
+#define CO_TIMER_TIMERFD_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_if.h"
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+/*! \brief TIMERFD TIMER
+*
+*    This structure holds the state of the node timer, which is emulated
+*    with a one-shot timerfd on CLOCK_MONOTONIC. The timerfd is programmed
+*    to the next pending timer event only, so the application can sleep
+*    (e.g. in epoll_wait()) until the member Fd becomes readable. The timer
+*    ticks are counted on a fixed grid and timer events, which are started
+*    while processing an elapsed event, are based on the elapsed event. So
+*    the timer events are not drifting with the processing latency. The
+*    processing ends with the next call of LinuxIoWait(). The application
+*    sets the member Fd to -1 (no timerfd) before the node initialization.
+*/
+typedef struct TIMER_FD_T {
+    int                Fd;        /*!< timerfd (-1: closed)                  */
+    uint64_t           Period;    /*!< duration of a timer tick in ns        */
+    uint64_t           Origin;    /*!< CLOCK_MONOTONIC time of tick 0 in ns  */
+    uint64_t           Tick;      /*!< tick of the next timer event          */
+    uint32_t           Reload;    /*!< ticks of the next timer event         */
+    uint8_t            Armed;     /*!< timer is running                      */
+    uint8_t            Chain;     /*!< processing an elapsed event           */
+
+} TIMER_FD;
+
+/******************************************************************************
+* PUBLIC SYMBOLS
+******************************************************************************/
+
+/*! \brief TIMERFD TIMER DRIVER
+*
+*    The driver context (member Ctx of CO_IF_DRV) must be a LINUX_IO
+*    structure (see drv_linux_io.h).
+*/
+extern const CO_IF_TIMER_DRV TimerFdDriver;
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif
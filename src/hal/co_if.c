@@ -34,10 +34,12 @@ void COIfInit(CO_IF *cif, struct CO_NODE_T *node, uint32_t freq)
     const CO_IF_NVM_DRV   *nvm   = cif->Drv->Nvm;
 
     /* initialize interface structure */
-    cif->Node = node;
+    cif->Node    = node;
+    cif->TxNum   = 0;
+    cif->TxDefer = 0;
 
     /* initialize hardware via drivers */
-    nvm->Init();
-    timer->Init(freq);
-    can->Init();
+    nvm->Init(cif);
+    timer->Init(cif, freq);
+    can->Init(cif);
 }
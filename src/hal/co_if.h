@@ -26,10 +26,26 @@ extern "C" {
 ******************************************************************************/
 
 #include "co_types.h"
+#include "co_cfg.h"
 #include "co_if_can.h"
 #include "co_if_timer.h"
 #include "co_if_nvm.h"
 
+/******************************************************************************
+* PUBLIC MACROS
+******************************************************************************/
+
+/*! \brief GET DRIVER CONTEXT
+*
+*    This macro returns the driver instance context of the given interface.
+*    Drivers use this context to address the hardware channel of the node,
+*    when multiple nodes are running in a single application.
+*
+* \param cif
+*    pointer to the interface structure
+*/
+#define CO_IF_CTX(cif)       ((cif)->Drv->Ctx)
+
 /******************************************************************************
 * PUBLIC TYPES
 ******************************************************************************/
@@ -40,11 +56,15 @@ typedef struct CO_IF_DRV_T {         /*!< Type, which links driver functions */
     const CO_IF_CAN_DRV    *Can;     /*!< Link to CAN driver functions       */
     const CO_IF_TIMER_DRV  *Timer;   /*!< Link to Timer driver functions     */
     const CO_IF_NVM_DRV    *Nvm;     /*!< Link to NVM driver functions       */
+    void                   *Ctx;     /*!< Driver instance context (optional) */
 } CO_IF_DRV;
 
 typedef struct CO_IF_T {          /*!< Driver interface structure            */
     struct CO_NODE_T *Node;       /*!< Link to parent node                   */
     CO_IF_DRV        *Drv;        /*!< Link to hardware driver functions     */
+    CO_IF_FRM         TxQ[CO_IF_TX_BATCH_N]; /*!< deferred transmit frames   */
+    uint16_t          TxNum;      /*!< number of frames in transmit queue    */
+    uint8_t           TxDefer;    /*!< nesting level of deferred transmit    */
 } CO_IF;
 
 /******************************************************************************
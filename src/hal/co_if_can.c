@@ -20,6 +20,12 @@
 
 #include "co_core.h"
 
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static int16_t COIfCanTxQueue(CO_IF *cif, CO_IF_FRM *frm);
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -31,7 +37,7 @@ void COIfCanInit(CO_IF *cif, struct CO_NODE_T *node)
 {
     const CO_IF_CAN_DRV *can = cif->Drv->Can;
     (void)node;
-    can->Init();
+    can->Init(cif);
 }
 
 /*
@@ -42,13 +48,46 @@ int16_t COIfCanRead (CO_IF *cif, CO_IF_FRM *frm)
     int16_t err;
     const CO_IF_CAN_DRV *can = cif->Drv->Can;
 
-    err = can->Read(frm);
+    err = can->Read(cif, frm);
     if (err < (int16_t)0) {
         cif->Node->Error = CO_ERR_IF_CAN_READ;
     }
     return (err);
 }
 
+/*
+* see function definition
+*/
+int16_t COIfCanReadBatch(CO_IF *cif, CO_IF_FRM *frm, uint16_t max)
+{
+    int16_t  err = 0;
+    uint16_t num = 0;
+    const CO_IF_CAN_DRV *can = cif->Drv->Can;
+
+    if (can->ReadBatch != 0) {
+        err = can->ReadBatch(cif, frm, max);
+        if (err < (int16_t)0) {
+            cif->Node->Error = CO_ERR_IF_CAN_READ;
+        }
+        return (err);
+    }
+
+    while (num < max) {
+        err = can->Read(cif, &frm[num]);
+        if (err <= (int16_t)0) {
+            break;
+        }
+        num++;
+    }
+    if (err < (int16_t)0) {
+        cif->Node->Error = CO_ERR_IF_CAN_READ;
+        if (num == 0) {
+            return (err);
+        }
+    }
+    return ((int16_t)num);
+}
+
 /*
 * see function definition
 */
@@ -57,20 +96,87 @@ int16_t COIfCanSend(CO_IF *cif, CO_IF_FRM *frm)
     int16_t err;
     const CO_IF_CAN_DRV *can = cif->Drv->Can;
 
-    err = can->Send(frm);
+    if (cif->TxDefer > 0) {
+        return (COIfCanTxQueue(cif, frm));
+    }
+    err = can->Send(cif, frm);
     if (err < (int16_t)0) {
         cif->Node->Error = CO_ERR_IF_CAN_SEND;
     }
     return (err);
 }
 
+/*
+* see function definition
+*/
+int16_t COIfCanSendBatch(CO_IF *cif, CO_IF_FRM *frm, uint16_t num)
+{
+    int16_t  err = 0;
+    uint16_t sent = 0;
+    const CO_IF_CAN_DRV *can;
+
+    if (num == 0) {
+        return (0);
+    }
+    can = cif->Drv->Can;
+    if (can->SendBatch != 0) {
+        err = can->SendBatch(cif, frm, num);
+        if ((err < (int16_t)0) || ((uint16_t)err < num)) {
+            cif->Node->Error = CO_ERR_IF_CAN_SEND;
+        }
+        return (err);
+    }
+
+    while (sent < num) {
+        err = can->Send(cif, &frm[sent]);
+        if (err < (int16_t)0) {
+            cif->Node->Error = CO_ERR_IF_CAN_SEND;
+            break;
+        }
+        sent++;
+    }
+    if ((err < (int16_t)0) && (sent == 0)) {
+        return (err);
+    }
+    return ((int16_t)sent);
+}
+
+/*
+* see function definition
+*/
+void COIfCanSendDefer(CO_IF *cif)
+{
+    cif->TxDefer++;
+}
+
+/*
+* see function definition
+*/
+int16_t COIfCanSendFlush(CO_IF *cif)
+{
+    int16_t result;
+
+    if (cif->TxDefer > 0) {
+        cif->TxDefer--;
+    }
+    if (cif->TxDefer > 0) {
+        return (0);
+    }
+    result     = COIfCanSendBatch(cif, &cif->TxQ[0], cif->TxNum);
+    cif->TxNum = 0;
+
+    return (result);
+}
+
 /*
 * see function definition
 */
 void COIfCanReset(CO_IF *cif)
 {
     const CO_IF_CAN_DRV *can = cif->Drv->Can;
-    can->Reset();    
+
+    cif->TxNum = 0;
+    can->Reset(cif);    
 }
 
 /*
@@ -79,7 +185,7 @@ void COIfCanReset(CO_IF *cif)
 void COIfCanClose(CO_IF *cif)
 {
     const CO_IF_CAN_DRV *can = cif->Drv->Can;
-    can->Close(); 
+    can->Close(cif); 
 }
 
 /*
@@ -95,5 +201,49 @@ void COIfCanEnable(CO_IF *cif, uint32_t baudrate)
       	cif->Node->Baudrate = baudrate;
     }
 
-    can->Enable(baudrate);
+    can->Enable(cif, baudrate);
+}
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+
+/*! \brief  QUEUE CAN FRAME
+*
+*    This function inserts the given CAN frame into the transmit queue of
+*    the node. The queue is kept in ascending order of the CAN identifier;
+*    frames with the same identifier keep their order. A full queue is
+*    flushed to the driver before the new frame is inserted.
+*
+* \param cif
+*    pointer to the interface structure
+*
+* \param frm
+*    pointer to the transmit frame
+*
+* \retval  >0    the size of CO_IF_FRM on success
+* \retval  <0    the internal CanBus error code
+*/
+static int16_t COIfCanTxQueue(CO_IF *cif, CO_IF_FRM *frm)
+{
+    int16_t  err;
+    uint16_t pos;
+
+    if (cif->TxNum >= (uint16_t)CO_IF_TX_BATCH_N) {
+        err        = COIfCanSendBatch(cif, &cif->TxQ[0], cif->TxNum);
+        cif->TxNum = 0;
+        if (err < (int16_t)0) {
+            return (err);
+        }
+    }
+
+    pos = cif->TxNum;
+    while ((pos > 0) && (cif->TxQ[pos - 1].Identifier > frm->Identifier)) {
+        cif->TxQ[pos] = cif->TxQ[pos - 1];
+        pos--;
+    }
+    cif->TxQ[pos] = *frm;
+    cif->TxNum++;
+
+    return ((int16_t)sizeof(CO_IF_FRM));
 }
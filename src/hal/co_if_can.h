@@ -188,20 +188,24 @@ typedef struct CO_IF_FRM_T {         /*!< Type, which represents a CAN frame */
     uint8_t   DLC;                   /*!< CAN message data length code (DLC) */
 } CO_IF_FRM;
 
-typedef void    (*CO_IF_CAN_INIT_FUNC  )(void);
-typedef void    (*CO_IF_CAN_ENABLE_FUNC)(uint32_t);
-typedef int16_t (*CO_IF_CAN_READ_FUNC  )(CO_IF_FRM *);
-typedef int16_t (*CO_IF_CAN_SEND_FUNC  )(CO_IF_FRM *);
-typedef void    (*CO_IF_CAN_RESET_FUNC )(void);
-typedef void    (*CO_IF_CAN_CLOSE_FUNC )(void);
+typedef void    (*CO_IF_CAN_INIT_FUNC      )(struct CO_IF_T *);
+typedef void    (*CO_IF_CAN_ENABLE_FUNC    )(struct CO_IF_T *, uint32_t);
+typedef int16_t (*CO_IF_CAN_READ_FUNC      )(struct CO_IF_T *, CO_IF_FRM *);
+typedef int16_t (*CO_IF_CAN_SEND_FUNC      )(struct CO_IF_T *, CO_IF_FRM *);
+typedef void    (*CO_IF_CAN_RESET_FUNC     )(struct CO_IF_T *);
+typedef void    (*CO_IF_CAN_CLOSE_FUNC     )(struct CO_IF_T *);
+typedef int16_t (*CO_IF_CAN_READ_BATCH_FUNC)(struct CO_IF_T *, CO_IF_FRM *, uint16_t);
+typedef int16_t (*CO_IF_CAN_SEND_BATCH_FUNC)(struct CO_IF_T *, CO_IF_FRM *, uint16_t);
 
 typedef struct CO_IF_CAN_DRV_T {
-    CO_IF_CAN_INIT_FUNC   Init;
-    CO_IF_CAN_ENABLE_FUNC Enable;
-    CO_IF_CAN_READ_FUNC   Read;
-    CO_IF_CAN_SEND_FUNC   Send;
-    CO_IF_CAN_RESET_FUNC  Reset;
-    CO_IF_CAN_CLOSE_FUNC  Close;
+    CO_IF_CAN_INIT_FUNC       Init;
+    CO_IF_CAN_ENABLE_FUNC     Enable;
+    CO_IF_CAN_READ_FUNC       Read;
+    CO_IF_CAN_SEND_FUNC       Send;
+    CO_IF_CAN_RESET_FUNC      Reset;
+    CO_IF_CAN_CLOSE_FUNC      Close;
+    CO_IF_CAN_READ_BATCH_FUNC ReadBatch;   /*!< optional (0: use Read)   */
+    CO_IF_CAN_SEND_BATCH_FUNC SendBatch;   /*!< optional (0: use Send)   */
 } CO_IF_CAN_DRV;
 
 /******************************************************************************
@@ -245,9 +249,35 @@ void COIfCanInit(struct CO_IF_T *cif, struct CO_NODE_T *node);
 */
 int16_t COIfCanRead(struct CO_IF_T *cif, CO_IF_FRM *frm);
 
+/*! \brief  READ MULTIPLE CAN FRAMES
+*
+*    This function reads up to max CAN frames from the interface with a
+*    single call of the optional driver function ReadBatch. For drivers
+*    without ReadBatch, the driver function Read is called repeatedly until
+*    no more CAN frame is available or max frames are received.
+*
+* \note  The fallback with repeated Read is intended for polling drivers.
+*        A blocking Read waits until max CAN frames are received.
+*
+* \param cif
+*    pointer to the interface structure
+*
+* \param frm
+*    pointer to the receive frame buffer array
+*
+* \param max
+*    maximal number of frames in the receive frame buffer array
+*
+* \retval  >=0   the number of received CAN frames
+* \retval  <0    the CAN driver error code
+*/
+int16_t COIfCanReadBatch(struct CO_IF_T *cif, CO_IF_FRM *frm, uint16_t max);
+
 /*! \brief  SEND CAN FRAME
 *
 *    This function sends the given CAN frame on the interface without delay.
+*    While the transmission is deferred (see \ref COIfCanSendDefer()), the
+*    CAN frame is copied into the transmit queue of the node instead.
 *
 * \param cif
 *     pointer to the interface structure
@@ -260,6 +290,53 @@ int16_t COIfCanRead(struct CO_IF_T *cif, CO_IF_FRM *frm);
 */
 int16_t COIfCanSend(struct CO_IF_T *cif, CO_IF_FRM *frm);
 
+/*! \brief  SEND MULTIPLE CAN FRAMES
+*
+*    This function sends the given CAN frames with a single call of the
+*    optional driver function SendBatch. For drivers without SendBatch, the
+*    driver function Send is called for each CAN frame.
+*
+* \param cif
+*     pointer to the interface structure
+*
+* \param frm
+*     pointer to the transmit frame buffer array
+*
+* \param num
+*     number of CAN frames in the transmit frame buffer array
+*
+* \retval  >=0   the number of CAN frames accepted by the driver
+* \retval  <0    the internal CanBus error code
+*/
+int16_t COIfCanSendBatch(struct CO_IF_T *cif, CO_IF_FRM *frm, uint16_t num);
+
+/*! \brief  DEFER CAN TRANSMISSION
+*
+*    This function starts collecting all following CAN frames, which are
+*    sent with \ref COIfCanSend(), in the transmit queue of the node. The
+*    calls may be nested; each call must be finished with a call of
+*    \ref COIfCanSendFlush().
+*
+* \param cif
+*     pointer to the interface structure
+*/
+void COIfCanSendDefer(struct CO_IF_T *cif);
+
+/*! \brief  FLUSH DEFERRED CAN TRANSMISSION
+*
+*    This function finishes the deferred transmission. When the outermost
+*    deferral is finished, all collected CAN frames are handed over to the
+*    driver in a single batch, ordered by the CAN identifier (lowest
+*    identifier first).
+*
+* \param cif
+*     pointer to the interface structure
+*
+* \retval  >=0   the number of CAN frames accepted by the driver
+* \retval  <0    the internal CanBus error code
+*/
+int16_t COIfCanSendFlush(struct CO_IF_T *cif);
+
 /*! \brief  RESET CAN INTERFACE
 *
 *    This function resets the CAN interface and flushes all already
@@ -304,10 +381,13 @@ void COIfCanEnable(struct CO_IF_T *cif, uint32_t baudrate);
 *    The CAN frame pointer is checked to be valid before calling this
 *    function.
 *
+* \param cif
+*    pointer to the interface structure, which received the CAN frame
+*
 * \param frm
 *    The received CAN frame
 */
-extern void COIfCanReceive(CO_IF_FRM *frm);
+extern void COIfCanReceive(struct CO_IF_T *cif, CO_IF_FRM *frm);
 
 #ifdef __cplusplus               /* for compatibility with C++ environments  */
 }
@@ -33,12 +33,12 @@ extern "C" {
 
 struct CO_IF_T;                /* Declaration of interface structure         */
 
-typedef void     (*CO_IF_TIMER_INIT_FUNC  )(uint32_t);
-typedef void     (*CO_IF_TIMER_RELOAD_FUNC)(uint32_t);
-typedef uint32_t (*CO_IF_TIMER_DELAY_FUNC )(void);
-typedef void     (*CO_IF_TIMER_STOP_FUNC  )(void);
-typedef void     (*CO_IF_TIMER_START_FUNC )(void);
-typedef uint8_t  (*CO_IF_TIMER_UPDATE_FUNC)(void);
+typedef void     (*CO_IF_TIMER_INIT_FUNC  )(struct CO_IF_T *, uint32_t);
+typedef void     (*CO_IF_TIMER_RELOAD_FUNC)(struct CO_IF_T *, uint32_t);
+typedef uint32_t (*CO_IF_TIMER_DELAY_FUNC )(struct CO_IF_T *);
+typedef void     (*CO_IF_TIMER_STOP_FUNC  )(struct CO_IF_T *);
+typedef void     (*CO_IF_TIMER_START_FUNC )(struct CO_IF_T *);
+typedef uint8_t  (*CO_IF_TIMER_UPDATE_FUNC)(struct CO_IF_T *);
 
 typedef struct CO_IF_TIMER_DRV_T {
     CO_IF_TIMER_INIT_FUNC   Init;
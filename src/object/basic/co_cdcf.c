@@ -0,0 +1,425 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTCdcfSize (struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width);
+static CO_ERR   COTCdcfRead (struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+static CO_ERR   COTCdcfWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+static CO_ERR   COTCdcfInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node);
+static CO_ERR   COTCdcfReset(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t para);
+
+static uint32_t COTCdcfGet    (uint8_t *buf, uint8_t width);
+static void     COTCdcfSet    (uint8_t *buf, uint32_t val, uint8_t width);
+static CO_ERR   COTCdcfRdEntry(CO_OBJ *entry, struct CO_NODE_T *node, uint8_t *buf, uint32_t len);
+static CO_ERR   COTCdcfWrEntry(CO_OBJ *entry, struct CO_NODE_T *node, uint8_t *buf, uint32_t len);
+static uint32_t COTCdcfSnapSize(CO_OBJ_CDCF *cdcf, struct CO_NODE_T *node);
+static CO_ERR   COTCdcfSnap   (CO_OBJ_CDCF *cdcf, struct CO_NODE_T *node);
+static CO_ERR   COTCdcfCheck  (CO_OBJ *obj, CO_OBJ_CDCF *cdcf, struct CO_NODE_T *node);
+static CO_ERR   COTCdcfApply  (CO_OBJ_CDCF *cdcf, struct CO_NODE_T *node);
+static void     COTCdcfUndo   (CO_OBJ_CDCF *cdcf, struct CO_NODE_T *node, uint32_t num);
+static CO_ERR   COTCdcfWait   (CO_OBJ_CDCF *cdcf);
+
+/******************************************************************************
+* PUBLIC GLOBALS
+******************************************************************************/
+
+const CO_OBJ_TYPE COTCdcf = { COTCdcfSize, COTCdcfInit, COTCdcfRead, COTCdcfWrite, COTCdcfReset };
+
+/******************************************************************************
+* FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTCdcfSize(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    uint32_t     result = 0;
+    CO_OBJ_CDCF *cdcf;
+
+    ASSERT_PTR_ERR(obj->Data, 0);
+
+    cdcf = (CO_OBJ_CDCF *)(obj->Data);
+
+    /* given width of 0 returns snapshot size (or buffer size) */
+    if (width == 0) {
+        cdcf->Total = 0;
+        if (cdcf->Keys != 0) {
+            result = COTCdcfSnapSize(cdcf, node);
+        } else {
+            result = cdcf->Size;
+        }
+    } else {
+
+        /* a download may be shorter than the buffer */
+        if (width < cdcf->Size) {
+            result = width;
+        } else {
+            result = cdcf->Size;
+        }
+        cdcf->Total = result;
+    }
+    return (result);
+}
+
+static CO_ERR COTCdcfRead(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    CO_OBJ_CDCF *cdcf;
+    CO_ERR       err;
+    uint8_t     *dst;
+    uint32_t     num;
+    uint32_t     len;
+
+    ASSERT_PTR_ERR(obj->Data, CO_ERR_BAD_ARG);
+
+    cdcf = (CO_OBJ_CDCF *)(obj->Data);
+    dst  = (uint8_t *)buffer;
+    if (cdcf->Keys == 0) {
+        return (CO_ERR_OBJ_ACC);
+    }
+
+    /* take the snapshot of the entries with the first chunk */
+    if (cdcf->Offset == 0) {
+        err = COTCdcfSnap(cdcf, node);
+        if (err != CO_ERR_NONE) {
+            return (CO_ERR_TYPE_RD);
+        }
+    }
+
+    /* set length to minimum of buffer and remaining snapshot size */
+    num = cdcf->Pos - cdcf->Offset;
+    if (num >= size) {
+        len = size;
+    } else {
+        len = num;
+    }
+    while (len > 0) {
+        *dst = cdcf->Start[cdcf->Offset];
+        dst++;
+        len--;
+        cdcf->Offset++;
+    }
+
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR COTCdcfWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    CO_OBJ_CDCF *cdcf;
+    CO_ERR       err;
+    uint8_t     *src;
+    uint32_t     num;
+    uint32_t     len;
+
+    ASSERT_PTR_ERR(obj->Data, CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(node, CO_ERR_BAD_ARG);
+
+    cdcf = (CO_OBJ_CDCF *)(obj->Data);
+    src  = (uint8_t *)buffer;
+    if (cdcf->Offset == 0) {
+        cdcf->Pos = CO_CDCF_HEAD;
+        cdcf->Rec = 0;
+        cdcf->Err = 0;
+    }
+
+    /* collect the chunk in the buffer */
+    if (size > (cdcf->Size - cdcf->Offset)) {
+        cdcf->Offset = 0;
+        return (CO_ERR_TYPE_WR);
+    }
+    while (size > 0) {
+        cdcf->Start[cdcf->Offset] = *src;
+        src++;
+        size--;
+        cdcf->Offset++;
+    }
+    if (cdcf->Offset < CO_CDCF_HEAD) {
+        return (COTCdcfWait(cdcf));
+    }
+
+    /* skip all complete records */
+    num = COTCdcfGet(&cdcf->Start[0], 4);
+    while ((cdcf->Rec < num) &&
+           ((cdcf->Offset - cdcf->Pos) >= CO_CDCF_REC)) {
+        len = COTCdcfGet(&cdcf->Start[cdcf->Pos + 3u], 4);
+        if (len > (cdcf->Offset - cdcf->Pos - CO_CDCF_REC)) {
+            break;
+        }
+        cdcf->Pos += CO_CDCF_REC + len;
+        cdcf->Rec++;
+    }
+    if (cdcf->Rec < num) {
+        return (COTCdcfWait(cdcf));
+    }
+
+    /* all records are received: check and write them in a single pass */
+    err = CO_ERR_TYPE_WR;
+    if (cdcf->Pos == cdcf->Offset) {
+        if (COTCdcfCheck(obj, cdcf, node) == CO_ERR_NONE) {
+            err = COTCdcfApply(cdcf, node);
+        }
+    }
+    cdcf->Offset = 0;
+    cdcf->Total  = 0;
+    return (err);
+}
+
+static CO_ERR COTCdcfInit(struct CO_OBJ_T *obj, struct CO_NODE_T *node)
+{
+    CO_OBJ_CDCF *cdcf;
+
+    CO_UNUSED(node);
+    ASSERT_PTR_ERR(obj->Data, CO_ERR_BAD_ARG);
+
+    cdcf = (CO_OBJ_CDCF *)(obj->Data);
+    cdcf->Offset = 0;
+    cdcf->Pos    = 0;
+    cdcf->Rec    = 0;
+    cdcf->Err    = 0;
+    cdcf->Total  = 0;
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR COTCdcfReset(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t para)
+{
+    CO_OBJ_CDCF *cdcf;
+
+    CO_UNUSED(node);
+    ASSERT_PTR_ERR(obj->Data, CO_ERR_BAD_ARG);
+
+    cdcf = (CO_OBJ_CDCF *)(obj->Data);
+    cdcf->Offset = para;
+    return (CO_ERR_NONE);
+}
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+
+/* The concise DCF is stored in little endian byte order */
+static uint32_t COTCdcfGet(uint8_t *buf, uint8_t width)
+{
+    uint32_t result = 0;
+
+    while (width > 0u) {
+        width--;
+        result = (result << 8) | (uint32_t)buf[width];
+    }
+    return (result);
+}
+
+static void COTCdcfSet(uint8_t *buf, uint32_t val, uint8_t width)
+{
+    uint8_t n;
+
+    for (n = 0; n < width; n++) {
+        buf[n] = (uint8_t)val;
+        val  >>= 8;
+    }
+}
+
+/* Basic entries are accessed as value like with an expedited SDO transfer,
+ * all other entries as buffer like with a segmented SDO transfer.
+ */
+static CO_ERR COTCdcfRdEntry(CO_OBJ *entry, struct CO_NODE_T *node, uint8_t *buf, uint32_t len)
+{
+    CO_ERR   err;
+    uint32_t val = 0;
+
+    if (len <= 4u) {
+        err = COObjRdValue(entry, node, (void *)&val, (uint8_t)len);
+        COTCdcfSet(buf, val, (uint8_t)len);
+    } else {
+        err = COObjRdBufStart(entry, node, buf, len);
+    }
+    return (err);
+}
+
+static CO_ERR COTCdcfWrEntry(CO_OBJ *entry, struct CO_NODE_T *node, uint8_t *buf, uint32_t len)
+{
+    CO_ERR   err;
+    uint32_t val;
+
+    if (len <= 4u) {
+        val = COTCdcfGet(buf, (uint8_t)len);
+        err = COObjWrValue(entry, node, (void *)&val, (uint8_t)len);
+    } else {
+        err = COObjWrBufStart(entry, node, buf, len);
+    }
+    return (err);
+}
+
+static uint32_t COTCdcfSnapSize(CO_OBJ_CDCF *cdcf, struct CO_NODE_T *node)
+{
+    CO_OBJ  *entry;
+    uint32_t result = CO_CDCF_HEAD;
+    uint16_t n;
+
+    for (n = 0; n < cdcf->Num; n++) {
+        entry = CODictFind(&node->Dict, cdcf->Keys[n]);
+        if (entry == 0) {
+            return (0);
+        }
+        result += CO_CDCF_REC + COObjGetSize(entry, node, 0);
+    }
+    if (result > cdcf->Size) {
+        result = 0;
+    }
+    return (result);
+}
+
+static CO_ERR COTCdcfSnap(CO_OBJ_CDCF *cdcf, struct CO_NODE_T *node)
+{
+    CO_OBJ  *entry;
+    CO_ERR   err;
+    uint32_t pos = CO_CDCF_HEAD;
+    uint32_t len;
+    uint16_t n;
+
+    for (n = 0; n < cdcf->Num; n++) {
+        entry = CODictFind(&node->Dict, cdcf->Keys[n]);
+        if (entry == 0) {
+            return (CO_ERR_OBJ_NOT_FOUND);
+        }
+        len = COObjGetSize(entry, node, 0);
+        if ((len == 0) || ((pos + CO_CDCF_REC + len) > cdcf->Size)) {
+            return (CO_ERR_OBJ_SIZE);
+        }
+        COTCdcfSet(&cdcf->Start[pos],      CO_GET_IDX(cdcf->Keys[n]), 2);
+        COTCdcfSet(&cdcf->Start[pos + 2u], CO_GET_SUB(cdcf->Keys[n]), 1);
+        COTCdcfSet(&cdcf->Start[pos + 3u], len, 4);
+        err = COTCdcfRdEntry(entry, node, &cdcf->Start[pos + CO_CDCF_REC], len);
+        if (err != CO_ERR_NONE) {
+            return (err);
+        }
+        pos += CO_CDCF_REC + len;
+    }
+    COTCdcfSet(&cdcf->Start[0], cdcf->Num, 4);
+    cdcf->Pos = pos;
+    return (CO_ERR_NONE);
+}
+
+/* All records must address existing and writable entries (except this
+ * object) with the size of the entry, and the old values of all records
+ * must fit into the rollback memory. Nothing is written before.
+ */
+static CO_ERR COTCdcfCheck(CO_OBJ *obj, CO_OBJ_CDCF *cdcf, struct CO_NODE_T *node)
+{
+    CO_OBJ  *entry;
+    uint32_t num = cdcf->Rec;
+    uint32_t pos = CO_CDCF_HEAD;
+    uint32_t undo = 0;
+    uint32_t key;
+    uint32_t len;
+
+    while (num > 0) {
+        key   = CO_DEV(COTCdcfGet(&cdcf->Start[pos], 2),
+                       COTCdcfGet(&cdcf->Start[pos + 2u], 1));
+        len   = COTCdcfGet(&cdcf->Start[pos + 3u], 4);
+        undo += len;
+        entry = CODictFind(&node->Dict, key);
+        if ((entry == 0) || (entry == obj)              ||
+            (CO_IS_WRITE(entry->Key) == 0)              ||
+            (COObjGetSize(entry, node, len) != len)     ||
+            (undo > cdcf->UndoSize)) {
+            cdcf->Err = key;
+            return (CO_ERR_TYPE_WR);
+        }
+        pos += CO_CDCF_REC + len;
+        num--;
+    }
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR COTCdcfApply(CO_OBJ_CDCF *cdcf, struct CO_NODE_T *node)
+{
+    CO_OBJ  *entry;
+    CO_ERR   err;
+    uint32_t pos  = CO_CDCF_HEAD;
+    uint32_t undo = 0;
+    uint32_t key;
+    uint32_t len;
+    uint32_t n;
+
+    for (n = 0; n < cdcf->Rec; n++) {
+        key   = CO_DEV(COTCdcfGet(&cdcf->Start[pos], 2),
+                       COTCdcfGet(&cdcf->Start[pos + 2u], 1));
+        len   = COTCdcfGet(&cdcf->Start[pos + 3u], 4);
+        entry = CODictFind(&node->Dict, key);
+        err   = COTCdcfRdEntry(entry, node, &cdcf->Undo[undo], len);
+        if (err == CO_ERR_NONE) {
+            err = COTCdcfWrEntry(entry, node, &cdcf->Start[pos + CO_CDCF_REC], len);
+        }
+        if (err != CO_ERR_NONE) {
+            cdcf->Err = key;
+            COTCdcfUndo(cdcf, node, n);
+            return (CO_ERR_TYPE_WR);
+        }
+        undo += len;
+        pos  += CO_CDCF_REC + len;
+    }
+    return (CO_ERR_NONE);
+}
+
+/* Restore the old values of the given number of written records in reverse
+ * order, so an entry, which is written twice, gets the value before the
+ * concise DCF. The restore is done on best effort.
+ */
+static void COTCdcfUndo(CO_OBJ_CDCF *cdcf, struct CO_NODE_T *node, uint32_t num)
+{
+    CO_OBJ  *entry;
+    uint32_t pos;
+    uint32_t undo;
+    uint32_t key;
+    uint32_t len;
+    uint32_t n;
+
+    while (num > 0) {
+        num--;
+        pos  = CO_CDCF_HEAD;
+        undo = 0;
+        for (n = 0; n < num; n++) {
+            len   = COTCdcfGet(&cdcf->Start[pos + 3u], 4);
+            undo += len;
+            pos  += CO_CDCF_REC + len;
+        }
+        key   = CO_DEV(COTCdcfGet(&cdcf->Start[pos], 2),
+                       COTCdcfGet(&cdcf->Start[pos + 2u], 1));
+        len   = COTCdcfGet(&cdcf->Start[pos + 3u], 4);
+        entry = CODictFind(&node->Dict, key);
+        (void)COTCdcfWrEntry(entry, node, &cdcf->Undo[undo], len);
+    }
+}
+
+/* Records are missing after the received chunk. The download is truncated,
+ * when the announced size of the download is received already; nothing is
+ * written in this case.
+ */
+static CO_ERR COTCdcfWait(CO_OBJ_CDCF *cdcf)
+{
+    if ((cdcf->Total != 0u) && (cdcf->Offset >= cdcf->Total)) {
+        cdcf->Offset = 0;
+        cdcf->Total  = 0;
+        return (CO_ERR_TYPE_WR);
+    }
+    return (CO_ERR_NONE);
+}
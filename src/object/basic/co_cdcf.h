@@ -0,0 +1,103 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_CDCF_H_
+#define CO_CDCF_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_err.h"
+#include "co_obj.h"
+
+/******************************************************************************
+* DEFINES
+******************************************************************************/
+
+#define CO_TCDCF  ((const CO_OBJ_TYPE *)&COTCdcf)
+
+#define CO_CDCF_HEAD    4u       /*!< size of the number of entries          */
+#define CO_CDCF_REC     7u       /*!< size of index, subindex and data size  */
+
+/******************************************************************************
+* PUBLIC TYPE DEFINITION
+******************************************************************************/
+
+/*! \brief CONCISE DCF MANAGEMENT STRUCTURE
+*
+*    This structure holds all data, which are needed for the concise DCF
+*    object management within the object dictionary. The buffer holds the
+*    received concise DCF until all records are complete, or the snapshot
+*    of the listed entries while it is read.
+*/
+typedef struct CO_OBJ_CDCF_T {
+    uint32_t        Offset;            /*!< Internal offset information      */
+    uint32_t        Size;              /*!< Buffer size information          */
+    uint8_t        *Start;             /*!< Buffer start address             */
+    const uint32_t *Keys;              /*!< snapshot entries (0: write only) */
+    uint16_t        Num;               /*!< number of snapshot entries       */
+    uint8_t        *Undo;              /*!< rollback memory for old values   */
+    uint32_t        UndoSize;          /*!< rollback memory size             */
+    uint32_t        Pos;               /*!< Internal end of parsed records   */
+    uint32_t        Rec;               /*!< Internal number of parsed records*/
+    uint32_t        Err;               /*!< entry of the failed record (0: ok)*/
+    uint32_t        Total;             /*!< announced download size (0: none)*/
+
+} CO_OBJ_CDCF;
+
+/******************************************************************************
+* PUBLIC CONSTANTS
+******************************************************************************/
+
+/*! \brief OBJECT TYPE CONCISE DCF
+*
+*    This type is responsible for the configuration of many object entries
+*    with a single SDO transfer. The object entry member 'Data' holds the
+*    concise DCF management structure. The data format is the concise DCF
+*    of CiA 302: the number of entries (UNSIGNED32), followed by a record
+*    for each entry with the index (UNSIGNED16), the subindex (UNSIGNED8),
+*    the data size (UNSIGNED32) and the data.
+*
+*    A download is collected in the buffer. When the last record is
+*    received, all records are checked (existing and writable entry with
+*    matching size, enough rollback memory) before the records are written
+*    in the given order. When writing a record fails, the already written
+*    entries are restored in reverse order and the transfer is aborted. The
+*    key (CO_DEV) of the failing record is stored in the member 'Err'. A
+*    download, which ends with the announced transfer size before all
+*    records are received, is aborted without writing a record.
+*
+*    An upload returns the snapshot of the entries, which are listed in the
+*    member 'Keys', in the same format.
+*
+* \note
+*    The records are written with the type functions of the entries, so
+*    the checks of the entries (e.g. PDO configuration) are applied. The
+*    rollback memory must hold the data of all records of a download.
+*/
+extern const CO_OBJ_TYPE COTCdcf;
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif  /* #ifndef CO_CDCF_H_ */
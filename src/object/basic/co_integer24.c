@@ -0,0 +1,145 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define COT_ENTRY_SIZE    (uint32_t)3
+#define COT_ENTRY_MASK    (uint32_t)0x00FFFFFF
+#define COT_ENTRY_SIGN    (uint32_t)0x00800000
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTInt24Size (struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width);
+static CO_ERR   COTInt24Read (struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+static CO_ERR   COTInt24Write(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+static uint32_t COTInt24Value(struct CO_OBJ_T *obj, uint32_t value);
+
+/******************************************************************************
+* PUBLIC GLOBALS
+******************************************************************************/
+
+const CO_OBJ_TYPE COTUInt24 = { COTInt24Size, 0, COTInt24Read, COTInt24Write, 0 };
+const CO_OBJ_TYPE COTSInt24 = { COTInt24Size, 0, COTInt24Read, COTInt24Write, 0 };
+
+/******************************************************************************
+* FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTInt24Size(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    uint32_t result = (uint32_t)0;
+
+    CO_UNUSED(node);
+    CO_UNUSED(width);
+
+    if (CO_IS_DIRECT(obj->Key) != 0) {
+        result = (uint32_t)COT_ENTRY_SIZE;
+    } else {
+        /* check for valid reference */
+        if ((obj->Data) != (CO_DATA)0) {
+            result = (uint32_t)COT_ENTRY_SIZE;
+        }
+    }
+    return (result);
+}
+
+static CO_ERR COTInt24Read(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    CO_ERR   result = CO_ERR_NONE;
+    uint8_t *dst    = (uint8_t *)buffer;
+    uint32_t value;
+
+    CO_UNUSED(node);
+    ASSERT_PTR_ERR(obj, CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(buffer, CO_ERR_BAD_ARG);
+
+    if (CO_IS_DIRECT(obj->Key) != 0) {
+        value = (uint32_t)(obj->Data);
+    } else {
+        value = *((uint32_t *)(obj->Data));
+    }
+    if (CO_IS_NODEID(obj->Key) != 0) {
+        value += node->NodeId;
+    }
+    if (size == COT_ENTRY_SIZE) {
+        dst[0] = (uint8_t)(value      );
+        dst[1] = (uint8_t)(value >>  8);
+        dst[2] = (uint8_t)(value >> 16);
+    } else {
+        result = CO_ERR_BAD_ARG;
+    }
+    return (result);
+}
+
+static CO_ERR COTInt24Write(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    CO_ERR   result = CO_ERR_NONE;
+    uint8_t *src    = (uint8_t *)buffer;
+    uint32_t value;
+    uint32_t oldValue;
+
+    CO_UNUSED(node);
+    ASSERT_PTR_ERR(obj, CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(buffer, CO_ERR_BAD_ARG);
+
+    if (size == COT_ENTRY_SIZE) {
+        value = ((uint32_t)src[0]      ) |
+                ((uint32_t)src[1] <<  8) |
+                ((uint32_t)src[2] << 16);
+        if (CO_IS_NODEID(obj->Key) != 0) {
+            value -= node->NodeId;
+        }
+        value = COTInt24Value(obj, value);
+        if (CO_IS_DIRECT(obj->Key) != 0) {
+            oldValue = (uint32_t)obj->Data;
+            obj->Data = (CO_DATA)(value);
+        } else {
+            oldValue = *((uint32_t *)(obj->Data));
+            *((uint32_t *)(obj->Data)) = value;
+        }
+        if ((CO_IS_ASYNC(obj->Key)  != 0    ) &&
+            (CO_IS_PDOMAP(obj->Key) != 0    ) &&
+            (oldValue               != value)) {
+            COTPdoTrigObj(node->TPdo, obj);
+        }
+    } else {
+        result = CO_ERR_BAD_ARG;
+    }
+    return (result);
+}
+
+/* The 24bit value is held in 32bit: clear the upper byte of an unsigned
+ * value, extend the sign of a signed value.
+ */
+static uint32_t COTInt24Value(struct CO_OBJ_T *obj, uint32_t value)
+{
+    value &= COT_ENTRY_MASK;
+    if ((obj->Type == CO_TSIGNED24) && ((value & COT_ENTRY_SIGN) != 0u)) {
+        value |= ~COT_ENTRY_MASK;
+    }
+    return (value);
+}
@@ -0,0 +1,68 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+#ifndef CO_INTEGER24_H_
+#define CO_INTEGER24_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_err.h"
+#include "co_obj.h"
+
+/******************************************************************************
+* DEFINES
+******************************************************************************/
+
+#define CO_TUNSIGNED24  ((const CO_OBJ_TYPE *)&COTUInt24)
+#define CO_TSIGNED24    ((const CO_OBJ_TYPE *)&COTSInt24)
+
+/******************************************************************************
+* PUBLIC CONSTANTS
+******************************************************************************/
+
+/*! \brief OBJECT TYPE UNSIGNED24
+*
+*    This type is a basic type for unsigned 24bit values. The value is
+*    stored in a 32bit variable; the upper byte is cleared with each write
+*    access. The value is read and written as a sequence of 3 bytes in the
+*    CANopen byte order (little endian), so the entry is accessed with
+*    CODictRdBuffer() and CODictWrBuffer() instead of CODictRdLong() and
+*    CODictWrLong().
+*/
+extern const CO_OBJ_TYPE COTUInt24;
+
+/*! \brief OBJECT TYPE SIGNED24
+*
+*    This type is a basic type for signed 24bit values. The value is
+*    stored in a 32bit variable; the upper byte is sign extended with each
+*    write access. The value is read and written as a sequence of 3 bytes
+*    in the CANopen byte order (little endian).
+*/
+extern const CO_OBJ_TYPE COTSInt24;
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif  /* #ifndef CO_INTEGER24_H_ */
@@ -35,15 +35,16 @@ extern "C" {
 
 #define CO_TUNSIGNED32  ((const CO_OBJ_TYPE *)&COTInt32)
 #define CO_TSIGNED32    ((const CO_OBJ_TYPE *)&COTInt32)
+#define CO_TREAL32      ((const CO_OBJ_TYPE *)&COTInt32)
 
 /******************************************************************************
 * PUBLIC CONSTANTS
 ******************************************************************************/
 
-/*! \brief OBJECT TYPE SIGNED32 / UNSIGNED32
+/*! \brief OBJECT TYPE SIGNED32 / UNSIGNED32 / REAL32
 *
-*    This type is a basic type for 32bit values, regardless of signed or
-*    unsigned usage.
+*    This type is a basic type for 32bit values, regardless of signed,
+*    unsigned or floating point usage.
 */
 extern const CO_OBJ_TYPE COTInt32;
 
@@ -0,0 +1,144 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTInt64Size (struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width);
+static CO_ERR   COTInt64Read (struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+static CO_ERR   COTInt64Write(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+static uint32_t COTInt64Width(const CO_OBJ_TYPE *type);
+
+/******************************************************************************
+* PUBLIC GLOBALS
+******************************************************************************/
+
+const CO_OBJ_TYPE COTInt64  = { COTInt64Size, 0, COTInt64Read, COTInt64Write, 0 };
+const CO_OBJ_TYPE COTUInt40 = { COTInt64Size, 0, COTInt64Read, COTInt64Write, 0 };
+const CO_OBJ_TYPE COTUInt48 = { COTInt64Size, 0, COTInt64Read, COTInt64Write, 0 };
+const CO_OBJ_TYPE COTUInt56 = { COTInt64Size, 0, COTInt64Read, COTInt64Write, 0 };
+const CO_OBJ_TYPE COTSInt40 = { COTInt64Size, 0, COTInt64Read, COTInt64Write, 0 };
+const CO_OBJ_TYPE COTSInt48 = { COTInt64Size, 0, COTInt64Read, COTInt64Write, 0 };
+const CO_OBJ_TYPE COTSInt56 = { COTInt64Size, 0, COTInt64Read, COTInt64Write, 0 };
+
+/******************************************************************************
+* FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTInt64Size(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    uint32_t result = (uint32_t)0;
+
+    CO_UNUSED(node);
+    CO_UNUSED(width);
+
+    /* the value doesn't fit into the entry: a reference is needed */
+    if ((CO_IS_DIRECT(obj->Key) == 0) &&
+        ((obj->Data) != (CO_DATA)0)) {
+        result = COTInt64Width(obj->Type);
+    }
+    return (result);
+}
+
+static CO_ERR COTInt64Read(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    uint8_t  *dst = (uint8_t *)buffer;
+    uint64_t  value;
+    uint32_t  n;
+
+    CO_UNUSED(node);
+    ASSERT_PTR_ERR(obj, CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(buffer, CO_ERR_BAD_ARG);
+
+    if ((CO_IS_DIRECT(obj->Key) != 0) ||
+        (size != COTInt64Width(obj->Type))) {
+        return (CO_ERR_BAD_ARG);
+    }
+    value = *((uint64_t *)(obj->Data));
+    if (CO_IS_NODEID(obj->Key) != 0) {
+        value += node->NodeId;
+    }
+    for (n = 0; n < size; n++) {
+        dst[n] = (uint8_t)value;
+        value >>= 8;
+    }
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR COTInt64Write(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    uint8_t  *src = (uint8_t *)buffer;
+    uint64_t  value = 0;
+    uint64_t  oldValue;
+    uint32_t  n;
+
+    CO_UNUSED(node);
+    ASSERT_PTR_ERR(obj, CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(buffer, CO_ERR_BAD_ARG);
+
+    if ((CO_IS_DIRECT(obj->Key) != 0) ||
+        (size != COTInt64Width(obj->Type))) {
+        return (CO_ERR_BAD_ARG);
+    }
+    for (n = size; n > 0u; n--) {
+        value = (value << 8) | src[n - 1u];
+    }
+    if (CO_IS_NODEID(obj->Key) != 0) {
+        value -= node->NodeId;
+    }
+    if (size < 8u) {
+        value &= ((uint64_t)1 << (size * 8u)) - 1u;
+        if (((obj->Type == CO_TSIGNED40) ||
+             (obj->Type == CO_TSIGNED48) ||
+             (obj->Type == CO_TSIGNED56)) &&
+            ((value >> ((size * 8u) - 1u)) != 0u)) {
+            value |= ~(uint64_t)0 << (size * 8u);
+        }
+    }
+    oldValue = *((uint64_t *)(obj->Data));
+    *((uint64_t *)(obj->Data)) = value;
+    if ((CO_IS_ASYNC(obj->Key)  != 0    ) &&
+        (CO_IS_PDOMAP(obj->Key) != 0    ) &&
+        (oldValue               != value)) {
+        COTPdoTrigObj(node->TPdo, obj);
+    }
+    return (CO_ERR_NONE);
+}
+
+/* All types share the functions: the type of the object entry selects the
+ * number of bytes.
+ */
+static uint32_t COTInt64Width(const CO_OBJ_TYPE *type)
+{
+    uint32_t result = 8u;
+
+    if ((type == CO_TUNSIGNED40) || (type == CO_TSIGNED40)) {
+        result = 5u;
+    } else if ((type == CO_TUNSIGNED48) || (type == CO_TSIGNED48)) {
+        result = 6u;
+    } else if ((type == CO_TUNSIGNED56) || (type == CO_TSIGNED56)) {
+        result = 7u;
+    }
+    return (result);
+}
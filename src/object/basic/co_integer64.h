@@ -0,0 +1,92 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+#ifndef CO_INTEGER64_H_
+#define CO_INTEGER64_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_err.h"
+#include "co_obj.h"
+
+/******************************************************************************
+* DEFINES
+******************************************************************************/
+
+#define CO_TUNSIGNED64  ((const CO_OBJ_TYPE *)&COTInt64)
+#define CO_TSIGNED64    ((const CO_OBJ_TYPE *)&COTInt64)
+#define CO_TREAL64      ((const CO_OBJ_TYPE *)&COTInt64)
+
+#define CO_TUNSIGNED40  ((const CO_OBJ_TYPE *)&COTUInt40)
+#define CO_TSIGNED40    ((const CO_OBJ_TYPE *)&COTSInt40)
+#define CO_TUNSIGNED48  ((const CO_OBJ_TYPE *)&COTUInt48)
+#define CO_TSIGNED48    ((const CO_OBJ_TYPE *)&COTSInt48)
+#define CO_TUNSIGNED56  ((const CO_OBJ_TYPE *)&COTUInt56)
+#define CO_TSIGNED56    ((const CO_OBJ_TYPE *)&COTSInt56)
+
+/******************************************************************************
+* PUBLIC CONSTANTS
+******************************************************************************/
+
+/*! \brief OBJECT TYPE SIGNED64 / UNSIGNED64 / REAL64
+*
+*    This type is a basic type for 64bit values, regardless of signed,
+*    unsigned or floating point usage. The object entry member 'Data' must
+*    reference the 64bit variable.
+*
+*    The value is read and written as a sequence of 8 bytes in the CANopen
+*    byte order (little endian), so the SDO server transfers the value in
+*    segments and the PDO packs the value into the frame without further
+*    conversion. On a little endian CPU, this is the memory layout of the
+*    64bit variable.
+*/
+extern const CO_OBJ_TYPE COTInt64;
+
+/*! \brief OBJECT TYPE UNSIGNED40 / UNSIGNED48 / UNSIGNED56
+*
+*    These types are basic types for unsigned 40, 48 and 56bit values. The
+*    value is stored in a 64bit variable; the upper bytes are cleared with
+*    each write access. The value is read and written as a sequence of 5,
+*    6 or 7 bytes in the CANopen byte order (little endian).
+*/
+extern const CO_OBJ_TYPE COTUInt40;
+extern const CO_OBJ_TYPE COTUInt48;
+extern const CO_OBJ_TYPE COTUInt56;
+
+/*! \brief OBJECT TYPE SIGNED40 / SIGNED48 / SIGNED56
+*
+*    These types are basic types for signed 40, 48 and 56bit values. The
+*    value is stored in a 64bit variable; the upper bytes are sign extended
+*    with each write access. The value is read and written as a sequence of
+*    5, 6 or 7 bytes in the CANopen byte order (little endian).
+*/
+extern const CO_OBJ_TYPE COTSInt40;
+extern const CO_OBJ_TYPE COTSInt48;
+extern const CO_OBJ_TYPE COTSInt56;
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif  /* #ifndef CO_INTEGER64_H_ */
@@ -0,0 +1,158 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTStreamSize (struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width);
+static CO_ERR   COTStreamRead (struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+static CO_ERR   COTStreamWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+static CO_ERR   COTStreamInit (struct CO_OBJ_T *obj, struct CO_NODE_T *node);
+static CO_ERR   COTStreamReset(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t para);
+
+/******************************************************************************
+* PUBLIC GLOBALS
+******************************************************************************/
+
+const CO_OBJ_TYPE COTStream = { COTStreamSize, COTStreamInit, COTStreamRead, COTStreamWrite, COTStreamReset };
+
+/******************************************************************************
+* FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTStreamSize(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    uint32_t       result = 0;
+    CO_OBJ_STREAM *stream;
+
+    CO_UNUSED(node);
+    ASSERT_PTR_ERR(obj->Data, 0);
+
+    stream = (CO_OBJ_STREAM *)(obj->Data);
+
+    /* given width of 0 returns stream size */
+    if (width == 0) {
+        result = stream->Size;
+    } else {
+
+        /* return minimum of given width and stream size */
+        if (width < stream->Size) {
+            result = width;
+        } else {
+            result = stream->Size;
+        }
+    }
+    return (result);
+}
+
+static CO_ERR COTStreamRead(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    CO_OBJ_STREAM *stream;
+    CO_ERR         err;
+    uint32_t       num;
+    uint32_t       len;
+
+    CO_UNUSED(node);
+    ASSERT_PTR_ERR(obj->Data, CO_ERR_BAD_ARG);
+
+    stream = (CO_OBJ_STREAM *)(obj->Data);
+    if (stream->Read == 0) {
+        return (CO_ERR_OBJ_ACC);
+    }
+
+    /* set length to minimum of buffer and remaining stream size */
+    num = stream->Size - stream->Offset;
+    if (num >= size) {
+        len = size;
+    } else {
+        len = num;
+    }
+
+    /* pass the chunk to the application */
+    if (len > 0) {
+        err = stream->Read(stream, stream->Offset, (uint8_t *)buffer, len);
+        if (err != CO_ERR_NONE) {
+            return (CO_ERR_TYPE_RD);
+        }
+        stream->Offset += len;
+    }
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR COTStreamWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    CO_OBJ_STREAM *stream;
+    CO_ERR         err;
+    uint32_t       num;
+    uint32_t       len;
+
+    CO_UNUSED(node);
+    ASSERT_PTR_ERR(obj->Data, CO_ERR_BAD_ARG);
+
+    stream = (CO_OBJ_STREAM *)(obj->Data);
+    if (stream->Write == 0) {
+        return (CO_ERR_OBJ_ACC);
+    }
+
+    /* set length to minimum of buffer and remaining stream size */
+    num = stream->Size - stream->Offset;
+    if (num >= size) {
+        len = size;
+    } else {
+        len = num;
+    }
+
+    /* pass the chunk to the application */
+    if (len > 0) {
+        err = stream->Write(stream, stream->Offset, (uint8_t *)buffer, len);
+        if (err != CO_ERR_NONE) {
+            return (CO_ERR_TYPE_WR);
+        }
+        stream->Offset += len;
+    }
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR COTStreamInit(struct CO_OBJ_T *obj, struct CO_NODE_T *node)
+{
+    CO_OBJ_STREAM *stream;
+
+    CO_UNUSED(node);
+    ASSERT_PTR_ERR(obj->Data, CO_ERR_BAD_ARG);
+
+    stream = (CO_OBJ_STREAM *)(obj->Data);
+    stream->Offset = 0;
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR COTStreamReset(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t para)
+{
+    CO_OBJ_STREAM *stream;
+
+    CO_UNUSED(node);
+    ASSERT_PTR_ERR(obj->Data, CO_ERR_BAD_ARG);
+
+    stream = (CO_OBJ_STREAM *)(obj->Data);
+    stream->Offset = para;
+    return (CO_ERR_NONE);
+}
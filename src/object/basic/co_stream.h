@@ -0,0 +1,103 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_STREAM_H_
+#define CO_STREAM_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_err.h"
+#include "co_obj.h"
+
+/******************************************************************************
+* DEFINES
+******************************************************************************/
+
+#define CO_TSTREAM  ((const CO_OBJ_TYPE *)&COTStream)
+
+/******************************************************************************
+* PUBLIC TYPE DEFINITION
+******************************************************************************/
+
+struct CO_OBJ_STREAM_T;          /* Declaration of stream structure          */
+
+/*! \brief STREAM ACCESS FUNCTION
+*
+*    This function type transfers a chunk of the stream data between the
+*    given buffer and the storage of the application (e.g. a file).
+*
+* \param stream
+*    reference to the stream management structure
+*
+* \param offset
+*    byte offset of the chunk within the stream
+*
+* \param buf
+*    reference to the chunk data
+*
+* \param len
+*    length of the chunk in bytes
+*
+* \retval   =CO_ERR_NONE    chunk is transfered
+* \retval  !=CO_ERR_NONE    error in the storage of the application
+*/
+typedef CO_ERR (*CO_STREAM_FUNC)(struct CO_OBJ_STREAM_T *stream, uint32_t offset, uint8_t *buf, uint32_t len);
+
+/*! \brief STREAM MANAGEMENT STRUCTURE
+*
+*    This structure holds all data, which are needed for the stream object
+*    management within the object dictionary.
+*/
+typedef struct CO_OBJ_STREAM_T {
+    uint32_t        Offset;            /*!< Internal offset information      */
+    uint32_t        Size;              /*!< Stream size information          */
+    CO_STREAM_FUNC  Read;              /*!< read chunk (0: not readable)     */
+    CO_STREAM_FUNC  Write;             /*!< write chunk (0: not writable)    */
+    void           *Ctx;               /*!< application context (e.g. file)  */
+
+} CO_OBJ_STREAM;
+
+/******************************************************************************
+* PUBLIC CONSTANTS
+******************************************************************************/
+
+/*! \brief OBJECT TYPE STREAM
+*
+*    This type is responsible for the access to large domains, which are not
+*    resident in memory (e.g. firmware images in a file). The object entry
+*    member 'Data' holds the stream management structure. The SDO transfers
+*    pass each received or requested chunk of the SDO transfer buffer to the
+*    access functions of the application, together with the byte offset of
+*    the chunk within the stream.
+*
+* \note
+*    The SDO transfers call the access functions in ascending order of the
+*    offsets. A new transfer starts with offset 0.
+*/
+extern const CO_OBJ_TYPE COTStream;
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif  /* #ifndef CO_STREAM_H_ */
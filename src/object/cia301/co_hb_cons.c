@@ -221,6 +221,7 @@ CO_ERR CONmtHbConsActivate(CO_HBCONS *hbc, uint16_t time, uint8_t nodeid)
             hbc->Next   = 0;
         }
     }
+    CO_DISP_INVALIDATE(nmt->Node);
 
     return (result);
 }
@@ -257,11 +258,8 @@ static void CONmtHbConsMonitor(void *parg)
 int16_t CONmtHbConsCheck(CO_NMT *nmt, CO_IF_FRM *frm)
 {
     CO_HBCONS *hbc;
-    CO_TMR    *tmr;
-    CO_MODE    state;
     int16_t    result = -1;
     uint32_t   cobid;
-    uint32_t   ticks;
     uint8_t    nodeid;
 
     cobid  = frm->Identifier;
@@ -275,29 +273,11 @@ int16_t CONmtHbConsCheck(CO_NMT *nmt, CO_IF_FRM *frm)
     } else {
         return (result);
     }
-    tmr = &nmt->Node->Tmr;
     while (hbc != 0) {
         if (hbc->NodeId != nodeid) {
             hbc = hbc->Next;
         } else {
-            if (hbc->Tmr >= 0) {
-                COTmrDelete(tmr, hbc->Tmr);
-            }
-            ticks = COTmrGetTicks(tmr, hbc->Time, CO_TMR_UNIT_1MS);
-            hbc->Tmr = COTmrCreate(tmr,
-                ticks,
-                0,
-                CONmtHbConsMonitor,
-                hbc);
-            if (hbc->Tmr < 0) {
-                nmt->Node->Error = CO_ERR_TMR_CREATE;
-            }
-            state = CONmtModeDecode(frm->Data[0]);
-            if (hbc->State != state) {
-                CONmtHbConsChange(nmt, hbc->NodeId, state);
-            }
-            hbc->State = state;
-            result     = (int16_t)hbc->NodeId;
+            result = CONmtHbConsUpdate(hbc, frm);
             break;
         }
     }
@@ -305,6 +285,36 @@ int16_t CONmtHbConsCheck(CO_NMT *nmt, CO_IF_FRM *frm)
     return (result);
 }
 
+int16_t CONmtHbConsUpdate(CO_HBCONS *hbc, CO_IF_FRM *frm)
+{
+    CO_NMT    *nmt;
+    CO_TMR    *tmr;
+    CO_MODE    state;
+    uint32_t   ticks;
+
+    nmt = &hbc->Node->Nmt;
+    tmr = &hbc->Node->Tmr;
+    if (hbc->Tmr >= 0) {
+        COTmrDelete(tmr, hbc->Tmr);
+    }
+    ticks = COTmrGetTicks(tmr, hbc->Time, CO_TMR_UNIT_1MS);
+    hbc->Tmr = COTmrCreate(tmr,
+        ticks,
+        0,
+        CONmtHbConsMonitor,
+        hbc);
+    if (hbc->Tmr < 0) {
+        nmt->Node->Error = CO_ERR_TMR_CREATE;
+    }
+    state = CONmtModeDecode(frm->Data[0]);
+    if (hbc->State != state) {
+        CONmtHbConsChange(nmt, hbc->NodeId, state);
+    }
+    hbc->State = state;
+
+    return ((int16_t)hbc->NodeId);
+}
+
 /******************************************************************************
 * PUBLIC API FUNCTION
 ******************************************************************************/
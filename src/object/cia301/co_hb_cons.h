@@ -74,6 +74,8 @@ extern const CO_OBJ_TYPE COTNmtHbCons;
 
 int16_t CONmtHbConsCheck(CO_NMT *nmt, CO_IF_FRM *frm);
 
+int16_t CONmtHbConsUpdate(CO_HBCONS *hbc, CO_IF_FRM *frm);
+
 /******************************************************************************
 * PUBLIC API FUNCTION
 ******************************************************************************/
@@ -171,7 +171,7 @@ CO_ERR COParaRestore(struct CO_PARA_T *pg, struct CO_NODE_T *node)
 
     /* call default callback function */
     if ((pg->Value & CO_PARA___E) != 0) {
-        err = COParaDefault(pg);
+        err = COParaDefault(pg, node);
         if (err != CO_ERR_NONE) {
             result = CO_ERR_PARA_RESTORE;
         }
@@ -0,0 +1,129 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define COT_ENTRY_SIZE    (uint32_t)4
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTSdoStatSize (struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width);
+static CO_ERR   COTSdoStatRead (struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+static CO_ERR   COTSdoStatWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size);
+
+/******************************************************************************
+* PUBLIC GLOBALS
+******************************************************************************/
+
+const CO_OBJ_TYPE COTSdoStat = { COTSdoStatSize, 0, COTSdoStatRead, COTSdoStatWrite, 0 };
+
+/******************************************************************************
+* PRIVATE TYPE FUNCTIONS
+******************************************************************************/
+
+static uint32_t COTSdoStatSize(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    uint32_t result = (uint32_t)0;
+    uint8_t  sub;
+
+    CO_UNUSED(node);
+    CO_UNUSED(width);
+
+    sub = CO_GET_SUB(obj->Key);
+    if ((obj->Data != (CO_DATA)0) &&
+        (sub       >= CO_SDO_STAT_SUB_NUM) &&
+        (sub       <  CO_SDO_STAT_SUB_N)) {
+        result = COT_ENTRY_SIZE;
+    }
+    return (result);
+}
+
+static CO_ERR COTSdoStatRead(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    CO_SDO_STAT *stat;
+    uint32_t     value;
+    uint8_t      sub;
+    uint8_t      n;
+
+    CO_UNUSED(node);
+    ASSERT_PTR_ERR(obj, CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(buffer, CO_ERR_BAD_ARG);
+
+    stat = (CO_SDO_STAT *)(obj->Data);
+    sub  = CO_GET_SUB(obj->Key);
+    if ((stat == NULL) || (size != COT_ENTRY_SIZE)) {
+        return (CO_ERR_BAD_ARG);
+    }
+
+    if (sub < CO_SDO_STAT_SUB_NUM) {
+        return (CO_ERR_TYPE_RD);
+    } else if (sub < CO_SDO_STAT_SUB_BYTES) {
+        value = stat->Num[sub - CO_SDO_STAT_SUB_NUM];
+    } else if (sub == CO_SDO_STAT_SUB_BYTES) {
+        value = stat->Bytes;
+    } else if (sub == CO_SDO_STAT_SUB_ABORT) {
+        value = stat->Abort;
+    } else if (sub == CO_SDO_STAT_SUB_TMO) {
+        value = stat->Timeout;
+    } else if (sub == CO_SDO_STAT_SUB_OTHER) {
+        value = stat->Other;
+    } else if (sub < CO_SDO_STAT_SUB_CODE) {
+        value = stat->Hist[sub - CO_SDO_STAT_SUB_HIST];
+    } else if (sub < CO_SDO_STAT_SUB_N) {
+        n = (uint8_t)(sub - CO_SDO_STAT_SUB_CODE);
+        if ((n & 0x01u) == 0u) {
+            value = stat->Code[n >> 1u].Code;
+        } else {
+            value = stat->Code[n >> 1u].Num;
+        }
+    } else {
+        return (CO_ERR_TYPE_RD);
+    }
+    *((uint32_t *)buffer) = value;
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR COTSdoStatWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    CO_SDO_STAT *stat;
+
+    CO_UNUSED(node);
+    ASSERT_PTR_ERR(obj, CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(buffer, CO_ERR_BAD_ARG);
+
+    stat = (CO_SDO_STAT *)(obj->Data);
+    if ((stat == NULL) || (size != COT_ENTRY_SIZE)) {
+        return (CO_ERR_BAD_ARG);
+    }
+
+    /* only value 0 is allowed to clear the statistics */
+    if (*((uint32_t *)buffer) != (uint32_t)0) {
+        return (CO_ERR_OBJ_RANGE);
+    }
+    COSdoStatClear(stat);
+    return (CO_ERR_NONE);
+}
@@ -0,0 +1,90 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+#ifndef CO_SDO_STAT_H_
+#define CO_SDO_STAT_H_
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_err.h"
+#include "co_obj.h"
+#include "co_sdo.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_TSDO_STAT  ((const CO_OBJ_TYPE *)&COTSdoStat)
+
+/*! \brief SDO STATISTICS SUBINDEX
+*
+*    These defines are the subindex of the first entry of each counter
+*    group within the SDO statistics object.
+* \{
+*/
+#define CO_SDO_STAT_SUB_NUM     1u   /*!< transfers per type (6 entries)    */
+#define CO_SDO_STAT_SUB_BYTES   7u   /*!< bytes of finished transfers       */
+#define CO_SDO_STAT_SUB_ABORT   8u   /*!< aborted transfers                 */
+#define CO_SDO_STAT_SUB_TMO     9u   /*!< aborts due to timeout             */
+#define CO_SDO_STAT_SUB_OTHER   10u  /*!< aborts with further codes         */
+#define CO_SDO_STAT_SUB_HIST    11u  /*!< histogram (CO_SDO_STAT_HIST_N)    */
+#define CO_SDO_STAT_SUB_CODE    (CO_SDO_STAT_SUB_HIST + CO_SDO_STAT_HIST_N)
+                                     /*!< abort code and number, in turns   */
+#define CO_SDO_STAT_SUB_N       (CO_SDO_STAT_SUB_CODE + (2u * CO_SDO_STAT_CODE_N))
+                                     /*!< number of used subindex           */
+/*! \} */
+
+#if (CO_SDO_STAT_HIST_N + (2 * CO_SDO_STAT_CODE_N)) > 244
+#error "CO_SDO_STAT_CODE_N: the SDO statistics object exceeds subindex 254"
+#endif
+
+/******************************************************************************
+* PUBLIC CONSTANTS
+******************************************************************************/
+
+/*! \brief OBJECT TYPE SDO STATISTICS
+*
+*    This type is responsible for the access to the statistics of an SDO
+*    server or SDO client within a manufacturer specific object. The object
+*    entry member 'Data' holds the reference to the statistics (e.g.
+*    &node.Sdo[0].Stat). Each subindex 1..CO_SDO_STAT_SUB_N-1 is an
+*    UNSIGNED32 counter; subindex 0 is a constant UNSIGNED8 entry with the
+*    highest subindex. Writing the value 0 to any counter with write access
+*    clears the statistics.
+*
+*    - 1..6: finished transfers (see \ref CO_SDO_STAT_TYPE)
+*    - 7: bytes of finished transfers
+*    - 8: aborted transfers
+*    - 9: aborts due to timeout
+*    - 10: aborts with codes, which are not counted separately
+*    - 11..: finished transfers per histogram bucket
+*    - CO_SDO_STAT_SUB_CODE..: abort code and number of aborts, in turns
+*/
+extern const CO_OBJ_TYPE COTSdoStat;
+
+#ifdef __cplusplus               /* for compatibility with C++ environments  */
+}
+#endif
+
+#endif  /* #ifndef CO_SDO_STAT_H_ */
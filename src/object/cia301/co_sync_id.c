@@ -71,6 +71,7 @@ static CO_ERR COTSyncIdWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void
 
     sync = &node->Sync;
     nid = *(uint32_t*)buffer;
+    CO_DISP_INVALIDATE(node);
     (void)uint32->Read(obj, node, &oid, 4);
 
     /* when current entry is generating SYNCs, bits 0 to 29 shall not be changed */
@@ -123,6 +124,7 @@ static CO_ERR COTSyncIdInit(struct CO_OBJ_T *obj, struct CO_NODE_T *node)
     /* check for emergency cob-id object */
     if (CO_DEV(COT_OBJECT, 0) == CO_GET_DEV(obj->Key)) {
         result = uint32->Read(obj, node, &node->Sync.CobId, 4);
+        CO_DISP_INVALIDATE(node);
         COSyncProdActivate(&node->Sync);
     }
     return (result);
@@ -35,9 +35,20 @@ static CO_ERR COCSdoUploadSegmented        (CO_CSDO *csdo);
 static CO_ERR COCSdoInitDownloadSegmented  (CO_CSDO *csdo);
 static CO_ERR COCSdoDownloadSegmented      (CO_CSDO *csdo);
 static CO_ERR COCSdoFinishDownloadSegmented(CO_CSDO *csdo);
+static CO_ERR COCSdoInitUploadBlock        (CO_CSDO *csdo);
+static CO_ERR COCSdoUploadBlock            (CO_CSDO *csdo);
+static CO_ERR COCSdoEndUploadBlock         (CO_CSDO *csdo);
+static CO_ERR COCSdoInitDownloadBlock      (CO_CSDO *csdo);
+static CO_ERR COCSdoAckDownloadBlock       (CO_CSDO *csdo);
+static CO_ERR COCSdoEndDownloadBlock       (CO_CSDO *csdo);
+static void   COCSdoSendBlock              (CO_CSDO *csdo);
 static void   COCSdoAbort                  (CO_CSDO *csdo, uint32_t err);
 static void   COCSdoTransferFinalize       (CO_CSDO *csdo);
+static void   COCSdoTimerRefresh           (CO_CSDO *csdo);
 static void   COCSdoTimeout                (void *parg);
+#if USE_SDO_STAT
+static void   COCSdoStatStart              (CO_CSDO *csdo);
+#endif
 
 /******************************************************************************
 * PRIVATE FUNCTIONS
@@ -50,8 +61,10 @@ static void COCSdoAbort(CO_CSDO *csdo, uint32_t err)
     /* store abort code */
     csdo->Tfer.Abort = err;
 
-    /* send the SDO timeout response */
-    if (err == CO_SDO_ERR_TIMEOUT) {
+    /* send the SDO abort request on timeout and in block transfers, which
+     * would keep the SDO server in the block transfer otherwise */
+    if ((err            == CO_SDO_ERR_TIMEOUT           ) ||
+        (csdo->Tfer.Type >= CO_CSDO_TRANSFER_UPLOAD_BLOCK)) {
         CO_SET_ID  (&frm, csdo->TxId        );
         CO_SET_BYTE(&frm, 0x80,           0u);
         CO_SET_WORD(&frm, csdo->Tfer.Idx, 1u);
@@ -83,6 +96,8 @@ static void COCSdoReset(CO_CSDO *csdo, uint8_t num, struct CO_NODE_T *node)
     csdonum->RxId  = CO_SDO_ID_OFF;
     csdonum->TxId  = CO_SDO_ID_OFF;
     csdonum->State = CO_CSDO_STATE_INVALID;
+    csdonum->Req   = NULL;
+    CO_DISP_INVALIDATE(node);
 
     /* Reset transfer context */
     csdonum->Tfer.Csdo    = csdonum;
@@ -94,7 +109,15 @@ static void COCSdoReset(CO_CSDO *csdo, uint8_t num, struct CO_NODE_T *node)
     csdonum->Tfer.Tmt     = 0;
     csdonum->Tfer.Call    = NULL;
     csdonum->Tfer.Buf_Idx = 0;
+    csdonum->Bytes        = 0;
     csdonum->Tfer.TBit    = 0;
+    csdonum->Tfer.Crc     = 0;
+    csdonum->Tfer.CrcOn   = 0;
+    csdonum->Tfer.BlkSize = 0;
+    csdonum->Tfer.Seq     = 0;
+#if USE_SDO_STAT
+    csdonum->Stat.Act     = 0;
+#endif
 
     if (csdonum->Tfer.Tmr >= 0) {
         tid = COTmrDelete(&(node->Tmr), csdonum->Tfer.Tmr);
@@ -122,6 +145,7 @@ static void COCSdoEnable(CO_CSDO *csdo, uint8_t num)
     csdonum->State = CO_CSDO_STATE_INVALID;
 
     node = csdo->Node;
+    CO_DISP_INVALIDATE(node);
     err = CODictRdLong(&node->Dict, CO_DEV((uint32_t)0x1280u + (uint32_t)num, 1u), &txId);
     if (err != CO_ERR_NONE) {
         return;
@@ -137,9 +161,10 @@ static void COCSdoEnable(CO_CSDO *csdo, uint8_t num)
 
     if (((rxId & CO_SDO_ID_OFF) == (uint32_t)0) &&
         ((txId & CO_SDO_ID_OFF) == (uint32_t)0)){
-        csdonum->TxId  = txId + nodeId;
-        csdonum->RxId  = rxId + nodeId;
-        csdonum->State = CO_CSDO_STATE_IDLE;
+        csdonum->TxId   = txId + nodeId;
+        csdonum->RxId   = rxId + nodeId;
+        csdonum->NodeId = nodeId;
+        csdonum->State  = CO_CSDO_STATE_IDLE;
     }
 }
 
@@ -156,9 +181,14 @@ static void COCSdoTransferFinalize(CO_CSDO *csdo)
         sub  = csdo->Tfer.Sub;
         code = csdo->Tfer.Abort;
         call = csdo->Tfer.Call;
+        csdo->Bytes = (code == 0u) ? csdo->Tfer.Size : 0u;
+#if USE_SDO_STAT
+        COSdoStatEnd(&csdo->Stat, code, COSdoStatTime(csdo->Node));
+#endif
 
-        if (call != NULL) {
-            call(csdo, idx, sub, code);
+        /* Stop the timeout of the finished transfer */
+        if (csdo->Tfer.Tmr >= 0) {
+            (void)COTmrDelete(&(csdo->Node->Tmr), csdo->Tfer.Tmr);
         }
 
         /* Reset finished transfer information */
@@ -173,19 +203,39 @@ static void COCSdoTransferFinalize(CO_CSDO *csdo)
         csdo->Tfer.Tmr   = -1;
         csdo->Tfer.Buf_Idx = 0;
         csdo->Tfer.TBit = 0;
+        csdo->Tfer.Crc = 0;
+        csdo->Tfer.CrcOn = 0;
+        csdo->Tfer.BlkSize = 0;
+        csdo->Tfer.Seq = 0;
 
-        /* Release SDO client for next request */
+        /* Release SDO client for next request; the callback may start
+         * the next transfer with this SDO client */
         csdo->Frm   = NULL;
         csdo->State = CO_CSDO_STATE_IDLE;
+
+        if (call != NULL) {
+            call(csdo, idx, sub, code);
+        }
     }
 }
 
+static void COCSdoTimerRefresh(CO_CSDO *csdo)
+{
+    uint32_t ticks;
+
+    (void)COTmrDelete(&(csdo->Node->Tmr), csdo->Tfer.Tmr);
+    ticks = COTmrGetTicks(&(csdo->Node->Tmr), csdo->Tfer.Tmt, CO_TMR_UNIT_1MS);
+    csdo->Tfer.Tmr = COTmrCreate(&(csdo->Node->Tmr), ticks, 0, &COCSdoTimeout, csdo);
+}
+
 static void COCSdoTimeout(void *parg)
 {
     CO_CSDO *csdo;
 
     csdo = (CO_CSDO *)parg;
     if (csdo->State == CO_CSDO_STATE_BUSY) {
+        /* The elapsed timer is released by the timer management */
+        csdo->Tfer.Tmr = -1;
         /* Abort SDO transfer because of timeout */
         COCSdoAbort(csdo, CO_SDO_ERR_TIMEOUT);
         /* Finalize aborted transfer */
@@ -193,6 +243,29 @@ static void COCSdoTimeout(void *parg)
     }
 }
 
+#if USE_SDO_STAT
+static void COCSdoStatStart(CO_CSDO *csdo)
+{
+    CO_CSDO_TRANSFER_TYPE tfer = csdo->Tfer.Type;
+    uint8_t               type;
+
+    if (tfer == CO_CSDO_TRANSFER_UPLOAD) {
+        type = (uint8_t)CO_SDO_STAT_EXP_UP;
+    } else if (tfer == CO_CSDO_TRANSFER_UPLOAD_SEGMENT) {
+        type = (uint8_t)CO_SDO_STAT_SEG_UP;
+    } else if (tfer == CO_CSDO_TRANSFER_UPLOAD_BLOCK) {
+        type = (uint8_t)CO_SDO_STAT_BLK_UP;
+    } else if (tfer == CO_CSDO_TRANSFER_DOWNLOAD) {
+        type = (uint8_t)CO_SDO_STAT_EXP_DOWN;
+    } else if (tfer == CO_CSDO_TRANSFER_DOWNLOAD_SEGMENT) {
+        type = (uint8_t)CO_SDO_STAT_SEG_DOWN;
+    } else {
+        type = (uint8_t)CO_SDO_STAT_BLK_DOWN;
+    }
+    COSdoStatStart(&csdo->Stat, type, csdo->Tfer.Size, COSdoStatTime(csdo->Node));
+}
+#endif
+
 static CO_ERR COCSdoUploadExpedited(CO_CSDO *csdo)
 {
     CO_ERR  result = CO_ERR_SDO_SILENT;
@@ -206,9 +279,14 @@ static CO_ERR COCSdoUploadExpedited(CO_CSDO *csdo)
         if (width > (uint8_t)csdo->Tfer.Size) {
             COCSdoAbort(csdo, CO_SDO_ERR_MEM);
         } else {
+#if USE_SDO_STAT
+            csdo->Stat.Size = width;
+#endif
             for (n = 0u; n < width; n++) {
                 csdo->Tfer.Buf[n] = CO_GET_BYTE(csdo->Frm, n + 4u);
             }
+            /* the server may send less bytes than the buffer provides */
+            csdo->Tfer.Size = width;
         }
     }
     COCSdoTransferFinalize(csdo);
@@ -225,7 +303,6 @@ static CO_ERR COCSdoInitUploadSegmented(CO_CSDO *csdo)
 {
     CO_ERR    result = CO_ERR_SDO_SILENT;
     uint32_t  obj_size;
-    uint32_t  ticks;
     uint16_t  Idx;
     uint8_t   Sub;
     CO_IF_FRM frm;
@@ -250,9 +327,7 @@ static CO_ERR COCSdoInitUploadSegmented(CO_CSDO *csdo)
         CO_SET_LONG(&frm, 0, 4u);
 
         /* refresh timer */
-        (void)COTmrDelete(&(csdo->Node->Tmr), csdo->Tfer.Tmr);
-        ticks = COTmrGetTicks(&(csdo->Node->Tmr), csdo->Tfer.Tmt, CO_TMR_UNIT_1MS);
-        csdo->Tfer.Tmr = COTmrCreate(&(csdo->Node->Tmr), ticks, 0, &COCSdoTimeout, csdo);
+        COCSdoTimerRefresh(csdo);
 
         (void)COIfCanSend(&csdo->Node->If, &frm);
     } else {
@@ -266,7 +341,6 @@ static CO_ERR COCSdoInitUploadSegmented(CO_CSDO *csdo)
 static CO_ERR COCSdoUploadSegmented(CO_CSDO *csdo)
 {
     CO_ERR    result = CO_ERR_SDO_SILENT;
-    uint32_t  ticks;
     uint8_t   cmd;
     uint8_t   n;
     CO_IF_FRM frm;
@@ -296,9 +370,7 @@ static CO_ERR COCSdoUploadSegmented(CO_CSDO *csdo)
             CO_SET_LONG(&frm, 0, 4u);
 
             /* refresh timer */
-            (void)COTmrDelete(&(csdo->Node->Tmr), csdo->Tfer.Tmr);
-            ticks = COTmrGetTicks(&(csdo->Node->Tmr), csdo->Tfer.Tmt, CO_TMR_UNIT_1MS);
-            csdo->Tfer.Tmr = COTmrCreate(&(csdo->Node->Tmr), ticks, 0, &COCSdoTimeout, csdo);
+            COCSdoTimerRefresh(csdo);
 
             (void)COIfCanSend(&csdo->Node->If, &frm);
         } else {
@@ -315,7 +387,6 @@ static CO_ERR COCSdoUploadSegmented(CO_CSDO *csdo)
 static CO_ERR COCSdoInitDownloadSegmented(CO_CSDO *csdo)
 {
     CO_ERR    result = CO_ERR_SDO_SILENT;
-    uint32_t  ticks;
     uint16_t  Idx;
     uint8_t   Sub;
     uint8_t   n;
@@ -351,9 +422,7 @@ static CO_ERR COCSdoInitDownloadSegmented(CO_CSDO *csdo)
         CO_SET_BYTE(&frm, cmd, 0u);
 
         /* refresh timer */
-        (void)COTmrDelete(&(csdo->Node->Tmr), csdo->Tfer.Tmr);
-        ticks = COTmrGetTicks(&(csdo->Node->Tmr), csdo->Tfer.Tmt, CO_TMR_UNIT_1MS);
-        csdo->Tfer.Tmr = COTmrCreate(&(csdo->Node->Tmr), ticks, 0, &COCSdoTimeout, csdo);
+        COCSdoTimerRefresh(csdo);
 
         (void)COIfCanSend(&csdo->Node->If, &frm);
     } else {
@@ -367,7 +436,6 @@ static CO_ERR COCSdoInitDownloadSegmented(CO_CSDO *csdo)
 static CO_ERR COCSdoDownloadSegmented(CO_CSDO *csdo)
 {
     CO_ERR    result = CO_ERR_SDO_SILENT;
-    uint32_t  ticks;
     uint8_t   cmd;
     uint8_t   n;
     uint8_t   width;
@@ -404,9 +472,7 @@ static CO_ERR COCSdoDownloadSegmented(CO_CSDO *csdo)
         CO_SET_BYTE(&frm, cmd, 0u);
 
          /* refresh timer */
-        (void)COTmrDelete(&(csdo->Node->Tmr), csdo->Tfer.Tmr);
-        ticks = COTmrGetTicks(&(csdo->Node->Tmr), csdo->Tfer.Tmt, CO_TMR_UNIT_1MS);
-        csdo->Tfer.Tmr = COTmrCreate(&(csdo->Node->Tmr), ticks, 0, &COCSdoTimeout, csdo);
+        COCSdoTimerRefresh(csdo);
 
         (void)COIfCanSend(&csdo->Node->If, &frm);
     } else {
@@ -423,6 +489,294 @@ static CO_ERR COCSdoFinishDownloadSegmented(CO_CSDO *csdo)
     return CO_ERR_SDO_SILENT;
 }
 
+static CO_ERR COCSdoInitUploadBlock(CO_CSDO *csdo)
+{
+    CO_ERR    result = CO_ERR_SDO_SILENT;
+    uint32_t  obj_size;
+    uint16_t  Idx;
+    uint8_t   Sub;
+    uint8_t   cmd;
+    CO_IF_FRM frm;
+
+    cmd      = CO_GET_BYTE(csdo->Frm, 0u);
+    Idx      = CO_GET_WORD(csdo->Frm, 1u);
+    Sub      = CO_GET_BYTE(csdo->Frm, 3u);
+    obj_size = CO_GET_LONG(csdo->Frm, 4u);
+
+    if ((Idx != csdo->Tfer.Idx) ||
+        (Sub != csdo->Tfer.Sub)) {
+        COCSdoAbort(csdo, CO_SDO_ERR_CMD);
+        COCSdoTransferFinalize(csdo);
+    } else if (((cmd & 0x02u) != 0u) && (obj_size != csdo->Tfer.Size)) {
+        COCSdoAbort(csdo, CO_SDO_ERR_LEN);
+        COCSdoTransferFinalize(csdo);
+    } else {
+        result = CO_ERR_NONE;
+
+        /* use CRC, when supported by client and server */
+        csdo->Tfer.CrcOn   = (uint8_t)(((cmd >> 2u) & 0x01u) & (uint8_t)CO_CSDO_BLK_CRC);
+        csdo->Tfer.Crc     = 0;
+        csdo->Tfer.Seq     = 0;
+        csdo->Tfer.Buf_Idx = 0;
+        csdo->Tfer.Type    = CO_CSDO_TRANSFER_UPLOAD_BLOCK_SEG;
+
+        /* start the block upload */
+        CO_SET_ID  (&frm, csdo->TxId);
+        CO_SET_DLC (&frm, 8u);
+        CO_SET_BYTE(&frm, 0xA3, 0u);
+        CO_SET_WORD(&frm, 0, 1u);
+        CO_SET_BYTE(&frm, 0, 3u);
+        CO_SET_LONG(&frm, 0, 4u);
+
+        /* refresh timer */
+        COCSdoTimerRefresh(csdo);
+
+        (void)COIfCanSend(&csdo->Node->If, &frm);
+    }
+
+    return result;
+}
+
+static CO_ERR COCSdoUploadBlock(CO_CSDO *csdo)
+{
+    CO_ERR    result = CO_ERR_SDO_SILENT;
+    uint32_t  pos;
+    uint32_t  num;
+    uint8_t   last = 0u;
+    uint8_t   cmd;
+    uint8_t   seq;
+    uint8_t   n;
+    CO_IF_FRM frm;
+
+    cmd = CO_GET_BYTE(csdo->Frm, 0u);
+    seq = cmd & 0x7Fu;
+    if (seq == (uint8_t)(csdo->Tfer.Seq + 1u)) {
+        /* store segment; padding bytes after the buffer are ignored */
+        pos = csdo->Tfer.Buf_Idx + ((uint32_t)csdo->Tfer.Seq * 7u);
+        for (n = 1u; (n < 8u) && (pos < csdo->Tfer.Size); n++) {
+            csdo->Tfer.Buf[pos] = CO_GET_BYTE(csdo->Frm, n);
+            pos++;
+        }
+        csdo->Tfer.Seq = seq;
+        if ((cmd & 0x80u) != 0u) {
+            last = 1u;
+        }
+    }
+
+    if ((seq < csdo->Tfer.BlkSize) && ((cmd & 0x80u) == 0u)) {
+        /* wait for further segments of this block */
+        COCSdoTimerRefresh(csdo);
+        return (result);
+    }
+
+    /* end of block: confirm the segments, which are received in sequence */
+    num = (uint32_t)csdo->Tfer.Seq * 7u;
+    if ((last == 0u) && ((csdo->Tfer.Buf_Idx + num) >= csdo->Tfer.Size)) {
+        COCSdoAbort(csdo, CO_SDO_ERR_LEN);
+        COCSdoTransferFinalize(csdo);
+        return (result);
+    }
+    if (csdo->Tfer.CrcOn != 0u) {
+        pos = csdo->Tfer.Size - csdo->Tfer.Buf_Idx;
+        if (pos > num) {
+            pos = num;
+        }
+        csdo->Tfer.Crc = COSdoCrc(csdo->Tfer.Crc, &csdo->Tfer.Buf[csdo->Tfer.Buf_Idx], pos);
+    }
+    csdo->Tfer.Buf_Idx += num;
+
+    CO_SET_ID  (&frm, csdo->TxId);
+    CO_SET_DLC (&frm, 8u);
+    CO_SET_BYTE(&frm, 0xA2, 0u);
+    CO_SET_BYTE(&frm, csdo->Tfer.Seq, 1u);
+    CO_SET_BYTE(&frm, csdo->Tfer.BlkSize, 2u);
+    CO_SET_BYTE(&frm, 0, 3u);
+    CO_SET_LONG(&frm, 0, 4u);
+
+    csdo->Tfer.Seq = 0;
+    if (last != 0u) {
+        csdo->Tfer.Type = CO_CSDO_TRANSFER_UPLOAD_BLOCK_END;
+    }
+
+    /* refresh timer */
+    COCSdoTimerRefresh(csdo);
+
+    (void)COIfCanSend(&csdo->Node->If, &frm);
+
+    return (result);
+}
+
+static CO_ERR COCSdoEndUploadBlock(CO_CSDO *csdo)
+{
+    CO_ERR    result = CO_ERR_SDO_SILENT;
+    uint16_t  crc;
+    uint8_t   cmd;
+    uint8_t   n;
+    CO_IF_FRM frm;
+
+    cmd = CO_GET_BYTE(csdo->Frm, 0u);
+    crc = CO_GET_WORD(csdo->Frm, 1u);
+    n   = (cmd >> 2u) & 0x07u;
+
+    if ((csdo->Tfer.Buf_Idx - n) != csdo->Tfer.Size) {
+        COCSdoAbort(csdo, CO_SDO_ERR_LEN);
+    } else if ((csdo->Tfer.CrcOn != 0u) && (crc != csdo->Tfer.Crc)) {
+        COCSdoAbort(csdo, CO_SDO_ERR_CRC);
+    } else {
+        CO_SET_ID  (&frm, csdo->TxId);
+        CO_SET_DLC (&frm, 8u);
+        CO_SET_BYTE(&frm, 0xA1, 0u);
+        CO_SET_WORD(&frm, 0, 1u);
+        CO_SET_BYTE(&frm, 0, 3u);
+        CO_SET_LONG(&frm, 0, 4u);
+
+        (void)COIfCanSend(&csdo->Node->If, &frm);
+    }
+    COCSdoTransferFinalize(csdo);
+
+    return (result);
+}
+
+static CO_ERR COCSdoInitDownloadBlock(CO_CSDO *csdo)
+{
+    CO_ERR    result = CO_ERR_SDO_SILENT;
+    uint16_t  Idx;
+    uint8_t   Sub;
+    uint8_t   cmd;
+    uint8_t   blksize;
+
+    cmd     = CO_GET_BYTE(csdo->Frm, 0u);
+    Idx     = CO_GET_WORD(csdo->Frm, 1u);
+    Sub     = CO_GET_BYTE(csdo->Frm, 3u);
+    blksize = CO_GET_BYTE(csdo->Frm, 4u);
+
+    if ((Idx != csdo->Tfer.Idx) ||
+        (Sub != csdo->Tfer.Sub)) {
+        COCSdoAbort(csdo, CO_SDO_ERR_CMD);
+        COCSdoTransferFinalize(csdo);
+    } else if ((blksize < 1u) || (blksize > 127u)) {
+        COCSdoAbort(csdo, CO_SDO_ERR_BLK_SIZE);
+        COCSdoTransferFinalize(csdo);
+    } else {
+        result = CO_ERR_NONE;
+
+        /* use CRC, when supported by client and server */
+        csdo->Tfer.CrcOn   = (uint8_t)(((cmd >> 2u) & 0x01u) & (uint8_t)CO_CSDO_BLK_CRC);
+        csdo->Tfer.Crc     = 0;
+        csdo->Tfer.BlkSize = blksize;
+        csdo->Tfer.Type    = CO_CSDO_TRANSFER_DOWNLOAD_BLOCK_SEG;
+        COCSdoSendBlock(csdo);
+    }
+
+    return (result);
+}
+
+static CO_ERR COCSdoAckDownloadBlock(CO_CSDO *csdo)
+{
+    CO_ERR    result = CO_ERR_SDO_SILENT;
+    uint32_t  num;
+    uint8_t   seq;
+    uint8_t   blksize;
+    uint8_t   n;
+    CO_IF_FRM frm;
+
+    seq     = CO_GET_BYTE(csdo->Frm, 1u);
+    blksize = CO_GET_BYTE(csdo->Frm, 2u);
+
+    if (seq > csdo->Tfer.Seq) {
+        COCSdoAbort(csdo, CO_SDO_ERR_SEQ_NUM);
+        COCSdoTransferFinalize(csdo);
+    } else if ((blksize < 1u) || (blksize > 127u)) {
+        COCSdoAbort(csdo, CO_SDO_ERR_BLK_SIZE);
+        COCSdoTransferFinalize(csdo);
+    } else {
+        result = CO_ERR_NONE;
+
+        /* confirmed segments are done, missing segments are repeated */
+        num = (uint32_t)seq * 7u;
+        if (num > (csdo->Tfer.Size - csdo->Tfer.Buf_Idx)) {
+            num = csdo->Tfer.Size - csdo->Tfer.Buf_Idx;
+        }
+        if (csdo->Tfer.CrcOn != 0u) {
+            csdo->Tfer.Crc = COSdoCrc(csdo->Tfer.Crc, &csdo->Tfer.Buf[csdo->Tfer.Buf_Idx], num);
+        }
+        csdo->Tfer.Buf_Idx += num;
+        csdo->Tfer.BlkSize  = blksize;
+
+        if (csdo->Tfer.Buf_Idx < csdo->Tfer.Size) {
+            COCSdoSendBlock(csdo);
+        } else {
+            /* number of bytes in last segment without data */
+            n = (uint8_t)((7u - (csdo->Tfer.Size % 7u)) % 7u);
+
+            CO_SET_ID  (&frm, csdo->TxId);
+            CO_SET_DLC (&frm, 8u);
+            CO_SET_BYTE(&frm, (uint8_t)(0xC1u | (uint8_t)(n << 2u)), 0u);
+            CO_SET_WORD(&frm, csdo->Tfer.Crc, 1u);
+            CO_SET_BYTE(&frm, 0, 3u);
+            CO_SET_LONG(&frm, 0, 4u);
+
+            csdo->Tfer.Type = CO_CSDO_TRANSFER_DOWNLOAD_BLOCK_END;
+
+            /* refresh timer */
+            COCSdoTimerRefresh(csdo);
+
+            (void)COIfCanSend(&csdo->Node->If, &frm);
+        }
+    }
+
+    return (result);
+}
+
+static CO_ERR COCSdoEndDownloadBlock(CO_CSDO *csdo)
+{
+    COCSdoTransferFinalize(csdo);
+    return CO_ERR_SDO_SILENT;
+}
+
+static void COCSdoSendBlock(CO_CSDO *csdo)
+{
+    CO_IF_FRM frm[CO_IF_TX_BATCH_N];
+    uint32_t  pos;
+    uint16_t  num = 0u;
+    uint8_t   seq = 0u;
+    uint8_t   cmd;
+    uint8_t   n;
+
+    /* refresh timer */
+    COCSdoTimerRefresh(csdo);
+
+    /* send the segments of the block in batches to the CAN driver */
+    pos = csdo->Tfer.Buf_Idx;
+    while ((seq < csdo->Tfer.BlkSize) && (pos < csdo->Tfer.Size)) {
+        seq++;
+        CO_SET_ID (&frm[num], csdo->TxId);
+        CO_SET_DLC(&frm[num], 8u);
+        for (n = 1u; n < 8u; n++) {
+            if (pos < csdo->Tfer.Size) {
+                CO_SET_BYTE(&frm[num], csdo->Tfer.Buf[pos], n);
+                pos++;
+            } else {
+                CO_SET_BYTE(&frm[num], 0u, n);
+            }
+        }
+        cmd = seq;
+        if (pos >= csdo->Tfer.Size) {
+            cmd |= 0x80u;
+        }
+        CO_SET_BYTE(&frm[num], cmd, 0u);
+        num++;
+        if (num == (uint16_t)CO_IF_TX_BATCH_N) {
+            (void)COIfCanSendBatch(&csdo->Node->If, &frm[0], num);
+            num = 0u;
+        }
+    }
+    if (num > 0u) {
+        (void)COIfCanSendBatch(&csdo->Node->If, &frm[0], num);
+    }
+    csdo->Tfer.Seq = seq;
+}
+
 /******************************************************************************
 * PROTECTED API FUNCTIONS
 ******************************************************************************/
@@ -433,6 +787,10 @@ void COCSdoInit(CO_CSDO *csdo, struct CO_NODE_T *node)
 
     for (n = 0; n < (uint8_t)CO_CSDO_N; n++) {
         node->CSdo[n].Tfer.Tmr = -1;
+#if USE_SDO_STAT
+        node->CSdo[n].Stat.Act = 0;
+        COSdoStatClear(&node->CSdo[n].Stat);
+#endif
         COCSdoReset(csdo, n, node);
         COCSdoEnable(csdo, n);
     }
@@ -459,18 +817,11 @@ CO_CSDO *COCSdoCheck(CO_CSDO *csdo, CO_IF_FRM *frm)
              * interested in response
              * anymore.
              */
-            if ((CO_GET_ID(frm) == csdo[n].RxId) &&
-                (csdo[n].State  == CO_CSDO_STATE_BUSY)) {
-                /*
-                 * Update frame with COB-ID
-                 * and return client handle
-                 * for further processing.
-                 */
-                CO_SET_ID(frm, csdo[n].TxId);
-                csdo[n].Frm        = frm;
-                csdo[n].Tfer.Abort = 0;
-                result = &csdo[n];
-                break;
+            if (CO_GET_ID(frm) == csdo[n].RxId) {
+                result = COCSdoAccept(&csdo[n], frm);
+                if (result != NULL) {
+                    break;
+                }
             }
             n++;
         }
@@ -479,6 +830,25 @@ CO_CSDO *COCSdoCheck(CO_CSDO *csdo, CO_IF_FRM *frm)
     return (result);
 }
 
+CO_CSDO *COCSdoAccept(CO_CSDO *csdo, CO_IF_FRM *frm)
+{
+    CO_CSDO *result = NULL;
+
+    if (csdo->State == CO_CSDO_STATE_BUSY) {
+        /*
+         * Update frame with COB-ID
+         * and return client handle
+         * for further processing.
+         */
+        CO_SET_ID(frm, csdo->TxId);
+        csdo->Frm        = frm;
+        csdo->Tfer.Abort = 0;
+        result = csdo;
+    }
+
+    return (result);
+}
+
 CO_ERR COCSdoResponse(CO_CSDO *csdo)
 {
     CO_ERR   result = CO_ERR_SDO_SILENT;
@@ -523,6 +893,43 @@ CO_ERR COCSdoResponse(CO_CSDO *csdo)
             COCSdoAbort(csdo, CO_SDO_ERR_CMD);
             COCSdoTransferFinalize(csdo);
         }
+    } else if (csdo->Tfer.Type == CO_CSDO_TRANSFER_UPLOAD_BLOCK) {
+        if ((cmd & 0xE1u) == 0xC0u) {
+            (void)COCSdoInitUploadBlock(csdo);
+        } else {
+            COCSdoAbort(csdo, CO_SDO_ERR_CMD);
+            COCSdoTransferFinalize(csdo);
+        }
+    } else if (csdo->Tfer.Type == CO_CSDO_TRANSFER_UPLOAD_BLOCK_SEG) {
+        (void)COCSdoUploadBlock(csdo);
+    } else if (csdo->Tfer.Type == CO_CSDO_TRANSFER_UPLOAD_BLOCK_END) {
+        if ((cmd & 0xE3u) == 0xC1u) {
+            (void)COCSdoEndUploadBlock(csdo);
+        } else {
+            COCSdoAbort(csdo, CO_SDO_ERR_CMD);
+            COCSdoTransferFinalize(csdo);
+        }
+    } else if (csdo->Tfer.Type == CO_CSDO_TRANSFER_DOWNLOAD_BLOCK) {
+        if ((cmd & 0xE3u) == 0xA0u) {
+            (void)COCSdoInitDownloadBlock(csdo);
+        } else {
+            COCSdoAbort(csdo, CO_SDO_ERR_CMD);
+            COCSdoTransferFinalize(csdo);
+        }
+    } else if (csdo->Tfer.Type == CO_CSDO_TRANSFER_DOWNLOAD_BLOCK_SEG) {
+        if ((cmd & 0xE3u) == 0xA2u) {
+            (void)COCSdoAckDownloadBlock(csdo);
+        } else {
+            COCSdoAbort(csdo, CO_SDO_ERR_CMD);
+            COCSdoTransferFinalize(csdo);
+        }
+    } else if (csdo->Tfer.Type == CO_CSDO_TRANSFER_DOWNLOAD_BLOCK_END) {
+        if ((cmd & 0xE3u) == 0xA1u) {
+            (void)COCSdoEndDownloadBlock(csdo);
+        } else {
+            COCSdoAbort(csdo, CO_SDO_ERR_CMD);
+            COCSdoTransferFinalize(csdo);
+        }
     } else if (cmd == 0x60u) {
         result = COCSdoDownloadExpedited(csdo);
         return (result);
@@ -565,6 +972,8 @@ CO_ERR COCSdoRequestUpload(CO_CSDO *csdo,
 {
     CO_IF_FRM frm;
     uint32_t  ticks;
+    uint8_t   cmd;
+    uint8_t   blksize = 0u;
 
     ASSERT_PTR_ERR(csdo, CO_ERR_BAD_ARG);
     ASSERT_PTR_ERR(buf, CO_ERR_BAD_ARG);
@@ -589,9 +998,17 @@ CO_ERR COCSdoRequestUpload(CO_CSDO *csdo,
     csdo->State = CO_CSDO_STATE_BUSY;
 
     /* Update transfer info */
+    cmd = 0x40u;
     if (size <= (uint32_t)4) {
         /* expedited transfer */
         csdo->Tfer.Type = CO_CSDO_TRANSFER_UPLOAD;
+#if CO_CSDO_BLK_MIN > 0
+    } else if (size >= (uint32_t)CO_CSDO_BLK_MIN) {
+        /* block transfer */
+        csdo->Tfer.Type = CO_CSDO_TRANSFER_UPLOAD_BLOCK;
+        cmd             = (uint8_t)(0xA0u | (uint8_t)(CO_CSDO_BLK_CRC << 2u));
+        blksize         = (uint8_t)CO_CSDO_BLK_SIZE;
+#endif
     } else {
         /* segmented transfer */
         csdo->Tfer.Type = CO_CSDO_TRANSFER_UPLOAD_SEGMENT;
@@ -605,14 +1022,21 @@ CO_ERR COCSdoRequestUpload(CO_CSDO *csdo,
     csdo->Tfer.Call    = callback;
     csdo->Tfer.Buf_Idx = 0;
     csdo->Tfer.TBit    = 0;
+    csdo->Tfer.Crc     = 0;
+    csdo->Tfer.CrcOn   = 0;
+    csdo->Tfer.BlkSize = blksize;
+    csdo->Tfer.Seq     = 0;
+#if USE_SDO_STAT
+    COCSdoStatStart(csdo);
+#endif
 
     /* Transmit transfer initiation directly */
     CO_SET_ID  (&frm, csdo->TxId        );
     CO_SET_DLC (&frm, 8u                );
-    CO_SET_BYTE(&frm, 0x40          , 0u);
+    CO_SET_BYTE(&frm, cmd           , 0u);
     CO_SET_WORD(&frm, csdo->Tfer.Idx, 1u);
     CO_SET_BYTE(&frm, csdo->Tfer.Sub, 3u);
-    CO_SET_LONG(&frm, 0,              4u);
+    CO_SET_LONG(&frm, blksize,        4u);
 
     ticks = COTmrGetTicks(&(csdo->Node->Tmr), timeout, CO_TMR_UNIT_1MS);
     csdo->Tfer.Tmr = COTmrCreate(&(csdo->Node->Tmr), ticks, 0, &COCSdoTimeout, csdo);
@@ -622,6 +1046,33 @@ CO_ERR COCSdoRequestUpload(CO_CSDO *csdo,
     return CO_ERR_NONE;
 }
 
+CO_ERR COCSdoSetServer(CO_CSDO *csdo, uint8_t nodeId)
+{
+    ASSERT_PTR_ERR(csdo, CO_ERR_BAD_ARG);
+
+    if ((nodeId < 1u) || (nodeId > 127u)) {
+        /* invalid SDO server node-id */
+        return CO_ERR_BAD_ARG;
+    }
+    if (csdo->State == CO_CSDO_STATE_INVALID) {
+        /* Requested SDO client is disabled */
+        return CO_ERR_SDO_OFF;
+    }
+    if (csdo->State == CO_CSDO_STATE_BUSY) {
+        /* Requested SDO client is busy */
+        return CO_ERR_SDO_BUSY;
+    }
+
+    if (csdo->NodeId != nodeId) {
+        csdo->TxId   = (csdo->TxId - csdo->NodeId) + nodeId;
+        csdo->RxId   = (csdo->RxId - csdo->NodeId) + nodeId;
+        csdo->NodeId = nodeId;
+        CO_DISP_INVALIDATE(csdo->Node);
+    }
+
+    return CO_ERR_NONE;
+}
+
 CO_ERR COCSdoRequestDownload(CO_CSDO *csdo,
                              uint32_t key,
                              uint8_t *buffer,
@@ -667,6 +1118,10 @@ CO_ERR COCSdoRequestDownload(CO_CSDO *csdo,
     csdo->Tfer.Call    = callback;
     csdo->Tfer.Buf_Idx = 0;
     csdo->Tfer.TBit    = 0;
+    csdo->Tfer.Crc     = 0;
+    csdo->Tfer.CrcOn   = 0;
+    csdo->Tfer.BlkSize = 0;
+    csdo->Tfer.Seq     = 0;
 
     if (size <= (uint32_t)4u) {
         csdo->Tfer.Type = CO_CSDO_TRANSFER_DOWNLOAD;
@@ -684,6 +1139,14 @@ CO_ERR COCSdoRequestDownload(CO_CSDO *csdo,
                 CO_SET_BYTE(&frm, 0u, n);
             }
         }
+#if CO_CSDO_BLK_MIN > 0
+    } else if (size >= (uint32_t)CO_CSDO_BLK_MIN) {
+        csdo->Tfer.Type = CO_CSDO_TRANSFER_DOWNLOAD_BLOCK;
+
+        cmd = (uint8_t)(0xC2u | (uint8_t)(CO_CSDO_BLK_CRC << 2u));
+        CO_SET_BYTE(&frm,  cmd, 0u);
+        CO_SET_LONG(&frm, size, 4u);
+#endif
     } else {
         csdo->Tfer.Type = CO_CSDO_TRANSFER_DOWNLOAD_SEGMENT;
 
@@ -691,6 +1154,9 @@ CO_ERR COCSdoRequestDownload(CO_CSDO *csdo,
         CO_SET_BYTE(&frm,  cmd, 0u);
         CO_SET_LONG(&frm, size, 4u);
     }
+#if USE_SDO_STAT
+    COCSdoStatStart(csdo);
+#endif
 
     /* Transmit transfer initiation directly */
     CO_SET_ID  (&frm, csdo->TxId        );
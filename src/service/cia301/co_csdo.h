@@ -29,6 +29,14 @@ extern "C" {
 #include "co_sdo.h"
 #include "co_if.h"
 
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#if (CO_CSDO_BLK_SIZE < 1) || (CO_CSDO_BLK_SIZE > 127)
+#error "CO_CSDO_BLK_SIZE: the block size must be in range 1..127"
+#endif
+
 /******************************************************************************
 * PUBLIC TYPES
 ******************************************************************************/
@@ -48,10 +56,9 @@ typedef enum {
 
 /*! \brief SDO CLIENT TRANSFER TYPE
  *
- *   This enumeration holds the possible SDO client transfer types.
- *   Currently, only expedited transfer is supported, it might be
- *   required to extend this enumeration in future in case segmented
- *   and block transfer support will be added.
+ *   This enumeration holds the possible SDO client transfer types. The
+ *   block transfers are split into the protocol phases; all block phases
+ *   are numbered after the other transfer types.
  */
 typedef enum {
     CO_CSDO_TRANSFER_NONE     = 0,   /*!< No transfer is currently ongoing   */
@@ -59,10 +66,17 @@ typedef enum {
     CO_CSDO_TRANSFER_DOWNLOAD = 2,   /*!< SDO download is being executed     */
     CO_CSDO_TRANSFER_UPLOAD_SEGMENT = 3,  /*!< SDO segment upload is being executed     */
     CO_CSDO_TRANSFER_DOWNLOAD_SEGMENT = 4, /*!< SDO segment download is being executed     */
+    CO_CSDO_TRANSFER_UPLOAD_BLOCK = 5,         /*!< SDO block upload is initiated      */
+    CO_CSDO_TRANSFER_UPLOAD_BLOCK_SEG = 6,     /*!< SDO block upload receives blocks   */
+    CO_CSDO_TRANSFER_UPLOAD_BLOCK_END = 7,     /*!< SDO block upload waits for end     */
+    CO_CSDO_TRANSFER_DOWNLOAD_BLOCK = 8,       /*!< SDO block download is initiated    */
+    CO_CSDO_TRANSFER_DOWNLOAD_BLOCK_SEG = 9,   /*!< SDO block download sends blocks    */
+    CO_CSDO_TRANSFER_DOWNLOAD_BLOCK_END = 10,  /*!< SDO block download waits for end   */
 
 } CO_CSDO_TRANSFER_TYPE;
 
 struct CO_CSDO_T;
+struct CO_CSDO_REQ_T;              /* Declaration of queued request          */
 
 /*! \brief
  *
@@ -120,6 +134,10 @@ typedef struct CO_CSDO_TRANSFER_T {
     CO_CSDO_CALLBACK_T     Call;        /*!< Notification callback           */
     uint32_t               Buf_Idx;     /*!< Buffer Index                    */
     uint8_t                TBit;        /*!< Segment toggle bit              */
+    uint16_t               Crc;         /*!< Block CRC of confirmed data     */
+    uint8_t                CrcOn;       /*!< Block CRC used by both sides    */
+    uint8_t                BlkSize;     /*!< Number of segments per block    */
+    uint8_t                Seq;         /*!< Last sequence number in block   */
 } CO_CSDO_TRANSFER;
 
 /*! \brief SDO CLIENT
@@ -135,6 +153,11 @@ typedef struct CO_CSDO_T {
     uint8_t           NodeId;           /*!< Node-Id of addressed SDO server */
     CO_CSDO_STATE     State;            /*!< Current CSDO state              */
     CO_CSDO_TRANSFER  Tfer;             /*!< Current CSDO transfer info      */
+    struct CO_CSDO_REQ_T *Req;          /*!< Executed request of a queue     */
+    uint32_t          Bytes;            /*!< Bytes of last finished transfer */
+#if USE_SDO_STAT
+    struct CO_SDO_STAT_T  Stat;         /*!< Transfer statistics             */
+#endif
 } CO_CSDO;
 
 /******************************************************************************
@@ -162,6 +185,8 @@ CO_CSDO *COCSdoFind(struct CO_NODE_T *node, uint8_t num);
  *
  *   This function initiates SDO upload sequence. User should provide its
  *   own notification callback which is executed upon transfer completion.
+ *   Transfers of at least CO_CSDO_BLK_MIN bytes are using the SDO block
+ *   upload protocol.
  *
  * \param csdo
  *   Reference to SDO client
@@ -196,6 +221,8 @@ CO_ERR COCSdoRequestUpload(CO_CSDO *csdo,
  *
  *   This function initiates SDO download sequence. User should provide its
  *   own notification callback which is executed upon transfer completion.
+ *   Transfers of at least CO_CSDO_BLK_MIN bytes are using the SDO block
+ *   download protocol.
  *
  * \param csdo
  *   Reference to SDO client
@@ -226,6 +253,28 @@ CO_ERR COCSdoRequestDownload(CO_CSDO *csdo,
                              CO_CSDO_CALLBACK_T callback,
                              uint32_t timeout);
 
+/*! \brief
+ *
+ *   This function addresses the SDO client to another SDO server. The
+ *   COB-IDs of the SDO client are moved from the configured node-id in
+ *   object 1280h+[n] subindex 3 to the given node-id. The object entries
+ *   are not changed, therefore the next reset of the communication
+ *   restores the configured SDO server.
+ *
+ * \param csdo
+ *   Reference to SDO client
+ *
+ * \param nodeId
+ *   Node-Id of the SDO server (1..127)
+ *
+ * \retval  ==CO_ERR_NONE      SDO client addresses the SDO server
+ * \retval  ==CO_ERR_SDO_OFF   SDO client is disabled
+ * \retval  ==CO_ERR_SDO_BUSY  SDO client transfer is ongoing
+ * \retval  ==CO_ERR_BAD_ARG   invalid node-id
+ *
+ */
+CO_ERR COCSdoSetServer(CO_CSDO *csdo, uint8_t nodeId);
+
 /******************************************************************************
 * PROTECTED API FUNCTIONS
 ******************************************************************************/
@@ -265,6 +314,23 @@ void COCSdoInit(CO_CSDO *csdo, struct CO_NODE_T *node);
 */
 CO_CSDO *COCSdoCheck(CO_CSDO *csdo, CO_IF_FRM *frm);
 
+/*! \brief  ACCEPT SDO CLIENT FRAME
+*
+*    This function links the given response frame to the addressed SDO
+*    client, if this client is waiting for a response. The identifier in
+*    the frame will be modified to be the corresponding SDO request.
+*
+* \param csdo
+*    Ptr to addressed SDO client
+*
+* \param frm
+*    Frame, received from CAN bus
+*
+* \retval  >0    pointer to addressed SDO client
+* \retval  =0    SDO client is not waiting for a response
+*/
+CO_CSDO *COCSdoAccept(CO_CSDO *csdo, CO_IF_FRM *frm);
+
 /*! \brief  GENERATE SDO CLIENT RESPONSE
 *
 *    This function interprets the data byte #0 of the response
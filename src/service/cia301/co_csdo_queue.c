@@ -0,0 +1,370 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+#if USE_CSDO
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_CSDO_QUEUE_MAP_N  4u      /* words in node-id bitmap (128 bits)   */
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static CO_ERR   COCSdoQueueAdd     (CO_CSDO_QUEUE *q, uint8_t dir, uint8_t nodeId,
+                                    uint32_t key, uint8_t *buf, uint32_t size,
+                                    CO_CSDO_CALLBACK_T callback, uint32_t timeout);
+static CO_CSDO *COCSdoQueueClient  (CO_CSDO_QUEUE *q, uint8_t nodeId);
+static void     COCSdoQueueDispatch(CO_CSDO_QUEUE *q);
+static void     COCSdoQueueFinish  (CO_CSDO *csdo, uint16_t index, uint8_t sub, uint32_t code);
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void COCSdoQueueInit(CO_CSDO_QUEUE *q, struct CO_NODE_T *node, CO_CSDO_REQ *mem, uint16_t num)
+{
+    uint16_t n;
+
+    ASSERT_PTR(q);
+    ASSERT_PTR(node);
+
+    q->Node = node;
+    q->Free = NULL;
+    q->Head = NULL;
+    q->Tail = NULL;
+    q->Ctx  = NULL;
+    q->Stat.Done      = 0;
+    q->Stat.Abort     = 0;
+    q->Stat.Bytes     = 0;
+    q->Stat.Wait      = 0;
+    q->Stat.Active    = 0;
+    q->Stat.MaxActive = 0;
+
+    if (mem != NULL) {
+        for (n = num; n > 0u; n--) {
+            mem[n - 1u].Queue = q;
+            mem[n - 1u].Next  = q->Free;
+            q->Free           = &mem[n - 1u];
+        }
+    }
+}
+
+/*
+* see function definition
+*/
+CO_ERR COCSdoQueueUpload(CO_CSDO_QUEUE     *q,
+                         uint8_t            nodeId,
+                         uint32_t           key,
+                         uint8_t           *buf,
+                         uint32_t           size,
+                         CO_CSDO_CALLBACK_T callback,
+                         uint32_t           timeout)
+{
+    return (COCSdoQueueAdd(q, CO_CSDO_QUEUE_UPLOAD, nodeId, key,
+                           buf, size, callback, timeout));
+}
+
+/*
+* see function definition
+*/
+CO_ERR COCSdoQueueDownload(CO_CSDO_QUEUE     *q,
+                           uint8_t            nodeId,
+                           uint32_t           key,
+                           uint8_t           *buf,
+                           uint32_t           size,
+                           CO_CSDO_CALLBACK_T callback,
+                           uint32_t           timeout)
+{
+    return (COCSdoQueueAdd(q, CO_CSDO_QUEUE_DOWNLOAD, nodeId, key,
+                           buf, size, callback, timeout));
+}
+
+/*
+* see function definition
+*/
+void COCSdoQueueGetStat(CO_CSDO_QUEUE *q, CO_CSDO_QUEUE_STAT *stat, uint8_t clear)
+{
+    ASSERT_PTR(q);
+    ASSERT_PTR(stat);
+
+    *stat = q->Stat;
+    if (clear != 0u) {
+        q->Stat.Done      = 0;
+        q->Stat.Abort     = 0;
+        q->Stat.Bytes     = 0;
+        q->Stat.MaxActive = q->Stat.Active;
+    }
+}
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+
+/*! \brief  APPEND REQUEST
+*
+*    This function takes a free request, appends it to the waiting requests
+*    and starts the waiting requests, which can be executed now.
+*
+* \param q
+*    pointer to the request queue
+*
+* \param dir
+*    transfer direction (CO_CSDO_QUEUE_UPLOAD or CO_CSDO_QUEUE_DOWNLOAD)
+*
+* \param nodeId
+*    node-id of the SDO server
+*
+* \param key
+*    object entry key
+*
+* \param buf
+*    reference to transfered data
+*
+* \param size
+*    size of transfered data
+*
+* \param callback
+*    notification callback on transfer end
+*
+* \param timeout
+*    SDO server response timeout in milliseconds
+*
+* \retval  =CO_ERR_NONE         request is queued (or started)
+* \retval  =CO_ERR_BAD_ARG      invalid argument
+* \retval  =CO_ERR_CSDO_QUEUE   no free request memory available
+*/
+static CO_ERR COCSdoQueueAdd(CO_CSDO_QUEUE *q, uint8_t dir, uint8_t nodeId,
+                             uint32_t key, uint8_t *buf, uint32_t size,
+                             CO_CSDO_CALLBACK_T callback, uint32_t timeout)
+{
+    CO_CSDO_REQ *req;
+
+    ASSERT_PTR_ERR(q, CO_ERR_BAD_ARG);
+    ASSERT_PTR_ERR(buf, CO_ERR_BAD_ARG);
+    ASSERT_NOT_ERR(size, (uint32_t)0, CO_ERR_BAD_ARG);
+
+    if ((callback == (CO_CSDO_CALLBACK_T)NULL) ||
+        (nodeId   <  1u                      ) ||
+        (nodeId   >  127u                    )) {
+        return (CO_ERR_BAD_ARG);
+    }
+
+    req = q->Free;
+    if (req == NULL) {
+        return (CO_ERR_CSDO_QUEUE);
+    }
+    q->Free = req->Next;
+
+    req->Next   = NULL;
+    req->Call   = callback;
+    req->Buf    = buf;
+    req->Key    = key;
+    req->Size   = size;
+    req->Tmt    = timeout;
+    req->NodeId = nodeId;
+    req->Dir    = dir;
+    if (q->Tail == NULL) {
+        q->Head = req;
+    } else {
+        q->Tail->Next = req;
+    }
+    q->Tail = req;
+    q->Stat.Wait++;
+
+    COCSdoQueueDispatch(q);
+
+    return (CO_ERR_NONE);
+}
+
+/*! \brief  SELECT SDO CLIENT
+*
+*    This function selects an idle SDO client for a request to the given
+*    SDO server. An SDO client, which already addresses this SDO server is
+*    preferred, so the dispatch table of the node is kept.
+*
+* \param q
+*    pointer to the request queue
+*
+* \param nodeId
+*    node-id of the SDO server
+*
+* \retval  >0    pointer to the selected SDO client
+* \retval  =0    no SDO client is idle
+*/
+static CO_CSDO *COCSdoQueueClient(CO_CSDO_QUEUE *q, uint8_t nodeId)
+{
+    CO_CSDO *csdo;
+    CO_CSDO *result = NULL;
+    uint8_t  n;
+
+    for (n = 0; n < (uint8_t)CO_CSDO_N; n++) {
+        csdo = &q->Node->CSdo[n];
+        if ((csdo->State == CO_CSDO_STATE_IDLE) &&
+            (csdo->Req   == NULL              )) {
+            if (csdo->NodeId == nodeId) {
+                result = csdo;
+                break;
+            }
+            if (result == NULL) {
+                result = csdo;
+            }
+        }
+    }
+
+    return (result);
+}
+
+/*! \brief  DISPATCH WAITING REQUESTS
+*
+*    This function starts the waiting requests in the order of the queue
+*    on the idle SDO clients. A request is skipped, when the SDO server is
+*    busy with a previous request; all later requests to this SDO server
+*    are skipped, too. The search stops with the first request, which
+*    finds no idle SDO client.
+*
+* \param q
+*    pointer to the request queue
+*/
+static void COCSdoQueueDispatch(CO_CSDO_QUEUE *q)
+{
+    uint32_t     busy[CO_CSDO_QUEUE_MAP_N] = { 0 };
+    CO_CSDO_REQ *prev;
+    CO_CSDO_REQ *req;
+    CO_CSDO_REQ *next;
+    CO_CSDO     *csdo;
+    CO_ERR       err;
+    uint32_t     bit;
+    uint8_t      word;
+    uint8_t      n;
+
+    /* mark SDO servers with an executed request */
+    for (n = 0; n < (uint8_t)CO_CSDO_N; n++) {
+        req = q->Node->CSdo[n].Req;
+        if (req != NULL) {
+            busy[req->NodeId >> 5u] |= (uint32_t)1u << (req->NodeId & 0x1Fu);
+        }
+    }
+
+    prev = NULL;
+    req  = q->Head;
+    while (req != NULL) {
+        next = req->Next;
+        word = (uint8_t)(req->NodeId >> 5u);
+        bit  = (uint32_t)1u << (req->NodeId & 0x1Fu);
+        if ((busy[word] & bit) == 0u) {
+            csdo = COCSdoQueueClient(q, req->NodeId);
+            if (csdo == NULL) {
+                break;
+            }
+            (void)COCSdoSetServer(csdo, req->NodeId);
+            if (req->Dir == CO_CSDO_QUEUE_UPLOAD) {
+                err = COCSdoRequestUpload(csdo, req->Key, req->Buf, req->Size,
+                                          &COCSdoQueueFinish, req->Tmt);
+            } else {
+                err = COCSdoRequestDownload(csdo, req->Key, req->Buf, req->Size,
+                                            &COCSdoQueueFinish, req->Tmt);
+            }
+            if (err != CO_ERR_NONE) {
+                break;
+            }
+
+            /* remove started request from waiting requests */
+            if (prev == NULL) {
+                q->Head = next;
+            } else {
+                prev->Next = next;
+            }
+            if (q->Tail == req) {
+                q->Tail = prev;
+            }
+            req->Next = NULL;
+            csdo->Req = req;
+            q->Stat.Wait--;
+            q->Stat.Active++;
+            if (q->Stat.Active > q->Stat.MaxActive) {
+                q->Stat.MaxActive = q->Stat.Active;
+            }
+        } else {
+            prev = req;
+        }
+        busy[word] |= bit;
+        req = next;
+    }
+}
+
+/*! \brief  FINISH REQUEST
+*
+*    This function is the notification callback of all queued transfers.
+*    The request is released and the callback of the application is called
+*    before the next waiting requests are started. The SDO client refers to
+*    the finished request until the callback of the application returns.
+*
+* \param csdo
+*    pointer to the SDO client
+*
+* \param index
+*    dictionary index of the transfer
+*
+* \param sub
+*    dictionary subindex of the transfer
+*
+* \param code
+*    abort code of the transfer (0 = transfer finished)
+*/
+static void COCSdoQueueFinish(CO_CSDO *csdo, uint16_t index, uint8_t sub, uint32_t code)
+{
+    CO_CSDO_QUEUE     *q;
+    CO_CSDO_REQ       *req;
+    CO_CSDO_CALLBACK_T call;
+
+    req = csdo->Req;
+    if (req == NULL) {
+        return;
+    }
+    q    = req->Queue;
+    call = req->Call;
+
+    q->Stat.Active--;
+    if (code == 0u) {
+        q->Stat.Done++;
+        q->Stat.Bytes += csdo->Bytes;
+    } else {
+        q->Stat.Abort++;
+    }
+
+    /* release request for the application callback */
+    req->Next = q->Free;
+    q->Free   = req;
+
+    call(csdo, index, sub, code);
+    csdo->Req = NULL;
+
+    COCSdoQueueDispatch(q);
+}
+
+#endif /* USE_CSDO */
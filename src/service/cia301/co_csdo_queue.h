@@ -0,0 +1,229 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef CO_CSDO_QUEUE_H_
+#define CO_CSDO_QUEUE_H_
+
+#if defined __cplusplus
+extern "C" {
+#endif
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_types.h"
+#include "co_err.h"
+#include "co_csdo.h"
+
+/******************************************************************************
+* PUBLIC DEFINES
+******************************************************************************/
+
+#define CO_CSDO_QUEUE_UPLOAD     0u  /*!< request reads from the SDO server   */
+#define CO_CSDO_QUEUE_DOWNLOAD   1u  /*!< request writes to the SDO server    */
+
+/******************************************************************************
+* PUBLIC TYPES
+******************************************************************************/
+
+struct CO_NODE_T;                /* Declaration of canopen node structure    */
+struct CO_CSDO_QUEUE_T;          /* Declaration of request queue structure   */
+
+/*! \brief SDO CLIENT REQUEST
+*
+*    This structure holds a single queued SDO transfer. The request memory
+*    is provided by the application with \ref COCSdoQueueInit().
+*/
+typedef struct CO_CSDO_REQ_T {
+    struct CO_CSDO_REQ_T   *Next;     /*!< next request in list              */
+    struct CO_CSDO_QUEUE_T *Queue;    /*!< link to request queue             */
+    CO_CSDO_CALLBACK_T      Call;     /*!< notification callback             */
+    uint8_t                *Buf;      /*!< reference to transfered data      */
+    uint32_t                Key;      /*!< object entry key (CO_DEV)         */
+    uint32_t                Size;     /*!< transfered data size              */
+    uint32_t                Tmt;      /*!< timeout value in milliseconds     */
+    uint8_t                 NodeId;   /*!< node-id of addressed SDO server   */
+    uint8_t                 Dir;      /*!< upload or download request        */
+
+} CO_CSDO_REQ;
+
+/*! \brief SDO CLIENT QUEUE STATISTICS
+*
+*    This structure holds the aggregated counters of a request queue. The
+*    throughput is the number of transfered bytes divided by the time of
+*    the application between two readings of the statistics.
+*/
+typedef struct CO_CSDO_QUEUE_STAT_T {
+    uint32_t                Done;     /*!< number of finished transfers      */
+    uint32_t                Abort;    /*!< number of aborted transfers       */
+    uint32_t                Bytes;    /*!< received or sent bytes (finished) */
+    uint16_t                Wait;     /*!< number of waiting requests        */
+    uint16_t                Active;   /*!< number of executed requests       */
+    uint16_t                MaxActive;/*!< maximal concurrent requests       */
+
+} CO_CSDO_QUEUE_STAT;
+
+/*! \brief SDO CLIENT REQUEST QUEUE
+*
+*    This structure holds the waiting SDO transfers of a node. The waiting
+*    requests are executed concurrently by all idle SDO clients of the
+*    node, while the requests to a single SDO server are executed one after
+*    the other in the order of the queue.
+*
+*    During the notification callback of a queued transfer, the member Req
+*    of the SDO client refers to the finished request, so the callback gets
+*    the request queue and its application context with csdo->Req->Queue.
+*/
+typedef struct CO_CSDO_QUEUE_T {
+    struct CO_NODE_T       *Node;     /*!< link to parent node               */
+    CO_CSDO_REQ            *Free;     /*!< list of unused requests           */
+    CO_CSDO_REQ            *Head;     /*!< first waiting request             */
+    CO_CSDO_REQ            *Tail;     /*!< last waiting request              */
+    CO_CSDO_QUEUE_STAT      Stat;     /*!< aggregated transfer counters      */
+    void                   *Ctx;      /*!< application context (optional)    */
+
+} CO_CSDO_QUEUE;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  INIT REQUEST QUEUE
+*
+*    This function initializes the request queue of the given node with
+*    the request memory of the application. All enabled SDO clients of the
+*    node are used by the queue; the SDO clients are re-addressed to the
+*    requested SDO servers with \ref COCSdoSetServer().
+*
+* \note
+*    The queue must be initialized after \ref CONodeInit(). SDO clients,
+*    which are busy with a transfer of the application, are skipped until
+*    the transfer is finished.
+*
+* \param q
+*    pointer to the request queue
+*
+* \param node
+*    pointer to the CANopen node object
+*
+* \param mem
+*    pointer to the request memory
+*
+* \param num
+*    number of requests in the request memory
+*/
+void COCSdoQueueInit(CO_CSDO_QUEUE *q, struct CO_NODE_T *node, CO_CSDO_REQ *mem, uint16_t num);
+
+/*! \brief  QUEUE SDO UPLOAD
+*
+*    This function appends an SDO upload from the given SDO server to the
+*    request queue. The transfer is started, when an SDO client is idle and
+*    all previous requests to this SDO server are finished.
+*
+* \param q
+*    pointer to the request queue
+*
+* \param nodeId
+*    node-id of the SDO server (1..127)
+*
+* \param key
+*    object entry key; should be generated with the macro CO_DEV()
+*
+* \param buf
+*    reference to the buffer for the uploaded data
+*
+* \param size
+*    size of the buffer
+*
+* \param callback
+*    notification callback on transfer end (complete or abort)
+*
+* \param timeout
+*    SDO server response timeout in milliseconds
+*
+* \retval  =CO_ERR_NONE         request is queued (or started)
+* \retval  =CO_ERR_BAD_ARG      invalid argument
+* \retval  =CO_ERR_CSDO_QUEUE   no free request memory available
+*/
+CO_ERR COCSdoQueueUpload(CO_CSDO_QUEUE     *q,
+                         uint8_t            nodeId,
+                         uint32_t           key,
+                         uint8_t           *buf,
+                         uint32_t           size,
+                         CO_CSDO_CALLBACK_T callback,
+                         uint32_t           timeout);
+
+/*! \brief  QUEUE SDO DOWNLOAD
+*
+*    This function appends an SDO download to the given SDO server to the
+*    request queue. The transfer is started, when an SDO client is idle and
+*    all previous requests to this SDO server are finished.
+*
+* \param q
+*    pointer to the request queue
+*
+* \param nodeId
+*    node-id of the SDO server (1..127)
+*
+* \param key
+*    object entry key; should be generated with the macro CO_DEV()
+*
+* \param buf
+*    reference to the data to be downloaded
+*
+* \param size
+*    size of the data
+*
+* \param callback
+*    notification callback on transfer end (complete or abort)
+*
+* \param timeout
+*    SDO server response timeout in milliseconds
+*
+* \retval  =CO_ERR_NONE         request is queued (or started)
+* \retval  =CO_ERR_BAD_ARG      invalid argument
+* \retval  =CO_ERR_CSDO_QUEUE   no free request memory available
+*/
+CO_ERR COCSdoQueueDownload(CO_CSDO_QUEUE     *q,
+                           uint8_t            nodeId,
+                           uint32_t           key,
+                           uint8_t           *buf,
+                           uint32_t           size,
+                           CO_CSDO_CALLBACK_T callback,
+                           uint32_t           timeout);
+
+/*! \brief  GET QUEUE STATISTICS
+*
+*    This function returns the aggregated counters of the request queue.
+*    The counters of finished transfers are cleared, when requested.
+*
+* \param q
+*    pointer to the request queue
+*
+* \param stat
+*    pointer to the statistics (filled with the counters)
+*
+* \param clear
+*    clear the counters of finished transfers (=1), or keep them (=0)
+*/
+void COCSdoQueueGetStat(CO_CSDO_QUEUE *q, CO_CSDO_QUEUE_STAT *stat, uint8_t clear);
+
+#if defined __cplusplus
+}
+#endif
+
+#endif /* CO_CSDO_QUEUE_H_ */
@@ -22,24 +22,118 @@
 
 #include "co_core.h"
 
+#if CO_CPU_LITTLE_ENDIAN
+#include <string.h>
+#endif
+
 /******************************************************************************
 * PRIVATE HELPER FUNCTION PROTOTYPES
 ******************************************************************************/
 
-static void COTPdoMapClear(CO_TPDO_LINK *map);
+static void     COTPdoMapClear(CO_TPDO_LINK_MAP *map);
+static uint16_t COTPdoMapHash(CO_OBJ *obj);
+static uint8_t  COPdoIsPlain(CO_OBJ *obj, uint8_t size);
+static uint8_t  COPdoIsWide(CO_OBJ *obj, CO_NODE *node, uint8_t size);
+static void     COPdoPack(CO_IF_FRM *frm, uint8_t pos, CO_OBJ *obj, uint8_t size);
+static void     COPdoUnpack(CO_IF_FRM *frm, uint8_t pos, CO_OBJ *obj, uint8_t size);
 
 /******************************************************************************
 * PRIVATE HELPER FUNCTIONS
 ******************************************************************************/
 
-static void COTPdoMapClear(CO_TPDO_LINK *map)
+static void COTPdoMapClear(CO_TPDO_LINK_MAP *map)
 {
     uint16_t id;
 
-    for (id = 0; id < (CO_TPDO_N << 3); id++) {
-        map[id].Obj  = 0;
-        map[id].Num  = 0xFFFF;
+    for (id = 0; id < CO_TPDO_LINK_N; id++) {
+        map->Link[id].Obj  = 0;
+        map->Link[id].Num  = 0xFFFF;
+        map->Link[id].Next = id + 2;
+    }
+    map->Link[CO_TPDO_LINK_N - 1].Next = 0;
+    for (id = 0; id < CO_TPDO_HASH_N; id++) {
+        map->Head[id] = 0;
+    }
+    map->Free = 1;
+}
+
+static uint16_t COTPdoMapHash(CO_OBJ *obj)
+{
+    uintptr_t key;
+
+    /* object entries are located in arrays: neighbours get distinct keys */
+    key = (uintptr_t)obj / sizeof(CO_OBJ);
+    return ((uint16_t)(key & (CO_TPDO_HASH_N - 1)));
+}
+
+static uint8_t COPdoIsPlain(CO_OBJ *obj, uint8_t size)
+{
+    const CO_OBJ_TYPE *type;
+
+    if ((CO_IS_DIRECT(obj->Key) != 0) ||
+        (CO_IS_NODEID(obj->Key) != 0) ||
+        (obj->Data == (CO_DATA)0)) {
+        return (0u);
+    }
+    type = obj->Type;
+    if (((type == CO_TUNSIGNED8 ) && (size == 1u)) ||
+        ((type == CO_TUNSIGNED16) && (size == 2u)) ||
+        ((type == CO_TUNSIGNED32) && (size == 4u)) ||
+        ((type == CO_TUNSIGNED64) && (size == 8u))) {
+        return (1u);
+    }
+    return (0u);
+}
+
+static uint8_t COPdoIsWide(CO_OBJ *obj, CO_NODE *node, uint8_t size)
+{
+    const CO_OBJ_TYPE *type;
+
+    /* the wide basic types read and write the value in CANopen byte order */
+    type = obj->Type;
+    if ((type != CO_TUNSIGNED64) &&
+        (type != CO_TUNSIGNED40) && (type != CO_TSIGNED40) &&
+        (type != CO_TUNSIGNED48) && (type != CO_TSIGNED48) &&
+        (type != CO_TUNSIGNED56) && (type != CO_TSIGNED56)) {
+        return (0u);
+    }
+    return ((uint8_t)(COObjGetSize(obj, node, 0L) == (uint32_t)size));
+}
+
+static void COPdoPack(CO_IF_FRM *frm, uint8_t pos, CO_OBJ *obj, uint8_t size)
+{
+#if CO_CPU_LITTLE_ENDIAN
+    memcpy(&frm->Data[pos], (void *)obj->Data, size);
+#else
+    if (size == 1u) {
+        CO_SET_BYTE(frm, *(uint8_t *)obj->Data, pos);
+    } else if (size == 2u) {
+        CO_SET_WORD(frm, *(uint16_t *)obj->Data, pos);
+    } else if (size == 4u) {
+        CO_SET_LONG(frm, *(uint32_t *)obj->Data, pos);
+    } else {
+        CO_SET_LONG(frm, (uint32_t)(*(uint64_t *)obj->Data), pos);
+        CO_SET_LONG(frm, (uint32_t)(*(uint64_t *)obj->Data >> 32), pos + 4u);
+    }
+#endif
+}
+
+static void COPdoUnpack(CO_IF_FRM *frm, uint8_t pos, CO_OBJ *obj, uint8_t size)
+{
+#if CO_CPU_LITTLE_ENDIAN
+    memcpy((void *)obj->Data, &frm->Data[pos], size);
+#else
+    if (size == 1u) {
+        *(uint8_t *)obj->Data = CO_GET_BYTE(frm, pos);
+    } else if (size == 2u) {
+        *(uint16_t *)obj->Data = CO_GET_WORD(frm, pos);
+    } else if (size == 4u) {
+        *(uint32_t *)obj->Data = CO_GET_LONG(frm, pos);
+    } else {
+        *(uint64_t *)obj->Data = (uint64_t)CO_GET_LONG(frm, pos) |
+                                 ((uint64_t)CO_GET_LONG(frm, pos + 4u) << 32);
     }
+#endif
 }
 
 /******************************************************************************
@@ -56,13 +150,14 @@ void COTPdoInit(CO_TPDO *pdo, CO_NODE *node)
     ASSERT_PTR_FATAL(pdo);
     ASSERT_PTR_FATAL(node);
     
-    COTPdoMapClear(node->TMap);
+    COTPdoMapClear(&node->TMap);
     for (num = 0; num < CO_TPDO_N; num++) {
         pdo[num].Node       = node;
         pdo[num].EvTmr      = -1;
         pdo[num].InTmr      = -1;
         pdo[num].Identifier = CO_TPDO_COBID_OFF;
         pdo[num].ObjNum     = 0;
+        pdo[num].Fast       = 0;
         for (on = 0; on < 8; on++) {
             pdo[num].Map[on]  = 0;
             pdo[num].Size[on] = 0;
@@ -171,16 +266,20 @@ CO_ERR COTPdoGetMap (CO_TPDO *pdo, uint16_t num)
     uint8_t   mapnum;
     uint8_t   size;
     uint8_t   dlc;
+    uint8_t   fast;
 
     cod = &pdo[num].Node->Dict;
     idx = 0x1A00 + num;
+    pdo[num].Fast = 0;
+    COTPdoMapDelNum(&pdo->Node->TMap, num);
     err = CODictRdByte(cod, CO_DEV(idx, 0), &mapnum);
     if (err != CO_ERR_NONE) {
         return (CO_ERR_TPDO_MAP_OBJ);
     }
 
     /* build mapping table */
-    dlc = 0;
+    dlc  = 0;
+    fast = 0;
     for (on=0; on < mapnum; on++) {
         err = CODictRdLong(cod, CO_DEV(idx, 1+on), &mapping);
         if (err != CO_ERR_NONE) {
@@ -198,23 +297,85 @@ CO_ERR COTPdoGetMap (CO_TPDO *pdo, uint16_t num)
         } else {
             pdo[num].Map[on]  = obj;
             pdo[num].Size[on] = size;
-            COTPdoMapAdd(pdo->Node->TMap, obj, num);
+            COTPdoMapAdd(&pdo->Node->TMap, obj, num);
+            if (COPdoIsPlain(obj, size) != 0) {
+                fast |= (uint8_t)(1u << on);
+            }
         }
     }
     pdo[num].ObjNum = mapnum;
+    pdo[num].Fast   = fast;
 
     return (CO_ERR_NONE);
 }
 
-void COTPdoMapAdd(CO_TPDO_LINK *map, CO_OBJ *obj, uint16_t num)
+void COTPdoMapAdd(CO_TPDO_LINK_MAP *map, CO_OBJ *obj, uint16_t num)
 {
-    uint16_t id;
-    
-    for (id = 0; id < (CO_TPDO_N << 3); id++) {
-        if (map[id].Obj == 0) {
-            map[id].Obj = obj;
-            map[id].Num = num;
-            break;
+    CO_TPDO_LINK *link;
+    uint16_t     *pos;
+    uint16_t      id;
+
+    id = map->Free;
+    if (id == 0) {
+        return;
+    }
+    link      = &map->Link[id - 1];
+    map->Free = link->Next;
+    link->Obj = obj;
+    link->Num = num;
+
+    /* keep the chain sorted by TPDO number for a defined trigger order */
+    pos = &map->Head[COTPdoMapHash(obj)];
+    while ((*pos != 0) && (map->Link[*pos - 1].Num <= num)) {
+        pos = &map->Link[*pos - 1].Next;
+    }
+    link->Next = *pos;
+    *pos       = id;
+}
+
+void COTPdoMapDelNum(CO_TPDO_LINK_MAP *map, uint16_t num)
+{
+    CO_TPDO_LINK *link;
+    uint16_t     *pos;
+    uint16_t      hash;
+    uint16_t      id;
+
+    for (hash = 0; hash < CO_TPDO_HASH_N; hash++) {
+        pos = &map->Head[hash];
+        while (*pos != 0) {
+            id   = *pos;
+            link = &map->Link[id - 1];
+            if (link->Num == num) {
+                *pos       = link->Next;
+                link->Obj  = 0;
+                link->Num  = 0xFFFF;
+                link->Next = map->Free;
+                map->Free  = id;
+            } else {
+                pos = &link->Next;
+            }
+        }
+    }
+}
+
+void COTPdoMapDelSig(CO_TPDO_LINK_MAP *map, CO_OBJ *obj)
+{
+    CO_TPDO_LINK *link;
+    uint16_t     *pos;
+    uint16_t      id;
+
+    pos = &map->Head[COTPdoMapHash(obj)];
+    while (*pos != 0) {
+        id   = *pos;
+        link = &map->Link[id - 1];
+        if (link->Obj == obj) {
+            *pos       = link->Next;
+            link->Obj  = 0;
+            link->Num  = 0xFFFF;
+            link->Next = map->Free;
+            map->Free  = id;
+        } else {
+            pos = &link->Next;
         }
     }
 }
@@ -227,13 +388,14 @@ void COTPdoClear(CO_TPDO *pdo, CO_NODE *node)
     ASSERT_PTR(pdo);
     ASSERT_PTR(node);
     
-    COTPdoMapClear(node->TMap);
+    COTPdoMapClear(&node->TMap);
     for (num = 0; num < CO_TPDO_N; num++) {
         pdo[num].Node       = node;
         pdo[num].EvTmr      = -1;
         pdo[num].InTmr      = -1;
         pdo[num].Identifier = CO_TPDO_COBID_OFF;
         pdo[num].ObjNum     = 0;
+        pdo[num].Fast       = 0;
         for (on = 0; on < 8; on++) {
             pdo[num].Map[on]  = 0;
             pdo[num].Size[on] = 0;
@@ -310,11 +472,17 @@ void COTPdoTx(CO_TPDO *pdo)
     frm.DLC        = 0;
     for (num = 0; num < pdo->ObjNum; num++) {
         pdosz = pdo->Size[num];
-        if (pdosz <= 4) {
+        if ((pdo->Fast & (1u << num)) != 0) {
+            COPdoPack(&frm, frm.DLC, pdo->Map[num], pdosz);
+            frm.DLC += pdosz;
+        } else if (pdosz <= 4) {
             /* supported mapping: 1 to 4 bytes */
             sz = COObjGetSize(pdo->Map[num], pdo->Node, 0L);
             if (sz <= (uint32_t)(8 - frm.DLC)) {
-                if (pdosz == 3) {
+                if (sz == 3u) {
+                    /* a 24bit type is read as a sequence of 3 bytes */
+                    COObjRdValue(pdo->Map[num], pdo->Node, &frm.Data[frm.DLC], 3u);
+                } else if ((pdosz == 3) && (sz == 4u)) {
                     /* for 3bytes, read a basic 32bit type */
                     COObjRdValue(pdo->Map[num], pdo->Node, &data, 4u);
                 } else {
@@ -334,12 +502,18 @@ void COTPdoTx(CO_TPDO *pdo)
                 }
                 frm.DLC += pdosz;
             }
+        } else if (COPdoIsWide(pdo->Map[num], pdo->Node, pdosz) != 0) {
+            /* supported mapping: 5 to 8 bytes of a wide basic type */
+            if (pdosz <= (uint8_t)(8 - frm.DLC)) {
+                COObjRdValue(pdo->Map[num], pdo->Node, &frm.Data[frm.DLC], pdosz);
+                frm.DLC += pdosz;
+            }
         } else {
-            COTpdoReadData(&frm, frm.DLC, pdosz, pdo->Map[num]);
+            COTpdoReadData(pdo, &frm, frm.DLC, pdosz, pdo->Map[num]);
         }
     }
 
-    COPdoTransmit(&frm);
+    COPdoTransmit(pdo, &frm);
     (void)COIfCanSend(&pdo->Node->If, &frm);
 }
 
@@ -350,15 +524,19 @@ void COTPdoTx(CO_TPDO *pdo)
 WEAK_TEST
 void COTPdoTrigObj(CO_TPDO *pdo, CO_OBJ *obj)
 {
-    uint32_t n;
-    uint16_t num;
+    CO_TPDO_LINK_MAP *map;
+    CO_TPDO_LINK     *link;
+    uint16_t          id;
 
     if (CO_IS_PDOMAP(obj->Key) != 0) {
-        for (n=0; n < (CO_TPDO_N << 3); n++) {
-            if (pdo->Node->TMap[n].Obj == obj) {
-                num = pdo->Node->TMap[n].Num;
-                COTPdoTrigPdo(pdo, num);
+        map = &pdo->Node->TMap;
+        id  = map->Head[COTPdoMapHash(obj)];
+        while (id != 0) {
+            link = &map->Link[id - 1];
+            if (link->Obj == obj) {
+                COTPdoTrigPdo(pdo, link->Num);
             }
+            id = link->Next;
         }
     } else {
         pdo->Node->Error = CO_ERR_TPDO_OBJ_TRIGGER;
@@ -385,7 +563,9 @@ void CORPdoClear(CO_RPDO *pdo, CO_NODE *node)
         pdo[num].Node       = node;
         pdo[num].Identifier = 0;
         pdo[num].ObjNum     = 0;
+        pdo[num].Fast       = 0;
     }
+    CO_DISP_INVALIDATE(node);
 }
 
 void CORPdoInit(CO_RPDO *pdo, CO_NODE *node)
@@ -397,10 +577,12 @@ void CORPdoInit(CO_RPDO *pdo, CO_NODE *node)
     ASSERT_PTR_FATAL(pdo);
     ASSERT_PTR_FATAL(node);
 
+    CO_DISP_INVALIDATE(node);
     for (num = 0; num < CO_RPDO_N; num++) {
         pdo[num].Node       = node;
         pdo[num].Identifier = 0;
         pdo[num].ObjNum     = 0;
+        pdo[num].Fast       = 0;
         err = CODictRdByte(&node->Dict, CO_DEV(0x1400 + num, 0), &rnum);
         if (err == CO_ERR_NONE) {
             CORPdoReset(pdo, num);
@@ -423,6 +605,8 @@ CO_ERR CORPdoReset(CO_RPDO *pdo, uint16_t num)
     cod            = &wp->Node->Dict;
     wp->Identifier = 0;
     wp->ObjNum     = 0;
+    wp->Fast       = 0;
+    CO_DISP_INVALIDATE(wp->Node);
     for (on = 0; on < 8; on++) {
         wp->Map[on]  = 0;
         wp->Size[on] = 0;
@@ -485,9 +669,11 @@ CO_ERR CORPdoGetMap(CO_RPDO *pdo, uint16_t num)
     uint8_t   dlc;
     uint8_t   size;
     uint8_t   dummy = 0;
+    uint8_t   fast  = 0;
 
     cod = &pdo[num].Node->Dict;
     idx = 0x1600 + num;
+    pdo[num].Fast = 0;
     err = CODictRdByte(cod, CO_DEV(idx, 0), &mapnum);
     if (err != CO_ERR_NONE) {
         return (CO_ERR_RPDO_MAP_OBJ);
@@ -530,10 +716,16 @@ CO_ERR CORPdoGetMap(CO_RPDO *pdo, uint16_t num)
             } else {
                 pdo[num].Map[on + dummy] = obj;
                 pdo[num].Size[on + dummy] = size;
+                if ((COPdoIsPlain(obj, size) != 0) &&
+                    ((CO_IS_ASYNC(obj->Key)  == 0) ||
+                     (CO_IS_PDOMAP(obj->Key) == 0))) {
+                    fast |= (uint8_t)(1u << (on + dummy));
+                }
             }
         }
     }
     pdo[num].ObjNum = mapnum + dummy;
+    pdo[num].Fast   = fast;
     return (CO_ERR_NONE);
 }
 
@@ -541,7 +733,7 @@ void CORPdoRx(CO_RPDO *pdo, CO_IF_FRM *frm)
 {
     int16_t err = 0;
 
-    err = COPdoReceive(frm);
+    err = COPdoReceive(pdo, frm);
     if (err == 0) {
         if ((pdo->Flag & CO_RPDO_FLG_S_) == 0) {
             CORPdoWrite(pdo, frm);
@@ -583,7 +775,10 @@ void CORPdoWrite(CO_RPDO *pdo, CO_IF_FRM *frm)
     for (on = 0; on < pdo->ObjNum; on++) {
         obj   = pdo->Map[on];
         pdosz = pdo->Size[on];
-        if (obj != 0) {
+        if ((pdo->Fast & (1u << on)) != 0) {
+            COPdoUnpack(frm, dlc, obj, pdosz);
+            dlc += pdosz;
+        } else if (obj != 0) {
             if (pdosz <= 4) {
                 /* supported mapping: 1 to 4 bytes */
                 sz = (uint8_t)COObjGetSize(obj, pdo->Node, 0L);
@@ -595,16 +790,26 @@ void CORPdoWrite(CO_RPDO *pdo, CO_IF_FRM *frm)
                     val16 = CO_GET_WORD(frm, dlc);
                     dlc += 2;
                     COObjWrValue(obj, pdo->Node, (void *)&val16, sz);
+                } else if (sz == 3u) {
+                    /* a 24bit type is written as a sequence of 3 bytes */
+                    COObjWrValue(obj, pdo->Node, (void *)&frm->Data[dlc], sz);
+                    dlc += 3;
                 } else if (sz == 4u) {
-                    val32 = CO_GET_LONG(frm, dlc);
                     if (pdosz == 3) {
-                        val32 &= 0x00FFFFFF;
+                        val32 = (uint32_t)CO_GET_BYTE(frm, dlc) |
+                                ((uint32_t)CO_GET_WORD(frm, dlc + 1) << 8);
+                    } else {
+                        val32 = CO_GET_LONG(frm, dlc);
                     }
                     dlc += pdosz;
                     COObjWrValue(obj, pdo->Node, (void *)&val32, sz);
                 }
+            } else if (COPdoIsWide(obj, pdo->Node, pdosz) != 0) {
+                /* supported mapping: 5 to 8 bytes of a wide basic type */
+                COObjWrValue(obj, pdo->Node, (void *)&frm->Data[dlc], pdosz);
+                dlc += pdosz;
             } else {
-                CORpdoWriteData(frm, dlc, pdosz, obj);
+                CORpdoWriteData(pdo, frm, dlc, pdosz, obj);
             }
         }
     }
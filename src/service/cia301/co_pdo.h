@@ -28,6 +28,7 @@ extern "C" {
 #include "co_obj.h"
 #include "co_if.h"
 #include "co_tmr.h"
+#include "co_cfg.h"
 
 /******************************************************************************
 * PUBLIC DEFINES
@@ -37,6 +38,12 @@ extern "C" {
 #define CO_TPDO_COBID_REMOTE ((uint32_t)1 << 30)    /*!< RTR is not allowed  */
 #define CO_TPDO_COBID_EXT    ((uint32_t)1 << 29)    /*!< extended format     */
 
+#define CO_TPDO_LINK_N       (CO_TPDO_N * 8)        /*!< number of links     */
+
+#if (CO_TPDO_HASH_N < 1) || ((CO_TPDO_HASH_N & (CO_TPDO_HASH_N - 1)) != 0)
+#error "CO_TPDO_HASH_N: the number of hash buckets must be a power of 2"
+#endif
+
 #define CO_RPDO_COBID_OFF    ((uint32_t)1 << 31)    /*!< marked as unused    */
 #define CO_RPDO_COBID_EXT    ((uint32_t)1 << 29)    /*!< extended format     */
 
@@ -176,9 +183,24 @@ struct CO_OBJ_T;
 typedef struct CO_TPDO_LINK_T {
     struct CO_OBJ_T *Obj;        /*!< pointer to object                      */
     uint16_t         Num;        /*!< currently mapped to TPDO-num (0..511)  */
+    uint16_t         Next;       /*!< next link in chain (index+1, 0 = end)  */
 
 } CO_TPDO_LINK;
 
+/*! \brief TPDO SIGNAL LINK MAP
+*
+*    This structure holds the links from the mapped objects to the TPDOs.
+*    The links of all objects with the same hash value are chained in
+*    ascending TPDO number order, so triggering an object visits only the
+*    links of this hash bucket. Unused links are chained in a free list.
+*/
+typedef struct CO_TPDO_LINK_MAP_T {
+    CO_TPDO_LINK     Link[CO_TPDO_LINK_N];  /*!< link storage               */
+    uint16_t         Head[CO_TPDO_HASH_N];  /*!< first link (index+1)       */
+    uint16_t         Free;                  /*!< first free link (index+1)  */
+
+} CO_TPDO_LINK_MAP;
+
 /*! \brief TPDO DATA
 *
 *    This structure holds all data, which are needed for managing a
@@ -195,6 +217,7 @@ typedef struct CO_TPDO_T {
     uint32_t          Inhibit;     /*!< inhibit time in timer ticks          */
     uint8_t           Flags;       /*!< info flags                           */
     uint8_t           ObjNum;      /*!< Number of linked objects             */
+    uint8_t           Fast;        /*!< bit n: copy Map[n] without type      */
 
 } CO_TPDO;
 
@@ -210,6 +233,7 @@ typedef struct CO_RPDO_T {
     uint8_t           Size[8];     /*!< size of mapped object value in bytes */
     uint8_t           ObjNum;      /*!< Number of linked objects             */
     uint8_t           Flag;        /*!< Flags attributed of PDO              */
+    uint8_t           Fast;        /*!< bit n: copy Map[n] without type      */
 
 } CO_RPDO;
 
@@ -307,6 +331,10 @@ void COTPdoReset(CO_TPDO *pdo, uint16_t num);
 *    -# 0x1A00+[num] : 0x00 = Number of mapped signals (0..8)
 *    -# 0x1A00+[num] : 0x01..0x08 = Mapped signal
 *
+*    Mapped basic objects with a RAM reference, which fills the complete
+*    mapping size, are marked for the direct copy into the CAN frame. The
+*    object entry properties are evaluated with this function only.
+*
 * \param pdo
 *    Pointer to start of TPDO array
 *
@@ -357,7 +385,7 @@ void COTPdoTx(CO_TPDO *pdo);
 *    mapping table.
 *
 * \param map
-*    Pointer to start of link mapping table
+*    Pointer to link mapping table
 *
 * \param obj
 *    Pointer to object entry
@@ -365,7 +393,7 @@ void COTPdoTx(CO_TPDO *pdo);
 * \param num
 *    Linked TPDO number
 */
-void COTPdoMapAdd(CO_TPDO_LINK *map, struct CO_OBJ_T *obj, uint16_t num);
+void COTPdoMapAdd(CO_TPDO_LINK_MAP *map, struct CO_OBJ_T *obj, uint16_t num);
 
 /*! \brief TPDO LINK MAP DEL VIA TPDO-NUM
 *
@@ -373,12 +401,12 @@ void COTPdoMapAdd(CO_TPDO_LINK *map, struct CO_OBJ_T *obj, uint16_t num);
 *    TPDO number.
 *
 * \param map
-*    Pointer to start of link mapping table
+*    Pointer to link mapping table
 *
 * \param num
 *    Linked TPDO number
 */
-void COTPdoMapDelNum(CO_TPDO_LINK *map, uint16_t num);
+void COTPdoMapDelNum(CO_TPDO_LINK_MAP *map, uint16_t num);
 
 /*! \brief TPDO LINK MAP DEL VIA SIGNAL-ID
 *
@@ -386,12 +414,12 @@ void COTPdoMapDelNum(CO_TPDO_LINK *map, uint16_t num);
 *    signal identifier.
 *
 * \param map
-*    Pointer to start of link mapping table
+*    Pointer to link mapping table
 *
 * \param obj
 *    Pointer to object entry
 */
-void COTPdoMapDelSig(CO_TPDO_LINK *map, struct CO_OBJ_T *obj);
+void COTPdoMapDelSig(CO_TPDO_LINK_MAP *map, struct CO_OBJ_T *obj);
 
 /*! \brief RPDO CLEAR
 *
@@ -454,6 +482,11 @@ CO_ERR CORPdoReset(CO_RPDO *pdo, uint16_t num);
 *    -# 0x1600+[num] : 0x00 = Number of mapped signals (0..8)
 *    -# 0x1600+[num] : 0x01..0x08 = Mapped signal
 *
+*    Mapped basic objects with a RAM reference, which fills the complete
+*    mapping size and without asynchronous TPDO trigger, are marked for the
+*    direct copy out of the CAN frame. The object entry properties are
+*    evaluated with this function only.
+*
 * \param pdo
 *    Pointer to start of RPDO array
 *
@@ -517,10 +550,13 @@ void CORPdoWrite(CO_RPDO *pdo, CO_IF_FRM *frm);
 *    This function is called just before the PDO transmission will send
 *    the PDO message frame to the CANopen network.
 *
+* \param pdo
+*    Pointer to transmit PDO
+*
 * \param frm
 *    Pointer to PDO message frame
 */
-extern void COPdoTransmit(CO_IF_FRM *frm);
+extern void COPdoTransmit(CO_TPDO *pdo, CO_IF_FRM *frm);
 
 /*! \brief  PDO RECEIVE CALLBACK
 *
@@ -531,13 +567,16 @@ extern void COPdoTransmit(CO_IF_FRM *frm);
 *    <i>consuming</i> the PDO message frame, this function could modify the
 *    recieved data before distribution takes place.
 *
+* \param pdo
+*    Pointer to receive PDO
+*
 * \param frm
 *    Pointer to PDO message frame
 *
 * \retval   =0    CAN message frame is not consumed
 * \retval   >0    CAN message frame is consumed
 */
-extern int16_t COPdoReceive(CO_IF_FRM *frm);
+extern int16_t COPdoReceive(CO_RPDO *pdo, CO_IF_FRM *frm);
 
 /*! \brief  PDO WRITE DATA CALLBACK
 *
@@ -545,6 +584,9 @@ extern int16_t COPdoReceive(CO_IF_FRM *frm);
 *    frame into the object dictionary when mapped data value consumes
 *    more than 4 bytes.
 *
+* \param pdo
+*    Pointer to receive PDO
+*
 * \param frm
 *    Pointer to PDO message frame
 *
@@ -557,13 +599,16 @@ extern int16_t COPdoReceive(CO_IF_FRM *frm);
 * \param obj
 *    Pointer to the target object entry
 */
-extern void CORpdoWriteData(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj);
+extern void CORpdoWriteData(CO_RPDO *pdo, CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj);
 
 /*! \brief  PDO READ DATA CALLBACK
 *
 *    This function is called during PDO transmission when a mapped
 *    data value consumes more than 4 bytes.
 *
+* \param pdo
+*    Pointer to transmit PDO
+*
 * \param frm
 *    Pointer to PDO message frame
 *
@@ -576,7 +621,7 @@ extern void CORpdoWriteData(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *o
 * \param obj
 *    Pointer to the source object entry
 */
-extern void COTpdoReadData(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj);
+extern void COTpdoReadData(CO_TPDO *pdo, CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj);
 
 #ifdef __cplusplus               /* for compatibility with C++ environments  */
 }
@@ -0,0 +1,290 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+#if CO_SDO_CRC_CLMUL
+#include <wmmintrin.h>
+#include <tmmintrin.h>
+#endif
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#if CO_SDO_CRC_CLMUL
+
+/*! \brief CARRY-LESS MULTIPLICATION KERNEL
+*
+*    The kernel folds blocks of 16 bytes, shorter data and the remainder are
+*    calculated with the table. The fold constants are the remainders of
+*    x^192 and x^128 divided by the CRC polynomial.
+*/
+#define CO_SDO_CRC_CLMUL_MIN  32u         /*!< minimal data length for kernel */
+#define CO_SDO_CRC_K192       0x650Bu     /*!< x^192 mod P                    */
+#define CO_SDO_CRC_K128       0xAEFCu     /*!< x^128 mod P                    */
+
+#endif
+
+/******************************************************************************
+* PRIVATE CONSTANTS
+******************************************************************************/
+
+/*! \brief CRC TABLE
+*
+*    This table holds the CRC-16-CCITT checksum of each byte value, shifted
+*    to the upper byte of the checksum.
+*/
+static const uint16_t COSdoCrcTbl[256] = {
+    0x0000u, 0x1021u, 0x2042u, 0x3063u, 0x4084u, 0x50A5u, 0x60C6u, 0x70E7u,
+    0x8108u, 0x9129u, 0xA14Au, 0xB16Bu, 0xC18Cu, 0xD1ADu, 0xE1CEu, 0xF1EFu,
+    0x1231u, 0x0210u, 0x3273u, 0x2252u, 0x52B5u, 0x4294u, 0x72F7u, 0x62D6u,
+    0x9339u, 0x8318u, 0xB37Bu, 0xA35Au, 0xD3BDu, 0xC39Cu, 0xF3FFu, 0xE3DEu,
+    0x2462u, 0x3443u, 0x0420u, 0x1401u, 0x64E6u, 0x74C7u, 0x44A4u, 0x5485u,
+    0xA56Au, 0xB54Bu, 0x8528u, 0x9509u, 0xE5EEu, 0xF5CFu, 0xC5ACu, 0xD58Du,
+    0x3653u, 0x2672u, 0x1611u, 0x0630u, 0x76D7u, 0x66F6u, 0x5695u, 0x46B4u,
+    0xB75Bu, 0xA77Au, 0x9719u, 0x8738u, 0xF7DFu, 0xE7FEu, 0xD79Du, 0xC7BCu,
+    0x48C4u, 0x58E5u, 0x6886u, 0x78A7u, 0x0840u, 0x1861u, 0x2802u, 0x3823u,
+    0xC9CCu, 0xD9EDu, 0xE98Eu, 0xF9AFu, 0x8948u, 0x9969u, 0xA90Au, 0xB92Bu,
+    0x5AF5u, 0x4AD4u, 0x7AB7u, 0x6A96u, 0x1A71u, 0x0A50u, 0x3A33u, 0x2A12u,
+    0xDBFDu, 0xCBDCu, 0xFBBFu, 0xEB9Eu, 0x9B79u, 0x8B58u, 0xBB3Bu, 0xAB1Au,
+    0x6CA6u, 0x7C87u, 0x4CE4u, 0x5CC5u, 0x2C22u, 0x3C03u, 0x0C60u, 0x1C41u,
+    0xEDAEu, 0xFD8Fu, 0xCDECu, 0xDDCDu, 0xAD2Au, 0xBD0Bu, 0x8D68u, 0x9D49u,
+    0x7E97u, 0x6EB6u, 0x5ED5u, 0x4EF4u, 0x3E13u, 0x2E32u, 0x1E51u, 0x0E70u,
+    0xFF9Fu, 0xEFBEu, 0xDFDDu, 0xCFFCu, 0xBF1Bu, 0xAF3Au, 0x9F59u, 0x8F78u,
+    0x9188u, 0x81A9u, 0xB1CAu, 0xA1EBu, 0xD10Cu, 0xC12Du, 0xF14Eu, 0xE16Fu,
+    0x1080u, 0x00A1u, 0x30C2u, 0x20E3u, 0x5004u, 0x4025u, 0x7046u, 0x6067u,
+    0x83B9u, 0x9398u, 0xA3FBu, 0xB3DAu, 0xC33Du, 0xD31Cu, 0xE37Fu, 0xF35Eu,
+    0x02B1u, 0x1290u, 0x22F3u, 0x32D2u, 0x4235u, 0x5214u, 0x6277u, 0x7256u,
+    0xB5EAu, 0xA5CBu, 0x95A8u, 0x8589u, 0xF56Eu, 0xE54Fu, 0xD52Cu, 0xC50Du,
+    0x34E2u, 0x24C3u, 0x14A0u, 0x0481u, 0x7466u, 0x6447u, 0x5424u, 0x4405u,
+    0xA7DBu, 0xB7FAu, 0x8799u, 0x97B8u, 0xE75Fu, 0xF77Eu, 0xC71Du, 0xD73Cu,
+    0x26D3u, 0x36F2u, 0x0691u, 0x16B0u, 0x6657u, 0x7676u, 0x4615u, 0x5634u,
+    0xD94Cu, 0xC96Du, 0xF90Eu, 0xE92Fu, 0x99C8u, 0x89E9u, 0xB98Au, 0xA9ABu,
+    0x5844u, 0x4865u, 0x7806u, 0x6827u, 0x18C0u, 0x08E1u, 0x3882u, 0x28A3u,
+    0xCB7Du, 0xDB5Cu, 0xEB3Fu, 0xFB1Eu, 0x8BF9u, 0x9BD8u, 0xABBBu, 0xBB9Au,
+    0x4A75u, 0x5A54u, 0x6A37u, 0x7A16u, 0x0AF1u, 0x1AD0u, 0x2AB3u, 0x3A92u,
+    0xFD2Eu, 0xED0Fu, 0xDD6Cu, 0xCD4Du, 0xBDAAu, 0xAD8Bu, 0x9DE8u, 0x8DC9u,
+    0x7C26u, 0x6C07u, 0x5C64u, 0x4C45u, 0x3CA2u, 0x2C83u, 0x1CE0u, 0x0CC1u,
+    0xEF1Fu, 0xFF3Eu, 0xCF5Du, 0xDF7Cu, 0xAF9Bu, 0xBFBAu, 0x8FD9u, 0x9FF8u,
+    0x6E17u, 0x7E36u, 0x4E55u, 0x5E74u, 0x2E93u, 0x3EB2u, 0x0ED1u, 0x1EF0u
+};
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  CALCULATE CRC WITH TABLE
+*
+*    This function continues the checksum with the given data bytes, one
+*    table lookup per byte.
+*
+* \param crc
+*    checksum of the preceding data bytes
+*
+* \param buf
+*    pointer to the data bytes
+*
+* \param len
+*    number of data bytes
+*
+* \return
+*    checksum of the preceding and the given data bytes
+*/
+static uint16_t COSdoCrcTable(uint16_t crc, const uint8_t *buf, uint32_t len)
+{
+    while (len > 0u) {
+        crc = (uint16_t)((uint16_t)(crc << 8u) ^ COSdoCrcTbl[(uint8_t)(crc >> 8u) ^ *buf]);
+        buf++;
+        len--;
+    }
+    return (crc);
+}
+
+#if CO_SDO_CRC_CLMUL
+
+/*! \brief  CALCULATE CRC WITH CARRY-LESS MULTIPLICATION
+*
+*    This function continues the checksum with the given data bytes (at
+*    least 32 bytes). The data is folded in 128 bit steps into a 128 bit
+*    remainder, which has the same checksum as the folded data. The
+*    checksum of the remainder and of the trailing bytes is calculated
+*    with the table.
+*
+* \param crc
+*    checksum of the preceding data bytes
+*
+* \param buf
+*    pointer to the data bytes
+*
+* \param len
+*    number of data bytes
+*
+* \return
+*    checksum of the preceding and the given data bytes
+*/
+__attribute__((target("pclmul,ssse3")))
+static uint16_t COSdoCrcClmul(uint16_t crc, const uint8_t *buf, uint32_t len)
+{
+    const __m128i swap = _mm_set_epi8(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15);
+    const __m128i k    = _mm_set_epi64x(CO_SDO_CRC_K192, CO_SDO_CRC_K128);
+    __m128i       acc;
+    __m128i       hi;
+    __m128i       lo;
+    uint8_t       rem[16];
+
+    /* the first data bits are the highest polynomial coefficients, the
+     * preceding checksum is added to the first two data bytes */
+    acc = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)buf), swap);
+    acc = _mm_xor_si128(acc, _mm_set_epi64x((int64_t)((uint64_t)crc << 48u), 0));
+    buf += 16u;
+    len -= 16u;
+
+    while (len >= 16u) {
+        hi  = _mm_clmulepi64_si128(acc, k, 0x11);
+        lo  = _mm_clmulepi64_si128(acc, k, 0x00);
+        acc = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)buf), swap);
+        acc = _mm_xor_si128(acc, _mm_xor_si128(hi, lo));
+        buf += 16u;
+        len -= 16u;
+    }
+
+    _mm_storeu_si128((__m128i *)rem, _mm_shuffle_epi8(acc, swap));
+    crc = COSdoCrcTable(0u, rem, 16u);
+    return (COSdoCrcTable(crc, buf, len));
+}
+
+#endif
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+uint16_t COSdoCrc(uint16_t crc, const uint8_t *buf, uint32_t len)
+{
+#if CO_SDO_CRC_CLMUL
+    if ((len >= CO_SDO_CRC_CLMUL_MIN) &&
+        (__builtin_cpu_supports("pclmul") != 0) &&
+        (__builtin_cpu_supports("ssse3") != 0)) {
+        return (COSdoCrcClmul(crc, buf, len));
+    }
+#endif
+    return (COSdoCrcTable(crc, buf, len));
+}
+
+/*
+* see function definition
+*/
+void COSdoStatClear(CO_SDO_STAT *stat)
+{
+    uint8_t n;
+
+    for (n = 0u; n < (uint8_t)CO_SDO_STAT_TYPE_N; n++) {
+        stat->Num[n] = 0u;
+    }
+    for (n = 0u; n < (uint8_t)CO_SDO_STAT_CODE_N; n++) {
+        stat->Code[n].Code = 0u;
+        stat->Code[n].Num  = 0u;
+    }
+    for (n = 0u; n < (uint8_t)CO_SDO_STAT_HIST_N; n++) {
+        stat->Hist[n] = 0u;
+    }
+    stat->Bytes   = 0u;
+    stat->Abort   = 0u;
+    stat->Timeout = 0u;
+    stat->Other   = 0u;
+}
+
+/*
+* see function definition
+*/
+uint32_t COSdoStatLimit(uint8_t bucket)
+{
+    uint32_t limit = (uint32_t)CO_SDO_STAT_HIST_RES;
+    uint8_t  n;
+
+    if (bucket >= (uint8_t)(CO_SDO_STAT_HIST_N - 1)) {
+        return (0u);
+    }
+    for (n = 0u; n < bucket; n++) {
+        limit = (limit > 0x7FFFFFFFuL) ? 0xFFFFFFFFuL : (limit << 1u);
+    }
+    return (limit);
+}
+
+/******************************************************************************
+* PROTECTED FUNCTIONS
+******************************************************************************/
+
+/*
+* see function definition
+*/
+void COSdoStatStart(CO_SDO_STAT *stat, uint8_t type, uint32_t size, uint32_t now)
+{
+    stat->Start = now;
+    stat->Size  = size;
+    stat->Type  = type;
+    stat->Act   = 1u;
+}
+
+/*
+* see function definition
+*/
+void COSdoStatEnd(CO_SDO_STAT *stat, uint32_t code, uint32_t now)
+{
+    uint32_t us;
+    uint32_t limit;
+    uint8_t  n;
+
+    if (stat->Act == 0u) {
+        return;
+    }
+    stat->Act = 0u;
+
+    if (code == 0u) {
+        us    = now - stat->Start;
+        limit = (uint32_t)CO_SDO_STAT_HIST_RES;
+        n     = 0u;
+        while ((n < (uint8_t)(CO_SDO_STAT_HIST_N - 1)) && (us >= limit)) {
+            limit = (limit > 0x7FFFFFFFuL) ? 0xFFFFFFFFuL : (limit << 1u);
+            n++;
+        }
+        stat->Hist[n]++;
+        stat->Num[stat->Type]++;
+        stat->Bytes += stat->Size;
+        return;
+    }
+
+    stat->Abort++;
+    if (code == (uint32_t)CO_SDO_ERR_TIMEOUT) {
+        stat->Timeout++;
+    }
+    for (n = 0u; n < (uint8_t)CO_SDO_STAT_CODE_N; n++) {
+        if ((stat->Code[n].Code == code) || (stat->Code[n].Code == 0u)) {
+            stat->Code[n].Code = code;
+            stat->Code[n].Num++;
+            return;
+        }
+    }
+    stat->Other++;
+}
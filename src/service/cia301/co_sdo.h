@@ -105,6 +105,14 @@ extern "C"{
 #define CO_SDO_BUF_SEG     127
 #define CO_SDO_BUF_BYTE    (CO_SDO_BUF_SEG*7) /*!< transfer buffer size in byte           */
 
+#if CO_SDO_STAT_CODE_N < 1
+#error "CO_SDO_STAT_CODE_N: at least one abort code must be counted"
+#endif
+
+#if (CO_SDO_STAT_HIST_N < 1) || (CO_SDO_STAT_HIST_N > 32)
+#error "CO_SDO_STAT_HIST_N: the histogram must have 1..32 buckets"
+#endif
+
 /******************************************************************************
 * PUBLIC TYPES
 ******************************************************************************/
@@ -121,6 +129,166 @@ typedef struct CO_SDO_BUF_T {
 
 } CO_SDO_BUF;
 
+/*! \brief SDO STATISTICS TRANSFER TYPES
+*
+*    This enumeration holds the transfer types, which are counted in the
+*    SDO statistics.
+*/
+typedef enum CO_SDO_STAT_TYPE_T {
+    CO_SDO_STAT_EXP_UP = 0,      /*!< expedited upload                       */
+    CO_SDO_STAT_EXP_DOWN,        /*!< expedited download                     */
+    CO_SDO_STAT_SEG_UP,          /*!< segmented upload                       */
+    CO_SDO_STAT_SEG_DOWN,        /*!< segmented download                     */
+    CO_SDO_STAT_BLK_UP,          /*!< block upload                           */
+    CO_SDO_STAT_BLK_DOWN,        /*!< block download                         */
+    CO_SDO_STAT_TYPE_N           /*!< number of transfer types               */
+
+} CO_SDO_STAT_TYPE;
+
+/*! \brief SDO STATISTICS ABORT CODE
+*
+*    This structure holds the number of aborts with a single abort code.
+*/
+typedef struct CO_SDO_STAT_CODE_T {
+    uint32_t  Code;              /*!< abort code (0: unused)                 */
+    uint32_t  Num;               /*!< number of aborts with this code        */
+
+} CO_SDO_STAT_CODE;
+
+/*! \brief SDO STATISTICS
+*
+*    This structure holds the statistics of a single SDO server or SDO
+*    client. The counters are wrapping around; the members marked as
+*    internal hold the active transfer.
+*/
+typedef struct CO_SDO_STAT_T {
+    uint32_t  Num[CO_SDO_STAT_TYPE_N];    /*!< finished transfers per type   */
+    uint32_t  Bytes;                      /*!< bytes of finished transfers   */
+    uint32_t  Abort;                      /*!< aborted transfers             */
+    uint32_t  Timeout;                    /*!< aborts due to timeout         */
+    CO_SDO_STAT_CODE Code[CO_SDO_STAT_CODE_N]; /*!< aborts per abort code    */
+    uint32_t  Other;                      /*!< aborts with further codes     */
+    uint32_t  Hist[CO_SDO_STAT_HIST_N];   /*!< finished transfers per time   */
+    uint32_t  Start;                      /*!< Internal start time           */
+    uint32_t  Size;                       /*!< Internal transfer size        */
+    uint8_t   Type;                       /*!< Internal transfer type        */
+    uint8_t   Act;                        /*!< Internal transfer is active   */
+
+} CO_SDO_STAT;
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  CALCULATE SDO BLOCK CRC
+*
+*    This function continues the calculation of the CRC-16-CCITT checksum
+*    (polynomial x^16 + x^12 + x^5 + 1, start value 0) of the SDO block
+*    transfer with the given data bytes. The checksum of a transfer can be
+*    calculated in multiple steps, starting with crc = 0. Longer data is
+*    calculated with the carry-less multiplication, when it is enabled with
+*    CO_SDO_CRC_CLMUL and supported by the CPU.
+*
+* \param crc
+*    checksum of the preceding data bytes
+*
+* \param buf
+*    pointer to the data bytes
+*
+* \param len
+*    number of data bytes
+*
+* \return
+*    checksum of the preceding and the given data bytes
+*/
+uint16_t COSdoCrc(uint16_t crc, const uint8_t *buf, uint32_t len);
+
+/*! \brief  CLEAR SDO STATISTICS
+*
+*    This function clears all counters of the given SDO statistics. An
+*    active transfer is counted, when it is finished. The statistics of the
+*    SDO servers and SDO clients are the members 'Stat' of the node members
+*    'Sdo[n]' and 'CSdo[n]', when enabled with USE_SDO_STAT.
+*
+* \param stat
+*    pointer to the SDO statistics
+*/
+void COSdoStatClear(CO_SDO_STAT *stat);
+
+/*! \brief  GET SDO STATISTICS HISTOGRAM LIMIT
+*
+*    This function returns the upper limit of the given histogram bucket.
+*    A transfer is counted in the first bucket with a duration less than
+*    the limit.
+*
+* \param bucket
+*    number of histogram bucket (0..CO_SDO_STAT_HIST_N-1)
+*
+* \return
+*    upper limit in microseconds (0: unlimited, last bucket)
+*/
+uint32_t COSdoStatLimit(uint8_t bucket);
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/*! \brief  START COUNTED TRANSFER
+*
+*    This function marks the start of a transfer in the given SDO
+*    statistics.
+*
+* \param stat
+*    pointer to the SDO statistics
+*
+* \param type
+*    transfer type (see \ref CO_SDO_STAT_TYPE)
+*
+* \param size
+*    transfered bytes, when finished (may be set later in member 'Size')
+*
+* \param now
+*    current time in microseconds (see \ref COSdoStatTime())
+*/
+void COSdoStatStart(CO_SDO_STAT *stat, uint8_t type, uint32_t size, uint32_t now);
+
+/*! \brief  END COUNTED TRANSFER
+*
+*    This function counts the end of the active transfer in the given SDO
+*    statistics. A finished transfer is counted with its type, size and
+*    duration; an aborted transfer with its abort code.
+*
+* \param stat
+*    pointer to the SDO statistics
+*
+* \param code
+*    abort code of the transfer (0: transfer is finished)
+*
+* \param now
+*    current time in microseconds (see \ref COSdoStatTime())
+*/
+void COSdoStatEnd(CO_SDO_STAT *stat, uint32_t code, uint32_t now);
+
+/******************************************************************************
+* CALLBACK FUNCTIONS
+******************************************************************************/
+
+/*! \brief  SDO STATISTICS TIME
+*
+*    This function is called at the start and at the end of each SDO
+*    transfer, when the SDO statistics are enabled with USE_SDO_STAT. The
+*    function returns a free running time in microseconds; the difference
+*    of two calls is the transfer duration. The default implementation
+*    returns 0, so all transfers are counted in the first histogram bucket.
+*
+* \param node
+*    pointer to the CANopen node
+*
+* \return
+*    free running time in microseconds
+*/
+extern uint32_t COSdoStatTime(struct CO_NODE_T *node);
+
 #if defined __cplusplus
 }
 #endif
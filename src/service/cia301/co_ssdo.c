@@ -20,15 +20,105 @@
 
 #include "co_core.h"
 
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+/* An object entry with up to 8 bytes (e.g. a 64bit value) is staged in the
+ * transfer buffer during a segmented or block transfer, so the entry is read
+ * and written with a single access. A block transfer stages the entry at the
+ * end of the transfer buffer, because the front holds the sent or received
+ * blocks.
+ */
+#define CO_SDO_VAL_MAX      8u
+#define CO_SDO_VAL_OFS      (CO_SDO_BUF_BYTE - CO_SDO_VAL_MAX)
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static CO_ERR COSdoProtocol(CO_SDO *srv);
+static CO_ERR COSdoBufAlloc(CO_SDO *srv);
+static void   COSdoRelease (CO_SDO *srv);
+static void   COSdoTmrStart(CO_SDO *srv);
+static void   COSdoTimeout (void *parg);
+static CO_ERR COSdoBlkFlush(CO_SDO *srv, uint8_t ackseq);
+static void   COSdoBlkNext (CO_SDO *srv);
+static void   COSdoBlkWrite(CO_SDO *srv, uint8_t *buf, uint32_t len);
+static void   COSdoBlkSync (CO_SDO *srv);
+static void   COSdoBlkDefer(void *parg);
+static CO_ERR COSdoBlkRead (CO_SDO *srv, uint8_t *buf, uint32_t len);
+#if CO_SSDO_CACHE_N > 0
+static CO_ERR COSdoCacheGet(CO_SDO *srv);
+static void   COSdoCachePut(CO_SDO *srv, uint8_t cmd, uint32_t data);
+static void   COSdoCacheClear(void *parg);
+#endif
+#if USE_SDO_STAT
+static uint8_t COSdoStatBegin (CO_SDO *srv);
+static void    COSdoStatUpdate(CO_SDO *srv, uint8_t start, CO_ERR result);
+#endif
+
 /******************************************************************************
 * PROTECTED API FUNCTIONS
 ******************************************************************************/
 
+uint8_t COSdoBurst(CO_SDO *srv, CO_IF_FRM *frm, uint16_t num)
+{
+    uint32_t id;
+    uint16_t i;
+    uint16_t j;
+    uint8_t  cmd;
+    uint8_t  n;
+
+    for (i = 1; i < num; i++) {
+        cmd = CO_GET_BYTE(&frm[i], 0);
+        if ((cmd != 0x40) && ((cmd & 0xF2) != 0x22)) {
+            continue;
+        }
+        id = CO_GET_ID(&frm[i]);
+        for (j = 0; j < i; j++) {
+            cmd = CO_GET_BYTE(&frm[j], 0);
+            if ((CO_GET_ID(&frm[j]) == id) &&
+                ((cmd == 0x40) || ((cmd & 0xF2) == 0x22))) {
+                break;
+            }
+        }
+        if (j == i) {
+            continue;
+        }
+        for (n = 0; n < CO_SSDO_N; n++) {
+            if (srv[n].RxId == id) {
+                return (1);
+            }
+        }
+    }
+    return (0);
+}
+
 void COSdoInit(CO_SDO *srv, CO_NODE *node)
 {
     uint8_t n;
 
+    for (n=0; n < CO_SSDO_BUF_N; n++) {
+        node->SdoPool.Free[n] = (uint8_t)(CO_SSDO_BUF_N - 1 - n);
+    }
+    node->SdoPool.Num = CO_SSDO_BUF_N;
+#if CO_SSDO_CACHE_N > 0
+    node->SdoCache.Num  = 0;
+    node->SdoCache.Next = 0;
+    node->SdoCache.Tmr  = -1;
+#endif
+
     for (n=0; n < CO_SSDO_N; n++) {
+        srv[n].Tmr       = -1;
+        srv[n].Blk.WrTmr = -1;
+        srv[n].Buf.Start = 0;
+        srv[n].BlkSize   = CO_SSDO_BLK_SIZE;
+        srv[n].BlkDefer  = CO_SSDO_BLK_DEFER;
+#if USE_SDO_STAT
+        srv[n].Stat.Act  = 0;
+        COSdoStatClear(&srv[n].Stat);
+#endif
         COSdoReset (srv, n, node);
         COSdoEnable(srv, n);
     }
@@ -38,25 +128,25 @@ WEAK_TEST
 void COSdoReset(CO_SDO *srv, uint8_t num, CO_NODE *node)
 {
     CO_SDO   *srvnum;
-    uint32_t  offset;
 
     ASSERT_PTR(srv);
     ASSERT_LOWER(num, CO_SSDO_N);
 
     srvnum               = &srv[num];
     srvnum->Node         = node;
+    COSdoRelease(srvnum);
     srvnum->RxId         = CO_SDO_ID_OFF;
     srvnum->TxId         = CO_SDO_ID_OFF;
     srvnum->Frm          = 0;
     srvnum->Obj          = 0;
-    offset               = num * CO_SDO_BUF_BYTE;
-    srvnum->Buf.Start    = &node->SdoBuf[offset];
-    srvnum->Buf.Cur      = &node->SdoBuf[offset];
-    srvnum->Buf.Num      = 0;
     srvnum->Seg.TBit     = 0;
     srvnum->Seg.Num      = 0;
     srvnum->Seg.Size     = 0;
     srvnum->Blk.State    = BLK_IDLE;
+#if USE_SDO_STAT
+    srvnum->Stat.Act     = 0;
+#endif
+    CO_DISP_INVALIDATE(node);
 }
 
 WEAK_TEST
@@ -75,6 +165,7 @@ void COSdoEnable(CO_SDO *srv, uint8_t num)
     srvnum->TxId = CO_SDO_ID_OFF;
 
     node = srv->Node;
+    CO_DISP_INVALIDATE(node);
     err  = CODictRdLong(&node->Dict, CO_DEV(0x1200 + num, 1), &rxId);
     if (err != CO_ERR_NONE) {
         return;
@@ -100,14 +191,7 @@ CO_SDO *COSdoCheck(CO_SDO *srv, CO_IF_FRM *frm)
         n = 0;
         while ((n < CO_SSDO_N) && (result == 0)) {
             if (CO_GET_ID(frm) == srv[n].RxId) {
-                CO_SET_ID(frm, srv[n].TxId);
-                srv[n].Frm   = frm;
-                srv[n].Abort = 0;
-                if (srv[n].Obj == 0) {
-                    srv[n].Idx = CO_GET_WORD(frm, 1);
-                    srv[n].Sub = CO_GET_BYTE(frm, 3);
-                }
-                result = &srv[n];
+                result = COSdoAccept(&srv[n], frm);
             }
             n++;
         }
@@ -115,86 +199,36 @@ CO_SDO *COSdoCheck(CO_SDO *srv, CO_IF_FRM *frm)
     return (result);
 }
 
-CO_ERR COSdoResponse(CO_SDO *srv)
+CO_SDO *COSdoAccept(CO_SDO *srv, CO_IF_FRM *frm)
 {
-    CO_ERR  result = CO_ERR_SDO_ABORT;
-    uint8_t cmd;
-
-    cmd = CO_GET_BYTE(srv->Frm, 0);
-
-    /* client abort */
-    if (cmd == 0x80) {
-        COSdoAbortReq(srv);
-        return (result);
-    }
-
-    /* active block transfer */
-    if (srv->Blk.State == BLK_DOWNLOAD) {
-        result = COSdoDownloadBlock(srv);
-        return (result);
-    } else if (srv->Blk.State == BLK_DNWAIT) {
-        if ((cmd & 0xE3) == 0xC1) {
-            result = COSdoEndDownloadBlock(srv);
-        } else {
-            srv->Blk.State = BLK_DOWNLOAD;
-            result = COSdoDownloadBlock(srv);
-        }
-        return (result);
-    } else if (srv->Blk.State == BLK_UPLOAD) {
-        if (cmd == 0xA1) {
-            result = COSdoEndUploadBlock(srv);
-        } else if ((cmd & 0xE3) == 0xA2) {
-            result = COSdoAckUploadBlock(srv);
-        } else {
-            COSdoAbort(srv, CO_SDO_ERR_CMD);
-            COSdoAbortReq(srv);
-        }
-        return (result);
+    CO_SET_ID(frm, srv->TxId);
+    srv->Frm   = frm;
+    srv->Abort = 0;
+    if (srv->Obj == 0) {
+        srv->Idx = CO_GET_WORD(frm, 1);
+        srv->Sub = CO_GET_BYTE(frm, 3);
     }
+    return (srv);
+}
 
-    /* expedited transfer */
-    if ((cmd & 0xF2) == 0x22) {
-        result = COSdoGetObject(srv, CO_SDO_WR);
-        if (result == 0) {
-            result = COSdoDownloadExpedited(srv);
-        }
-    } else if (cmd == 0x40) {
-        result = COSdoGetObject(srv, CO_SDO_RD);
-        if (result == 0) {
-            result = COSdoUploadExpedited(srv);
-        }
-
-    /* segmented transfer */
-    } else if ((cmd & 0xF2) == 0x20) {
-        result = COSdoGetObject(srv, CO_SDO_WR);
-        if (result == 0) {
-            result = COSdoInitDownloadSegmented(srv);
-        }
-    } else if ((cmd & 0xE0) == 0x00) {
-        result = COSdoDownloadSegmented(srv);
-    } else if ((cmd & 0xEF) == 0x60) {
-        result = COSdoUploadSegmented(srv);
-
-    /* block transfer */
-    } else if ((cmd & 0xF9) == 0xC0) {
-        result = COSdoGetObject(srv, CO_SDO_WR);
-        if (result == 0) {
-            result = COSdoInitDownloadBlock(srv);
-        }
-    } else if ((cmd & 0xE3) == 0xA0) {
-        result = COSdoInitUploadBlock(srv);
-    } else if (cmd == 0xA3) {
-        result = COSdoUploadBlock(srv);
-
-    /* invalid or unknown command */
+CO_ERR COSdoResponse(CO_SDO *srv)
+{
+    CO_ERR result;
+#if USE_SDO_STAT
+    uint8_t start;
+
+    start  = COSdoStatBegin(srv);
+    result = COSdoProtocol(srv);
+    COSdoStatUpdate(srv, start, result);
+#else
+    result = COSdoProtocol(srv);
+#endif
+    if (srv->Obj == 0) {
+        srv->Blk.State = BLK_IDLE;
+        COSdoRelease(srv);
     } else {
-        COSdoAbort(srv, CO_SDO_ERR_CMD);
-        COSdoAbortReq(srv);
+        COSdoTmrStart(srv);
     }
-
-    /* set DLC for the SDO response */
-    CO_SET_DLC(srv->Frm, 8u);
-
     return (result);
 }
 
@@ -275,13 +309,22 @@ CO_ERR COSdoUploadExpedited(CO_SDO *srv)
     CO_ERR   err;
     uint32_t size;
     uint32_t data   = 0;
+    uint8_t  val[3];
     uint8_t  cmd;
 
     size = COSdoGetSize(srv, 0, true);
     if (size == 0) {
         return (result);
     } else if (size <= 4) {
-        err = COObjRdValue(srv->Obj, srv->Node, (void *)&data, (uint8_t)size);
+        if (size == 3) {
+            /* a 24bit entry is read as a sequence of 3 bytes */
+            err  = COObjRdValue(srv->Obj, srv->Node, (void *)&val[0], 3);
+            data = (uint32_t)val[0]         |
+                   ((uint32_t)val[1] <<  8) |
+                   ((uint32_t)val[2] << 16);
+        } else {
+            err  = COObjRdValue(srv->Obj, srv->Node, (void *)&data, (uint8_t)size);
+        }
         if (err != CO_ERR_NONE) {
             if (srv->Abort > 0) {
                 COSdoAbort(srv, srv->Abort);
@@ -293,10 +336,17 @@ CO_ERR COSdoUploadExpedited(CO_SDO *srv)
             cmd = (uint8_t)0x43u | (uint8_t)(((4u - size) & 0x3u) << 2u);
             CO_SET_BYTE(srv->Frm,  cmd, 0);
             CO_SET_LONG(srv->Frm, data, 4);
+#if CO_SSDO_CACHE_N > 0
+            COSdoCachePut(srv, cmd, data);
+#endif
             srv->Obj = 0;
             result   = CO_ERR_NONE;
         }
     } else {
+        result = COSdoBufAlloc(srv);
+        if (result != CO_ERR_NONE) {
+            return (result);
+        }
         result = COSdoInitUploadSegmented(srv, size);
     }
 
@@ -313,6 +363,7 @@ CO_ERR COSdoDownloadExpedited(CO_SDO *srv)
     uint32_t size;
     uint32_t data;
     uint32_t width  =  0;
+    uint8_t  val[3];
     uint8_t  cmd;
 
     cmd = CO_GET_BYTE(srv->Frm, 0);
@@ -322,7 +373,15 @@ CO_ERR COSdoDownloadExpedited(CO_SDO *srv)
     size = COSdoGetSize(srv, width, true);
     if ((size > 0) && (size <= 4)) {
         data   = CO_GET_LONG(srv->Frm, 4);
-        err    = COObjWrValue(srv->Obj, srv->Node, (void*)&data, (uint8_t)size);
+        if (size == 3) {
+            /* a 24bit entry is written as a sequence of 3 bytes */
+            val[0] = (uint8_t)(data      );
+            val[1] = (uint8_t)(data >>  8);
+            val[2] = (uint8_t)(data >> 16);
+            err    = COObjWrValue(srv->Obj, srv->Node, (void*)&val[0], 3);
+        } else {
+            err    = COObjWrValue(srv->Obj, srv->Node, (void*)&data, (uint8_t)size);
+        }
         if (err != CO_ERR_NONE) {
             if (srv->Abort > 0) {
                 COSdoAbort(srv, srv->Abort);
@@ -370,9 +429,15 @@ CO_ERR COSdoInitUploadSegmented(CO_SDO *srv, uint32_t size)
     CO_SET_LONG(srv->Frm, size, 4);
 
     /* setup SDO buffer */
-    srv->Buf.Cur  = srv->Buf.Start;
-    srv->Buf.Num  = 0;
-    result = COObjRdBufStart(srv->Obj, srv->Node, srv->Buf.Cur, 0);
+    result = COSdoBufAlloc(srv);
+    if (result != CO_ERR_NONE) {
+        return (result);
+    }
+    if (size <= CO_SDO_VAL_MAX) {
+        result = COObjRdBufStart(srv->Obj, srv->Node, srv->Buf.Start, size);
+    } else {
+        result = COObjRdBufStart(srv->Obj, srv->Node, srv->Buf.Cur, 0);
+    }
     if (result != CO_ERR_NONE) {
         srv->Node->Error = CO_ERR_SDO_READ;
         COSdoAbort(srv, CO_SDO_ERR_HW_ACCESS);
@@ -413,13 +478,17 @@ CO_ERR COSdoUploadSegmented(CO_SDO *srv)
         c_bit = 1;
     }
 
-    result = COObjRdBufCont(srv->Obj, srv->Node, srv->Buf.Start, width);
-    if (result != CO_ERR_NONE) {
-        COSdoAbort(srv, CO_SDO_ERR_TOS);
-        return (CO_ERR_SDO_ABORT);
+    if (srv->Seg.Size <= CO_SDO_VAL_MAX) {
+        /* staged entry: continue in the transfer buffer */
+        srv->Buf.Cur = srv->Buf.Start + srv->Seg.Num;
+    } else {
+        result = COObjRdBufCont(srv->Obj, srv->Node, srv->Buf.Start, width);
+        if (result != CO_ERR_NONE) {
+            COSdoAbort(srv, CO_SDO_ERR_TOS);
+            return (CO_ERR_SDO_ABORT);
+        }
+        srv->Buf.Cur = srv->Buf.Start;
     }
-
-    srv->Buf.Cur = srv->Buf.Start;
     for (i = 0; i < (uint8_t)width; i++) {
         CO_SET_BYTE(srv->Frm, *(srv->Buf.Cur), 1 + i);
         srv->Buf.Cur++;
@@ -465,12 +534,17 @@ CO_ERR COSdoInitDownloadSegmented(CO_SDO *srv)
         CO_SET_LONG(srv->Frm, 0, 4);
 
         /* setup SDO buffer */
-        srv->Buf.Cur  = srv->Buf.Start;
-        srv->Buf.Num  = 0;
+        result = COSdoBufAlloc(srv);
+        if (result != CO_ERR_NONE) {
+            return (result);
+        }
 
         if (size <= 4) {
             /* no action for basic type entry */
             result = CO_ERR_NONE;
+        } else if (size <= CO_SDO_VAL_MAX) {
+            /* staged entry: written with the last segment */
+            result = CO_ERR_NONE;
         } else {
             result = COObjWrBufStart(srv->Obj, srv->Node, srv->Buf.Cur, 0);
         }
@@ -496,6 +570,12 @@ CO_ERR COSdoDownloadSegmented(CO_SDO *srv)
     uint8_t  n;
     uint8_t  cmd;
     uint8_t  bid;
+    uint8_t  stage;
+
+    if (srv->Obj == 0) {
+        COSdoAbort(srv, CO_SDO_ERR_CMD);
+        return (CO_ERR_SDO_ABORT);
+    }
 
     cmd = CO_GET_BYTE(srv->Frm, 0);
     if ((cmd >> 4) != srv->Seg.TBit) {
@@ -512,6 +592,12 @@ CO_ERR COSdoDownloadSegmented(CO_SDO *srv)
     } else {
         num = 7 - n;
     }
+    stage = (uint8_t)((srv->Seg.Size > 4) && (srv->Seg.Size <= CO_SDO_VAL_MAX));
+    if ((stage != 0) && ((srv->Seg.Num + num) > srv->Seg.Size)) {
+        COSdoAbort(srv, CO_SDO_ERR_LEN_HIGH);
+        return (CO_ERR_SDO_ABORT);
+    }
+    srv->Seg.Num += num;
 
     bid = 1;
     while (num > 0) {
@@ -521,10 +607,13 @@ CO_ERR COSdoDownloadSegmented(CO_SDO *srv)
         bid++;
         num--;
     }
-    srv->Seg.Num += srv->Buf.Num;
 
     len = (uint32_t)srv->Buf.Num;
-    result = COObjWrBufCont(srv->Obj, srv->Node, srv->Buf.Start, len);
+    if (stage == 0) {
+        result = COObjWrBufCont(srv->Obj, srv->Node, srv->Buf.Start, len);
+    } else if ((cmd & 0x01) == 0x01) {
+        result = COObjWrBufStart(srv->Obj, srv->Node, srv->Buf.Start, len);
+    }
     if ((cmd & 0x01) == 0x01) {
         if (result != CO_ERR_NONE) {
             srv->Node->Error = CO_ERR_SDO_WRITE;
@@ -534,7 +623,7 @@ CO_ERR COSdoDownloadSegmented(CO_SDO *srv)
         srv->Seg.Size = 0;
         srv->Seg.Num  = 0;
         srv->Obj      = 0;
-    } else {
+    } else if (stage == 0) {
         if (len <= 4) {
             result = CO_ERR_SDO_WRITE;
         }
@@ -576,21 +665,38 @@ CO_ERR COSdoInitDownloadBlock(CO_SDO *srv)
     }
     size = COSdoGetSize(srv, width, false);
     if (size > 0) {
+        result = COSdoBufAlloc(srv);
+        if (result != CO_ERR_NONE) {
+            return (result);
+        }
         srv->Blk.State  = BLK_DOWNLOAD;
-        srv->Blk.SegNum = CO_SDO_BUF_SEG;
+        srv->Blk.SegNum = srv->BlkSize;
+        if ((srv->BlkDefer != 0) && (srv->Blk.SegNum > CO_SDO_BLK_HALF)) {
+            srv->Blk.SegNum = CO_SDO_BLK_HALF;
+        }
         srv->Blk.SegCnt = 0;
         srv->Blk.SegOk  = 0;
         srv->Blk.Size   = size;
         srv->Blk.Len    = size;
-        srv->Buf.Cur    = srv->Buf.Start;
-        srv->Buf.Num    = 0;
-
-        CO_SET_BYTE(srv->Frm, 0xA0, 0);
-        CO_SET_LONG(srv->Frm, (uint32_t)CO_SDO_BUF_SEG, 4);
+        srv->Blk.Crc    = 0;
+        srv->Blk.CrcOn  = (uint8_t)(((cmd >> 2) & 0x01) & CO_SSDO_BLK_CRC);
+        srv->Blk.Rx     = srv->Buf.Start;
+        srv->Blk.Wr     = 0;
+        srv->Blk.WrNum  = 0;
+        srv->Blk.Ack    = 0;
+        srv->Blk.Val    = 0;
+
+        cmd = (uint8_t)(0xA0 | (srv->Blk.CrcOn << 2));
+        CO_SET_BYTE(srv->Frm, cmd, 0);
+        CO_SET_LONG(srv->Frm, (uint32_t)srv->Blk.SegNum, 4);
         
         if (size <= 4) {
             /* no action for basic type entry */
             result = CO_ERR_NONE;
+        } else if (size <= CO_SDO_VAL_MAX) {
+            /* staged entry: written with the end of the transfer */
+            srv->Blk.Val = &srv->Buf.Start[CO_SDO_VAL_OFS];
+            result = CO_ERR_NONE;
         } else {
             result = COObjWrBufStart(srv->Obj, srv->Node, srv->Buf.Cur, 0);
         }
@@ -615,7 +721,24 @@ CO_ERR COSdoEndDownloadBlock(CO_SDO *srv)
     if ((cmd & 0x01) != 0) {
         n      = (cmd & 0x1C) >> 2;
         len    = ((uint32_t)srv->Buf.Num - n);
-        result = COObjWrBufCont(srv->Obj, srv->Node, srv->Buf.Start, len);
+        COSdoBlkSync(srv);
+        if (srv->Blk.CrcOn != 0) {
+            srv->Blk.Crc = COSdoCrc(srv->Blk.Crc, srv->Blk.Rx, len);
+            if (srv->Blk.Crc != CO_GET_WORD(srv->Frm, 1)) {
+                COSdoAbort(srv, CO_SDO_ERR_CRC);
+                COSdoAbortReq(srv);
+                return (CO_ERR_SDO_ABORT);
+            }
+        }
+        if (srv->Blk.Val != 0) {
+            COSdoBlkWrite(srv, srv->Blk.Rx, len);
+            len    = (uint32_t)(srv->Blk.Val - &srv->Buf.Start[CO_SDO_VAL_OFS]);
+            result = COObjWrBufStart(srv->Obj, srv->Node,
+                                     &srv->Buf.Start[CO_SDO_VAL_OFS], len);
+            srv->Blk.Val = 0;
+        } else {
+            result = COObjWrBufCont(srv->Obj, srv->Node, srv->Blk.Rx, len);
+        }
         if (result != CO_ERR_NONE) {
             srv->Node->Error = CO_ERR_SDO_WRITE;
             COSdoAbort(srv, CO_SDO_ERR_TOS);
@@ -637,8 +760,6 @@ CO_ERR COSdoEndDownloadBlock(CO_SDO *srv)
 CO_ERR COSdoDownloadBlock(CO_SDO *srv)
 {
     CO_ERR   result = CO_ERR_SDO_SILENT;
-    CO_ERR   err;
-    uint32_t len;
     uint8_t  cmd;
     uint8_t  i;
 
@@ -664,47 +785,45 @@ CO_ERR COSdoDownloadBlock(CO_SDO *srv)
             return (result);
         }
         srv->Blk.SegCnt++;
-        if ((srv->Blk.SegCnt == CO_SDO_BUF_SEG) ||
-             ((cmd & 0x80)   != 0             )) {
+        if ((srv->Blk.SegCnt == srv->Blk.SegNum) ||
+             ((cmd & 0x80)   != 0              )) {
 
             CO_SET_BYTE(srv->Frm, 0xA2, 0);
             CO_SET_BYTE(srv->Frm, srv->Blk.SegCnt, 1);
-            CO_SET_BYTE(srv->Frm, CO_SDO_BUF_SEG, 2);
+            CO_SET_BYTE(srv->Frm, srv->Blk.SegNum, 2);
             for (i = 3; i <= 7; i++) {
                 CO_SET_BYTE(srv->Frm, 0, i);
             }
-            srv->Blk.SegCnt  = 0;
             srv->Blk.State   = BLK_DNWAIT;
             result           = CO_ERR_NONE;
-        }
 
-        if (result == CO_ERR_NONE) {
+            /* the last block is written with the end of the transfer */
             if ((cmd & 0x80) == 0) {
-                len = (uint32_t)srv->Buf.Num;
-                err = COObjWrBufCont(srv->Obj, srv->Node, srv->Buf.Start, len);
-                if (err != CO_ERR_NONE) {
-                    srv->Node->Error = CO_ERR_SDO_WRITE;
-                }
-                srv->Buf.Cur = srv->Buf.Start;
-                srv->Buf.Num = 0;
+                result = COSdoBlkFlush(srv, srv->Blk.SegCnt);
             }
+            srv->Blk.SegCnt  = 0;
         }
     } else {
         if ((srv->Blk.SegCnt & 0x80) == 0) {
             srv->Blk.SegCnt |= 0x80;
         }
 
-        if (((cmd & 0x7F) == CO_SDO_BUF_SEG) ||
-            ((cmd & 0x80) != 0             )) {
+        if (((cmd & 0x7F) == srv->Blk.SegNum) ||
+            ((cmd & 0x80) != 0              )) {
 
             CO_SET_BYTE(srv->Frm, 0xA2, 0);
             CO_SET_BYTE(srv->Frm, srv->Blk.SegCnt & 0x7F, 1);
-            CO_SET_BYTE(srv->Frm, CO_SDO_BUF_SEG, 2);
+            CO_SET_BYTE(srv->Frm, srv->Blk.SegNum, 2);
             CO_SET_BYTE(srv->Frm, 0, 3);
             CO_SET_LONG(srv->Frm, 0, 4);
 
+            /* write the acknowledged segments, the next block is stored
+             * from the start of the receive buffer */
+            result = CO_ERR_NONE;
+            if (srv->Buf.Num > 0) {
+                result = COSdoBlkFlush(srv, srv->Blk.SegCnt & 0x7F);
+            }
             srv->Blk.SegCnt = 0;
-            result          = CO_ERR_NONE;
         }
     }
     return (result);
@@ -739,21 +858,37 @@ CO_ERR COSdoInitUploadBlock(CO_SDO *srv)
         }
     }
 
+    if (COSdoBufAlloc(srv) != CO_ERR_NONE) {
+        return (CO_ERR_SDO_ABORT);
+    }
+
     size  = srv->Blk.Size;
-    cmd   = 0xC2;
+    cmd   = CO_GET_BYTE(srv->Frm, 0);
 
     srv->Blk.LastValid = 0xFF;
     srv->Blk.Len       = srv->Blk.Size;
     srv->Blk.SegOk     = 0;
+    srv->Blk.Crc       = 0;
+    srv->Blk.CrcOn     = (uint8_t)(((cmd >> 2) & 0x01) & CO_SSDO_BLK_CRC);
+
+    cmd = (uint8_t)(0xC2 | (srv->Blk.CrcOn << 2));
 
+    srv->Blk.Val = 0;
     if (size <= 4) {
         /* no action for basic type entry */
         err = CO_ERR_NONE;
+    } else if (size <= CO_SDO_VAL_MAX) {
+        /* staged entry: read the whole value once */
+        srv->Blk.Val = &srv->Buf.Start[CO_SDO_VAL_OFS];
+        err = COObjRdBufStart(srv->Obj, srv->Node, srv->Blk.Val, size);
     } else {
         err = COObjRdBufStart(srv->Obj, srv->Node, srv->Buf.Cur, 0);
     }
     if (err != CO_ERR_NONE) {
         srv->Node->Error = CO_ERR_SDO_READ;
+        COSdoAbort(srv, CO_SDO_ERR_HW_ACCESS);
+        COSdoAbortReq(srv);
+        return (CO_ERR_SDO_ABORT);
     }
     CO_SET_BYTE(srv->Frm, cmd, 0);
     CO_SET_LONG(srv->Frm, size, 4);
@@ -774,6 +909,11 @@ CO_ERR COSdoUploadBlock(CO_SDO *srv)
     uint8_t  len;
     uint8_t  i;
 
+    if (srv->Obj == 0) {
+        COSdoAbort(srv, CO_SDO_ERR_CMD);
+        return (CO_ERR_SDO_ABORT);
+    }
+
     srv->Buf.Cur = srv->Buf.Start;
     srv->Buf.Num = 0u;
     num          = srv->Blk.SegNum * 7u;
@@ -799,6 +939,8 @@ CO_ERR COSdoUploadBlock(CO_SDO *srv)
                 txBuf++;
                 txNum--;
             }
+            /* refill the buffer with the number of removed bytes */
+            num = byteOk;
         } else {
             /* repeat whole buffer (no remaining bytes needed) */
             num = 0u;
@@ -808,23 +950,23 @@ CO_ERR COSdoUploadBlock(CO_SDO *srv)
     if (num > 0u) {
         if (srv->Blk.Size > num) {
             /* fill remaining buffer with data from object entry */
-            err = COObjRdBufCont(srv->Obj, srv->Node, srv->Buf.Cur, num);
-            if (err != CO_ERR_NONE) {
-                srv->Node->Error = CO_ERR_SDO_READ;
-            }
+            err = COSdoBlkRead(srv, srv->Buf.Cur, num);
             srv->Blk.Size -= num;
         } else {
             /* read remaining data from object entry in buffer */
-            if (srv->Blk.Size <= 4) {
-                err = COObjRdBufCont(srv->Obj, srv->Node, srv->Buf.Cur, srv->Blk.Size);
+            if ((srv->Blk.Size <= 4) || (srv->Blk.Val != 0)) {
+                err = COSdoBlkRead(srv, srv->Buf.Cur, srv->Blk.Size);
             } else {
-                err = COObjRdBufCont(srv->Obj, srv->Node, srv->Buf.Cur, num);
-            } 
-            if (err != CO_ERR_NONE) {
-                srv->Node->Error = CO_ERR_SDO_READ;
+                err = COSdoBlkRead(srv, srv->Buf.Cur, num);
             }
             srv->Blk.Size = 0;
         }
+        if (err != CO_ERR_NONE) {
+            srv->Node->Error = CO_ERR_SDO_READ;
+            COSdoAbort(srv, CO_SDO_ERR_TOS);
+            COSdoAbortReq(srv);
+            return (CO_ERR_SDO_ABORT);
+        }
     }
 
     /* set DLC for block transfers */
@@ -871,18 +1013,30 @@ CO_ERR COSdoUploadBlock(CO_SDO *srv)
 
 CO_ERR COSdoAckUploadBlock(CO_SDO *srv)
 {
-    CO_ERR  result = CO_ERR_SDO_SILENT;
-    uint8_t cmd;
-    uint8_t seq;
-    uint8_t val;
-    uint8_t i;
+    CO_ERR   result = CO_ERR_SDO_SILENT;
+    uint32_t num;
+    uint8_t  cmd;
+    uint8_t  seq;
+    uint8_t  val;
+    uint8_t  i;
 
     seq = CO_GET_BYTE(srv->Frm, 1);
     if (seq > srv->Blk.SegCnt) {
         COSdoAbort(srv, CO_SDO_ERR_SEQ_NUM);
         COSdoAbortReq(srv);
         return (CO_ERR_SDO_ABORT);
-    } else if (seq < srv->Blk.SegCnt) {
+    }
+
+    /* the confirmed bytes are at the start of the transfer buffer */
+    if (srv->Blk.CrcOn != 0) {
+        num = (uint32_t)seq * 7u;
+        if ((seq == srv->Blk.SegCnt) && (srv->Blk.Len == 0)) {
+            num -= (7u - srv->Blk.LastValid);
+        }
+        srv->Blk.Crc = COSdoCrc(srv->Blk.Crc, srv->Buf.Start, num);
+    }
+
+    if (seq < srv->Blk.SegCnt) {
         srv->Blk.State = BLK_REPEAT;
         srv->Blk.SegOk = seq;
         result         = COSdoUploadBlock(srv);
@@ -896,6 +1050,9 @@ CO_ERR COSdoAckUploadBlock(CO_SDO *srv)
             for (i = 1; i <= 7; i++) {
                 CO_SET_BYTE(srv->Frm, 0, i);
             }
+            if (srv->Blk.CrcOn != 0) {
+                CO_SET_WORD(srv->Frm, srv->Blk.Crc, 1);
+            }
             result = CO_ERR_NONE;
         }
     } else {
@@ -936,3 +1093,657 @@ void COSdoAbortReq(CO_SDO *srv)
     srv->Seg.Size  =  0;
     srv->Seg.TBit  =  0;
 }
+
+void COSdoStop(CO_SDO *srv, uint32_t err)
+{
+    CO_IF_FRM frm;
+
+    if (srv->Obj == 0) {
+        return;
+    }
+
+    if ((srv->Node->Nmt.Allowed & CO_SDO_ALLOWED) != 0) {
+        CO_SET_ID  (&frm, srv->TxId);
+        CO_SET_DLC (&frm, 8u);
+        CO_SET_BYTE(&frm, 0x80, 0);
+        CO_SET_WORD(&frm, srv->Idx, 1);
+        CO_SET_BYTE(&frm, srv->Sub, 3);
+        CO_SET_LONG(&frm, err, 4);
+        (void)COIfCanSend(&srv->Node->If, &frm);
+    }
+#if USE_SDO_STAT
+    COSdoStatEnd(&srv->Stat, err, COSdoStatTime(srv->Node));
+#endif
+    COSdoAbortReq(srv);
+    COSdoRelease(srv);
+}
+
+/******************************************************************************
+* PUBLIC API FUNCTIONS
+******************************************************************************/
+
+CO_ERR COSdoSetBlock(CO_SDO *srv, uint8_t size, uint8_t defer)
+{
+    ASSERT_PTR_ERR(srv, CO_ERR_BAD_ARG);
+
+    if ((size < 1u) || (size > CO_SDO_BUF_SEG)) {
+        return (CO_ERR_BAD_ARG);
+    }
+    if (srv->Obj != 0) {
+        return (CO_ERR_SDO_BUSY);
+    }
+    srv->BlkSize  = size;
+    srv->BlkDefer = (uint8_t)(defer != 0u);
+    return (CO_ERR_NONE);
+}
+
+/******************************************************************************
+* PRIVATE HELPER FUNCTIONS
+******************************************************************************/
+/*! \brief  SDO SERVER PROTOCOL
+*
+*    This function executes the SDO server protocol for the received SDO
+*    request and prepares the SDO response.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \retval  ==CO_ERR_NONE        on success
+* \retval  ==CO_ERR_SDO_SILENT  on success, but no response is sent
+* \retval  ==CO_ERR_SDO_ABORT   on SDO abort
+*/
+static CO_ERR COSdoProtocol(CO_SDO *srv)
+{
+    CO_ERR  result = CO_ERR_SDO_ABORT;
+    uint8_t cmd;
+
+    cmd = CO_GET_BYTE(srv->Frm, 0);
+
+    /* client abort */
+    if (cmd == 0x80) {
+        COSdoAbortReq(srv);
+        return (result);
+    }
+
+    /* active block transfer */
+    if (srv->Blk.State == BLK_DOWNLOAD) {
+        result = COSdoDownloadBlock(srv);
+        return (result);
+    } else if (srv->Blk.State == BLK_DNWAIT) {
+        if ((cmd & 0xE3) == 0xC1) {
+            result = COSdoEndDownloadBlock(srv);
+        } else {
+            srv->Blk.State = BLK_DOWNLOAD;
+            result = COSdoDownloadBlock(srv);
+        }
+        return (result);
+    } else if (srv->Blk.State == BLK_UPLOAD) {
+        if (cmd == 0xA1) {
+            result = COSdoEndUploadBlock(srv);
+        } else if ((cmd & 0xE3) == 0xA2) {
+            result = COSdoAckUploadBlock(srv);
+        } else {
+            COSdoAbort(srv, CO_SDO_ERR_CMD);
+            COSdoAbortReq(srv);
+        }
+        return (result);
+    }
+
+    /* expedited transfer */
+    if ((cmd & 0xF2) == 0x22) {
+        result = COSdoGetObject(srv, CO_SDO_WR);
+        if (result == 0) {
+            result = COSdoDownloadExpedited(srv);
+        }
+    } else if (cmd == 0x40) {
+#if CO_SSDO_CACHE_N > 0
+        result = COSdoCacheGet(srv);
+        if (result == 0) {
+            CO_SET_DLC(srv->Frm, 8u);
+            return (result);
+        }
+#endif
+        result = COSdoGetObject(srv, CO_SDO_RD);
+        if (result == 0) {
+            result = COSdoUploadExpedited(srv);
+        }
+
+    /* segmented transfer */
+    } else if ((cmd & 0xF2) == 0x20) {
+        result = COSdoGetObject(srv, CO_SDO_WR);
+        if (result == 0) {
+            result = COSdoInitDownloadSegmented(srv);
+        }
+    } else if ((cmd & 0xE0) == 0x00) {
+        result = COSdoDownloadSegmented(srv);
+    } else if ((cmd & 0xEF) == 0x60) {
+        result = COSdoUploadSegmented(srv);
+
+    /* block transfer */
+    } else if ((cmd & 0xF9) == 0xC0) {
+        result = COSdoGetObject(srv, CO_SDO_WR);
+        if (result == 0) {
+            result = COSdoInitDownloadBlock(srv);
+        }
+    } else if ((cmd & 0xE3) == 0xA0) {
+        result = COSdoInitUploadBlock(srv);
+    } else if (cmd == 0xA3) {
+        result = COSdoUploadBlock(srv);
+
+    /* invalid or unknown command */
+    } else {
+        COSdoAbort(srv, CO_SDO_ERR_CMD);
+        COSdoAbortReq(srv);
+    }
+
+    /* set DLC for the SDO response */
+    CO_SET_DLC(srv->Frm, 8u);
+
+    return (result);
+}
+
+/*! \brief  ALLOCATE TRANSFER BUFFER
+*
+*    This function takes a transfer buffer from the buffer pool of the node
+*    for a starting segmented or block transfer. An SDO server, which holds
+*    a buffer already, keeps it. The transfer is aborted with 'out of
+*    memory', when no buffer is available.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \retval  ==CO_ERR_NONE        on success
+* \retval  ==CO_ERR_SDO_ABORT   no transfer buffer available
+*/
+static CO_ERR COSdoBufAlloc(CO_SDO *srv)
+{
+    CO_SDO_POOL *pool;
+    uint32_t     offset;
+
+    if (srv->Buf.Start == 0) {
+        pool = &srv->Node->SdoPool;
+        if (pool->Num == 0) {
+            COSdoAbort(srv, CO_SDO_ERR_MEM);
+            return (CO_ERR_SDO_ABORT);
+        }
+        pool->Num--;
+        offset         = (uint32_t)pool->Free[pool->Num] * CO_SDO_BUF_BYTE;
+        srv->Buf.Start = &srv->Node->SdoBuf[offset];
+    }
+    srv->Buf.Cur = srv->Buf.Start;
+    srv->Buf.Num = 0;
+    return (CO_ERR_NONE);
+}
+
+/*! \brief  READ BLOCK UPLOAD DATA
+*
+*    This function reads the next bytes of a block upload into the transfer
+*    buffer. The bytes of a staged entry are taken from the staged value,
+*    all other entries are read from the object entry.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \param buf
+*    Pointer to the destination in the transfer buffer
+*
+* \param len
+*    Number of bytes to read
+*
+* \retval  =CO_ERR_NONE    bytes are read
+* \retval  !=CO_ERR_NONE   error while reading the object entry
+*/
+static CO_ERR COSdoBlkRead(CO_SDO *srv, uint8_t *buf, uint32_t len)
+{
+    if (srv->Blk.Val == 0) {
+        return (COObjRdBufCont(srv->Obj, srv->Node, buf, len));
+    }
+    while (len > 0u) {
+        *buf = *srv->Blk.Val;
+        srv->Blk.Val++;
+        buf++;
+        len--;
+    }
+    return (CO_ERR_NONE);
+}
+
+/*! \brief  RELEASE TRANSFER RESOURCES
+*
+*    This function stops the protocol timeout and gives the transfer buffer
+*    back to the buffer pool of the node.
+*
+* \param srv
+*    Pointer to SDO server object
+*/
+static void COSdoRelease(CO_SDO *srv)
+{
+    CO_SDO_POOL *pool;
+    uint32_t     num;
+
+    if (srv->Tmr >= 0) {
+        (void)COTmrDelete(&srv->Node->Tmr, srv->Tmr);
+        srv->Tmr = -1;
+    }
+    if (srv->Blk.WrTmr >= 0) {
+        (void)COTmrDelete(&srv->Node->Tmr, srv->Blk.WrTmr);
+        srv->Blk.WrTmr = -1;
+    }
+    srv->Blk.Wr  = 0;
+    srv->Blk.Ack = 0;
+    if (srv->Buf.Start != 0) {
+        pool = &srv->Node->SdoPool;
+        num  = (uint32_t)(srv->Buf.Start - srv->Node->SdoBuf) / CO_SDO_BUF_BYTE;
+        pool->Free[pool->Num] = (uint8_t)num;
+        pool->Num++;
+        srv->Buf.Start = 0;
+    }
+    srv->Buf.Cur = 0;
+    srv->Buf.Num = 0;
+}
+
+/*! \brief  (RE-)START PROTOCOL TIMEOUT
+*
+*    This function restarts the protocol timeout of the active transfer
+*    with each processed SDO request.
+*
+* \param srv
+*    Pointer to SDO server object
+*/
+static void COSdoTmrStart(CO_SDO *srv)
+{
+#if CO_SSDO_TMO > 0
+    CO_TMR  *tmr = &srv->Node->Tmr;
+    uint32_t ticks;
+
+    if (srv->Tmr >= 0) {
+        (void)COTmrDelete(tmr, srv->Tmr);
+    }
+    ticks    = COTmrGetTicks(tmr, (uint16_t)CO_SSDO_TMO, CO_TMR_UNIT_1MS);
+    srv->Tmr = COTmrCreate(tmr, ticks, 0, &COSdoTimeout, srv);
+#else
+    (void)srv;
+#endif
+}
+
+/*! \brief  PROTOCOL TIMEOUT
+*
+*    This timer callback function aborts the active transfer, when the SDO
+*    client sends no request within the protocol timeout. The abort is sent
+*    to the SDO client, when SDO transfers are allowed in the current NMT
+*    mode.
+*
+* \param parg
+*    Pointer to SDO server object
+*/
+static void COSdoTimeout(void *parg)
+{
+    CO_SDO *srv = (CO_SDO *)parg;
+
+    srv->Tmr = -1;
+    COSdoStop(srv, CO_SDO_ERR_TIMEOUT);
+}
+
+/*! \brief  FLUSH RECEIVED BLOCK
+*
+*    This function takes the received segments of a block download for the
+*    CRC calculation and writes them into the object entry. With deferred
+*    write, the block is written by a timer action and the next block is
+*    received into the other half of the transfer buffer. The acknowledge
+*    is held back, when the previous block is not written yet.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \param ackseq
+*    Sequence number of the last acknowledged segment
+*
+* \retval  ==CO_ERR_NONE        acknowledge is sent now
+* \retval  ==CO_ERR_SDO_SILENT  acknowledge is held back
+*/
+static CO_ERR COSdoBlkFlush(CO_SDO *srv, uint8_t ackseq)
+{
+    uint32_t len = srv->Buf.Num;
+
+    if (srv->Blk.CrcOn != 0) {
+        srv->Blk.Crc = COSdoCrc(srv->Blk.Crc, srv->Blk.Rx, len);
+    }
+    if (srv->Blk.Wr != 0) {
+        srv->Blk.Ack = (uint8_t)(0x80 | ackseq);
+        return (CO_ERR_SDO_SILENT);
+    }
+    COSdoBlkNext(srv);
+    return (CO_ERR_NONE);
+}
+
+/*! \brief  START NEXT BLOCK
+*
+*    This function writes the received block into the object entry (or
+*    defers the write to a timer action) and prepares the reception of the
+*    next block.
+*
+* \param srv
+*    Pointer to SDO server object
+*/
+static void COSdoBlkNext(CO_SDO *srv)
+{
+    uint32_t len = srv->Buf.Num;
+
+    if (srv->BlkDefer != 0) {
+        srv->Blk.WrTmr = COTmrCreate(&srv->Node->Tmr, 1, 0, &COSdoBlkDefer, srv);
+    }
+    if (srv->Blk.WrTmr >= 0) {
+        srv->Blk.Wr    = srv->Blk.Rx;
+        srv->Blk.WrNum = len;
+        if (srv->Blk.Rx == srv->Buf.Start) {
+            srv->Blk.Rx = &srv->Buf.Start[CO_SDO_BLK_HALF * 7];
+        } else {
+            srv->Blk.Rx = srv->Buf.Start;
+        }
+    } else {
+        /* no timer action available: write block immediately */
+        COSdoBlkWrite(srv, srv->Blk.Rx, len);
+    }
+    srv->Buf.Cur = srv->Blk.Rx;
+    srv->Buf.Num = 0;
+}
+
+/*! \brief  WRITE BLOCK
+*
+*    This function writes the received bytes of a block download into the
+*    addressed object entry. The bytes of a staged entry are collected in
+*    the transfer buffer instead.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \param buf
+*    Pointer to the received bytes
+*
+* \param len
+*    Number of received bytes
+*/
+static void COSdoBlkWrite(CO_SDO *srv, uint8_t *buf, uint32_t len)
+{
+    CO_ERR   err;
+    uint8_t *end;
+
+    if (srv->Blk.Val != 0) {
+        end = &srv->Buf.Start[CO_SDO_VAL_OFS + srv->Blk.Size];
+        while ((len > 0) && (srv->Blk.Val < end)) {
+            *srv->Blk.Val = *buf;
+            srv->Blk.Val++;
+            buf++;
+            len--;
+        }
+        return;
+    }
+    err = COObjWrBufCont(srv->Obj, srv->Node, buf, len);
+    if (err != CO_ERR_NONE) {
+        srv->Node->Error = CO_ERR_SDO_WRITE;
+    }
+}
+
+/*! \brief  SYNCHRONIZE DEFERRED WRITE
+*
+*    This function writes the pending block of a block download at once,
+*    e.g. before the last block is written at the end of the transfer.
+*
+* \param srv
+*    Pointer to SDO server object
+*/
+static void COSdoBlkSync(CO_SDO *srv)
+{
+    if (srv->Blk.WrTmr >= 0) {
+        (void)COTmrDelete(&srv->Node->Tmr, srv->Blk.WrTmr);
+        srv->Blk.WrTmr = -1;
+    }
+    if (srv->Blk.Wr != 0) {
+        COSdoBlkWrite(srv, srv->Blk.Wr, srv->Blk.WrNum);
+        srv->Blk.Wr = 0;
+    }
+}
+
+/*! \brief  DEFERRED BLOCK WRITE
+*
+*    This timer callback function writes the pending block of a block
+*    download into the object entry. A held back acknowledge of the next
+*    block is sent afterwards and the next block is deferred in turn.
+*
+* \param parg
+*    Pointer to SDO server object
+*/
+static void COSdoBlkDefer(void *parg)
+{
+    CO_SDO    *srv = (CO_SDO *)parg;
+    CO_IF_FRM  frm;
+    uint8_t    ack;
+
+    srv->Blk.WrTmr = -1;
+    if ((srv->Obj == 0) || (srv->Blk.Wr == 0)) {
+        return;
+    }
+    COSdoBlkWrite(srv, srv->Blk.Wr, srv->Blk.WrNum);
+    srv->Blk.Wr = 0;
+
+    ack = srv->Blk.Ack;
+    if (ack != 0) {
+        srv->Blk.Ack = 0;
+        COSdoBlkNext(srv);
+        if ((srv->Node->Nmt.Allowed & CO_SDO_ALLOWED) != 0) {
+            CO_SET_ID  (&frm, srv->TxId);
+            CO_SET_DLC (&frm, 8u);
+            CO_SET_BYTE(&frm, 0xA2, 0);
+            CO_SET_BYTE(&frm, ack & 0x7F, 1);
+            CO_SET_BYTE(&frm, srv->Blk.SegNum, 2);
+            CO_SET_BYTE(&frm, 0, 3);
+            CO_SET_LONG(&frm, 0, 4);
+            (void)COIfCanSend(&srv->Node->If, &frm);
+        }
+        COSdoTmrStart(srv);
+    }
+}
+
+#if CO_SSDO_CACHE_N > 0
+
+/*! \brief  GET CACHED RESPONSE
+*
+*    This function looks for the cached response of the addressed object
+*    entry. On a hit, the response is written into the SDO frame. The cache
+*    is not used, while a transfer of the SDO server is active.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \retval  ==CO_ERR_NONE        response is taken from the cache
+* \retval  ==CO_ERR_SDO_ABORT   response is not cached
+*/
+static CO_ERR COSdoCacheGet(CO_SDO *srv)
+{
+    CO_SDO_CACHE *cache = &srv->Node->SdoCache;
+    uint32_t      key;
+    uint8_t       n;
+
+    if (srv->Obj != 0) {
+        return (CO_ERR_SDO_ABORT);
+    }
+    key = CO_DEV(srv->Idx, srv->Sub);
+    for (n = 0; n < cache->Num; n++) {
+        if (cache->Entry[n].Key == key) {
+            CO_SET_BYTE(srv->Frm, cache->Entry[n].Cmd, 0);
+            CO_SET_LONG(srv->Frm, cache->Entry[n].Data, 4);
+            srv->Obj = 0;
+            return (CO_ERR_NONE);
+        }
+    }
+    return (CO_ERR_SDO_ABORT);
+}
+
+/*! \brief  PUT RESPONSE INTO CACHE
+*
+*    This function stores the expedited upload response of the addressed
+*    object entry, when the entry is read-only and of a basic integer type.
+*    The cache timeout is started with the first cached response.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \param cmd
+*    Response command byte
+*
+* \param data
+*    Response data bytes #4..#7
+*/
+static void COSdoCachePut(CO_SDO *srv, uint8_t cmd, uint32_t data)
+{
+    CO_SDO_CACHE *cache = &srv->Node->SdoCache;
+    CO_OBJ       *obj   = srv->Obj;
+    CO_TMR       *tmr   = &srv->Node->Tmr;
+    uint32_t      ticks;
+    uint8_t       n;
+
+    if (CO_IS_WRITE(obj->Key) != 0) {
+        return;
+    }
+    if ((obj->Type != CO_TUNSIGNED8 ) &&
+        (obj->Type != CO_TUNSIGNED16) &&
+        (obj->Type != CO_TUNSIGNED32)) {
+        return;
+    }
+    if (cache->Tmr < 0) {
+        ticks      = COTmrGetTicks(tmr, (uint16_t)CO_SSDO_CACHE_TMO, CO_TMR_UNIT_1MS);
+        cache->Tmr = COTmrCreate(tmr, ticks, 0, &COSdoCacheClear, srv->Node);
+        if (cache->Tmr < 0) {
+            return;
+        }
+    }
+
+    if (cache->Num < (uint8_t)CO_SSDO_CACHE_N) {
+        n           = cache->Num;
+        cache->Num++;
+        cache->Next = 0;
+    } else {
+        n = cache->Next;
+        cache->Next++;
+        if (cache->Next >= (uint8_t)CO_SSDO_CACHE_N) {
+            cache->Next = 0;
+        }
+    }
+    cache->Entry[n].Key  = CO_GET_DEV(obj->Key);
+    cache->Entry[n].Data = data;
+    cache->Entry[n].Cmd  = cmd;
+}
+
+/*! \brief  CACHE TIMEOUT
+*
+*    This timer callback function clears the cached responses, when the
+*    cache timeout is elapsed.
+*
+* \param parg
+*    Pointer to CANopen node object
+*/
+static void COSdoCacheClear(void *parg)
+{
+    CO_NODE *node = (CO_NODE *)parg;
+
+    node->SdoCache.Tmr  = -1;
+    node->SdoCache.Num  = 0;
+    node->SdoCache.Next = 0;
+}
+
+#endif
+
+#if USE_SDO_STAT
+
+/*! \brief  START COUNTED SERVER TRANSFER
+*
+*    This function starts the statistics of a transfer, when the received
+*    request initiates a transfer. The size of an expedited download is
+*    given in the request; the size of the other transfers is taken after
+*    the first response.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \retval  =1    request initiates a transfer
+* \retval  =0    request continues a transfer or is invalid
+*/
+static uint8_t COSdoStatBegin(CO_SDO *srv)
+{
+    uint32_t size = 0;
+    uint8_t  type;
+    uint8_t  cmd;
+
+    if (srv->Obj != 0) {
+        return (0);
+    }
+    cmd = CO_GET_BYTE(srv->Frm, 0);
+    if (cmd == 0x40) {
+        type = CO_SDO_STAT_EXP_UP;
+    } else if ((cmd & 0xF2) == 0x22) {
+        type = CO_SDO_STAT_EXP_DOWN;
+        size = 4;
+        if ((cmd & 0x01) != 0) {
+            size -= (uint32_t)((cmd >> 2) & 0x03);
+        }
+    } else if ((cmd & 0xF2) == 0x20) {
+        type = CO_SDO_STAT_SEG_DOWN;
+    } else if ((cmd & 0xF9) == 0xC0) {
+        type = CO_SDO_STAT_BLK_DOWN;
+    } else if ((cmd & 0xE3) == 0xA0) {
+        type = CO_SDO_STAT_BLK_UP;
+    } else {
+        return (0);
+    }
+    COSdoStatStart(&srv->Stat, type, size, COSdoStatTime(srv->Node));
+    return (1);
+}
+
+/*! \brief  UPDATE COUNTED SERVER TRANSFER
+*
+*    This function takes the transfer size from the first response of a
+*    transfer (an upload is counted as segmented upload, when the object
+*    entry doesn't fit into an expedited response) and counts the end of
+*    the transfer.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \param start
+*    The response is the first response of the transfer (1), or not (0)
+*
+* \param result
+*    Result of the SDO protocol
+*/
+static void COSdoStatUpdate(CO_SDO *srv, uint8_t start, CO_ERR result)
+{
+    CO_SDO_STAT *stat = &srv->Stat;
+    uint32_t     code = 0;
+    uint8_t      cmd;
+
+    if (stat->Act == 0) {
+        return;
+    }
+    cmd = CO_GET_BYTE(srv->Frm, 0);
+    if ((start != 0) && (result != CO_ERR_SDO_ABORT)) {
+        if (stat->Type == CO_SDO_STAT_EXP_UP) {
+            if (cmd == 0x41) {
+                stat->Type = CO_SDO_STAT_SEG_UP;
+                stat->Size = srv->Seg.Size;
+            } else {
+                stat->Size = 4 - (uint32_t)((cmd >> 2) & 0x03);
+            }
+        } else if (stat->Type == CO_SDO_STAT_SEG_DOWN) {
+            stat->Size = srv->Seg.Size;
+        } else if (stat->Type != CO_SDO_STAT_EXP_DOWN) {
+            stat->Size = srv->Blk.Size;
+        }
+    }
+    if (srv->Obj == 0) {
+        if (result == CO_ERR_SDO_ABORT) {
+            code = (cmd == 0x80) ? CO_GET_LONG(srv->Frm, 4) : CO_SDO_ERR_GENERAL;
+        }
+        COSdoStatEnd(stat, code, COSdoStatTime(srv->Node));
+    }
+}
+
+#endif
@@ -36,6 +36,34 @@ extern "C" {
 #define CO_SDO_RD               1             /*!< Object read access        */
 #define CO_SDO_WR               2             /*!< Object write access       */
 
+#if (CO_SSDO_BUF_N < 1) || (CO_SSDO_BUF_N > CO_SSDO_N)
+#error "CO_SSDO_BUF_N: the number of transfer buffers must be 1..CO_SSDO_N"
+#endif
+
+#if (CO_SSDO_BLK_SIZE < 1) || (CO_SSDO_BLK_SIZE > CO_SDO_BUF_SEG)
+#error "CO_SSDO_BLK_SIZE: the block size must be 1..127 segments"
+#endif
+
+#define CO_SDO_BLK_HALF   (CO_SDO_BUF_SEG / 2)  /*!< block size for deferred write */
+
+#if CO_SSDO_CACHE_N > 255
+#error "CO_SSDO_CACHE_N: the response cache supports up to 255 entries"
+#endif
+
+/*! \brief INVALIDATE SDO RESPONSE CACHE
+*
+*    This macro clears the cached expedited upload responses of the given
+*    node. The macro is used by all functions, which write an object entry.
+*
+* \param node
+*    pointer to the CANopen node object
+*/
+#if CO_SSDO_CACHE_N > 0
+#define CO_SDO_CACHE_INVALIDATE(node)    ((node)->SdoCache.Num = 0u)
+#else
+#define CO_SDO_CACHE_INVALIDATE(node)
+#endif
+
 /******************************************************************************
 * PUBLIC TYPES
 ******************************************************************************/
@@ -80,6 +108,14 @@ typedef struct CO_SDO_BLK_T {
     uint8_t                 SegCnt;     /*!< current segment number          */
     uint8_t                 SegOk;      /*!< last successfull sent segment   */
     uint8_t                 LastValid;  /*!< valid bytes in last segment     */
+    uint16_t                Crc;        /*!< CRC of confirmed bytes          */
+    uint8_t                 CrcOn;      /*!< CRC is used in transfer         */
+    uint8_t                *Rx;         /*!< start of received block         */
+    uint8_t                *Wr;         /*!< block to be written (0: none)   */
+    uint32_t                WrNum;      /*!< number of bytes to be written   */
+    int16_t                 WrTmr;      /*!< deferred write timer (-1: none) */
+    uint8_t                 Ack;        /*!< held acknowledge (0x80|ackseq)  */
+    uint8_t                *Val;        /*!< next staged byte (0: none)      */
 
 } CO_SDO_BLK;
 
@@ -100,13 +136,112 @@ typedef struct CO_SDO_T {
     struct CO_SDO_BUF_T Buf;     /*!< Transfer buffer management structure   */
     struct CO_SDO_SEG_T Seg;     /*!< Segmented transfer control structure   */
     struct CO_SDO_BLK_T Blk;     /*!< Block transfer control structure       */
+    int16_t             Tmr;     /*!< Protocol timeout timer (-1 = stopped)  */
+    uint8_t             BlkSize; /*!< Block size of block downloads          */
+    uint8_t             BlkDefer;/*!< Deferred write of block downloads      */
+#if USE_SDO_STAT
+    struct CO_SDO_STAT_T Stat;   /*!< Transfer statistics                    */
+#endif
 
 } CO_SDO;
 
+/*! \brief SDO SERVER BUFFER POOL
+*
+*    This structure holds the transfer buffers, which are not used by an
+*    active segmented or block transfer. The buffers are taken and released
+*    in constant time.
+*/
+typedef struct CO_SDO_POOL_T {
+    uint8_t             Free[CO_SSDO_BUF_N]; /*!< unused buffer numbers      */
+    uint8_t             Num;                 /*!< number of unused buffers   */
+
+} CO_SDO_POOL;
+
+#if CO_SSDO_CACHE_N > 0
+
+/*! \brief SDO SERVER CACHED RESPONSE
+*
+*    This structure holds the response of a single expedited upload.
+*/
+typedef struct CO_SDO_CACHE_ENTRY_T {
+    uint32_t            Key;     /*!< object entry key (CO_DEV)              */
+    uint32_t            Data;    /*!< response data bytes #4..#7             */
+    uint8_t             Cmd;     /*!< response command byte                  */
+
+} CO_SDO_CACHE_ENTRY;
+
+/*! \brief SDO SERVER RESPONSE CACHE
+*
+*    This structure holds the cached expedited upload responses of the
+*    read-only object entries. The cache is shared by the SDO servers of
+*    the node; the oldest entry is replaced, when the cache is full.
+*/
+typedef struct CO_SDO_CACHE_T {
+    CO_SDO_CACHE_ENTRY  Entry[CO_SSDO_CACHE_N]; /*!< cached responses        */
+    uint8_t             Num;                    /*!< number of used entries  */
+    uint8_t             Next;                   /*!< next replaced entry     */
+    int16_t             Tmr;                    /*!< timeout (-1 = stopped)  */
+
+} CO_SDO_CACHE;
+
+#endif
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  SET BLOCK DOWNLOAD MODE
+*
+*    This function sets the block size and the write mode of the block
+*    downloads to the given SDO server. With deferred write, a received
+*    block is acknowledged at once and written into the object entry by a
+*    timer action of the node, while the next block is received. The
+*    acknowledge is held back only, when the previous block is not written
+*    yet. The block size is limited to 63 segments in this mode.
+*
+*    The settings are used starting with the next block download. The
+*    next reset of the communication restores the default settings
+*    CO_SSDO_BLK_SIZE and CO_SSDO_BLK_DEFER.
+*
+* \param srv
+*    Pointer to SDO server object (e.g. &node->Sdo[0])
+*
+* \param size
+*    Block size in segments (1..127)
+*
+* \param defer
+*    Deferred write of the received blocks (1: on, 0: off)
+*
+* \retval  ==CO_ERR_NONE      block download mode is set
+* \retval  ==CO_ERR_SDO_BUSY  SDO server transfer is ongoing
+* \retval  ==CO_ERR_BAD_ARG   invalid block size
+*/
+CO_ERR COSdoSetBlock(CO_SDO *srv, uint8_t size, uint8_t defer);
+
 /******************************************************************************
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
+/*! \brief  CHECK FOR EXPEDITED BURST
+*
+*    This function checks the given batch of received CAN frames for more
+*    than one expedited SDO request to the same SDO server. The responses
+*    of such a batch are intended to be sent in a burst.
+*
+* \param srv
+*    Ptr to root element of SDO server array
+*
+* \param frm
+*    Pointer to the received CAN frames
+*
+* \param num
+*    Number of received CAN frames
+*
+* \retval  =1    batch holds an expedited burst
+* \retval  =0    batch holds no expedited burst
+*/
+uint8_t COSdoBurst(CO_SDO *srv, CO_IF_FRM *frm, uint16_t num);
+
 /*! \brief  INIT SDO SERVER
 *
 *    This function reads the content of the object dictionary with
@@ -170,10 +305,29 @@ void COSdoEnable(CO_SDO *srv, uint8_t num);
 */
 CO_SDO *COSdoCheck(CO_SDO *srv, CO_IF_FRM *frm);
 
+/*! \brief  ACCEPT SDO FRAME
+*
+*    This function links the given SDO request frame to the addressed SDO
+*    server. The identifier in the frame will be modified to be the
+*    corresponding SDO response.
+*
+* \param srv
+*    Ptr to addressed SDO server
+*
+* \param frm
+*    Frame, received from CAN bus
+*
+* \return
+*    pointer to addressed SDO server
+*/
+CO_SDO *COSdoAccept(CO_SDO *srv, CO_IF_FRM *frm);
+
 /*! \brief  GENERATE SDO RESPONSE
 *
 *    This function interprets the data byte #0 of the SDO request and
-*    organizes the generation of the corresponding response.
+*    organizes the generation of the corresponding response. The protocol
+*    timeout of an active transfer is restarted; the transfer buffer and
+*    the timeout are released at the end of the transfer.
 *
 * \param srv
 *    Ptr to addressed SDO server
@@ -544,6 +698,21 @@ CO_ERR COSdoEndUploadBlock(struct CO_SDO_T *srv);
 */
 void COSdoAbortReq(CO_SDO *srv);
 
+/*! \brief  STOP ACTIVE TRANSFER
+*
+*    This function aborts the active transfer of the SDO server without a
+*    request of the SDO client (e.g. on a protocol timeout). The abort is
+*    sent to the SDO client, when SDO transfers are allowed in the current
+*    NMT mode. Nothing happens, when no transfer is active.
+*
+* \param srv
+*    Pointer to SDO server object
+*
+* \param err
+*    SDO abort code
+*/
+void COSdoStop(CO_SDO *srv, uint32_t err);
+
 /*! \brief  WRITE SDO IDENTIFIER
 *
 *    This write function is responsible for the object write procedure for
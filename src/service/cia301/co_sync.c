@@ -36,6 +36,7 @@ void COSyncInit(CO_SYNC *sync, struct CO_NODE_T *node)
     sync->Tmr   = -1;
     sync->Cycle = 0;
     sync->CobId = 0;
+    CO_DISP_INVALIDATE(node);
 
     for (i = 0; i < CO_TPDO_N; i++) {
         sync->TSync[i] = 0;
@@ -128,6 +129,8 @@ void COSyncHandler (CO_SYNC *sync)
 {
     uint8_t i;
 
+    /* hand over all synchronous TPDOs to the driver in a single batch */
+    COIfCanSendDefer(&sync->Node->If);
     for (i = 0; i < CO_TPDO_N; i++) {
         if (sync->TPdo[i] != 0) {
             if (sync->TNum[i] == 0) {
@@ -140,6 +143,7 @@ void COSyncHandler (CO_SYNC *sync)
             }
         }
     }
+    (void)COIfCanSendFlush(&sync->Node->If);
 
     for (i = 0; i < CO_RPDO_N; i++) {
         if (sync->RPdo[i] != 0) {
@@ -305,7 +305,7 @@ int16_t COLssStoreConfiguration(CO_LSS *lss, CO_IF_FRM *frm)
 {
     CO_ERR err;
 
-    err = COLssStore(lss->CfgBaudrate, lss->CfgNodeId);
+    err = COLssStore(lss->Node, lss->CfgBaudrate, lss->CfgNodeId);
     if (err == CO_ERR_NONE) {
         lss->Flags |= CO_LSS_STORED;
         CO_SET_BYTE(frm, 0, 1);
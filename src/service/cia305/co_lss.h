@@ -154,6 +154,9 @@ int16_t COLssNonConfiguredRemoteSlave(CO_LSS *lss, CO_IF_FRM *frm);
 *    The CAN frame pointer is checked to be valid before calling this
 *    function.
 *
+* \param node
+*    Pointer to the CANopen node, which stores the configuration
+*
 * \param baudrate
 *    The configured baudrate for storage
 *
@@ -163,7 +166,7 @@ int16_t COLssNonConfiguredRemoteSlave(CO_LSS *lss, CO_IF_FRM *frm);
 * \retval  =CO_ERR_NONE   configuration stored
 * \retval !=CO_ERR_NONE   error is detected
 */
-extern CO_ERR COLssStore(uint32_t baudrate, uint8_t nodeId);
+extern CO_ERR COLssStore(struct CO_NODE_T *node, uint32_t baudrate, uint8_t nodeId);
 
 /*! \brief LSS CONFIGURATION LOAD CALLBACK
 *
@@ -175,6 +178,9 @@ extern CO_ERR COLssStore(uint32_t baudrate, uint8_t nodeId);
 *    The CAN frame pointer is checked to be valid before calling this
 *    function.
 *
+* \param node
+*    Pointer to the CANopen node, which loads the configuration
+*
 * \param baudrate
 *    Reference to the baudrate, which should be set to storage value
 *
@@ -184,7 +190,7 @@ extern CO_ERR COLssStore(uint32_t baudrate, uint8_t nodeId);
 * \retval  =CO_ERR_NONE   configuration stored
 * \retval !=CO_ERR_NONE   error is detected
 */
-extern CO_ERR COLssLoad(uint32_t *baudrate, uint8_t *nodeId);
+extern CO_ERR COLssLoad(struct CO_NODE_T *node, uint32_t *baudrate, uint8_t *nodeId);
 
 #ifdef __cplusplus               /* for compatibility with C++ environments  */
 }
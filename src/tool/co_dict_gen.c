@@ -0,0 +1,189 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define CO_DICT_GEN_STR_(x)   #x
+#define CO_DICT_GEN_STR(x)    CO_DICT_GEN_STR_(x)
+
+#ifndef CO_DICT_GEN_SPEC
+#error "CO_DICT_GEN_SPEC: the node specification symbol must be defined"
+#endif
+
+#ifndef CO_DICT_GEN_NAME
+#error "CO_DICT_GEN_NAME: the lookup table symbol must be defined"
+#endif
+
+/******************************************************************************
+* EXTERNAL VARIABLES
+******************************************************************************/
+
+/* The node specification is linked from the application sources, so the
+ * table is generated from the compiled object entry array.
+ */
+extern struct CO_NODE_SPEC_T CO_DICT_GEN_SPEC;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint32_t *GenKey;
+static uint16_t *GenPos;
+static uint32_t  GenNext;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* Fill the implicit tree with an in-order walk, so the sorted object entries
+ * are placed in Eytzinger order.
+ */
+static void GenFill(const CO_OBJ *obj, uint32_t pos, uint32_t num)
+{
+    if (pos <= num) {
+        GenFill(obj, 2u * pos, num);
+        GenKey[pos] = CO_GET_DEV(obj[GenNext].Key);
+        GenPos[pos] = (uint16_t)GenNext;
+        GenNext++;
+        GenFill(obj, (2u * pos) + 1u, num);
+    }
+}
+
+/* Check the object entries; the lookup table requires a strictly ascending
+ * order of the keys.
+ */
+static int GenCheck(const CO_OBJ *obj, uint32_t num)
+{
+    uint32_t n;
+    int      result = 0;
+
+    for (n = 1; n < num; n++) {
+        if (CO_GET_DEV(obj[n].Key) == CO_GET_DEV(obj[n - 1u].Key)) {
+            (void)fprintf(stderr, "%s: entry %u: duplicate key %04Xh:%02Xh\n",
+                CO_DICT_GEN_STR(CO_DICT_GEN_SPEC), (unsigned)n,
+                (unsigned)CO_GET_IDX(obj[n].Key), (unsigned)CO_GET_SUB(obj[n].Key));
+            result = -1;
+        } else if (CO_GET_DEV(obj[n].Key) < CO_GET_DEV(obj[n - 1u].Key)) {
+            (void)fprintf(stderr, "%s: entry %u: key %04Xh:%02Xh is not sorted\n",
+                CO_DICT_GEN_STR(CO_DICT_GEN_SPEC), (unsigned)n,
+                (unsigned)CO_GET_IDX(obj[n].Key), (unsigned)CO_GET_SUB(obj[n].Key));
+            result = -1;
+        }
+    }
+    return (result);
+}
+
+/* Write the lookup table as C source.
+ */
+static int GenWrite(const char *path, uint32_t num)
+{
+    FILE     *out;
+    uint32_t  n;
+
+    out = fopen(path, "w");
+    if (out == NULL) {
+        (void)fprintf(stderr, "%s: can't create file\n", path);
+        return (-1);
+    }
+    (void)fprintf(out,
+        "/* Generated lookup table of %s - don't edit */\n\n"
+        "#include \"co_core.h\"\n\n"
+        "static const uint32_t %s_Key[%u] = {\n",
+        CO_DICT_GEN_STR(CO_DICT_GEN_SPEC), CO_DICT_GEN_STR(CO_DICT_GEN_NAME),
+        (unsigned)(num + 1u));
+    for (n = 0; n <= num; n++) {
+        (void)fprintf(out, "    0x%08Xu,\n", (unsigned)GenKey[n]);
+    }
+    (void)fprintf(out,
+        "};\n\n"
+        "static const uint16_t %s_Pos[%u] = {\n",
+        CO_DICT_GEN_STR(CO_DICT_GEN_NAME), (unsigned)(num + 1u));
+    for (n = 0; n <= num; n++) {
+        (void)fprintf(out, "    %uu,\n", (unsigned)GenPos[n]);
+    }
+    (void)fprintf(out,
+        "};\n\n"
+        "const CO_DICT_TBL %s = {\n"
+        "    &%s_Key[0],\n"
+        "    &%s_Pos[0],\n"
+        "    %uu\n"
+        "};\n",
+        CO_DICT_GEN_STR(CO_DICT_GEN_NAME), CO_DICT_GEN_STR(CO_DICT_GEN_NAME),
+        CO_DICT_GEN_STR(CO_DICT_GEN_NAME), (unsigned)num);
+
+    if (fclose(out) != 0) {
+        (void)fprintf(stderr, "%s: can't write file\n", path);
+        return (-1);
+    }
+    return (0);
+}
+
+/******************************************************************************
+* GENERATOR
+******************************************************************************/
+
+/* Usage: <generator> <output file>
+ *
+ * The generator is built by the CMake function canopen_dict_table() with
+ * the application sources, which define the node specification.
+ */
+int main(int argc, char *argv[])
+{
+    const CO_OBJ *obj = CO_DICT_GEN_SPEC.Dict;
+    uint32_t      num = 0;
+
+    if (argc != 2) {
+        (void)fprintf(stderr, "usage: %s <output file>\n", argv[0]);
+        return (EXIT_FAILURE);
+    }
+    if (obj == NULL) {
+        (void)fprintf(stderr, "%s: no object dictionary\n",
+            CO_DICT_GEN_STR(CO_DICT_GEN_SPEC));
+        return (EXIT_FAILURE);
+    }
+    while ((num < CO_DICT_GEN_SPEC.DictLen) && (obj[num].Key != 0)) {
+        num++;
+    }
+    if (GenCheck(obj, num) != 0) {
+        return (EXIT_FAILURE);
+    }
+
+    GenKey = calloc(num + 1u, sizeof(uint32_t));
+    GenPos = calloc(num + 1u, sizeof(uint16_t));
+    if ((GenKey == NULL) || (GenPos == NULL)) {
+        (void)fprintf(stderr, "out of memory\n");
+        return (EXIT_FAILURE);
+    }
+    GenNext = 0;
+    GenFill(obj, 1u, num);
+
+    if (GenWrite(argv[1], num) != 0) {
+        return (EXIT_FAILURE);
+    }
+    return (EXIT_SUCCESS);
+}
@@ -0,0 +1,69 @@
+#******************************************************************************
+#   Copyright 2020 Embedded Office GmbH & Co. KG
+#
+#   Licensed under the Apache License, Version 2.0 (the "License");
+#   you may not use this file except in compliance with the License.
+#   You may obtain a copy of the License at
+#
+#       http://www.apache.org/licenses/LICENSE-2.0
+#
+#   Unless required by applicable law or agreed to in writing, software
+#   distributed under the License is distributed on an "AS IS" BASIS,
+#   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+#   See the License for the specific language governing permissions and
+#   limitations under the License.
+#******************************************************************************
+
+
+#---
+# canopen_dict_table(<target> SPEC <spec> NAME <name> SOURCES <files>...)
+#
+# Generates the dictionary lookup table <name> (CO_DICT_TBL) for the object
+# dictionary of the node specification <spec> and adds it to the sources
+# of <target>. The generator is built with the toolchain of <target> from
+# the given sources, which define the node specification and all referenced
+# symbols, and with the include directories, definitions and libraries of
+# <target>, so the generator sees the same object dictionary as the target.
+# The build fails, if the object entries are not sorted or a key is used
+# twice.
+#
+# When cross-compiling, the generator can't run on the build host directly.
+# It is executed with CMAKE_CROSSCOMPILING_EMULATOR (e.g. qemu-arm), which
+# must be set in this case; otherwise the configuration fails.
+#
+# The application selects the table after the node initialization with:
+#   CODictUseTbl(&node.Dict, &<name>);
+#
+function(canopen_dict_table target)
+  cmake_parse_arguments(arg "" "SPEC;NAME" "SOURCES" ${ARGN})
+  if(NOT arg_SPEC OR NOT arg_NAME OR NOT arg_SOURCES)
+    message(FATAL_ERROR "canopen_dict_table(${target}): SPEC, NAME and SOURCES are required")
+  endif()
+  if(CMAKE_CROSSCOMPILING AND NOT CMAKE_CROSSCOMPILING_EMULATOR)
+    message(FATAL_ERROR "canopen_dict_table(${target}): the generator can't run on the build host "
+                        "when cross-compiling; set CMAKE_CROSSCOMPILING_EMULATOR")
+  endif()
+
+  set(gen ${target}-dict-gen)
+  set(out ${CMAKE_CURRENT_BINARY_DIR}/${target}-${arg_NAME}.c)
+
+  add_executable(${gen} ${CMAKE_CURRENT_FUNCTION_LIST_DIR}/co_dict_gen.c ${arg_SOURCES})
+  target_include_directories(${gen} PRIVATE $<TARGET_PROPERTY:${target},INCLUDE_DIRECTORIES>)
+  target_compile_definitions(${gen}
+    PRIVATE
+      $<TARGET_PROPERTY:${target},COMPILE_DEFINITIONS>
+      CO_DICT_GEN_SPEC=${arg_SPEC}
+      CO_DICT_GEN_NAME=${arg_NAME}
+  )
+  target_link_libraries(${gen} PRIVATE $<TARGET_PROPERTY:${target},LINK_LIBRARIES>)
+
+  # a target name as command is prefixed with the cross-compiling emulator
+  add_custom_command(
+    OUTPUT  ${out}
+    COMMAND ${gen} ${out}
+    DEPENDS ${gen}
+    COMMENT "Generating dictionary lookup table ${arg_NAME}"
+    VERBATIM
+  )
+  target_sources(${target} PRIVATE ${out})
+endfunction()
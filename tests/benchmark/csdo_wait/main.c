@@ -0,0 +1,421 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "bm_env.h"
+
+#include <unistd.h>
+
+#include "drv_linux_io.h"
+#include "drv_csdo_wait.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_SRV_N      16u            /* number of SDO server nodes           */
+#define BM_OBJ_N      8u             /* object entries 2000h:1..n per server */
+#define BM_THREAD_N   16u            /* maximal number of calling threads    */
+#define BM_REQ_N      64u            /* request memory of the queue          */
+#define BM_RX_N       256u           /* receive frames of a node (power of 2)*/
+#define BM_BUS_N      1024u          /* frames on the bus within one round   */
+#define BM_TMR_N      32u            /* number of timer actions of a node    */
+#define BM_DICT_N     (4u + (4u * CO_CSDO_N) + BM_OBJ_N + 1u)
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+typedef struct BM_NODE_T {
+    CO_NODE        Node;
+    CO_IF_DRV      Drv;
+    CO_OBJ         Dict[BM_DICT_N];
+    CO_TMR_MEM     TmrMem[BM_TMR_N];
+    uint8_t        SdoBuf[CO_SSDO_N * CO_SDO_BUF_BYTE];
+    CO_IF_FRM      Rx[BM_RX_N];
+    uint32_t       RxHead;
+    uint32_t       RxTail;
+    uint32_t       Obj[BM_OBJ_N];
+} BM_NODE;
+
+typedef struct BM_THREAD_T {
+    pthread_t      Id;
+    uint32_t       Num;
+    uint8_t        NodeId;
+    uint64_t       Sum;
+    uint64_t       Max;
+    uint32_t       Fail;
+} BM_THREAD;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static BM_NODE       BmNode[1u + BM_SRV_N];
+static CO_IF_FRM     BmBus[BM_BUS_N];
+static uint8_t       BmBusFrom[BM_BUS_N];
+static uint32_t      BmBusNum;
+
+static uint32_t      BmCliTx[CO_CSDO_N];
+static uint32_t      BmCliRx[CO_CSDO_N];
+static uint8_t       BmCliId[CO_CSDO_N];
+static const uint32_t BmSrvRx = 0x600;
+static const uint32_t BmSrvTx = 0x580;
+
+static CO_CSDO_QUEUE BmQueue;
+static CO_CSDO_REQ   BmReq[BM_REQ_N];
+static CSDO_WAIT     BmWait;
+static LINUX_IO      BmIo;
+static uint32_t      BmStop;
+static BM_THREAD     BmThread[BM_THREAD_N];
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* The simulated bus is working in rounds: all frames sent within a round
+ * are received by all other nodes at the beginning of the next round. All
+ * nodes are executed by the node thread.
+ */
+static void BmCanInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmCanEnable(CO_IF *cif, uint32_t baudrate)
+{
+    (void)cif;
+    (void)baudrate;
+}
+
+static int16_t BmCanRead(CO_IF *cif, CO_IF_FRM *frm)
+{
+    BM_NODE *bn = (BM_NODE *)CO_IF_CTX(cif);
+
+    if (bn->RxHead == bn->RxTail) {
+        return (0);
+    }
+    *frm = bn->Rx[bn->RxTail & (BM_RX_N - 1u)];
+    bn->RxTail++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static int16_t BmCanSend(CO_IF *cif, CO_IF_FRM *frm)
+{
+    BM_NODE *bn = (BM_NODE *)CO_IF_CTX(cif);
+
+    if (BmBusNum >= BM_BUS_N) {
+        return (-1);
+    }
+    BmBus[BmBusNum]     = *frm;
+    BmBusFrom[BmBusNum] = (uint8_t)(bn - &BmNode[0]);
+    BmBusNum++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static void BmCanReset(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmCanClose(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmTmrInit(CO_IF *cif, uint32_t freq)
+{
+    (void)cif;
+    (void)freq;
+}
+
+static void BmTmrReload(CO_IF *cif, uint32_t reload)
+{
+    (void)cif;
+    (void)reload;
+}
+
+static uint32_t BmTmrDelay(CO_IF *cif)
+{
+    (void)cif;
+    return (0);
+}
+
+static void BmTmrStop(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmTmrStart(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint8_t BmTmrUpdate(CO_IF *cif)
+{
+    (void)cif;
+    return (0);
+}
+
+static void BmNvmInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint32_t BmNvmRdWr(CO_IF *cif, uint32_t start, uint8_t *buf, uint32_t size)
+{
+    (void)cif;
+    (void)start;
+    (void)buf;
+    (void)size;
+    return (0);
+}
+
+static const CO_IF_CAN_DRV BmCan = {
+    BmCanInit, BmCanEnable, BmCanRead, BmCanSend, BmCanReset, BmCanClose, 0, 0
+};
+static const CO_IF_TIMER_DRV BmTmr = {
+    BmTmrInit, BmTmrReload, BmTmrDelay, BmTmrStop, BmTmrStart, BmTmrUpdate
+};
+static const CO_IF_NVM_DRV BmNvm = { BmNvmInit, BmNvmRdWr, BmNvmRdWr };
+
+static void BmSetup(BM_NODE *bn, uint8_t nodeId)
+{
+    CO_NODE_SPEC spec;
+    uint32_t     i = 0;
+    uint32_t     n;
+
+    bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1000, 0, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(0)};
+    bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1001, 0, CO_OBJ_____R_), CO_TUNSIGNED8 , (CO_DATA)(0)};
+    if (nodeId == 1u) {
+        for (n = 0; n < CO_CSDO_N; n++) {
+            BmCliTx[n] = 0x600;
+            BmCliRx[n] = 0x580;
+            BmCliId[n] = (uint8_t)(2u + n);
+            bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1280 + n, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(3)};
+            bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1280 + n, 1, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&BmCliTx[n])};
+            bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1280 + n, 2, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&BmCliRx[n])};
+            bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1280 + n, 3, CO_OBJ_____R_), CO_TUNSIGNED8 , (CO_DATA)(&BmCliId[n])};
+        }
+    } else {
+        bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1200, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(2)};
+        bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1200, 1, CO_OBJ__N__R_), CO_TUNSIGNED32, (CO_DATA)(&BmSrvRx)};
+        bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1200, 2, CO_OBJ__N__R_), CO_TUNSIGNED32, (CO_DATA)(&BmSrvTx)};
+        for (n = 0; n < BM_OBJ_N; n++) {
+            bn->Obj[n]    = ((uint32_t)nodeId << 8) | (n + 1u);
+            bn->Dict[i++] = (CO_OBJ){CO_KEY(0x2000, n + 1u, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&bn->Obj[n])};
+        }
+    }
+    while (i < BM_DICT_N) {
+        bn->Dict[i++] = (CO_OBJ)CO_OBJ_DICT_ENDMARK;
+    }
+
+    bn->Drv.Can   = &BmCan;
+    bn->Drv.Timer = &BmTmr;
+    bn->Drv.Nvm   = &BmNvm;
+    bn->Drv.Ctx   = bn;
+    bn->RxHead    = 0;
+    bn->RxTail    = 0;
+
+    spec.NodeId   = nodeId;
+    spec.Baudrate = 250000;
+    spec.Dict     = &bn->Dict[0];
+    spec.DictLen  = BM_DICT_N;
+    spec.EmcyCode = NULL;
+    spec.TmrMem   = &bn->TmrMem[0];
+    spec.TmrNum   = BM_TMR_N;
+    spec.TmrFreq  = 1000;
+    spec.Drv      = &bn->Drv;
+    spec.SdoBuf   = &bn->SdoBuf[0];
+    CONodeInit(&bn->Node, &spec);
+    CONodeStart(&bn->Node);
+    CONmtSetMode(&bn->Node.Nmt, CO_OPERATIONAL);
+}
+
+/* Deliver the frames of the last round to all other nodes and let all
+ * nodes process the received frames.
+ */
+static void BmRound(void)
+{
+    CO_IF_FRM frm[BM_BUS_N];
+    uint8_t   from[BM_BUS_N];
+    uint32_t  num = BmBusNum;
+    uint32_t  f;
+    uint32_t  n;
+    BM_NODE  *bn;
+
+    for (f = 0; f < num; f++) {
+        frm[f]  = BmBus[f];
+        from[f] = BmBusFrom[f];
+    }
+    BmBusNum = 0;
+
+    for (n = 0; n < (1u + BM_SRV_N); n++) {
+        bn = &BmNode[n];
+        for (f = 0; f < num; f++) {
+            if ((from[f] != n) && ((bn->RxHead - bn->RxTail) < BM_RX_N)) {
+                bn->Rx[bn->RxHead & (BM_RX_N - 1u)] = frm[f];
+                bn->RxHead++;
+            }
+        }
+    }
+    for (n = 0; n < (1u + BM_SRV_N); n++) {
+        bn = &BmNode[n];
+        while (bn->RxHead != bn->RxTail) {
+            CONodeProcess(&bn->Node);
+        }
+    }
+}
+
+/* The node thread sleeps in epoll until an application thread posts a
+ * request, and runs the bus rounds until all frames are processed.
+ */
+static void *BmNodeThread(void *parg)
+{
+    (void)parg;
+
+    while (__atomic_load_n(&BmStop, __ATOMIC_ACQUIRE) == 0u) {
+        (void)LinuxIoWait(&BmIo, (BmBusNum > 0u) ? 0 : -1);
+        (void)CSdoWaitProcess(&BmWait);
+        while (BmBusNum > 0u) {
+            BmRound();
+        }
+    }
+    CSdoWaitClose(&BmWait);
+    return (NULL);
+}
+
+/* Each application thread reads the object entries of a single SDO server
+ * with blocking uploads and measures the round-trip time of each upload.
+ */
+static void *BmAppThread(void *parg)
+{
+    BM_THREAD *bt = (BM_THREAD *)parg;
+    uint64_t   t0;
+    uint64_t   dt;
+    uint32_t   val;
+    uint32_t   sub;
+    uint32_t   n;
+    CO_ERR     err;
+
+    for (n = 0; n < bt->Num; n++) {
+        sub = 1u + (n % BM_OBJ_N);
+        val = 0;
+        t0  = BM_Now();
+        err = CSdoWaitUpload(&BmWait, bt->NodeId, CO_DEV(0x2000, sub),
+                             (uint8_t *)&val, sizeof(val), 1000, NULL);
+        dt  = BM_Now() - t0;
+        bt->Sum += dt;
+        if (dt > bt->Max) {
+            bt->Max = dt;
+        }
+        if ((err != CO_ERR_NONE) || (val != (((uint32_t)bt->NodeId << 8) | sub))) {
+            bt->Fail++;
+        }
+    }
+    return (NULL);
+}
+
+static uint32_t BmRun(uint32_t uploads, uint32_t threads)
+{
+    uint64_t start;
+    uint64_t ns;
+    uint64_t sum  = 0;
+    uint64_t max  = 0;
+    uint32_t fail = 0;
+    uint32_t n;
+    char     name[40];
+
+    for (n = 0; n < threads; n++) {
+        BmThread[n].Num    = uploads / threads;
+        BmThread[n].NodeId = (uint8_t)(2u + (n % BM_SRV_N));
+        BmThread[n].Sum    = 0;
+        BmThread[n].Max    = 0;
+        BmThread[n].Fail   = 0;
+    }
+    start = BM_Now();
+    for (n = 0; n < threads; n++) {
+        (void)pthread_create(&BmThread[n].Id, NULL, BmAppThread, &BmThread[n]);
+    }
+    for (n = 0; n < threads; n++) {
+        (void)pthread_join(BmThread[n].Id, NULL);
+        sum  += BmThread[n].Sum;
+        fail += BmThread[n].Fail;
+        if (BmThread[n].Max > max) {
+            max = BmThread[n].Max;
+        }
+    }
+    ns = BM_Now() - start;
+
+    uploads = (uploads / threads) * threads;
+    (void)snprintf(name, sizeof(name), "%u threads", threads);
+    BM_Report(name, uploads, ns);
+    printf("  round-trip: mean %.1f us, max %.1f us, failed %u\n",
+        (double)sum / (double)uploads / 1000.0, (double)max / 1000.0, fail);
+    return (fail);
+}
+
+/******************************************************************************
+* BENCHMARK
+******************************************************************************/
+
+/* Read object entries with blocking uploads from several application
+ * threads. The SDO client node and the SDO server nodes are executed by a
+ * single node thread over the simulated bus, so the measured round-trip
+ * time is the handover between the threads and the protocol processing.
+ * With more threads, the uploads to different SDO servers are executed
+ * concurrently, while the throughput is limited by the node thread.
+ */
+int main(int argc, char *argv[])
+{
+    uint32_t  uploads = BM_Count(argc, argv, 20000u);
+    pthread_t node;
+    uint32_t  fail = 0;
+    uint64_t  one  = 1;
+    uint32_t  n;
+
+    for (n = 0; n < (1u + BM_SRV_N); n++) {
+        BmSetup(&BmNode[n], (uint8_t)(n + 1u));
+    }
+    BmBusNum = 0;
+    COCSdoQueueInit(&BmQueue, &BmNode[0].Node, &BmReq[0], BM_REQ_N);
+
+    BmIo.Can.Fd   = -1;
+    BmIo.Timer.Fd = -1;
+    if ((LinuxIoOpen(&BmIo) < 0) ||
+        (CSdoWaitInit(&BmWait, &BmQueue) < 0) ||
+        (LinuxIoAdd(&BmIo, BmWait.Fd) < 0)) {
+        printf("blocking SDO client: not available\n");
+        return (1);
+    }
+    printf("blocking SDO client: %u uploads, %u SDO servers\n",
+        uploads, (unsigned)BM_SRV_N);
+
+    (void)pthread_create(&node, NULL, BmNodeThread, NULL);
+    fail += BmRun(uploads, 1);
+    fail += BmRun(uploads, 4);
+    fail += BmRun(uploads, BM_THREAD_N);
+
+    __atomic_store_n(&BmStop, 1u, __ATOMIC_RELEASE);
+    (void)write(BmWait.Fd, &one, sizeof(one));
+    (void)pthread_join(node, NULL);
+    LinuxIoClose(&BmIo);
+
+    return ((fail == 0u) ? 0 : 1);
+}
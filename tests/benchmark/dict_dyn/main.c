@@ -0,0 +1,242 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "bm_env.h"
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_OBJ_N      10000u               /* object entries                 */
+#define BM_CHG_N      1000u                /* inserts/removes in linked dict */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE       BmNode;
+static CO_DICT_DYN   BmDyn;
+static CO_OBJ        BmArena[BM_OBJ_N + 1u];
+static uint32_t      BmKey[BM_OBJ_N];
+static uint32_t      BmFail;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* Prepare the keys of 1000 indices 2000h..23E7h with 10 subindex entries
+ * each in the order of the dictionary, or shuffled like the entries of a
+ * device description.
+ */
+static void BmPrepare(uint8_t shuffle)
+{
+    uint32_t seed = 12345u;
+    uint32_t n;
+    uint32_t m;
+    uint32_t key;
+
+    for (n = 0; n < BM_OBJ_N; n++) {
+        BmKey[n] = CO_KEY(0x2000u + (n / 10u), n % 10u, CO_OBJ_____RW);
+    }
+    if (shuffle != 0u) {
+        for (n = BM_OBJ_N - 1u; n > 0u; n--) {
+            seed     = (seed * 1103515245u) + 12345u;
+            m        = (seed >> 8) % (n + 1u);
+            key      = BmKey[n];
+            BmKey[n] = BmKey[m];
+            BmKey[m] = key;
+        }
+    }
+}
+
+/* Check, that all entries are found in the node dictionary.
+ */
+static void BmCheck(CO_DICT *cod)
+{
+    uint32_t n;
+    CO_OBJ  *obj;
+
+    if (cod->Num != BM_OBJ_N) {
+        BmFail++;
+    }
+    for (n = 0; n < BM_OBJ_N; n++) {
+        obj = CODictFind(cod, BmKey[n]);
+        if ((obj == NULL) || (obj->Key != BmKey[n])) {
+            BmFail++;
+        }
+    }
+}
+
+/* Insertion of the dynamic-od example before: search the position from the
+ * start and swap all following entries one by one.
+ */
+static void BmSwapInsert(CO_OBJ *root, uint32_t key)
+{
+    CO_OBJ  temp = { key, CO_TUNSIGNED32, 0 };
+    CO_OBJ  x;
+    CO_OBJ *od = root;
+
+    while ((od->Key != 0) && (CO_GET_DEV(od->Key) < CO_GET_DEV(key))) {
+        od++;
+    }
+    while (od->Key != 0) {
+        x     = *od;
+        *od   = temp;
+        temp  = x;
+        od++;
+    }
+    *od   = temp;
+    od[1] = (CO_OBJ)CO_OBJ_DICT_ENDMARK;
+}
+
+static void BmRunSwap(const char *name, uint32_t loops)
+{
+    uint64_t start;
+    uint64_t ns = 0;
+    uint32_t loop;
+    uint32_t n;
+
+    for (loop = 0; loop < loops; loop++) {
+        BmArena[0] = (CO_OBJ)CO_OBJ_DICT_ENDMARK;
+        start = BM_Now();
+        for (n = 0; n < BM_OBJ_N; n++) {
+            BmSwapInsert(&BmArena[0], BmKey[n]);
+        }
+        ns += BM_Now() - start;
+        (void)CODictInit(&BmNode.Dict, &BmNode, &BmArena[0], BM_OBJ_N + 1u);
+        BmCheck(&BmNode.Dict);
+    }
+    BM_Report(name, (uint64_t)loops * BM_OBJ_N, ns);
+}
+
+/* Bulk build: collect all entries and sort them once.
+ */
+static void BmRunBulk(const char *name, uint32_t loops)
+{
+    uint64_t start;
+    uint64_t ns = 0;
+    uint32_t loop;
+    uint32_t n;
+
+    for (loop = 0; loop < loops; loop++) {
+        start = BM_Now();
+        (void)CODictDynInit(&BmDyn, &BmArena[0], sizeof(BmArena));
+        for (n = 0; n < BM_OBJ_N; n++) {
+            (void)CODictDynAdd(&BmDyn, BmKey[n], CO_TUNSIGNED32, 0);
+        }
+        if (CODictDynBuild(&BmDyn) != CO_ERR_NONE) {
+            BmFail++;
+        }
+        ns += BM_Now() - start;
+        (void)CODictInit(&BmNode.Dict, &BmNode, BmDyn.Root, BM_OBJ_N + 1u);
+        BmCheck(&BmNode.Dict);
+    }
+    BM_Report(name, (uint64_t)loops * BM_OBJ_N, ns);
+}
+
+/* Incremental build: insert each entry into the sorted entries.
+ */
+static void BmRunInsert(const char *name, uint32_t loops)
+{
+    uint64_t start;
+    uint64_t ns = 0;
+    uint32_t loop;
+    uint32_t n;
+
+    for (loop = 0; loop < loops; loop++) {
+        start = BM_Now();
+        (void)CODictDynInit(&BmDyn, &BmArena[0], sizeof(BmArena));
+        (void)CODictDynBuild(&BmDyn);
+        for (n = 0; n < BM_OBJ_N; n++) {
+            if (CODictDynInsert(&BmDyn, BmKey[n], CO_TUNSIGNED32, 0) != CO_ERR_NONE) {
+                BmFail++;
+            }
+        }
+        ns += BM_Now() - start;
+        (void)CODictInit(&BmNode.Dict, &BmNode, BmDyn.Root, BM_OBJ_N + 1u);
+        BmCheck(&BmNode.Dict);
+    }
+    BM_Report(name, (uint64_t)loops * BM_OBJ_N, ns);
+}
+
+/* Remove and insert again single entries of the linked node dictionary
+ * with 10000 entries.
+ */
+static void BmRunChange(const char *name, uint32_t loops)
+{
+    uint64_t start;
+    uint64_t ns;
+    uint32_t loop;
+    uint32_t n;
+
+    (void)CODictDynInit(&BmDyn, &BmArena[0], sizeof(BmArena));
+    for (n = 0; n < BM_OBJ_N; n++) {
+        (void)CODictDynAdd(&BmDyn, BmKey[n], CO_TUNSIGNED32, 0);
+    }
+    (void)CODictDynBuild(&BmDyn);
+    (void)CODictInit(&BmNode.Dict, &BmNode, BmDyn.Root, BM_OBJ_N + 1u);
+    (void)CODictDynLink(&BmDyn, &BmNode.Dict);
+
+    start = BM_Now();
+    for (loop = 0; loop < loops; loop++) {
+        for (n = 0; n < BM_CHG_N; n++) {
+            if ((CODictDynRemove(&BmDyn, BmKey[n]) != CO_ERR_NONE) ||
+                (CODictDynInsert(&BmDyn, BmKey[n], CO_TUNSIGNED32, 0) != CO_ERR_NONE)) {
+                BmFail++;
+            }
+        }
+    }
+    ns = BM_Now() - start;
+    BM_Report(name, (uint64_t)loops * BM_CHG_N * 2u, ns);
+    BmCheck(&BmNode.Dict);
+}
+
+/******************************************************************************
+* BENCHMARK
+******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    uint32_t loops = BM_Count(argc, argv, 10u);
+
+    printf("Dynamic dictionary: %u entries, time per entry\n", (unsigned)BM_OBJ_N);
+
+    BmPrepare(1);
+    /* before: insertion by swapping entries, O(n) per entry */
+    BmRunSwap  ("swap insert, shuffled",     1);
+
+    /* after: bulk build and insertion with a block move */
+    BmRunBulk  ("bulk build, shuffled",      loops);
+    BmRunInsert("insert, shuffled",          loops);
+    BmRunChange("remove/insert, linked",     loops);
+
+    BmPrepare(0);
+    BmRunSwap  ("swap insert, in order",     1);
+    BmRunBulk  ("bulk build, in order",      loops);
+    BmRunInsert("insert, in order",          loops);
+
+    if (BmFail != 0u) {
+        printf("  FAILED: %u unexpected results\n", (unsigned)BmFail);
+        return (1);
+    }
+    return (0);
+}
@@ -0,0 +1,79 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_DICT_N     5001u                /* 500 indices with 10 entries    */
+
+/* The dictionary holds the indices 2000h..21F3h with 10 subindex entries
+ * each. Every 8th index has a gap in the subindex entries (subindex 0, 2,
+ * 4, ..), like a record with unused members. The entries are expanded with
+ * macros, so the dictionary is a static table like a generated object
+ * dictionary.
+ */
+#define BM_STEP(i)    ((((i) % 8u) == 7u) ? 2u : 1u)
+#define BM_OBJ(i,s)   {CO_KEY(0x2000u + (i), (s) * BM_STEP(i), CO_OBJ_____RW), \
+                       CO_TUNSIGNED32, (CO_DATA)(&BmVal)}
+#define BM_IDX(i)     BM_OBJ(i,0u), BM_OBJ(i,1u), BM_OBJ(i,2u), BM_OBJ(i,3u), \
+                      BM_OBJ(i,4u), BM_OBJ(i,5u), BM_OBJ(i,6u), BM_OBJ(i,7u), \
+                      BM_OBJ(i,8u), BM_OBJ(i,9u)
+#define BM_IDX10(i)   BM_IDX((i)+0u), BM_IDX((i)+1u), BM_IDX((i)+2u), \
+                      BM_IDX((i)+3u), BM_IDX((i)+4u), BM_IDX((i)+5u), \
+                      BM_IDX((i)+6u), BM_IDX((i)+7u), BM_IDX((i)+8u), \
+                      BM_IDX((i)+9u)
+#define BM_IDX100(i)  BM_IDX10((i)+ 0u), BM_IDX10((i)+10u), BM_IDX10((i)+20u), \
+                      BM_IDX10((i)+30u), BM_IDX10((i)+40u), BM_IDX10((i)+50u), \
+                      BM_IDX10((i)+60u), BM_IDX10((i)+70u), BM_IDX10((i)+80u), \
+                      BM_IDX10((i)+90u)
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint32_t BmVal;
+
+static CO_OBJ   BmDict[BM_DICT_N] = {
+    BM_IDX100(0u), BM_IDX100(100u), BM_IDX100(200u), BM_IDX100(300u),
+    BM_IDX100(400u),
+    CO_OBJ_DICT_ENDMARK
+};
+
+/******************************************************************************
+* PUBLIC VARIABLES
+******************************************************************************/
+
+/* Only the object dictionary of the node specification is used. */
+struct CO_NODE_SPEC_T BmSpec = {
+    1,                       /* default Node-Id                */
+    250000,                  /* default Baudrate               */
+    &BmDict[0],              /* pointer to object dictionary   */
+    BM_DICT_N,               /* object dictionary max length   */
+    NULL,                    /* EMCY code & register bit table */
+    NULL,                    /* pointer to timer memory blocks */
+    0,                       /* number of timer memory blocks  */
+    1000,                    /* timer clock frequency in Hz    */
+    NULL,                    /* select drivers for application */
+    NULL                     /* SDO Transfer Buffer Memory     */
+};
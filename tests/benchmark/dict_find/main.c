@@ -0,0 +1,173 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "bm_env.h"
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_KEY_N      4096u                /* random lookup keys             */
+#define BM_HOT_N      16u                  /* keys of the hot set            */
+
+/******************************************************************************
+* EXTERNAL SYMBOLS
+******************************************************************************/
+
+extern struct CO_NODE_SPEC_T BmSpec;       /* dictionary with 5000 entries   */
+#ifdef BM_DICT_TBL
+extern const CO_DICT_TBL     BmTbl;        /* generated lookup table         */
+#endif
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE       BmNode;
+static CO_OBJ       *BmDict;
+static uint16_t      BmNum;
+static uint32_t      BmKey[BM_KEY_N];
+static uint16_t      BmPos[BM_KEY_N];
+static uint32_t      BmFail;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* Prepare the dictionary with 5000 entries: the indices 2000h..21F3h with
+ * 10 subindex entries each (see bm_dict.c).
+ */
+static void BmSetup(CO_NODE *node)
+{
+    BmDict = BmSpec.Dict;
+    BmNum  = (uint16_t)CODictInit(&node->Dict, node, BmDict, BmSpec.DictLen);
+    if (BmNum != 5000u) {
+        BmFail++;
+    }
+#ifdef BM_DICT_TBL
+    if (CODictUseTbl(&node->Dict, &BmTbl) != CO_ERR_NONE) {
+        BmFail++;
+    }
+#endif
+}
+
+/* Prepare the lookup keys in a pseudo random order (linear congruential
+ * generator), so the lookups are spread over the whole dictionary.
+ */
+static void BmPrepare(void)
+{
+    uint32_t seed = 12345u;
+    uint32_t n;
+    uint16_t pos;
+
+    for (n = 0; n < BM_KEY_N; n++) {
+        seed     = (seed * 1103515245u) + 12345u;
+        pos      = (uint16_t)((seed >> 8) % BmNum);
+        BmPos[n] = pos;
+        BmKey[n] = CO_GET_DEV(BmDict[pos].Key);
+    }
+}
+
+/* Measure the lookups of the first 'num' prepared keys.
+ */
+static void BmRun(CO_NODE *node, const char *name, uint32_t num, uint32_t loops)
+{
+    uint64_t start;
+    uint64_t ns;
+    uint32_t loop;
+    uint32_t n;
+    CO_OBJ  *obj;
+
+    start = BM_Now();
+    for (loop = 0; loop < loops; loop++) {
+        for (n = 0; n < num; n++) {
+            obj = CODictFind(&node->Dict, BmKey[n]);
+            if (obj != &BmDict[BmPos[n]]) {
+                BmFail++;
+            }
+        }
+    }
+    ns = BM_Now() - start;
+    BM_Report(name, (uint64_t)loops * num, ns);
+}
+
+/* Measure the lookups of all entries in the order of the dictionary.
+ */
+static void BmRunAll(CO_NODE *node, const char *name, uint32_t loops)
+{
+    uint64_t start;
+    uint64_t ns;
+    uint32_t loop;
+    uint32_t n;
+    CO_OBJ  *obj;
+
+    start = BM_Now();
+    for (loop = 0; loop < loops; loop++) {
+        for (n = 0; n < BmNum; n++) {
+            obj = CODictFind(&node->Dict, CO_GET_DEV(BmDict[n].Key));
+            if (obj != &BmDict[n]) {
+                BmFail++;
+            }
+        }
+    }
+    ns = BM_Now() - start;
+    BM_Report(name, (uint64_t)loops * BmNum, ns);
+}
+
+/* Check the lookup of missing entries: unused subindex in a gap, behind the
+ * last subindex, unused index.
+ */
+static void BmMissing(CO_NODE *node)
+{
+    if ((CODictFind(&node->Dict, CO_DEV(0x2007, 1))  != NULL) ||
+        (CODictFind(&node->Dict, CO_DEV(0x2000, 10)) != NULL) ||
+        (CODictFind(&node->Dict, CO_DEV(0x1000, 0))  != NULL) ||
+        (CODictFind(&node->Dict, CO_DEV(0x3000, 0))  != NULL)) {
+        BmFail++;
+    }
+}
+
+/******************************************************************************
+* BENCHMARK
+******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    uint32_t loops = BM_Count(argc, argv, 5000u);
+
+    BmSetup(&BmNode);
+    BmPrepare();
+
+    printf("Dictionary lookup: %u entries, %u directory indices, %u cached keys, %s\n",
+        (unsigned)BmNum, (unsigned)CO_DICT_DIR_N, (unsigned)CO_DICT_CACHE_N,
+        (BmNode.Dict.Tbl != NULL) ? "generated table" : "no table");
+
+    BmMissing(&BmNode);
+    BmRunAll(&BmNode, "all entries, in order", loops / 2u + 1u);
+    BmRun(&BmNode, "random entries",        BM_KEY_N, loops / 2u + 1u);
+    BmRun(&BmNode, "hot set of 16 entries", BM_HOT_N, loops * 256u);
+
+    if (BmFail != 0u) {
+        printf("  FAILED: %u unexpected lookup results\n", (unsigned)BmFail);
+        return (1);
+    }
+    return (0);
+}
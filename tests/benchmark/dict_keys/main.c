@@ -0,0 +1,152 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "bm_env.h"
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_OBJ_N      10000u               /* maximal object entries         */
+#define BM_KEY_N      4096u                /* random lookup keys             */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE       BmNode;
+static CO_OBJ        BmDict[BM_OBJ_N + 1u];
+static uint32_t      BmKeys[BM_OBJ_N];
+static uint32_t      BmKey[BM_KEY_N];
+static uint16_t      BmPos[BM_KEY_N];
+static uint32_t      BmFail;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* Prepare the dictionary with 'num' entries: indices from 2000h with 10
+ * subindex entries each, and the lookup keys in a pseudo random order.
+ */
+static void BmSetup(CO_NODE *node, uint16_t num)
+{
+    uint32_t seed = 12345u;
+    uint32_t n;
+    uint16_t pos;
+
+    for (n = 0; n < num; n++) {
+        BmDict[n] = (CO_OBJ){ CO_KEY(0x2000u + (n / 10u), n % 10u, CO_OBJ_____RW),
+                              CO_TUNSIGNED32, (CO_DATA)(n) };
+    }
+    BmDict[n] = (CO_OBJ)CO_OBJ_DICT_ENDMARK;
+    if (CODictInit(&node->Dict, node, &BmDict[0], (uint16_t)(num + 1u)) != (int16_t)num) {
+        BmFail++;
+    }
+
+    for (n = 0; n < BM_KEY_N; n++) {
+        seed     = (seed * 1103515245u) + 12345u;
+        pos      = (uint16_t)((seed >> 8) % num);
+        BmPos[n] = pos;
+        BmKey[n] = CO_GET_DEV(BmDict[pos].Key);
+    }
+}
+
+/* Measure the lookups of all entries in the order of the dictionary and
+ * of the prepared random keys.
+ */
+static void BmRun(CO_NODE *node, const char *name, uint32_t loops)
+{
+    char     label[40];
+    uint64_t start;
+    uint64_t ns;
+    uint32_t loop;
+    uint32_t n;
+    CO_OBJ  *obj;
+
+    start = BM_Now();
+    for (loop = 0; loop < loops; loop++) {
+        for (n = 0; n < node->Dict.Num; n++) {
+            obj = CODictFind(&node->Dict, CO_GET_DEV(BmDict[n].Key));
+            if (obj != &BmDict[n]) {
+                BmFail++;
+            }
+        }
+    }
+    ns = BM_Now() - start;
+    (void)snprintf(label, sizeof(label), "%s, in order", name);
+    BM_Report(label, (uint64_t)loops * node->Dict.Num, ns);
+
+    start = BM_Now();
+    for (loop = 0; loop < loops; loop++) {
+        for (n = 0; n < BM_KEY_N; n++) {
+            obj = CODictFind(&node->Dict, BmKey[n]);
+            if (obj != &BmDict[BmPos[n]]) {
+                BmFail++;
+            }
+        }
+    }
+    ns = BM_Now() - start;
+    (void)snprintf(label, sizeof(label), "%s, random", name);
+    BM_Report(label, (uint64_t)loops * BM_KEY_N, ns);
+
+    if ((CODictFind(&node->Dict, CO_DEV(0x1000, 0)) != NULL) ||
+        (CODictFind(&node->Dict, CO_DEV(0x2000, 10)) != NULL) ||
+        (CODictFind(&node->Dict, CO_DEV(0xFFFF, 0)) != NULL)) {
+        BmFail++;
+    }
+}
+
+/* Compare the binary search in the object entries with the search in the
+ * dense key array for a dictionary with 'num' entries.
+ */
+static void BmCompare(CO_NODE *node, uint16_t num, uint32_t loops)
+{
+    BmSetup(node, num);
+    printf("Dictionary lookup: %u entries\n", (unsigned)num);
+
+    /* before: binary search in the object entries */
+    BmRun(node, "object entries", loops);
+
+    /* after: search in the dense key array */
+    if (CODictUseKeys(&node->Dict, &BmKeys[0], BM_OBJ_N) != CO_ERR_NONE) {
+        BmFail++;
+    }
+    BmRun(node, "key array", loops);
+}
+
+/******************************************************************************
+* BENCHMARK
+******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    uint32_t loops = BM_Count(argc, argv, 2000u);
+
+    BmCompare(&BmNode,  1000u, loops * 10u);
+    BmCompare(&BmNode, 10000u, loops);
+
+    if (BmFail != 0u) {
+        printf("  FAILED: %u unexpected lookup results\n", (unsigned)BmFail);
+        return (1);
+    }
+    return (0);
+}
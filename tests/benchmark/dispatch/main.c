@@ -0,0 +1,135 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "bm_env.h"
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_FRM_N     64u             /* number of frames in the test pattern */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE   BmNode;
+static CO_HBCONS BmHbc[CO_DISP_HBC_N];
+static CO_IF_FRM BmFrm[BM_FRM_N];
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* Prepare a node with one SDO server, all RPDOs (asynchronous, no mapping)
+ * and the maximum number of routed heartbeat consumers.
+ */
+static void BmSetup(CO_NODE *node)
+{
+    uint32_t n;
+
+    for (n = 0; n < CO_SSDO_N; n++) {
+        node->Sdo[n].RxId = CO_SDO_ID_OFF;
+    }
+    node->Sdo[0].RxId = 0x601;
+    for (n = 0; n < CO_RPDO_N; n++) {
+        node->RPdo[n].Node       = node;
+        node->RPdo[n].Identifier = 0x200 + n;
+        node->RPdo[n].Flag       = CO_RPDO_FLG__E;
+    }
+    for (n = 0; n < CO_DISP_HBC_N; n++) {
+        BmHbc[n].Node   = node;
+        BmHbc[n].NodeId = (uint8_t)(n + 1);
+        BmHbc[n].Next   = (n + 1 < CO_DISP_HBC_N) ? &BmHbc[n + 1] : NULL;
+    }
+    node->Nmt.HbCons = &BmHbc[0];
+    node->Sync.CobId = 0x80;
+    CODispInit(&node->Disp, node);
+    CODispBuild(&node->Disp);
+}
+
+/* Frame pattern: half of the frames are RPDOs of this node, the other half
+ * is bus traffic for other nodes (e.g. heartbeats, PDOs and SDOs of other
+ * devices), which must pass all checks before reaching the application.
+ */
+static void BmPattern(CO_IF_FRM *frm)
+{
+    uint32_t n;
+
+    for (n = 0; n < BM_FRM_N; n++) {
+        if ((n & 1u) == 0) {
+            frm[n].Identifier = 0x200 + ((n >> 1) % CO_RPDO_N);
+        } else {
+            frm[n].Identifier = 0x77F - ((n >> 1) % 0x40);
+        }
+        frm[n].DLC = 8;
+    }
+}
+
+static uint64_t BmRun(CO_NODE *node, uint32_t loops)
+{
+    CO_IF_FRM frm;
+    uint64_t  start;
+    uint32_t  loop;
+    uint32_t  n;
+
+    start = BM_Now();
+    for (loop = 0; loop < loops; loop++) {
+        for (n = 0; n < BM_FRM_N; n++) {
+            frm = BmFrm[n];
+            (void)CODispProcess(&node->Disp, &frm, CO_NMT_ALLOWED  |
+                                                   CO_SDO_ALLOWED  |
+                                                   CO_PDO_ALLOWED  |
+                                                   CO_SYNC_ALLOWED);
+        }
+    }
+    return (BM_Now() - start);
+}
+
+/******************************************************************************
+* BENCHMARK
+******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    uint32_t loops = BM_Count(argc, argv, 200000u);
+    uint64_t frames;
+    uint64_t ns;
+
+    BmSetup(&BmNode);
+    BmPattern(&BmFrm[0]);
+    frames = (uint64_t)loops * BM_FRM_N;
+
+    printf("CAN-ID dispatch: %u RPDO, %u SDO server, %u heartbeat consumer\n",
+        (unsigned)CO_RPDO_N, (unsigned)CO_SSDO_N, (unsigned)CO_DISP_HBC_N);
+
+    /* before: force the sequential fallback of the dispatcher */
+    BmNode.Disp.Overflow = 1;
+    ns = BmRun(&BmNode, loops);
+    BM_Report("sequential checks", frames, ns);
+
+    /* after: single lookup in the dispatch table */
+    BmNode.Disp.Overflow = 0;
+    ns = BmRun(&BmNode, loops);
+    BM_Report("dispatch table", frames, ns);
+
+    return (0);
+}
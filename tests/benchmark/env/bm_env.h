@@ -0,0 +1,110 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+#ifndef BM_ENV_H_
+#define BM_ENV_H_
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 199309L
+#endif
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+/*! \brief  GET TIMESTAMP
+*
+*    This function returns a monotonic timestamp in nanoseconds.
+*
+* \return
+*    current timestamp in ns
+*/
+static inline uint64_t BM_Now(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+
+/*! \brief  GET ITERATION COUNT
+*
+*    This function returns the iteration count, given as first command line
+*    argument, or the default count.
+*
+* \param argc
+*    number of command line arguments
+*
+* \param argv
+*    command line arguments
+*
+* \param def
+*    default iteration count
+*
+* \return
+*    iteration count
+*/
+static inline uint32_t BM_Count(int argc, char *argv[], uint32_t def)
+{
+    uint32_t result = def;
+
+    if (argc > 1) {
+        result = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+    if (result == 0) {
+        result = 1;
+    }
+    return (result);
+}
+
+/*! \brief  REPORT MEASUREMENT
+*
+*    This function prints the number of operations per second and the time
+*    per operation of a measurement.
+*
+* \param name
+*    name of the measurement
+*
+* \param ops
+*    number of executed operations
+*
+* \param ns
+*    measured time in ns
+*/
+static inline void BM_Report(const char *name, uint64_t ops, uint64_t ns)
+{
+    if (ns == 0) {
+        ns = 1;
+    }
+    if (ops == 0) {
+        ops = 1;
+    }
+    printf("%-32s %12.0f ops/s %10.1f ns/op\n",
+        name,
+        (double)ops * 1e9 / (double)ns,
+        (double)ns / (double)ops);
+}
+
+#endif /* BM_ENV_H_ */
@@ -0,0 +1,414 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "bm_env.h"
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_TMR_N      8u             /* number of timer actions in the pool  */
+#define BM_DICT_N     6u             /* number of object entries             */
+#define BM_FRM_NS     115000u        /* frame time at 1 MBit/s (incl. stuff) */
+#define BM_TICK_NS    1000000u       /* timer tick (1 kHz)                   */
+#define BM_SINK_N     3u             /* number of simulated sinks            */
+#define BM_SIZE_MAX   (1024u * 1024u)
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE       BmNode;
+static CO_IF_DRV     BmDrv;
+static CO_OBJ        BmDict[BM_DICT_N];
+static CO_TMR_MEM    BmTmrMem[BM_TMR_N];
+static uint8_t       BmSdoBuf[CO_SSDO_N * CO_SDO_BUF_BYTE];
+static CO_OBJ_STREAM BmStream;
+static uint8_t       BmImage[BM_SIZE_MAX];
+static CO_IF_FRM     BmTx;
+static uint32_t      BmTxNum;
+static uint32_t      BmFail;
+static uint32_t      BmTmrCnt;
+static uint32_t      BmSinkNs;       /* sink write time per byte             */
+static const uint32_t BmSink[BM_SINK_N] = { 4000u, 10000u, 25000u };
+
+/* virtual time of the simulation */
+static uint64_t      BmBus;          /* CAN bus and SDO client time          */
+static uint64_t      BmTick;         /* time of the next timer tick          */
+static uint64_t      BmBgDone;       /* end of the deferred sink write       */
+static uint8_t       BmInTmr;        /* sink write within a timer action     */
+static uint8_t       BmDue;          /* elapsed timer actions to process     */
+static uint32_t      BmHeld;         /* number of held back acknowledges     */
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* The node sends the SDO responses into a single frame buffer. The
+ * benchmark acts as the SDO client and checks each response. The timer
+ * counts the ticks of the simulated time.
+ */
+static void BmCanInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmCanEnable(CO_IF *cif, uint32_t baudrate)
+{
+    (void)cif;
+    (void)baudrate;
+}
+
+static int16_t BmCanRead(CO_IF *cif, CO_IF_FRM *frm)
+{
+    (void)cif;
+    (void)frm;
+    return (0);
+}
+
+static int16_t BmCanSend(CO_IF *cif, CO_IF_FRM *frm)
+{
+    (void)cif;
+    BmTx = *frm;
+    BmTxNum++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static void BmCanReset(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmCanClose(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmTmrInit(CO_IF *cif, uint32_t freq)
+{
+    (void)cif;
+    (void)freq;
+}
+
+static void BmTmrReload(CO_IF *cif, uint32_t reload)
+{
+    (void)cif;
+    BmTmrCnt = reload;
+}
+
+static uint32_t BmTmrDelay(CO_IF *cif)
+{
+    (void)cif;
+    return (BmTmrCnt);
+}
+
+static void BmTmrStop(CO_IF *cif)
+{
+    (void)cif;
+    BmTmrCnt = 0;
+}
+
+static void BmTmrStart(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint8_t BmTmrUpdate(CO_IF *cif)
+{
+    uint8_t result = 0;
+
+    (void)cif;
+    if (BmTmrCnt > 0u) {
+        BmTmrCnt--;
+        if (BmTmrCnt == 0u) {
+            result = 1;
+        }
+    }
+    return (result);
+}
+
+static void BmNvmInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint32_t BmNvmRdWr(CO_IF *cif, uint32_t start, uint8_t *buf, uint32_t size)
+{
+    (void)cif;
+    (void)start;
+    (void)buf;
+    (void)size;
+    return (0);
+}
+
+static const CO_IF_CAN_DRV BmCan = {
+    BmCanInit, BmCanEnable, BmCanRead, BmCanSend, BmCanReset, BmCanClose, 0, 0
+};
+static const CO_IF_TIMER_DRV BmTmr = {
+    BmTmrInit, BmTmrReload, BmTmrDelay, BmTmrStop, BmTmrStart, BmTmrUpdate
+};
+static const CO_IF_NVM_DRV BmNvm = { BmNvmInit, BmNvmRdWr, BmNvmRdWr };
+
+/* The slow sink (e.g. a flash memory) of the stream object. A write in
+ * the SDO request processing delays the SDO response, a write in a timer
+ * action runs in the background of the CAN communication.
+ */
+static CO_ERR BmSinkWrite(CO_OBJ_STREAM *stream, uint32_t offset, uint8_t *buf, uint32_t len)
+{
+    uint64_t cost = (uint64_t)len * BmSinkNs;
+    uint32_t n;
+
+    (void)stream;
+    for (n = 0; n < len; n++) {
+        BmImage[offset + n] = buf[n];
+    }
+    if (BmInTmr != 0u) {
+        BmBgDone = BmTick + cost;
+    } else {
+        BmBus += cost;
+    }
+    return (CO_ERR_NONE);
+}
+
+/* The image content is a function of the byte offset.
+ */
+static uint8_t BmPattern(uint32_t offset)
+{
+    return ((uint8_t)((offset * 31u) ^ (offset >> 9)));
+}
+
+/* Prepare a node with the stream object 2100h:0 and the SDO server
+ * (request 601h, response 581h).
+ */
+static void BmSetup(CO_NODE *node, uint32_t size)
+{
+    CO_NODE_SPEC spec;
+    uint32_t     i = 0;
+
+    BmDict[i++] = (CO_OBJ){CO_KEY(0x1000, 0, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(0)};
+    BmDict[i++] = (CO_OBJ){CO_KEY(0x1001, 0, CO_OBJ_____R_), CO_TUNSIGNED8 , (CO_DATA)(0)};
+    BmDict[i++] = (CO_OBJ){CO_KEY(0x1018, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(4)};
+    BmDict[i++] = (CO_OBJ){CO_KEY(0x2100, 0, CO_OBJ_____RW), CO_TSTREAM    , (CO_DATA)(&BmStream)};
+    while (i < BM_DICT_N) {
+        BmDict[i++] = (CO_OBJ)CO_OBJ_DICT_ENDMARK;
+    }
+    BmStream.Size  = size;
+    BmStream.Read  = 0;
+    BmStream.Write = &BmSinkWrite;
+
+    BmDrv.Can   = &BmCan;
+    BmDrv.Timer = &BmTmr;
+    BmDrv.Nvm   = &BmNvm;
+    BmDrv.Ctx   = NULL;
+
+    spec.NodeId   = 1;
+    spec.Baudrate = 1000000;
+    spec.Dict     = &BmDict[0];
+    spec.DictLen  = BM_DICT_N;
+    spec.EmcyCode = NULL;
+    spec.TmrMem   = &BmTmrMem[0];
+    spec.TmrNum   = BM_TMR_N;
+    spec.TmrFreq  = 1000;
+    spec.Drv      = &BmDrv;
+    spec.SdoBuf   = &BmSdoBuf[0];
+    CONodeInit(node, &spec);
+
+    node->Sdo[0].RxId = 0x601;
+    node->Sdo[0].TxId = 0x581;
+    CO_DISP_INVALIDATE(node);
+
+    CONodeStart(node);
+    CONmtSetMode(&node->Nmt, CO_OPERATIONAL);
+}
+
+/* Execute the timer actions, which are due until the given time. The
+ * timer actions are processed in the background, so a timer action waits
+ * for the end of the previous sink write.
+ */
+static void BmTimer(CO_NODE *node, uint64_t until)
+{
+    while (BmTick <= until) {
+        if (COTmrService(&node->Tmr) > 0) {
+            BmDue = 1;
+        }
+        if ((BmDue != 0u) && (BmTick >= BmBgDone)) {
+            BmDue   = 0;
+            BmInTmr = 1;
+            COTmrProcess(&node->Tmr);
+            BmInTmr = 0;
+        }
+        BmTick += BM_TICK_NS;
+    }
+}
+
+/* Send a single SDO request frame on the CAN bus.
+ */
+static void BmRequest(CO_NODE *node, CO_IF_FRM *frm)
+{
+    BmBus          += BM_FRM_NS;
+    BmTimer(node, BmBus);
+    frm->Identifier = 0x601;
+    frm->DLC        = 8;
+    BmTxNum         = 0;
+    (void)CODispProcess(&node->Disp, frm, CO_SDO_ALLOWED);
+}
+
+/* Wait for the SDO response with the expected command byte. A held back
+ * acknowledge is sent by the timer action after the deferred write.
+ */
+static void BmResponse(CO_NODE *node, uint8_t cmd, uint8_t mask)
+{
+    uint64_t limit = BmTick + (uint64_t)CO_SSDO_TMO * BM_TICK_NS;
+
+    if (BmTxNum == 0u) {
+        BmHeld++;
+        while ((BmTxNum == 0u) && (BmTick < limit)) {
+            BmTimer(node, BmTick);
+        }
+        if (BmBgDone > BmBus) {
+            BmBus = BmBgDone;
+        }
+    }
+    BmBus += BM_FRM_NS;
+    if ((BmTxNum != 1u) || ((BmTx.Data[0] & mask) != cmd)) {
+        BmFail++;
+    }
+}
+
+/* Block download of the image into the stream object (with CRC) and
+ * return the virtual transfer time.
+ */
+static uint64_t BmDownload(CO_NODE *node, uint32_t size)
+{
+    CO_IF_FRM frm = { 0 };
+    uint32_t  offset = 0;
+    uint16_t  crc = 0;
+    uint8_t   blksize;
+    uint8_t   seq;
+    uint8_t   n = 7;
+
+    BmBus    = 0;
+    BmTick   = BM_TICK_NS;
+    BmBgDone = 0;
+    BmDue    = 0;
+
+    frm.Data[0] = 0xC6;
+    CO_SET_WORD(&frm, 0x2100, 1);
+    CO_SET_BYTE(&frm, 0, 3);
+    CO_SET_LONG(&frm, size, 4);
+    BmRequest(node, &frm);
+    BmResponse(node, 0xA4, 0xFF);
+    blksize = BmTx.Data[4];
+
+    while ((offset < size) && (BmFail == 0u)) {
+        seq = 0;
+        while ((seq < blksize) && (offset < size)) {
+            seq++;
+            for (n = 0; n < 7u; n++) {
+                frm.Data[1u + n] = BmPattern(offset + n);
+            }
+            frm.Data[0] = seq;
+            if ((size - offset) <= 7u) {
+                frm.Data[0] |= 0x80;
+                n = (uint8_t)(size - offset);
+            }
+            crc     = COSdoCrc(crc, &frm.Data[1], n);
+            offset += n;
+            BmRequest(node, &frm);
+        }
+        BmResponse(node, 0xA2, 0xFF);
+        if (BmTx.Data[1] != seq) {
+            BmFail++;
+        }
+        blksize = BmTx.Data[2];
+    }
+
+    frm.Data[0] = (uint8_t)(0xC1 | ((7u - n) << 2));
+    CO_SET_WORD(&frm, crc, 1);
+    CO_SET_BYTE(&frm, 0, 3);
+    CO_SET_LONG(&frm, 0, 4);
+    BmRequest(node, &frm);
+    BmResponse(node, 0xA1, 0xFF);
+
+    for (offset = 0; offset < size; offset++) {
+        if (BmImage[offset] != BmPattern(offset)) {
+            BmFail++;
+            break;
+        }
+        BmImage[offset] = 0;
+    }
+    return (BmBus);
+}
+
+/* Print the transfer rate of the given virtual transfer time.
+ */
+static void BmRate(const char *name, uint32_t size, uint64_t ns)
+{
+    printf("%-32s %9.1f kB/s %10.1f ms  (%u held acknowledges)\n",
+        name,
+        ((double)size / 1000.0) / ((double)ns / 1e9),
+        (double)ns / 1e6,
+        (unsigned)BmHeld);
+}
+
+/******************************************************************************
+* BENCHMARK
+******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    uint32_t kib  = BM_Count(argc, argv, 256u);
+    uint32_t size = kib * 1024u;
+    uint64_t ns;
+    uint32_t n;
+
+    if (size > BM_SIZE_MAX) {
+        size = BM_SIZE_MAX;
+    }
+    printf("SDO block download of %u KiB at 1 MBit/s (simulated time)\n",
+        (unsigned)(size / 1024u));
+    printf("  bus only: %.1f kB/s\n",
+        ((double)size / 1000.0) / ((double)(((uint64_t)size + 6u) / 7u * BM_FRM_NS) / 1e9));
+    BmSetup(&BmNode, size);
+
+    for (n = 0; n < BM_SINK_N; n++) {
+        BmSinkNs = BmSink[n];
+        printf("sink with %.1f kB/s:\n", 1e6 / (double)BmSinkNs);
+
+        /* before: block written, before the block is acknowledged */
+        BmHeld = 0;
+        (void)COSdoSetBlock(&BmNode.Sdo[0], 127, 0);
+        ns = BmDownload(&BmNode, size);
+        BmRate("  write before acknowledge", size, ns);
+
+        /* after: block acknowledged, written while receiving the next block */
+        BmHeld = 0;
+        (void)COSdoSetBlock(&BmNode.Sdo[0], 127, 1);
+        ns = BmDownload(&BmNode, size);
+        BmRate("  deferred write", size, ns);
+    }
+
+    if (BmFail != 0u) {
+        printf("  FAILED: %u unexpected SDO responses or image bytes\n", (unsigned)BmFail);
+        return (1);
+    }
+    return (0);
+}
@@ -0,0 +1,120 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "bm_env.h"
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_DATA_N    65536u          /* size of the data buffer              */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint8_t BmData[BM_DATA_N];
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* Bitwise calculation as reference for the checksum and the speed.
+ */
+static uint16_t BmCrcBitwise(uint16_t crc, const uint8_t *buf, uint32_t len)
+{
+    uint8_t bit;
+
+    while (len > 0u) {
+        crc ^= (uint16_t)((uint16_t)*buf << 8u);
+        for (bit = 0u; bit < 8u; bit++) {
+            if ((crc & 0x8000u) != 0u) {
+                crc = (uint16_t)((uint16_t)(crc << 1u) ^ 0x1021u);
+            } else {
+                crc = (uint16_t)(crc << 1u);
+            }
+        }
+        buf++;
+        len--;
+    }
+    return (crc);
+}
+
+/* Calculate the checksum of the data buffer in pieces of the given size,
+ * like the SDO block transfer does with each confirmed block.
+ */
+static uint64_t BmRun(uint32_t len, uint32_t loops, uint16_t *crc)
+{
+    uint64_t start;
+    uint32_t loop;
+    uint32_t pos;
+
+    start = BM_Now();
+    for (loop = 0; loop < loops; loop++) {
+        *crc = 0;
+        for (pos = 0; (pos + len) <= BM_DATA_N; pos += len) {
+            *crc = COSdoCrc(*crc, &BmData[pos], len);
+        }
+    }
+    return (BM_Now() - start);
+}
+
+/******************************************************************************
+* BENCHMARK
+******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    static const uint32_t len[] = { 7u, 127u * 7u, BM_DATA_N };
+    uint32_t loops = BM_Count(argc, argv, 2000u);
+    uint32_t n;
+    uint64_t ns;
+    uint16_t crc;
+    uint16_t ref;
+    char     name[32];
+    int      result = 0;
+
+    for (n = 0; n < BM_DATA_N; n++) {
+        BmData[n] = (uint8_t)((n * 131u) ^ (n >> 8));
+    }
+
+    printf("SDO block CRC: %u bytes (%s)\n",
+        (unsigned)BM_DATA_N, (CO_SDO_CRC_CLMUL != 0) ? "table and clmul" : "table");
+
+    for (n = 0; n < sizeof(len) / sizeof(len[0]); n++) {
+        ns = BmRun(len[n], loops, &crc);
+        ref = BmCrcBitwise(0, &BmData[0], (BM_DATA_N / len[n]) * len[n]);
+        if (crc != ref) {
+            printf("checksum mismatch: %04x != %04x\n", crc, ref);
+            result = 1;
+        }
+        (void)snprintf(name, sizeof(name), "%u byte steps", (unsigned)len[n]);
+        BM_Report(name, (uint64_t)loops * BM_DATA_N, ns);
+    }
+
+    ns = BM_Now();
+    for (n = 0; n < loops; n++) {
+        ref = BmCrcBitwise(0, &BmData[0], BM_DATA_N);
+    }
+    BM_Report("bitwise reference", (uint64_t)loops * BM_DATA_N, BM_Now() - ns);
+
+    return (result);
+}
@@ -0,0 +1,364 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "bm_env.h"
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_REQ_N      CO_IF_RX_BATCH_N   /* polled entries per batch         */
+#define BM_DICT_N     (2u * BM_REQ_N + 1u)
+#define BM_TMR_N      8u
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE       BmNode;
+static CO_IF_DRV     BmDrv;
+static CO_OBJ        BmDict[BM_DICT_N];
+static CO_TMR_MEM    BmTmrMem[BM_TMR_N];
+static uint8_t       BmSdoBuf[CO_SSDO_BUF_N * CO_SDO_BUF_BYTE];
+static uint32_t      BmRo[BM_REQ_N];
+static uint32_t      BmRw[BM_REQ_N];
+static CO_IF_FRM     BmRx[BM_REQ_N];
+static uint32_t      BmRxRd;
+static CO_IF_FRM     BmTx[BM_REQ_N];
+static uint32_t      BmTxNum;
+static uint32_t      BmCall;
+static uint8_t       BmTick;
+static uint32_t      BmFail;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* The driver delivers the prepared requests of the polling SDO client and
+ * collects the responses. Each call of Send or SendBatch is counted as a
+ * driver call (e.g. a system call of a hosted CAN driver).
+ */
+static void BmCanInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmCanEnable(CO_IF *cif, uint32_t baudrate)
+{
+    (void)cif;
+    (void)baudrate;
+}
+
+static int16_t BmCanRead(CO_IF *cif, CO_IF_FRM *frm)
+{
+    (void)cif;
+    if (BmRxRd >= BM_REQ_N) {
+        return (0);
+    }
+    *frm = BmRx[BmRxRd];
+    BmRxRd++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static int16_t BmCanReadBatch(CO_IF *cif, CO_IF_FRM *frm, uint16_t max)
+{
+    int16_t num = 0;
+
+    (void)cif;
+    while ((num < (int16_t)max) && (BmRxRd < BM_REQ_N)) {
+        frm[num] = BmRx[BmRxRd];
+        BmRxRd++;
+        num++;
+    }
+    return (num);
+}
+
+static int16_t BmCanSend(CO_IF *cif, CO_IF_FRM *frm)
+{
+    (void)cif;
+    BmCall++;
+    if (BmTxNum < BM_REQ_N) {
+        BmTx[BmTxNum] = *frm;
+    }
+    BmTxNum++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static int16_t BmCanSendBatch(CO_IF *cif, CO_IF_FRM *frm, uint16_t num)
+{
+    uint16_t n;
+
+    (void)cif;
+    BmCall++;
+    for (n = 0; n < num; n++) {
+        if (BmTxNum < BM_REQ_N) {
+            BmTx[BmTxNum] = frm[n];
+        }
+        BmTxNum++;
+    }
+    return ((int16_t)num);
+}
+
+static void BmCanReset(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmCanClose(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmTmrInit(CO_IF *cif, uint32_t freq)
+{
+    (void)cif;
+    (void)freq;
+}
+
+static void BmTmrReload(CO_IF *cif, uint32_t reload)
+{
+    (void)cif;
+    (void)reload;
+}
+
+static uint32_t BmTmrDelay(CO_IF *cif)
+{
+    (void)cif;
+    return (0);
+}
+
+static void BmTmrStop(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmTmrStart(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint8_t BmTmrUpdate(CO_IF *cif)
+{
+    uint8_t result = BmTick;
+
+    (void)cif;
+    BmTick = 0;
+    return (result);
+}
+
+static void BmNvmInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint32_t BmNvmRdWr(CO_IF *cif, uint32_t start, uint8_t *buf, uint32_t size)
+{
+    (void)cif;
+    (void)start;
+    (void)buf;
+    (void)size;
+    return (0);
+}
+
+static const CO_IF_CAN_DRV BmCan = {
+    BmCanInit, BmCanEnable, BmCanRead, BmCanSend, BmCanReset, BmCanClose,
+    BmCanReadBatch, BmCanSendBatch
+};
+static const CO_IF_TIMER_DRV BmTmr = {
+    BmTmrInit, BmTmrReload, BmTmrDelay, BmTmrStop, BmTmrStart, BmTmrUpdate
+};
+static const CO_IF_NVM_DRV BmNvm = { BmNvmInit, BmNvmRdWr, BmNvmRdWr };
+
+/* Prepare a node with read-only entries 2100h:1..n and read-write entries
+ * 2200h:1..n, which are polled by the SDO client of node 1.
+ */
+static void BmSetup(CO_NODE *node)
+{
+    CO_NODE_SPEC spec;
+    uint32_t     i = 0;
+    uint32_t     n;
+
+    for (n = 0; n < BM_REQ_N; n++) {
+        BmRo[n] = 0x11000000u + n;
+        BmDict[i++] = (CO_OBJ){CO_KEY(0x2100, n + 1u, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&BmRo[n])};
+    }
+    for (n = 0; n < BM_REQ_N; n++) {
+        BmRw[n] = 0x22000000u + n;
+        BmDict[i++] = (CO_OBJ){CO_KEY(0x2200, n + 1u, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&BmRw[n])};
+    }
+    while (i < BM_DICT_N) {
+        BmDict[i++] = (CO_OBJ)CO_OBJ_DICT_ENDMARK;
+    }
+
+    BmDrv.Can   = &BmCan;
+    BmDrv.Timer = &BmTmr;
+    BmDrv.Nvm   = &BmNvm;
+    BmDrv.Ctx   = NULL;
+
+    spec.NodeId   = 1;
+    spec.Baudrate = 250000;
+    spec.Dict     = &BmDict[0];
+    spec.DictLen  = BM_DICT_N;
+    spec.EmcyCode = NULL;
+    spec.TmrMem   = &BmTmrMem[0];
+    spec.TmrNum   = BM_TMR_N;
+    spec.TmrFreq  = 1000;
+    spec.Drv      = &BmDrv;
+    spec.SdoBuf   = &BmSdoBuf[0];
+    CONodeInit(node, &spec);
+
+    node->Sdo[0].RxId      = 0x601;
+    node->Sdo[0].TxId      = 0x581;
+    node->Nmt.Allowed      = CO_SDO_ALLOWED;
+    CO_DISP_INVALIDATE(node);
+}
+
+/* Prepare the expedited upload requests of one polling round.
+ */
+static void BmPrepare(uint16_t idx)
+{
+    uint32_t n;
+    uint8_t  b;
+
+    for (n = 0; n < BM_REQ_N; n++) {
+        BmRx[n].Identifier = 0x601;
+        BmRx[n].DLC        = 8;
+        for (b = 0; b < 8; b++) {
+            BmRx[n].Data[b] = 0;
+        }
+        BmRx[n].Data[0] = 0x40;
+        BmRx[n].Data[1] = (uint8_t)idx;
+        BmRx[n].Data[2] = (uint8_t)(idx >> 8);
+        BmRx[n].Data[3] = (uint8_t)(n + 1u);
+    }
+}
+
+/* Execute one polling round and check all responses against the given
+ * values.
+ */
+static void BmPoll(CO_NODE *node, uint8_t batch, uint32_t *val)
+{
+    uint32_t n;
+
+    BmRxRd  = 0;
+    BmTxNum = 0;
+    if (batch != 0u) {
+        (void)CONodeProcessBatch(node, BM_REQ_N);
+    } else {
+        for (n = 0; n < BM_REQ_N; n++) {
+            CONodeProcess(node);
+        }
+    }
+    if (BmTxNum != BM_REQ_N) {
+        BmFail++;
+        return;
+    }
+    for (n = 0; n < BM_REQ_N; n++) {
+        if ((BmTx[n].Identifier != 0x581) ||
+            (BmTx[n].Data[0]    != 0x43 ) ||
+            (BmTx[n].Data[3]    != (uint8_t)(n + 1u)) ||
+            (CO_GET_LONG(&BmTx[n], 4) != val[n])) {
+            BmFail++;
+        }
+    }
+}
+
+/* Check the response cache: a written entry is uploaded with the new value
+ * at once, a changed variable is uploaded with the new value after the
+ * cache timeout.
+ */
+static void BmCache(CO_NODE *node)
+{
+    uint32_t exp[BM_REQ_N];
+    uint32_t n;
+
+    BmPrepare(0x2100);
+    BmPoll(node, 1, &BmRo[0]);
+
+    (void)CODictWrLong(&node->Dict, CO_DEV(0x2100, 1), 0x33000000u);
+    BmPoll(node, 1, &BmRo[0]);
+
+    for (n = 0; n < BM_REQ_N; n++) {
+        exp[n] = BmRo[n];
+    }
+    BmRo[1] = 0x44000000u;
+#if CO_SSDO_CACHE_N > 0
+    BmPoll(node, 1, &exp[0]);
+    BmTick = 1;
+    (void)COTmrService(&node->Tmr);
+    COTmrProcess(&node->Tmr);
+#endif
+    BmPoll(node, 1, &BmRo[0]);
+}
+
+/* Measure the polling rounds of the given entries.
+ */
+static void BmRun(CO_NODE *node, const char *name, uint8_t batch,
+                  uint16_t idx, uint32_t *val, uint32_t loops)
+{
+    uint64_t start;
+    uint64_t ns;
+    uint32_t call;
+    uint32_t loop;
+
+    BmPrepare(idx);
+    BmPoll(node, batch, val);
+    BmCall = 0;
+    start  = BM_Now();
+    for (loop = 0; loop < loops; loop++) {
+        BmPoll(node, batch, val);
+    }
+    ns   = BM_Now() - start;
+    call = BmCall;
+    BM_Report(name, (uint64_t)loops * BM_REQ_N, ns);
+    printf("  driver send calls per request: %.3f\n",
+        (double)call / ((double)loops * BM_REQ_N));
+}
+
+/******************************************************************************
+* BENCHMARK
+******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    uint32_t loops = BM_Count(argc, argv, 200000u);
+
+    BmSetup(&BmNode);
+
+    printf("SDO polling: %u expedited uploads per batch, %u cached responses\n",
+        (unsigned)BM_REQ_N, (unsigned)CO_SSDO_CACHE_N);
+
+    BmCache(&BmNode);
+
+    /* before: single frame processing, one driver call per response */
+    BmRun(&BmNode, "single frames, uncached", 0, 0x2200, &BmRw[0], loops);
+    BmRun(&BmNode, "single frames, cached",   0, 0x2100, &BmRo[0], loops);
+
+    /* after: responses of a batch are sent in a burst */
+    BmRun(&BmNode, "burst, uncached",         1, 0x2200, &BmRw[0], loops);
+    BmRun(&BmNode, "burst, cached",           1, 0x2100, &BmRo[0], loops);
+
+    if (BmFail != 0u) {
+        printf("  FAILED: %u unexpected SDO responses\n", (unsigned)BmFail);
+        return (1);
+    }
+    return (0);
+}
@@ -0,0 +1,362 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "bm_env.h"
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_SRV_N      40u            /* number of SDO server nodes           */
+#define BM_OBJ_N      8u             /* object entries 2000h:1..n per server */
+#define BM_REQ_N      4096u          /* maximal number of queued requests    */
+#define BM_RX_N       256u           /* receive frames of a node (power of 2)*/
+#define BM_BUS_N      1024u          /* frames on the bus within one round   */
+#define BM_TMR_N      8u             /* number of timer actions of a node    */
+#define BM_DICT_N     (4u + (4u * CO_CSDO_N) + BM_OBJ_N + 1u)
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+typedef struct BM_NODE_T {
+    CO_NODE        Node;
+    CO_IF_DRV      Drv;
+    CO_OBJ         Dict[BM_DICT_N];
+    CO_TMR_MEM     TmrMem[BM_TMR_N];
+    uint8_t        SdoBuf[CO_SSDO_N * CO_SDO_BUF_BYTE];
+    CO_IF_FRM      Rx[BM_RX_N];
+    uint32_t       RxHead;
+    uint32_t       RxTail;
+    uint32_t       Obj[BM_OBJ_N];
+} BM_NODE;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static BM_NODE       BmNode[1u + BM_SRV_N];
+static uint32_t      BmNodeNum;
+static CO_IF_FRM     BmBus[BM_BUS_N];
+static uint8_t       BmBusFrom[BM_BUS_N];
+static uint32_t      BmBusNum;
+static uint64_t      BmFrames;
+
+static uint32_t      BmCliTx[CO_CSDO_N];
+static uint32_t      BmCliRx[CO_CSDO_N];
+static uint8_t       BmCliId[CO_CSDO_N];
+static const uint32_t BmSrvRx = 0x600;
+static const uint32_t BmSrvTx = 0x580;
+
+static CO_CSDO_QUEUE BmQueue;
+static CO_CSDO_REQ   BmReq[BM_REQ_N];
+static uint32_t      BmVal[BM_REQ_N];
+static uint32_t      BmDone;
+static uint32_t      BmFail;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* The simulated bus is working in rounds: all frames sent within a round
+ * are received by all other nodes at the beginning of the next round. A
+ * round is the latency of a single SDO request or response.
+ */
+static void BmCanInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmCanEnable(CO_IF *cif, uint32_t baudrate)
+{
+    (void)cif;
+    (void)baudrate;
+}
+
+static int16_t BmCanRead(CO_IF *cif, CO_IF_FRM *frm)
+{
+    BM_NODE *bn = (BM_NODE *)CO_IF_CTX(cif);
+
+    if (bn->RxHead == bn->RxTail) {
+        return (0);
+    }
+    *frm = bn->Rx[bn->RxTail & (BM_RX_N - 1u)];
+    bn->RxTail++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static int16_t BmCanSend(CO_IF *cif, CO_IF_FRM *frm)
+{
+    BM_NODE *bn = (BM_NODE *)CO_IF_CTX(cif);
+
+    if (BmBusNum >= BM_BUS_N) {
+        return (-1);
+    }
+    BmBus[BmBusNum]     = *frm;
+    BmBusFrom[BmBusNum] = (uint8_t)(bn - &BmNode[0]);
+    BmBusNum++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static void BmCanReset(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmCanClose(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmTmrInit(CO_IF *cif, uint32_t freq)
+{
+    (void)cif;
+    (void)freq;
+}
+
+static void BmTmrReload(CO_IF *cif, uint32_t reload)
+{
+    (void)cif;
+    (void)reload;
+}
+
+static uint32_t BmTmrDelay(CO_IF *cif)
+{
+    (void)cif;
+    return (0);
+}
+
+static void BmTmrStop(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmTmrStart(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint8_t BmTmrUpdate(CO_IF *cif)
+{
+    (void)cif;
+    return (0);
+}
+
+static void BmNvmInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint32_t BmNvmRdWr(CO_IF *cif, uint32_t start, uint8_t *buf, uint32_t size)
+{
+    (void)cif;
+    (void)start;
+    (void)buf;
+    (void)size;
+    return (0);
+}
+
+static const CO_IF_CAN_DRV BmCan = {
+    BmCanInit, BmCanEnable, BmCanRead, BmCanSend, BmCanReset, BmCanClose, 0, 0
+};
+static const CO_IF_TIMER_DRV BmTmr = {
+    BmTmrInit, BmTmrReload, BmTmrDelay, BmTmrStop, BmTmrStart, BmTmrUpdate
+};
+static const CO_IF_NVM_DRV BmNvm = { BmNvmInit, BmNvmRdWr, BmNvmRdWr };
+
+static void BmSetup(BM_NODE *bn, uint8_t nodeId, uint8_t clients)
+{
+    CO_NODE_SPEC spec;
+    uint32_t     i = 0;
+    uint32_t     n;
+
+    bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1000, 0, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(0)};
+    bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1001, 0, CO_OBJ_____R_), CO_TUNSIGNED8 , (CO_DATA)(0)};
+    if (nodeId == 1u) {
+        for (n = 0; n < CO_CSDO_N; n++) {
+            BmCliTx[n] = (n < clients) ? 0x600 : CO_SDO_ID_OFF;
+            BmCliRx[n] = (n < clients) ? 0x580 : CO_SDO_ID_OFF;
+            BmCliId[n] = (uint8_t)(2u + n);
+            bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1280 + n, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(3)};
+            bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1280 + n, 1, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&BmCliTx[n])};
+            bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1280 + n, 2, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&BmCliRx[n])};
+            bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1280 + n, 3, CO_OBJ_____R_), CO_TUNSIGNED8 , (CO_DATA)(&BmCliId[n])};
+        }
+    } else {
+        bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1200, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(2)};
+        bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1200, 1, CO_OBJ__N__R_), CO_TUNSIGNED32, (CO_DATA)(&BmSrvRx)};
+        bn->Dict[i++] = (CO_OBJ){CO_KEY(0x1200, 2, CO_OBJ__N__R_), CO_TUNSIGNED32, (CO_DATA)(&BmSrvTx)};
+        for (n = 0; n < BM_OBJ_N; n++) {
+            bn->Obj[n]    = ((uint32_t)nodeId << 8) | (n + 1u);
+            bn->Dict[i++] = (CO_OBJ){CO_KEY(0x2000, n + 1u, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&bn->Obj[n])};
+        }
+    }
+    while (i < BM_DICT_N) {
+        bn->Dict[i++] = (CO_OBJ)CO_OBJ_DICT_ENDMARK;
+    }
+
+    bn->Drv.Can   = &BmCan;
+    bn->Drv.Timer = &BmTmr;
+    bn->Drv.Nvm   = &BmNvm;
+    bn->Drv.Ctx   = bn;
+    bn->RxHead    = 0;
+    bn->RxTail    = 0;
+
+    spec.NodeId   = nodeId;
+    spec.Baudrate = 250000;
+    spec.Dict     = &bn->Dict[0];
+    spec.DictLen  = BM_DICT_N;
+    spec.EmcyCode = NULL;
+    spec.TmrMem   = &bn->TmrMem[0];
+    spec.TmrNum   = BM_TMR_N;
+    spec.TmrFreq  = 1000;
+    spec.Drv      = &bn->Drv;
+    spec.SdoBuf   = &bn->SdoBuf[0];
+    CONodeInit(&bn->Node, &spec);
+    CONodeStart(&bn->Node);
+    CONmtSetMode(&bn->Node.Nmt, CO_OPERATIONAL);
+}
+
+/* Deliver the frames of the last round to all other nodes and let all
+ * nodes process the received frames.
+ */
+static void BmRound(void)
+{
+    CO_IF_FRM frm[BM_BUS_N];
+    uint8_t   from[BM_BUS_N];
+    uint32_t  num = BmBusNum;
+    uint32_t  f;
+    uint32_t  n;
+    BM_NODE  *bn;
+
+    for (f = 0; f < num; f++) {
+        frm[f]  = BmBus[f];
+        from[f] = BmBusFrom[f];
+    }
+    BmBusNum  = 0;
+    BmFrames += num;
+
+    for (n = 0; n < BmNodeNum; n++) {
+        bn = &BmNode[n];
+        for (f = 0; f < num; f++) {
+            if ((from[f] != n) && ((bn->RxHead - bn->RxTail) < BM_RX_N)) {
+                bn->Rx[bn->RxHead & (BM_RX_N - 1u)] = frm[f];
+                bn->RxHead++;
+            }
+        }
+    }
+    for (n = 0; n < BmNodeNum; n++) {
+        bn = &BmNode[n];
+        while (bn->RxHead != bn->RxTail) {
+            CONodeProcess(&bn->Node);
+        }
+    }
+}
+
+static void BmFinished(CO_CSDO *csdo, uint16_t index, uint8_t sub, uint32_t code)
+{
+    (void)csdo;
+    (void)index;
+    (void)sub;
+
+    if (code != 0u) {
+        BmFail++;
+    }
+    BmDone++;
+}
+
+static void BmRun(uint32_t entries, uint8_t servers, uint8_t clients)
+{
+    CO_CSDO_QUEUE_STAT stat;
+    uint64_t           start;
+    uint64_t           ns;
+    uint32_t           rounds = 0;
+    uint32_t           n;
+    uint32_t           sub;
+    uint8_t            id;
+    char               name[40];
+
+    BmNodeNum = 1u + servers;
+    BmBusNum  = 0;
+    BmFrames  = 0;
+    BmDone    = 0;
+    for (n = 0; n < BmNodeNum; n++) {
+        BmSetup(&BmNode[n], (uint8_t)(n + 1u), clients);
+    }
+    BmBusNum = 0;
+    COCSdoQueueInit(&BmQueue, &BmNode[0].Node, &BmReq[0], BM_REQ_N);
+
+    start = BM_Now();
+    for (n = 0; n < entries; n++) {
+        id       = (uint8_t)(2u + (n % servers));
+        sub      = 1u + ((n / servers) % BM_OBJ_N);
+        BmVal[n] = 0;
+        (void)COCSdoQueueUpload(&BmQueue, id, CO_DEV(0x2000, sub),
+                                (uint8_t *)&BmVal[n], sizeof(uint32_t),
+                                BmFinished, 1000);
+    }
+    while ((BmDone < entries) && (rounds < (entries * 4u))) {
+        BmRound();
+        rounds++;
+    }
+    ns = BM_Now() - start;
+
+    for (n = 0; n < entries; n++) {
+        id  = (uint8_t)(2u + (n % servers));
+        sub = 1u + ((n / servers) % BM_OBJ_N);
+        if (BmVal[n] != (((uint32_t)id << 8) | sub)) {
+            BmFail++;
+        }
+    }
+
+    COCSdoQueueGetStat(&BmQueue, &stat, 0);
+    (void)snprintf(name, sizeof(name), "%u server, %u client", servers, clients);
+    BM_Report(name, entries, ns);
+    printf("  rounds=%u frames=%u done=%u abort=%u bytes=%u max-active=%u failed=%u\n",
+        rounds, (unsigned)BmFrames, stat.Done, stat.Abort, stat.Bytes,
+        stat.MaxActive, BmFail);
+}
+
+/******************************************************************************
+* BENCHMARK
+******************************************************************************/
+
+/* Read object entries from several SDO server nodes with the request queue
+ * of the SDO client. The number of bus rounds is the configuration time in
+ * SDO round trips: a single SDO client needs two rounds per entry, while
+ * the queue executes the requests to different servers concurrently.
+ */
+int main(int argc, char *argv[])
+{
+    uint32_t entries = BM_Count(argc, argv, 2000u);
+
+    if (entries > BM_REQ_N) {
+        entries = BM_REQ_N;
+    }
+    printf("SDO client queue: %u entries, %u SDO clients\n",
+        entries, (unsigned)CO_CSDO_N);
+
+    BmRun(entries, BM_SRV_N, 1);
+    BmRun(entries, 4, CO_CSDO_N);
+    BmRun(entries, BM_SRV_N, CO_CSDO_N);
+
+    return ((BmFail == 0) ? 0 : 1);
+}
@@ -0,0 +1,329 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "bm_env.h"
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_DOM_N      16u            /* domains 2000h:1..n (one per buffer)  */
+#define BM_DOM_SIZE   28u            /* domain size (4 segments)             */
+#define BM_SEG_N      (BM_DOM_SIZE / 7u)
+#define BM_TMR_N      (CO_SSDO_BUF_N + 8u)
+#define BM_DICT_N     (4u + BM_DOM_N + 1u)
+#define BM_GROUP_N    (CO_SSDO_N / BM_DOM_N)
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE       BmNode;
+static CO_IF_DRV     BmDrv;
+static CO_OBJ        BmDict[BM_DICT_N];
+static CO_TMR_MEM    BmTmrMem[BM_TMR_N];
+static uint8_t       BmSdoBuf[CO_SSDO_BUF_N * CO_SDO_BUF_BYTE];
+static CO_OBJ_DOM    BmDom[BM_DOM_N];
+static uint8_t       BmDomData[BM_DOM_N][BM_DOM_SIZE];
+static uint32_t      BmVal = 0x12345678;
+static CO_IF_FRM     BmTx;
+static uint32_t      BmTxNum;
+static uint32_t      BmFail;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* The gateway node sends the SDO responses into a single frame buffer. The
+ * benchmark acts as the SDO clients and checks each response.
+ */
+static void BmCanInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmCanEnable(CO_IF *cif, uint32_t baudrate)
+{
+    (void)cif;
+    (void)baudrate;
+}
+
+static int16_t BmCanRead(CO_IF *cif, CO_IF_FRM *frm)
+{
+    (void)cif;
+    (void)frm;
+    return (0);
+}
+
+static int16_t BmCanSend(CO_IF *cif, CO_IF_FRM *frm)
+{
+    (void)cif;
+    BmTx = *frm;
+    BmTxNum++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static void BmCanReset(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmCanClose(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmTmrInit(CO_IF *cif, uint32_t freq)
+{
+    (void)cif;
+    (void)freq;
+}
+
+static void BmTmrReload(CO_IF *cif, uint32_t reload)
+{
+    (void)cif;
+    (void)reload;
+}
+
+static uint32_t BmTmrDelay(CO_IF *cif)
+{
+    (void)cif;
+    return (0);
+}
+
+static void BmTmrStop(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmTmrStart(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint8_t BmTmrUpdate(CO_IF *cif)
+{
+    (void)cif;
+    return (0);
+}
+
+static void BmNvmInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint32_t BmNvmRdWr(CO_IF *cif, uint32_t start, uint8_t *buf, uint32_t size)
+{
+    (void)cif;
+    (void)start;
+    (void)buf;
+    (void)size;
+    return (0);
+}
+
+static const CO_IF_CAN_DRV BmCan = {
+    BmCanInit, BmCanEnable, BmCanRead, BmCanSend, BmCanReset, BmCanClose, 0, 0
+};
+static const CO_IF_TIMER_DRV BmTmr = {
+    BmTmrInit, BmTmrReload, BmTmrDelay, BmTmrStop, BmTmrStart, BmTmrUpdate
+};
+static const CO_IF_NVM_DRV BmNvm = { BmNvmInit, BmNvmRdWr, BmNvmRdWr };
+
+/* Prepare a gateway node with CO_SSDO_N SDO servers (request 600h+n+1,
+ * response 580h+n+1), which share CO_SSDO_BUF_N transfer buffers.
+ */
+static void BmSetup(CO_NODE *node)
+{
+    CO_NODE_SPEC spec;
+    uint32_t     i = 0;
+    uint32_t     n;
+
+    BmDict[i++] = (CO_OBJ){CO_KEY(0x1000, 0, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(0)};
+    BmDict[i++] = (CO_OBJ){CO_KEY(0x1001, 0, CO_OBJ_____R_), CO_TUNSIGNED8 , (CO_DATA)(0)};
+    BmDict[i++] = (CO_OBJ){CO_KEY(0x1018, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(4)};
+    for (n = 0; n < BM_DOM_N; n++) {
+        BmDom[n].Offset = 0;
+        BmDom[n].Size   = BM_DOM_SIZE;
+        BmDom[n].Start  = &BmDomData[n][0];
+        BmDict[i++] = (CO_OBJ){CO_KEY(0x2000, n + 1u, CO_OBJ_____R_), CO_TDOMAIN, (CO_DATA)(&BmDom[n])};
+    }
+    BmDict[i++] = (CO_OBJ){CO_KEY(0x2001, 0, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&BmVal)};
+    while (i < BM_DICT_N) {
+        BmDict[i++] = (CO_OBJ)CO_OBJ_DICT_ENDMARK;
+    }
+
+    BmDrv.Can   = &BmCan;
+    BmDrv.Timer = &BmTmr;
+    BmDrv.Nvm   = &BmNvm;
+    BmDrv.Ctx   = NULL;
+
+    spec.NodeId   = 1;
+    spec.Baudrate = 250000;
+    spec.Dict     = &BmDict[0];
+    spec.DictLen  = BM_DICT_N;
+    spec.EmcyCode = NULL;
+    spec.TmrMem   = &BmTmrMem[0];
+    spec.TmrNum   = BM_TMR_N;
+    spec.TmrFreq  = 1000;
+    spec.Drv      = &BmDrv;
+    spec.SdoBuf   = &BmSdoBuf[0];
+    CONodeInit(node, &spec);
+
+    for (n = 0; n < CO_SSDO_N; n++) {
+        node->Sdo[n].RxId = 0x601 + n;
+        node->Sdo[n].TxId = 0x581 + n;
+    }
+    CO_DISP_INVALIDATE(node);
+}
+
+/* Send a single SDO request to the SDO server and check the response
+ * command byte (and the abort code, when the response is an abort).
+ */
+static void BmRequest(CO_NODE *node, uint32_t srv, uint8_t cmd, uint16_t idx,
+                      uint8_t sub, uint8_t rsp, uint32_t code)
+{
+    CO_IF_FRM frm;
+    uint8_t   n;
+
+    frm.Identifier = 0x601 + srv;
+    frm.DLC        = 8;
+    for (n = 0; n < 8; n++) {
+        frm.Data[n] = 0;
+    }
+    frm.Data[0] = cmd;
+    frm.Data[1] = (uint8_t)idx;
+    frm.Data[2] = (uint8_t)(idx >> 8);
+    frm.Data[3] = sub;
+
+    BmTxNum = 0;
+    (void)CODispProcess(&node->Disp, &frm, CO_SDO_ALLOWED);
+    if ((BmTxNum != 1u) || (BmTx.Identifier != (0x581 + srv))) {
+        BmFail++;
+    } else if ((BmTx.Data[0] & 0xF0) != (rsp & 0xF0)) {
+        BmFail++;
+    } else if ((rsp == 0x80) && (CO_GET_LONG(&BmTx, 4) != code)) {
+        BmFail++;
+    }
+}
+
+/* Check the buffer pool: all buffers are taken by concurrent segmented
+ * uploads, the next segmented upload is aborted with 'out of memory', an
+ * expedited upload is still served and the client aborts release the
+ * buffers again.
+ */
+static void BmPool(CO_NODE *node)
+{
+    uint32_t n;
+
+    for (n = 0; n < CO_SSDO_BUF_N; n++) {
+        BmRequest(node, n, 0x40, 0x2000, (uint8_t)(1u + (n % BM_DOM_N)), 0x41, 0);
+    }
+    BmRequest(node, CO_SSDO_BUF_N, 0x40, 0x2000, 1, 0x80, CO_SDO_ERR_MEM);
+    BmRequest(node, CO_SSDO_BUF_N, 0x40, 0x2001, 0, 0x43, 0);
+    if (node->SdoPool.Num != 0u) {
+        BmFail++;
+    }
+    for (n = 0; n < CO_SSDO_BUF_N; n++) {
+        BmRequest(node, n, 0x80, 0, 0, 0x80, 0);
+    }
+    if (node->SdoPool.Num != CO_SSDO_BUF_N) {
+        BmFail++;
+    }
+}
+
+/* One round: each group of SDO servers executes segmented uploads on all
+ * buffers (interleaved segment by segment), while all SDO servers execute
+ * an expedited upload in between.
+ */
+static uint64_t BmRun(CO_NODE *node, uint32_t loops)
+{
+    uint64_t frames = 0;
+    uint32_t loop;
+    uint32_t grp;
+    uint32_t srv;
+    uint32_t seg;
+    uint8_t  tgl;
+
+    for (loop = 0; loop < loops; loop++) {
+        for (grp = 0; grp < BM_GROUP_N; grp++) {
+            for (srv = grp; srv < CO_SSDO_N; srv += BM_GROUP_N) {
+                BmRequest(node, srv, 0x40, 0x2000, (uint8_t)(1u + (srv / BM_GROUP_N)), 0x41, 0);
+            }
+            tgl = 0;
+            for (seg = 0; seg < BM_SEG_N; seg++) {
+                for (srv = grp; srv < CO_SSDO_N; srv += BM_GROUP_N) {
+                    BmRequest(node, srv, (uint8_t)(0x60 | tgl), 0, 0, tgl, 0);
+                }
+                tgl ^= 0x10;
+            }
+            for (srv = 0; srv < CO_SSDO_N; srv += BM_GROUP_N) {
+                BmRequest(node, srv + grp, 0x40, 0x2001, 0, 0x43, 0);
+            }
+            frames += (uint64_t)BM_DOM_N * (BM_SEG_N + 2u);
+        }
+    }
+    return (frames);
+}
+
+/******************************************************************************
+* BENCHMARK
+******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    uint32_t loops = BM_Count(argc, argv, 20000u);
+    uint64_t frames;
+    uint64_t start;
+    uint64_t ns;
+
+    BmSetup(&BmNode);
+
+    printf("SDO server pool: %u SDO server, %u transfer buffer, %u dispatch slots\n",
+        (unsigned)CO_SSDO_N, (unsigned)CO_SSDO_BUF_N, (unsigned)CO_DISP_SLOT_N);
+    printf("  transfer buffer memory: %u bytes (%u bytes with one buffer per server)\n",
+        (unsigned)(CO_SSDO_BUF_N * CO_SDO_BUF_BYTE), (unsigned)(CO_SSDO_N * CO_SDO_BUF_BYTE));
+
+    BmPool(&BmNode);
+
+    /* before: force the sequential fallback of the dispatcher */
+    (void)BmRun(&BmNode, 1);
+    BmNode.Disp.Overflow = 1;
+    start  = BM_Now();
+    frames = BmRun(&BmNode, loops);
+    ns     = BM_Now() - start;
+    BM_Report("sequential checks", frames, ns);
+
+    /* after: single lookup in the dispatch table */
+    BmNode.Disp.Overflow = 0;
+    start  = BM_Now();
+    frames = BmRun(&BmNode, loops);
+    ns     = BM_Now() - start;
+    BM_Report("dispatch table", frames, ns);
+
+    if ((BmNode.Disp.Overflow != 0u) || (BmNode.SdoPool.Num != CO_SSDO_BUF_N)) {
+        BmFail++;
+    }
+    if (BmFail != 0u) {
+        printf("  FAILED: %u unexpected SDO responses\n", (unsigned)BmFail);
+        return (1);
+    }
+    return (0);
+}
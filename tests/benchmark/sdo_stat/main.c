@@ -0,0 +1,341 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "bm_env.h"
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_DOM_SIZE   28u            /* domain size (4 segments)             */
+#define BM_STAT_N     CO_SDO_STAT_SUB_HIST
+#define BM_DICT_N     (2u + BM_STAT_N + 1u)
+#define BM_TMR_N      8u
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE       BmNode;
+static CO_IF_DRV     BmDrv;
+static CO_OBJ        BmDict[BM_DICT_N];
+static CO_TMR_MEM    BmTmrMem[BM_TMR_N];
+static uint8_t       BmSdoBuf[CO_SSDO_BUF_N * CO_SDO_BUF_BYTE];
+static CO_OBJ_DOM    BmDom;
+static uint8_t       BmDomData[BM_DOM_SIZE];
+static uint32_t      BmVal = 0x12345678;
+static CO_IF_FRM     BmTx;
+static uint32_t      BmTxNum;
+static uint8_t       BmTick;
+static uint32_t      BmFail;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* The transfer duration is taken from the monotonic clock of the host.
+ */
+uint32_t COSdoStatTime(CO_NODE *node)
+{
+    (void)node;
+    return ((uint32_t)(BM_Now() / 1000u));
+}
+
+/* The node sends the SDO responses into a single frame buffer. The
+ * benchmark acts as the SDO client and checks each response.
+ */
+static void BmCanInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmCanEnable(CO_IF *cif, uint32_t baudrate)
+{
+    (void)cif;
+    (void)baudrate;
+}
+
+static int16_t BmCanRead(CO_IF *cif, CO_IF_FRM *frm)
+{
+    (void)cif;
+    (void)frm;
+    return (0);
+}
+
+static int16_t BmCanSend(CO_IF *cif, CO_IF_FRM *frm)
+{
+    (void)cif;
+    BmTx = *frm;
+    BmTxNum++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static void BmCanReset(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmCanClose(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmTmrInit(CO_IF *cif, uint32_t freq)
+{
+    (void)cif;
+    (void)freq;
+}
+
+static void BmTmrReload(CO_IF *cif, uint32_t reload)
+{
+    (void)cif;
+    (void)reload;
+}
+
+static uint32_t BmTmrDelay(CO_IF *cif)
+{
+    (void)cif;
+    return (0);
+}
+
+static void BmTmrStop(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmTmrStart(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint8_t BmTmrUpdate(CO_IF *cif)
+{
+    uint8_t result = BmTick;
+
+    (void)cif;
+    BmTick = 0;
+    return (result);
+}
+
+static void BmNvmInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint32_t BmNvmRdWr(CO_IF *cif, uint32_t start, uint8_t *buf, uint32_t size)
+{
+    (void)cif;
+    (void)start;
+    (void)buf;
+    (void)size;
+    return (0);
+}
+
+static const CO_IF_CAN_DRV BmCan = {
+    BmCanInit, BmCanEnable, BmCanRead, BmCanSend, BmCanReset, BmCanClose, 0, 0
+};
+static const CO_IF_TIMER_DRV BmTmr = {
+    BmTmrInit, BmTmrReload, BmTmrDelay, BmTmrStop, BmTmrStart, BmTmrUpdate
+};
+static const CO_IF_NVM_DRV BmNvm = { BmNvmInit, BmNvmRdWr, BmNvmRdWr };
+
+/* Prepare a node with a domain 2000h:1, a value 2001h:0 and the counters
+ * of the statistics of SDO server #0 in 2F00h:1..10.
+ */
+static void BmSetup(CO_NODE *node)
+{
+    CO_NODE_SPEC spec;
+    uint32_t     i = 0;
+    uint32_t     n;
+
+    BmDom.Offset = 0;
+    BmDom.Size   = BM_DOM_SIZE;
+    BmDom.Start  = &BmDomData[0];
+    BmDict[i++] = (CO_OBJ){CO_KEY(0x2000, 1, CO_OBJ_____RW), CO_TDOMAIN, (CO_DATA)(&BmDom)};
+    BmDict[i++] = (CO_OBJ){CO_KEY(0x2001, 0, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&BmVal)};
+    BmDict[i++] = (CO_OBJ){CO_KEY(0x2F00, 0, CO_OBJ_D___R_), CO_TUNSIGNED8, (CO_DATA)(BM_STAT_N - 1u)};
+#if USE_SDO_STAT
+    for (n = 1; n < BM_STAT_N; n++) {
+        BmDict[i++] = (CO_OBJ){CO_KEY(0x2F00, n, CO_OBJ_____RW), CO_TSDO_STAT, (CO_DATA)(&node->Sdo[0].Stat)};
+    }
+#else
+    (void)n;
+#endif
+    while (i < BM_DICT_N) {
+        BmDict[i++] = (CO_OBJ)CO_OBJ_DICT_ENDMARK;
+    }
+
+    BmDrv.Can   = &BmCan;
+    BmDrv.Timer = &BmTmr;
+    BmDrv.Nvm   = &BmNvm;
+    BmDrv.Ctx   = NULL;
+
+    spec.NodeId   = 1;
+    spec.Baudrate = 250000;
+    spec.Dict     = &BmDict[0];
+    spec.DictLen  = BM_DICT_N;
+    spec.EmcyCode = NULL;
+    spec.TmrMem   = &BmTmrMem[0];
+    spec.TmrNum   = BM_TMR_N;
+    spec.TmrFreq  = 1000;
+    spec.Drv      = &BmDrv;
+    spec.SdoBuf   = &BmSdoBuf[0];
+    CONodeInit(node, &spec);
+
+    node->Sdo[0].RxId = 0x601;
+    node->Sdo[0].TxId = 0x581;
+    CO_DISP_INVALIDATE(node);
+}
+
+/* Send a single SDO request to the SDO server and check the response
+ * command byte. The response is returned in BmTx.
+ */
+static void BmRequest(CO_NODE *node, uint8_t cmd, uint16_t idx, uint8_t sub,
+                      uint32_t data, uint8_t rsp)
+{
+    CO_IF_FRM frm;
+
+    frm.Identifier = 0x601;
+    frm.DLC        = 8;
+    frm.Data[0]    = cmd;
+    frm.Data[1]    = (uint8_t)idx;
+    frm.Data[2]    = (uint8_t)(idx >> 8);
+    frm.Data[3]    = sub;
+    CO_SET_LONG(&frm, data, 4);
+
+    BmTxNum = 0;
+    (void)CODispProcess(&node->Disp, &frm, CO_SDO_ALLOWED);
+    if ((BmTxNum != 1u) || (BmTx.Data[0] != rsp)) {
+        BmFail++;
+    }
+}
+
+#if USE_SDO_STAT
+
+/* Compare the counter in the SDO statistics with the expected value.
+ */
+static void BmExpect(uint32_t val, uint32_t exp)
+{
+    if (val != exp) {
+        BmFail++;
+    }
+}
+
+/* Check the statistics of the SDO server: each transfer type is counted
+ * with its size, an abort with its code and a protocol timeout as abort
+ * and timeout. The statistics object reads the counters via SDO.
+ */
+static void BmCheck(CO_NODE *node)
+{
+    CO_SDO_STAT *stat = &node->Sdo[0].Stat;
+    uint32_t     n;
+
+    BmRequest(node, 0x40, 0x2001, 0, 0,          0x43);
+    BmRequest(node, 0x23, 0x2001, 0, 0x12345678, 0x60);
+    BmRequest(node, 0x40, 0x2000, 1, 0,          0x41);
+    for (n = 0; n < (BM_DOM_SIZE / 7u); n++) {
+        BmRequest(node, (uint8_t)(0x60 | ((n & 1u) << 4)), 0, 0, 0,
+            (uint8_t)(((n & 1u) << 4) | ((n == 3u) ? 0x01 : 0x00)));
+    }
+    BmRequest(node, 0x21, 0x2000, 1, BM_DOM_SIZE, 0x60);
+    for (n = 0; n < (BM_DOM_SIZE / 7u); n++) {
+        BmRequest(node, (uint8_t)(((n & 1u) << 4) | ((n == 3u) ? 0x01 : 0x00)), 0, 0, 0,
+            (uint8_t)(0x20 | ((n & 1u) << 4)));
+    }
+    BmRequest(node, 0x40, 0x5000, 0, 0, 0x80);
+
+    BmExpect(stat->Num[CO_SDO_STAT_EXP_UP],   1);
+    BmExpect(stat->Num[CO_SDO_STAT_EXP_DOWN], 1);
+    BmExpect(stat->Num[CO_SDO_STAT_SEG_UP],   1);
+    BmExpect(stat->Num[CO_SDO_STAT_SEG_DOWN], 1);
+    BmExpect(stat->Bytes, 4u + 4u + (2u * BM_DOM_SIZE));
+    BmExpect(stat->Abort, 1);
+    BmExpect(stat->Code[0].Code, CO_SDO_ERR_OBJ);
+
+    /* protocol timeout of a segmented upload */
+    BmRequest(node, 0x40, 0x2000, 1, 0, 0x41);
+    for (n = 0; (n <= CO_SSDO_TMO) && (node->Sdo[0].Tmr >= 0); n++) {
+        BmTick = 1;
+        (void)COTmrService(&node->Tmr);
+        COTmrProcess(&node->Tmr);
+    }
+    BmExpect(stat->Abort,   2);
+    BmExpect(stat->Timeout, 1);
+    BmExpect(stat->Num[CO_SDO_STAT_SEG_UP], 1);
+
+    /* read and clear the counters via the statistics object */
+    BmRequest(node, 0x40, 0x2F00, CO_SDO_STAT_SUB_BYTES, 0, 0x43);
+    BmExpect(CO_GET_LONG(&BmTx, 4), 4u + 4u + (2u * BM_DOM_SIZE));
+    BmRequest(node, 0x40, 0x2F00, CO_SDO_STAT_SUB_TMO, 0, 0x43);
+    BmExpect(CO_GET_LONG(&BmTx, 4), 1);
+    BmRequest(node, 0x23, 0x2F00, CO_SDO_STAT_SUB_ABORT, 0, 0x60);
+    BmExpect(stat->Abort, 0);
+    BmExpect(stat->Num[CO_SDO_STAT_EXP_UP], 0);
+    BmExpect(stat->Num[CO_SDO_STAT_EXP_DOWN], 1);
+}
+
+#endif
+
+/******************************************************************************
+* BENCHMARK
+******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    uint32_t loops = BM_Count(argc, argv, 1000000u);
+    uint32_t loop;
+    uint64_t start;
+    uint64_t ns;
+
+    BmSetup(&BmNode);
+
+    printf("SDO statistics: %s\n", (USE_SDO_STAT != 0) ? "enabled" : "disabled");
+
+#if USE_SDO_STAT
+    BmCheck(&BmNode);
+    COSdoStatClear(&BmNode.Sdo[0].Stat);
+#endif
+
+    start = BM_Now();
+    for (loop = 0; loop < loops; loop++) {
+        BmRequest(&BmNode, 0x40, 0x2001, 0, 0, 0x43);
+    }
+    ns = BM_Now() - start;
+    BM_Report("expedited upload", loops, ns);
+
+#if USE_SDO_STAT
+    for (loop = 0; loop < CO_SDO_STAT_HIST_N; loop++) {
+        if (BmNode.Sdo[0].Stat.Hist[loop] != 0u) {
+            printf("  below %6u us: %u\n", (unsigned)COSdoStatLimit((uint8_t)loop),
+                (unsigned)BmNode.Sdo[0].Stat.Hist[loop]);
+        }
+    }
+    if (BmNode.Sdo[0].Stat.Num[CO_SDO_STAT_EXP_UP] != loops) {
+        BmFail++;
+    }
+#endif
+
+    if (BmFail != 0u) {
+        printf("  FAILED: %u unexpected SDO responses or counters\n", (unsigned)BmFail);
+        return (1);
+    }
+    return (0);
+}
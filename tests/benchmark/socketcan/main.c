@@ -0,0 +1,169 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "bm_env.h"
+#include "co_core.h"
+#include "drv_can_socketcan.h"
+
+#include <poll.h>
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_CHUNK      SOCKET_CAN_BATCH_N  /* frames in flight per round      */
+#define BM_WAIT_MS    100                 /* receive timeout in ms           */
+#define BM_SKIP       77                  /* exit code of a skipped test     */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static SOCKET_CAN BmTxCan;
+static SOCKET_CAN BmRxCan;
+static CO_IF_DRV  BmTxDrv = { &SocketCanDriver, 0, 0, &BmTxCan };
+static CO_IF_DRV  BmRxDrv = { &SocketCanDriver, 0, 0, &BmRxCan };
+static CO_IF      BmTx;
+static CO_IF      BmRx;
+static CO_IF_FRM  BmFrm[BM_CHUNK];
+static uint32_t   BmLost;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static int BmOpen(CO_IF *cif, CO_IF_DRV *drv, SOCKET_CAN *can, const char *name)
+{
+    can->Name = name;
+    can->Fd   = -1;
+    cif->Drv  = drv;
+    SocketCanDriver.Init(cif);
+    SocketCanDriver.Enable(cif, 250000u);
+    return (can->Fd);
+}
+
+static uint8_t BmWait(void)
+{
+    struct pollfd pfd;
+
+    pfd.fd     = BmRxCan.Fd;
+    pfd.events = POLLIN;
+    return ((poll(&pfd, 1, BM_WAIT_MS) > 0) ? 1u : 0u);
+}
+
+/* Send a chunk of frames one by one and receive them one by one on the
+ * second socket of the same interface.
+ */
+static uint64_t BmRunSingle(uint32_t loops)
+{
+    CO_IF_FRM frm;
+    uint64_t  start;
+    uint32_t  loop;
+    uint32_t  num;
+    uint32_t  n;
+
+    start = BM_Now();
+    for (loop = 0; loop < loops; loop++) {
+        for (n = 0; n < BM_CHUNK; n++) {
+            (void)SocketCanDriver.Send(&BmTx, &BmFrm[n]);
+        }
+        num = 0;
+        while (num < BM_CHUNK) {
+            if (SocketCanDriver.Read(&BmRx, &frm) > 0) {
+                num++;
+            } else if (BmWait() == 0u) {
+                BmLost += BM_CHUNK - num;
+                break;
+            }
+        }
+    }
+    return (BM_Now() - start);
+}
+
+/* Send and receive the same chunks with one system call per direction. */
+static uint64_t BmRunBatch(uint32_t loops)
+{
+    CO_IF_FRM frm[BM_CHUNK];
+    uint64_t  start;
+    uint32_t  loop;
+    uint32_t  num;
+    int16_t   err;
+
+    start = BM_Now();
+    for (loop = 0; loop < loops; loop++) {
+        (void)SocketCanDriver.SendBatch(&BmTx, &BmFrm[0], BM_CHUNK);
+        num = 0;
+        while (num < BM_CHUNK) {
+            err = SocketCanDriver.ReadBatch(&BmRx, &frm[0], (uint16_t)(BM_CHUNK - num));
+            if (err > 0) {
+                num += (uint32_t)err;
+            } else if (BmWait() == 0u) {
+                BmLost += BM_CHUNK - num;
+                break;
+            }
+        }
+    }
+    return (BM_Now() - start);
+}
+
+/******************************************************************************
+* BENCHMARK
+******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    const char *name  = "vcan0";
+    uint32_t    loops = BM_Count(argc, argv, 2000u);
+    uint64_t    ops;
+    uint64_t    ns;
+    uint32_t    n;
+
+    if (argc > 2) {
+        name = argv[2];
+    }
+    if ((BmOpen(&BmTx, &BmTxDrv, &BmTxCan, name) < 0) ||
+        (BmOpen(&BmRx, &BmRxDrv, &BmRxCan, name) < 0)) {
+        printf("SocketCAN: interface %s not available, skipped\n", name);
+        return (BM_SKIP);
+    }
+    for (n = 0; n < BM_CHUNK; n++) {
+        BmFrm[n].Identifier = 0x181 + n;
+        BmFrm[n].DLC        = 8;
+        BmFrm[n].Data[0]    = (uint8_t)n;
+    }
+    ops = (uint64_t)loops * BM_CHUNK;
+
+    printf("SocketCAN: %u frames over %s\n", (unsigned)ops, name);
+
+    ns = BmRunSingle(loops);
+    BM_Report("send/read single frames", ops, ns);
+
+    ns = BmRunBatch(loops);
+    BM_Report("send/read batched frames", ops, ns);
+
+    SocketCanDriver.Close(&BmTx);
+    SocketCanDriver.Close(&BmRx);
+
+    if (BmLost > 0) {
+        printf("lost frames: %u, kernel drops: %u\n", BmLost, BmRxCan.Drops);
+        return (1);
+    }
+    return (0);
+}
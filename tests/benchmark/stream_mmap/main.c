@@ -0,0 +1,416 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "bm_env.h"
+#include "drv_stream_mmap.h"
+
+#include <unistd.h>
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_TMR_N      8u             /* number of timer actions in the pool  */
+#define BM_DICT_N     6u             /* number of object entries             */
+#define BM_FRM_N      (CO_SDO_BUF_SEG + 1u)
+#define BM_PATH       "/tmp/bm-stream-mmap-dn.bin"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE       BmNode;
+static CO_IF_DRV     BmDrv;
+static CO_OBJ        BmDict[BM_DICT_N];
+static CO_TMR_MEM    BmTmrMem[BM_TMR_N];
+static uint8_t       BmSdoBuf[CO_SSDO_N * CO_SDO_BUF_BYTE];
+static CO_OBJ_STREAM BmStream;
+static STREAM_MMAP   BmMap;
+static CO_IF_FRM     BmTx[BM_FRM_N];
+static uint32_t      BmTxNum;
+static uint32_t      BmFail;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* The node sends the SDO responses (and the block upload segments) into a
+ * frame buffer. The benchmark acts as the SDO client and checks them.
+ */
+static void BmCanInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmCanEnable(CO_IF *cif, uint32_t baudrate)
+{
+    (void)cif;
+    (void)baudrate;
+}
+
+static int16_t BmCanRead(CO_IF *cif, CO_IF_FRM *frm)
+{
+    (void)cif;
+    (void)frm;
+    return (0);
+}
+
+static int16_t BmCanSend(CO_IF *cif, CO_IF_FRM *frm)
+{
+    (void)cif;
+    if (BmTxNum < BM_FRM_N) {
+        BmTx[BmTxNum] = *frm;
+    }
+    BmTxNum++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static void BmCanReset(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmCanClose(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmTmrInit(CO_IF *cif, uint32_t freq)
+{
+    (void)cif;
+    (void)freq;
+}
+
+static void BmTmrReload(CO_IF *cif, uint32_t reload)
+{
+    (void)cif;
+    (void)reload;
+}
+
+static uint32_t BmTmrDelay(CO_IF *cif)
+{
+    (void)cif;
+    return (0);
+}
+
+static void BmTmrStop(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void BmTmrStart(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint8_t BmTmrUpdate(CO_IF *cif)
+{
+    (void)cif;
+    return (0);
+}
+
+static void BmNvmInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint32_t BmNvmRdWr(CO_IF *cif, uint32_t start, uint8_t *buf, uint32_t size)
+{
+    (void)cif;
+    (void)start;
+    (void)buf;
+    (void)size;
+    return (0);
+}
+
+static const CO_IF_CAN_DRV BmCan = {
+    BmCanInit, BmCanEnable, BmCanRead, BmCanSend, BmCanReset, BmCanClose, 0, 0
+};
+static const CO_IF_TIMER_DRV BmTmr = {
+    BmTmrInit, BmTmrReload, BmTmrDelay, BmTmrStop, BmTmrStart, BmTmrUpdate
+};
+static const CO_IF_NVM_DRV BmNvm = { BmNvmInit, BmNvmRdWr, BmNvmRdWr };
+
+/* The image content is a function of the byte offset, so the client side
+ * needs no copy of the image, too.
+ */
+static uint8_t BmPattern(uint32_t offset)
+{
+    return ((uint8_t)((offset * 31u) ^ (offset >> 9)));
+}
+
+/* Prepare a node with the stream object 2100h:0 (the memory mapped file)
+ * and the SDO server (request 601h, response 581h).
+ */
+static void BmSetup(CO_NODE *node)
+{
+    CO_NODE_SPEC spec;
+    uint32_t     i = 0;
+
+    BmDict[i++] = (CO_OBJ){CO_KEY(0x1000, 0, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(0)};
+    BmDict[i++] = (CO_OBJ){CO_KEY(0x1001, 0, CO_OBJ_____R_), CO_TUNSIGNED8 , (CO_DATA)(0)};
+    BmDict[i++] = (CO_OBJ){CO_KEY(0x1018, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(4)};
+    BmDict[i++] = (CO_OBJ){CO_KEY(0x2100, 0, CO_OBJ_____RW), CO_TSTREAM    , (CO_DATA)(&BmStream)};
+    while (i < BM_DICT_N) {
+        BmDict[i++] = (CO_OBJ)CO_OBJ_DICT_ENDMARK;
+    }
+
+    BmDrv.Can   = &BmCan;
+    BmDrv.Timer = &BmTmr;
+    BmDrv.Nvm   = &BmNvm;
+    BmDrv.Ctx   = NULL;
+
+    spec.NodeId   = 1;
+    spec.Baudrate = 250000;
+    spec.Dict     = &BmDict[0];
+    spec.DictLen  = BM_DICT_N;
+    spec.EmcyCode = NULL;
+    spec.TmrMem   = &BmTmrMem[0];
+    spec.TmrNum   = BM_TMR_N;
+    spec.TmrFreq  = 1000;
+    spec.Drv      = &BmDrv;
+    spec.SdoBuf   = &BmSdoBuf[0];
+    CONodeInit(node, &spec);
+
+    node->Sdo[0].RxId = 0x601;
+    node->Sdo[0].TxId = 0x581;
+    CO_DISP_INVALIDATE(node);
+}
+
+/* Send a single SDO request frame and return the number of frames, which
+ * are sent by the SDO server.
+ */
+static uint32_t BmRequest(CO_NODE *node, CO_IF_FRM *frm)
+{
+    frm->Identifier = 0x601;
+    frm->DLC        = 8;
+    BmTxNum         = 0;
+    (void)CODispProcess(&node->Disp, frm, CO_SDO_ALLOWED);
+    return (BmTxNum);
+}
+
+/* Check a single response of the SDO server with the expected command
+ * byte.
+ */
+static void BmCheck(uint32_t num, uint8_t cmd, uint8_t mask)
+{
+    if ((num != 1u) || ((BmTx[0].Data[0] & mask) != cmd)) {
+        BmFail++;
+    }
+}
+
+/* Block download of the image into the stream object (blocks with the
+ * block size of the SDO server, CRC supported).
+ */
+static void BmDownload(CO_NODE *node, uint32_t size)
+{
+    CO_IF_FRM frm = { 0 };
+    uint32_t  offset = 0;
+    uint32_t  num;
+    uint16_t  crc = 0;
+    uint8_t   blksize;
+    uint8_t   seq;
+    uint8_t   n;
+
+    frm.Data[0] = 0xC6;
+    CO_SET_WORD(&frm, 0x2100, 1);
+    CO_SET_BYTE(&frm, 0, 3);
+    CO_SET_LONG(&frm, size, 4);
+    num = BmRequest(node, &frm);
+    BmCheck(num, 0xA0, 0xFB);
+    blksize = BmTx[0].Data[4];
+
+    while ((offset < size) && (BmFail == 0u)) {
+        seq = 0;
+        num = 0;
+        while ((seq < blksize) && (offset < size)) {
+            seq++;
+            for (n = 0; n < 7u; n++) {
+                frm.Data[1u + n] = BmPattern(offset + n);
+            }
+            frm.Data[0] = seq;
+            if ((size - offset) <= 7u) {
+                frm.Data[0] |= 0x80;
+                n = (uint8_t)(size - offset);
+            }
+            crc     = COSdoCrc(crc, &frm.Data[1], n);
+            offset += n;
+            num     = BmRequest(node, &frm);
+        }
+        BmCheck(num, 0xA2, 0xFF);
+        if (BmTx[0].Data[1] != seq) {
+            BmFail++;
+        }
+        blksize = BmTx[0].Data[2];
+    }
+
+    frm.Data[0] = (uint8_t)(0xC1 | ((7u - n) << 2));
+    CO_SET_WORD(&frm, crc, 1);
+    CO_SET_BYTE(&frm, 0, 3);
+    CO_SET_LONG(&frm, 0, 4);
+    num = BmRequest(node, &frm);
+    BmCheck(num, 0xA1, 0xFF);
+}
+
+/* Block upload of the stream object and compare with the image content
+ * (blocks of 127 segments, CRC supported).
+ */
+static void BmUpload(CO_NODE *node, uint32_t size)
+{
+    CO_IF_FRM frm = { 0 };
+    uint32_t  offset = 0;
+    uint32_t  num;
+    uint32_t  i;
+    uint16_t  crc = 0;
+    uint8_t   last = 0;
+    uint8_t   n;
+
+    frm.Data[0] = 0xA4;
+    CO_SET_WORD(&frm, 0x2100, 1);
+    CO_SET_BYTE(&frm, 0, 3);
+    CO_SET_BYTE(&frm, CO_SDO_BUF_SEG, 4);
+    num = BmRequest(node, &frm);
+    BmCheck(num, 0xC2, 0xFB);
+    if (CO_GET_LONG(&BmTx[0], 4) != size) {
+        BmFail++;
+    }
+
+    frm.Data[0] = 0xA3;
+    CO_SET_LONG(&frm, 0, 4);
+    num = BmRequest(node, &frm);
+    while ((last == 0u) && (BmFail == 0u)) {
+        if ((num < 1u) || (num > BM_FRM_N)) {
+            BmFail++;
+            break;
+        }
+        for (i = 0; i < num; i++) {
+            if ((BmTx[i].Data[0] & 0x7F) != (i + 1u)) {
+                BmFail++;
+            }
+            last = (uint8_t)(BmTx[i].Data[0] & 0x80);
+            for (n = 0; (n < 7u) && (offset < size); n++) {
+                if (BmTx[i].Data[1u + n] != BmPattern(offset)) {
+                    BmFail++;
+                }
+                crc = COSdoCrc(crc, &BmTx[i].Data[1u + n], 1);
+                offset++;
+            }
+        }
+        frm.Data[0] = 0xA2;
+        frm.Data[1] = (uint8_t)num;
+        frm.Data[2] = CO_SDO_BUF_SEG;
+        num = BmRequest(node, &frm);
+    }
+
+    BmCheck(num, 0xC1, 0xE3);
+    if ((offset != size) || (CO_GET_WORD(&BmTx[0], 1) != crc)) {
+        BmFail++;
+    }
+    frm.Data[0] = 0xA1;
+    CO_SET_WORD(&frm, 0, 1);
+    num = BmRequest(node, &frm);
+    if (num != 0u) {
+        BmFail++;
+    }
+}
+
+/* Compare the file content with the image content.
+ */
+static void BmVerify(const char *path, uint32_t size)
+{
+    CO_OBJ_STREAM stream = { 0 };
+    STREAM_MMAP   map;
+    uint8_t       buf[256];
+    uint32_t      offset;
+    uint32_t      i;
+
+    if (StreamMmapOpen(&stream, &map, path, 0) < 0) {
+        BmFail++;
+        return;
+    }
+    if (stream.Size != size) {
+        BmFail++;
+    }
+    for (offset = 0; (offset < stream.Size) && (BmFail == 0u); offset += sizeof(buf)) {
+        (void)stream.Read(&stream, offset, &buf[0], sizeof(buf));
+        for (i = 0; i < sizeof(buf); i++) {
+            if (buf[i] != BmPattern(offset + i)) {
+                BmFail++;
+            }
+        }
+    }
+    StreamMmapClose(&stream);
+}
+
+/******************************************************************************
+* BENCHMARK
+******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    uint32_t kib  = BM_Count(argc, argv, 16384u);
+    uint32_t size = kib * 1024u;
+    uint64_t frames;
+    uint64_t start;
+    uint64_t ns;
+
+    printf("SDO block transfer of %u KiB into a memory mapped stream object\n",
+        (unsigned)kib);
+    printf("  RAM per transfer: %u bytes (%u bytes with a domain copy of the image)\n",
+        (unsigned)CO_SDO_BUF_BYTE, (unsigned)(size + CO_SDO_BUF_BYTE));
+
+    BmSetup(&BmNode);
+    frames = ((uint64_t)size + 6u) / 7u;
+
+    /* download into a new file */
+    if (StreamMmapOpen(&BmStream, &BmMap, BM_PATH, size) < 0) {
+        printf("  FAILED: can't map file '%s'\n", BM_PATH);
+        return (1);
+    }
+    start = BM_Now();
+    BmDownload(&BmNode, size);
+    (void)StreamMmapSync(&BmStream);
+    ns    = BM_Now() - start;
+    BM_Report("block download (segment)", frames, ns);
+    printf("  block download: %.1f MiB/s\n",
+        ((double)size / (1024.0 * 1024.0)) / ((double)ns / 1e9));
+    StreamMmapClose(&BmStream);
+    BmVerify(BM_PATH, size);
+
+    /* upload from the existing file */
+    if (StreamMmapOpen(&BmStream, &BmMap, BM_PATH, 0) < 0) {
+        BmFail++;
+    } else {
+        start = BM_Now();
+        BmUpload(&BmNode, size);
+        ns    = BM_Now() - start;
+        BM_Report("block upload (segment)", frames, ns);
+        printf("  block upload: %.1f MiB/s\n",
+            ((double)size / (1024.0 * 1024.0)) / ((double)ns / 1e9));
+        StreamMmapClose(&BmStream);
+    }
+    (void)unlink(BM_PATH);
+
+    if (BmFail != 0u) {
+        printf("  FAILED: %u unexpected SDO responses or file bytes\n", (unsigned)BmFail);
+        return (1);
+    }
+    return (0);
+}
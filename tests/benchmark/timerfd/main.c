@@ -0,0 +1,109 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "bm_env.h"
+#include "drv_linux_io.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_TMR_N      16u            /* number of timer actions in the pool  */
+#define BM_FREQ       1000u          /* timer frequency in Hz                */
+#define BM_CYCLE      1u             /* cycle time of the action in ticks    */
+#define BM_CPU_MAX    50u            /* maximal accepted CPU load in %       */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE    BmNode;
+static CO_TMR_MEM BmMem[BM_TMR_N];
+static LINUX_IO   BmIo;
+static CO_IF_DRV  BmDrv = { 0, &TimerFdDriver, 0, &BmIo };
+static uint32_t   BmCalls;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint64_t BmCpu(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000u + (uint64_t)ts.tv_nsec);
+}
+
+static void BmFunc(void *parg)
+{
+    (void)parg;
+    BmCalls++;
+}
+
+/******************************************************************************
+* BENCHMARK
+******************************************************************************/
+
+/* Run a cyclic 1ms timer action with the timerfd driver and the epoll
+ * helper. The process sleeps between the timer events, so the CPU load
+ * must be small, while no timer event is lost.
+ */
+int main(int argc, char *argv[])
+{
+    uint32_t ms = BM_Count(argc, argv, 1000u);
+    uint64_t start;
+    uint64_t cpu;
+    uint64_t wall;
+    uint32_t expect;
+    uint32_t load;
+
+    BmIo.Can.Fd   = -1;
+    BmIo.Timer.Fd = -1;
+    BmNode.If.Drv  = &BmDrv;
+    BmNode.If.Node = &BmNode;
+    TimerFdDriver.Init(&BmNode.If, BM_FREQ);
+    COTmrInit(&BmNode.Tmr, &BmNode, BmMem, BM_TMR_N, BM_FREQ);
+    if ((BmIo.Timer.Fd < 0) || (LinuxIoOpen(&BmIo) < 0)) {
+        printf("timerfd: not available\n");
+        return (1);
+    }
+    (void)COTmrCreate(&BmNode.Tmr, BM_CYCLE, BM_CYCLE, BmFunc, NULL);
+
+    start = BM_Now();
+    cpu   = BmCpu();
+    while ((BM_Now() - start) < (uint64_t)ms * 1000000u) {
+        (void)LinuxIoProcess(&BmNode, -1);
+    }
+    cpu  = BmCpu() - cpu;
+    wall = BM_Now() - start;
+    LinuxIoClose(&BmIo);
+
+    expect = (uint32_t)(wall / (1000000000u / BM_FREQ) / BM_CYCLE);
+    load   = (uint32_t)(cpu * 100u / wall);
+    printf("timerfd: %u of %u timer events in %u ms, CPU load %u%%\n",
+        BmCalls, expect, (unsigned)(wall / 1000000u), load);
+    BM_Report("timer event", BmCalls, wall);
+
+    if ((BmCalls * 100u < expect * 95u) || (BmCalls > expect + 2u) || (load > BM_CPU_MAX)) {
+        return (1);
+    }
+    return (0);
+}
@@ -0,0 +1,131 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "bm_env.h"
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define BM_TMR_N     1024u           /* number of timer actions in the pool  */
+#define BM_PEND_N    768u            /* number of pending timer actions      */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_NODE    BmNode;
+static CO_TMR_MEM BmMem[BM_TMR_N];
+static int16_t    BmId[BM_PEND_N];
+static uint32_t   BmCounter;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void     BmTmrInit  (CO_IF *cif, uint32_t freq) { (void)cif; (void)freq; BmCounter = 0; }
+static void     BmTmrReload(CO_IF *cif, uint32_t reload) { (void)cif; BmCounter = reload; }
+static uint32_t BmTmrDelay (CO_IF *cif) { (void)cif; return (BmCounter); }
+static void     BmTmrStop  (CO_IF *cif) { (void)cif; BmCounter = 0; }
+static void     BmTmrStart (CO_IF *cif) { (void)cif; }
+static uint8_t  BmTmrUpdate(CO_IF *cif)
+{
+    uint8_t result = 0;
+
+    (void)cif;
+    if (BmCounter > 0) {
+        BmCounter--;
+        if (BmCounter == 0) {
+            result = 1;
+        }
+    }
+    return (result);
+}
+
+static const CO_IF_TIMER_DRV BmTimer = {
+    BmTmrInit, BmTmrReload, BmTmrDelay, BmTmrStop, BmTmrStart, BmTmrUpdate
+};
+static CO_IF_DRV BmDrv = { 0 };
+
+static void BmFunc(void *parg)
+{
+    (void)parg;
+}
+
+/* Prepare a timer management with pending actions of different delays,
+ * similar to the event timers of many TPDOs and heartbeat consumers.
+ */
+static void BmSetup(CO_NODE *node)
+{
+    uint32_t n;
+
+    BmDrv.Timer   = &BmTimer;
+    node->If.Drv  = &BmDrv;
+    node->If.Node = node;
+    COTmrInit(&node->Tmr, node, BmMem, BM_TMR_N, 1000000u);
+    for (n = 0; n < BM_PEND_N; n++) {
+        BmId[n] = COTmrCreate(&node->Tmr, 1000u + n * 97u, 0, BmFunc, NULL);
+    }
+}
+
+/* Restart the timers one after another, like a TPDO restarts its event
+ * timer with each transmission, while the time is running.
+ */
+static uint64_t BmRun(CO_NODE *node, uint32_t loops)
+{
+    uint64_t start;
+    uint32_t loop;
+    uint32_t n;
+
+    start = BM_Now();
+    for (loop = 0; loop < loops; loop++) {
+        for (n = 0; n < BM_PEND_N; n++) {
+            (void)COTmrDelete(&node->Tmr, BmId[n]);
+            BmId[n] = COTmrCreate(&node->Tmr, 1000u + n * 97u, 0, BmFunc, NULL);
+        }
+        if (COTmrService(&node->Tmr) > 0) {
+            COTmrProcess(&node->Tmr);
+        }
+    }
+    return (BM_Now() - start);
+}
+
+/******************************************************************************
+* BENCHMARK
+******************************************************************************/
+
+int main(int argc, char *argv[])
+{
+    uint32_t loops = BM_Count(argc, argv, 2000u);
+    uint64_t ops;
+    uint64_t ns;
+
+    BmSetup(&BmNode);
+    ops = (uint64_t)loops * BM_PEND_N;
+
+    printf("Timer restart: %u pending timers (%s)\n",
+        (unsigned)BM_PEND_N, (USE_TMR_WHEEL != 0) ? "timing wheel" : "delta list");
+
+    ns = BmRun(&BmNode, loops);
+    BM_Report("delete and create", ops, ns);
+
+    return (0);
+}
@@ -78,7 +78,8 @@ static uint16_t TS_Obj1017_0;
 static CO_IF_DRV TS_Driver = {
     &SimCanDriver,
     &SwCycleTimerDriver,
-    &SimNvmDriver
+    &SimNvmDriver,
+    NULL
 };
 
 /******************************************************************************
@@ -41,15 +41,19 @@ void TS_CallbackInit(TS_CALLBACK *cb)
 
     cb->NodeFatalError_Called = 0;
 
+    cb->TmrLock_ArgTmr = 0;
     cb->TmrLock_Called = 0;
     cb->TmrUnlock_Called = 0;
 
+    cb->IfCanReceive_ArgIf = 0;
     cb->IfCanReceive_ArgFrm = 0;
     cb->IfCanReceive_Called = 0;
 
+    cb->PdoTransmit_ArgPdo = 0;
     cb->PdoTransmit_ArgFrm = 0;
     cb->PdoTransmit_Called = 0;
 
+    cb->PdoReceive_ArgPdo = 0;
     cb->PdoReceive_ArgFrm = 0;
     cb->PdoReceive_Called = 0;
     cb->PdoReceive_Return = 0;
@@ -71,16 +75,23 @@ void TS_CallbackInit(TS_CALLBACK *cb)
     cb->NmtHbConsChange_ArgState = CO_INVALID;
     cb->NmtHbConsChange_Called = 0;
 
+    cb->LssStore_ArgNode = 0;
     cb->LssStore_ArgBaudrate = 0;
     cb->LssStore_ArgNodeId = 0;
     cb->LssStore_Called = 0;
     cb->LssStore_Return = CO_ERR_NONE;
 
+    cb->LssLoad_ArgNode = 0;
     cb->LssLoad_ArgBaudrate = 0;
     cb->LssLoad_ArgNodeId = 0;
     cb->LssLoad_Called = 0;
     cb->LssLoad_Return = CO_ERR_NONE;
 
+    cb->ParaDefault_ArgParaGrp = 0;
+    cb->ParaDefault_ArgNode = 0;
+    cb->ParaDefault_Called = 0;
+    cb->ParaDefault_Return = 0;
+
     cb->PdoSyncUpdate_ArgPdo = 0;
     cb->PdoSyncUpdate_Called = 0;
 
@@ -90,12 +101,14 @@ void TS_CallbackInit(TS_CALLBACK *cb)
     cb->AppCSdoCallback_ArgCode = 0;
     cb->AppCSdoCallback_Called = 0;
 
+    cb->CORpdoWriteData_ArgPdo = 0;
     cb->CORpdoWriteData_ArgFrm = 0;
     cb->CORpdoWriteData_ArgPos = 0;
     cb->CORpdoWriteData_ArgSize = 0;
     cb->CORpdoWriteData_ArgObj = 0;
     cb->CORpdoWriteData_Called = 0;
 
+    cb->COTpdoReadData_ArgPdo = 0;
     cb->COTpdoReadData_ArgFrm = 0;
     cb->COTpdoReadData_ArgPos = 0;
     cb->COTpdoReadData_ArgSize = 0;
@@ -122,41 +135,45 @@ void CONodeFatalError(void)
     }
 }
 
-void COTmrLock(void)
+void COTmrLock(CO_TMR *tmr)
 {
     if (TsCallbacks != 0) {
+        TsCallbacks->TmrLock_ArgTmr = tmr;
         TsCallbacks->TmrLock_Called++;
     }
 }
 
-void COTmrUnlock(void)
+void COTmrUnlock(CO_TMR *tmr)
 {
     if (TsCallbacks != 0) {
         TsCallbacks->TmrUnlock_Called++;
     }
 }
 
-void COIfCanReceive(CO_IF_FRM *frm)
+void COIfCanReceive(CO_IF *cif, CO_IF_FRM *frm)
 {
     if (TsCallbacks != 0) {
+        TsCallbacks->IfCanReceive_ArgIf  = cif;
         TsCallbacks->IfCanReceive_ArgFrm = frm;
         TsCallbacks->IfCanReceive_Called++;
     }
 }
 
-void COPdoTransmit(CO_IF_FRM *frm)
+void COPdoTransmit(CO_TPDO *pdo, CO_IF_FRM *frm)
 {
     if (TsCallbacks != 0) {
+        TsCallbacks->PdoTransmit_ArgPdo = pdo;
         TsCallbacks->PdoTransmit_ArgFrm = frm;
         TsCallbacks->PdoTransmit_Called++;
     }
 }
 
-int16_t COPdoReceive(CO_IF_FRM *frm)
+int16_t COPdoReceive(CO_RPDO *pdo, CO_IF_FRM *frm)
 {
     int16_t result = CO_ERR_NONE;
 
     if (TsCallbacks != 0) {
+        TsCallbacks->PdoReceive_ArgPdo = pdo;
         TsCallbacks->PdoReceive_ArgFrm = frm;
         TsCallbacks->PdoReceive_Called++;
         result = TsCallbacks->PdoReceive_Return;
@@ -202,7 +219,7 @@ void CONmtHbConsChange(CO_NMT *nmt, uint8_t nodeId, CO_MODE state)
     }
 }
 
-CO_ERR COLssStore(uint32_t baudrate, uint8_t nodeId)
+CO_ERR COLssStore(CO_NODE *node, uint32_t baudrate, uint8_t nodeId)
 {
     CO_ERR result = CO_ERR_NONE;
 
@@ -210,6 +227,7 @@ CO_ERR COLssStore(uint32_t baudrate, uint8_t nodeId)
     RamStorage_NodeId   = nodeId;
 
     if (TsCallbacks != 0) {
+        TsCallbacks->LssStore_ArgNode     = node;
         TsCallbacks->LssStore_ArgBaudrate = baudrate;
         TsCallbacks->LssStore_ArgNodeId   = nodeId;
         TsCallbacks->LssStore_Called++;
@@ -219,7 +237,7 @@ CO_ERR COLssStore(uint32_t baudrate, uint8_t nodeId)
     return (result);
 }
 
-CO_ERR COLssLoad(uint32_t *baudrate, uint8_t *nodeId)
+CO_ERR COLssLoad(CO_NODE *node, uint32_t *baudrate, uint8_t *nodeId)
 {
     CO_ERR result = CO_ERR_NONE;
 
@@ -231,6 +249,7 @@ CO_ERR COLssLoad(uint32_t *baudrate, uint8_t *nodeId)
     }
 
     if (TsCallbacks != 0) {
+        TsCallbacks->LssLoad_ArgNode     = node;
         TsCallbacks->LssLoad_ArgBaudrate = baudrate;
         TsCallbacks->LssLoad_ArgNodeId   = nodeId;
         TsCallbacks->LssLoad_Called++;
@@ -239,12 +258,13 @@ CO_ERR COLssLoad(uint32_t *baudrate, uint8_t *nodeId)
     return (result);
 }
 
-int16_t COParaDefault(CO_PARA *pg)
+int16_t COParaDefault(CO_PARA *pg, CO_NODE *node)
 {
     int16_t result = CO_ERR_NONE;
 
     if (TsCallbacks != 0) {
         TsCallbacks->ParaDefault_ArgParaGrp = pg;
+        TsCallbacks->ParaDefault_ArgNode    = node;
         TsCallbacks->ParaDefault_Called++;
         result = TsCallbacks->ParaDefault_Return;
     }
@@ -271,9 +291,10 @@ void TS_AppCSdoCallback(CO_CSDO *csdo, uint16_t index, uint8_t sub, uint32_t cod
     }
 }
 
-void CORpdoWriteData(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
+void CORpdoWriteData(CO_RPDO *pdo, CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
 {
     if (TsCallbacks != 0) {
+        TsCallbacks->CORpdoWriteData_ArgPdo = pdo;
         TsCallbacks->CORpdoWriteData_ArgFrm = frm;
         TsCallbacks->CORpdoWriteData_ArgPos = pos;
         TsCallbacks->CORpdoWriteData_ArgSize = size;
@@ -282,9 +303,10 @@ void CORpdoWriteData(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
     }
 }
 
-void COTpdoReadData(CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
+void COTpdoReadData(CO_TPDO *pdo, CO_IF_FRM *frm, uint8_t pos, uint8_t size, CO_OBJ *obj)
 {
     if (TsCallbacks != 0) {
+        TsCallbacks->COTpdoReadData_ArgPdo = pdo;
         TsCallbacks->COTpdoReadData_ArgFrm = frm;
         TsCallbacks->COTpdoReadData_ArgPos = pos;
         TsCallbacks->COTpdoReadData_ArgSize = size;
@@ -59,15 +59,19 @@ extern "C" {
 typedef struct TS_CALLBACK_T {
     uint32_t    NodeFatalError_Called;
 
+    CO_TMR     *TmrLock_ArgTmr;
     uint32_t    TmrLock_Called;
     uint32_t    TmrUnlock_Called;
 
+    CO_IF      *IfCanReceive_ArgIf;
     CO_IF_FRM  *IfCanReceive_ArgFrm;
     uint32_t    IfCanReceive_Called;
 
+    CO_TPDO    *PdoTransmit_ArgPdo;
     CO_IF_FRM  *PdoTransmit_ArgFrm;
     uint32_t    PdoTransmit_Called;
 
+    CO_RPDO    *PdoReceive_ArgPdo;
     CO_IF_FRM  *PdoReceive_ArgFrm;
     uint32_t    PdoReceive_Called;
     int16_t     PdoReceive_Return;
@@ -89,17 +93,20 @@ typedef struct TS_CALLBACK_T {
     CO_MODE     NmtHbConsChange_ArgState;
     uint32_t    NmtHbConsChange_Called;
 
+    CO_NODE    *LssStore_ArgNode;
     uint32_t    LssStore_ArgBaudrate;
     uint8_t     LssStore_ArgNodeId;
     uint32_t    LssStore_Called;
     int16_t     LssStore_Return;
 
+    CO_NODE    *LssLoad_ArgNode;
     uint32_t   *LssLoad_ArgBaudrate;
     uint8_t    *LssLoad_ArgNodeId;
     uint32_t    LssLoad_Called;
     int16_t     LssLoad_Return;
 
     CO_PARA    *ParaDefault_ArgParaGrp;
+    CO_NODE    *ParaDefault_ArgNode;
     uint32_t    ParaDefault_Called;
     int16_t     ParaDefault_Return;
 
@@ -112,12 +119,14 @@ typedef struct TS_CALLBACK_T {
     uint32_t    AppCSdoCallback_ArgCode;
     uint32_t    AppCSdoCallback_Called;
 
+    CO_RPDO    *CORpdoWriteData_ArgPdo;
     CO_IF_FRM  *CORpdoWriteData_ArgFrm;
     uint8_t     CORpdoWriteData_ArgPos;
     uint8_t     CORpdoWriteData_ArgSize;
     CO_OBJ     *CORpdoWriteData_ArgObj;
     uint32_t    CORpdoWriteData_Called;
 
+    CO_TPDO    *COTpdoReadData_ArgPdo;
     CO_IF_FRM  *COTpdoReadData_ArgFrm;
     uint8_t     COTpdoReadData_ArgPos;
     uint8_t     COTpdoReadData_ArgSize;
@@ -132,8 +141,8 @@ typedef struct TS_CALLBACK_T {
 void TS_CallbackInit  (TS_CALLBACK *cb);
 void TS_CallbackDeInit(void);
 
-void COTmrLock  (void);
-void COTmrUnlock(void);
+void COTmrLock  (CO_TMR *tmr);
+void COTmrUnlock(CO_TMR *tmr);
 
 /* Application callbacks provided via function argument: */
 void TS_AppCSdoCallback(CO_CSDO *csdo, uint16_t index, uint8_t sub, uint32_t code);
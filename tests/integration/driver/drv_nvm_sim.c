@@ -36,9 +36,9 @@ static uint8_t NvmMemory[NVM_SIM_SIZE];
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
-static void     DrvNvmInit  (void);
-static uint32_t DrvNvmRead  (uint32_t start, uint8_t *buffer, uint32_t size);
-static uint32_t DrvNvmWrite (uint32_t start, uint8_t *buffer, uint32_t size);
+static void     DrvNvmInit  (CO_IF *cif);
+static uint32_t DrvNvmRead  (CO_IF *cif, uint32_t start, uint8_t *buffer, uint32_t size);
+static uint32_t DrvNvmWrite (CO_IF *cif, uint32_t start, uint8_t *buffer, uint32_t size);
 
 
 /******************************************************************************
@@ -55,20 +55,24 @@ const CO_IF_NVM_DRV SimNvmDriver = {
 * PRIVATE FUNCTIONS
 ******************************************************************************/
 
-static void DrvNvmInit(void)
+static void DrvNvmInit(CO_IF *cif)
 {
     uint32_t idx;
 
+    (void)cif;
+
     for (idx = 0; idx < NVM_SIM_SIZE; idx++) {
         NvmMemory[idx] = 0xffu;
     }
 }
 
-static uint32_t DrvNvmRead(uint32_t start, uint8_t *buffer, uint32_t size)
+static uint32_t DrvNvmRead(CO_IF *cif, uint32_t start, uint8_t *buffer, uint32_t size)
 {
     uint32_t idx = 0;
     uint32_t pos;
 
+    (void)cif;
+
     idx = 0;
     pos = start;
     while ((pos < NVM_SIM_SIZE) && (idx < size)) {
@@ -80,11 +84,13 @@ static uint32_t DrvNvmRead(uint32_t start, uint8_t *buffer, uint32_t size)
     return (idx);
 }
 
-static uint32_t DrvNvmWrite(uint32_t start, uint8_t *buffer, uint32_t size)
+static uint32_t DrvNvmWrite(CO_IF *cif, uint32_t start, uint8_t *buffer, uint32_t size)
 {
     uint32_t idx = 0;
     uint32_t pos;
 
+    (void)cif;
+
     idx = 0;
     pos = start;
     while ((pos < NVM_SIM_SIZE) && (idx < size)) {
@@ -103,6 +103,9 @@ typedef enum DEF_CSDO_SUITES_E {                      /*---- SDO Client Test Sui
     DEF_S_CSDO_EXP_DOWN,                              /*!< Suite: SDO Download Expedited          */
     DEF_S_CSDO_SEG_UP,                                /*!< Suite: SDO Upload Segmented            */
     DEF_S_CSDO_SEG_DOWN,                              /*!< Suite: SDO Download Segmented          */
+    DEF_S_CSDO_BLK_UP,                                /*!< Suite: SDO Upload Block                */
+    DEF_S_CSDO_BLK_DOWN,                              /*!< Suite: SDO Download Block              */
+    DEF_S_CSDO_QUEUE,                                 /*!< Suite: SDO Client Request Queue        */
 
     DEF_S_CSDO_NUM                                    /*!< Number of Suites in Group              */
 } DEF_CSDO_SUITES;
@@ -142,5 +145,8 @@ typedef enum DEF_CSDO_SUITES_E {                      /*---- SDO Client Test Sui
 #define SUITE_CSDO_EXP_DOWN() TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_EXP_DOWN)  /*!< \addtogroup csdo_exp_down  SDO Client Expedited Download Test */
 #define SUITE_CSDO_SEG_UP()   TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_SEG_UP)    /*!< \addtogroup csdo_seg_down  SDO Client Segmented Upload Test   */
 #define SUITE_CSDO_SEG_DOWN() TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_SEG_DOWN)  /*!< \addtogroup csdo_seg_down  SDO Client Segmented Download Test */
+#define SUITE_CSDO_BLK_UP()   TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_BLK_UP)    /*!< \addtogroup csdo_blk_up    SDO Client Block Upload Test       */
+#define SUITE_CSDO_BLK_DOWN() TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_BLK_DOWN)  /*!< \addtogroup csdo_blk_down  SDO Client Block Download Test     */
+#define SUITE_CSDO_QUEUE()    TS_DEF_SUITE(DEF_G_CSDO, DEF_S_CSDO_QUEUE)     /*!< \addtogroup csdo_queue     SDO Client Request Queue Test      */
 
 #endif /* DEF_SUITE_H_ */
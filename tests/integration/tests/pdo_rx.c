@@ -249,6 +249,63 @@ TS_DEF_MAIN(TS_RPdo_24Bit)
     CHK_NO_ERR(&node);
 }
 
+TS_DEF_MAIN(TS_RPdo_64Bit)
+{
+    CO_NODE  node;
+    uint32_t rpdo_id     = 0x40000200;
+    uint32_t rpdo_map    = 0x25000140;
+    uint8_t  rpdo_type   = 1;
+    uint8_t  rpdo_len    = 1;
+    uint64_t data64      = 0x9192939495969798;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,  &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map, &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x01, CO_OBJ_____RW), CO_TUNSIGNED64, (CO_DATA)(&data64));
+    TS_CreateNodeAutoStart(&node);
+
+    TS_PDO_SEND(0x201, 0x21);
+
+    /* check signal to be unchanged */
+    TS_ASSERT(0x9192939495969798 == data64);
+
+    TS_SYNC_SEND();
+
+    /* check signal to be updated */
+    TS_ASSERT(0x2827262524232221 == data64);
+
+    /* check error free stack execution */
+    CHK_NO_ERR(&node);
+}
+
+TS_DEF_MAIN(TS_RPdo_48Bit)
+{
+    CO_NODE  node;
+    uint32_t rpdo_id     = 0x40000200;
+    uint32_t rpdo_map[2] = { 0x25000130, 0x25000210 };
+    uint8_t  rpdo_type   = 1;
+    uint8_t  rpdo_len    = 2;
+    uint64_t data48      = 0;
+    uint16_t data16      = 0;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,     &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map[0], &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x01, CO_OBJ_____RW), CO_TUNSIGNED48, (CO_DATA)(&data48));
+    TS_ODAdd(CO_KEY(0x2500, 0x02, CO_OBJ_____RW), CO_TUNSIGNED16, (CO_DATA)(&data16));
+    TS_CreateNodeAutoStart(&node);
+
+    TS_PDO_SEND(0x201, 0x21);
+    TS_SYNC_SEND();
+
+    /* check signals to be updated */
+    TS_ASSERT(0x262524232221 == data48);
+    TS_ASSERT(0x2827 == data16);
+
+    /* check error free stack execution */
+    CHK_NO_ERR(&node);
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief TC5
 *
@@ -374,6 +431,121 @@ TS_DEF_MAIN(TS_RPdo_UpdateType255)
     CHK_NO_ERR(&node);
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC9
+*
+*          This testcase will check the principle reception of:
+*          - PDO #0 (write to object with asynchronous TPDO trigger)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_RPdo_AsyncTrigger)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  rpdo_id      = 0x40000200;
+    uint32_t  rpdo_map     = 0x25000B08;
+    uint8_t   rpdo_type    = 255;
+    uint8_t   rpdo_len     = 1;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map     = 0x25000B08;
+    uint8_t   tpdo_type    = 254;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 1;
+    uint8_t   data         = 0x91;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,  &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map, &rpdo_len);
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ___APRW), CO_TUNSIGNED8, (CO_DATA)(&data));
+    TS_CreateNodeAutoStart(&node);
+
+    TS_PDO_SEND(0x201, 0xE1);
+
+    /* check signal to be changed */
+    TS_ASSERT(0xE1 == data);
+
+    /* check TPDO triggered by the changed signal */
+    CHK_CAN  (&frm);
+    CHK_PDO0 (frm, 0x181, 1);
+    CHK_BYTE (frm, 0, 0xE1);
+
+    /* check error free stack execution */
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC10
+*
+*          This testcase will check the principle reception of:
+*          - PDO #0 (referenced object followed by direct object)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_RPdo_RefAndDirect)
+{
+    CO_NODE  node;
+    uint32_t rpdo_id     = 0x40000200;
+    uint32_t rpdo_map[2] = { 0x25000B08, 0x25001510 };
+    uint8_t  rpdo_type   = 255;
+    uint8_t  rpdo_len    = 2;
+    uint8_t  data8       = 0x91;
+    uint16_t data16      = 0;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(0, &rpdo_id,     &rpdo_type);
+    TS_CreateRPdoMap(0, &rpdo_map[0], &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ_____RW), CO_TUNSIGNED8,  (CO_DATA)(&data8));
+    TS_ODAdd(CO_KEY(0x2500, 0x15, CO_OBJ_D___RW), CO_TUNSIGNED16, (CO_DATA)(0x8182));
+    TS_CreateNodeAutoStart(&node);
+
+    TS_PDO_SEND(0x201, 0x21);
+
+    /* check signals to be changed */
+    TS_ASSERT(0x21 == data8);
+    (void)CODictRdWord(&node.Dict, CO_DEV(0x2500, 0x15), &data16);
+    TS_ASSERT(0x2322 == data16);
+
+    /* check error free stack execution */
+    CHK_NO_ERR(&node);
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC11
+*
+*          This testcase will check the receive callback gets the owning object of:
+*          - PDO #1 (1 byte in content)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_RPdo_CallbackContext)
+{
+    CO_NODE  node;
+    uint32_t rpdo_id     = 0x40000300;
+    uint32_t rpdo_map[1] = { 0x25000B08 };
+    uint8_t  rpdo_type   = 255;
+    uint8_t  rpdo_len    = 1;
+    uint8_t  data        = 0x91;
+
+    TS_CreateMandatoryDir();
+    TS_CreateRPdoCom(1, &rpdo_id,     &rpdo_type);
+    TS_CreateRPdoMap(1, &rpdo_map[0], &rpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ_____RW), CO_TUNSIGNED8, (CO_DATA)(&data));
+    TS_CreateNodeAutoStart(&node);
+
+    TS_PDO_SEND(0x301, 0x31);
+
+    /* check signal to be changed */
+    TS_ASSERT(0x31 == data);
+
+    /* check callback is called with the receiving PDO */
+    CHK_CB_RPDO_RECEIVE(&CORpdoWriteDataCb, 1);
+    TS_ASSERT(&node.RPdo[1] == CORpdoWriteDataCb.PdoReceive_ArgPdo);
+
+    /* check error free stack execution */
+    CHK_NO_ERR(&node);
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -398,11 +570,16 @@ SUITE_PDO_RX()
     TS_RUNNER(TS_RPdo_2x4Byte);
     TS_RUNNER(TS_RPdo_1_2_4Byte);
     TS_RUNNER(TS_RPdo_24Bit);
+    TS_RUNNER(TS_RPdo_64Bit);
+    TS_RUNNER(TS_RPdo_48Bit);
 
     TS_RUNNER(TS_RPdo_NoData);
     TS_RUNNER(TS_RPdo_UpdateAfterSync);
     TS_RUNNER(TS_RPdo_UpdateType254);
     TS_RUNNER(TS_RPdo_UpdateType255);
+    TS_RUNNER(TS_RPdo_AsyncTrigger);
+    TS_RUNNER(TS_RPdo_RefAndDirect);
+    TS_RUNNER(TS_RPdo_CallbackContext);
 
     TS_End();
 }
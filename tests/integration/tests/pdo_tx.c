@@ -221,6 +221,66 @@ TS_DEF_MAIN(TS_TPdo_24Bit)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+TS_DEF_MAIN(TS_TPdo_64Bit)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map     = 0x25000140;
+    uint8_t   tpdo_type    = 0xfe;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 1;
+    uint64_t  data64       = 0x8877665544332211;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x01, CO_OBJ____PRW), CO_TUNSIGNED64, (CO_DATA)(&data64));
+    TS_CreateNodeAutoStart(&node);
+
+    COTPdoTrigPdo(node.TPdo, 0);                      /* send PDO #0                              */
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 8);                         /* check PDO #0 (Id and DLC)                */
+    CHK_LONG (frm, 0, 0x44332211);
+    CHK_LONG (frm, 4, 0x88776655);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+TS_DEF_MAIN(TS_TPdo_40Bit)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map[2]  = { 0x25000128, 0x25000218 };
+    uint8_t   tpdo_type    = 0xfe;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 2;
+    int64_t   data40       = -2;
+    int32_t   data24       = -3;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map[0], &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x01, CO_OBJ____PRW), CO_TSIGNED40, (CO_DATA)(&data40));
+    TS_ODAdd(CO_KEY(0x2500, 0x02, CO_OBJ____PRW), CO_TSIGNED24, (CO_DATA)(&data24));
+    TS_CreateNodeAutoStart(&node);
+
+    COTPdoTrigPdo(node.TPdo, 0);                      /* send PDO #0                              */
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 8);                         /* check PDO #0 (Id and DLC)                */
+    CHK_LONG (frm, 0, 0xfffffffe);
+    CHK_BYTE (frm, 4, 0xff);
+    CHK_BYTE (frm, 5, 0xfd);
+    CHK_WORD (frm, 6, 0xffff);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief TC5
 *
@@ -1128,6 +1188,200 @@ TS_DEF_MAIN(TS_TPdo_ChangeAsyncProperty)
     CHK_NO_ERR(&node);                                       /* check error free stack execution  */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC25
+*
+*          This testcase will check the principle transmission of:
+*          - PDO #0 and PDO #2 (same object mapped into both PDOs, triggered via object
+*            reference in ascending PDO order)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdo_TrigObjMultiPdo)
+{
+    CO_OBJ   *obj;
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint32_t  tpdo0_id     = 0x40000180;
+    uint32_t  tpdo1_id     = 0x40000280;
+    uint32_t  tpdo2_id     = 0x40000380;
+    uint32_t  tpdo0_map    = 0x25000B08;
+    uint32_t  tpdo1_map    = 0x25000C08;
+    uint32_t  tpdo2_map    = 0x25000B08;
+    uint8_t   tpdo_type    = 254;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 1;
+    uint8_t   data8_b      = 0x91;
+    uint8_t   data8_c      = 0x92;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo0_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoCom(1, &tpdo1_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoCom(2, &tpdo2_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo0_map, &tpdo_len);
+    TS_CreateTPdoMap(1, &tpdo1_map, &tpdo_len);
+    TS_CreateTPdoMap(2, &tpdo2_map, &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8_b));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8_c));
+    TS_CreateNodeAutoStart(&node);
+
+    obj = CODictFind(&node.Dict, CO_DEV(0x2500,0x0B));  /* trigger PDO via object reference         */
+    COTPdoTrigObj(node.TPdo, obj);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 1);                         /* check PDO #0 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x91);
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x381, 1);                         /* check PDO #2 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x91);
+    CHK_NOCAN(&frm);                                  /* check for no further CAN frame           */
+
+    obj = CODictFind(&node.Dict, CO_DEV(0x2500,0x0C));  /* trigger PDO via object reference         */
+    COTPdoTrigObj(node.TPdo, obj);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x281, 1);                         /* check PDO #1 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x92);
+    CHK_NOCAN(&frm);                                  /* check for no further CAN frame           */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC26
+*
+*          This testcase will check the principle transmission of:
+*          - PDO #0 (object reference trigger follows a PDO mapping changed in operational)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdo_TrigObjRemap)
+{
+    CO_OBJ   *obj_b;
+    CO_OBJ   *obj_c;
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_ERR    result;
+    uint32_t  tpdo_id      = 0x40000180;
+    uint32_t  tpdo_map     = 0x25000B08;
+    uint8_t   tpdo_type    = 254;
+    uint16_t  tpdo_inhibit = 0;
+    uint16_t  tpdo_evtime  = 0;
+    uint8_t   tpdo_len     = 1;
+    uint8_t   data8_b      = 0x91;
+    uint8_t   data8_c      = 0x92;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8_b));
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8_c));
+    TS_CreateNode(&node,0);
+
+    obj_b = CODictFind(&node.Dict, CO_DEV(0x2500,0x0B));
+    obj_c = CODictFind(&node.Dict, CO_DEV(0x2500,0x0C));
+
+    TS_NMT_SEND(0x01, 1);                             /* set node-id 0x01 to operational          */
+
+    result = CODictWrLong(&node.Dict, CO_DEV(0x1800,1), 0xC0000181);  /* PDO valid to invalid    */
+    TS_ASSERT(CO_ERR_NONE == result);
+    result = CODictWrByte(&node.Dict, CO_DEV(0x1A00,0), 0x0);        /* set mapping to 0         */
+    TS_ASSERT(CO_ERR_NONE == result);
+    result = CODictWrLong(&node.Dict, CO_DEV(0x1A00,1), 0x25000C08);  /* write mapping            */
+    TS_ASSERT(CO_ERR_NONE == result);
+    result = CODictWrByte(&node.Dict, CO_DEV(0x1A00,0), 0x1);        /* set mapping to 1         */
+    TS_ASSERT(CO_ERR_NONE == result);
+    result = CODictWrLong(&node.Dict, CO_DEV(0x1800,1), 0x40000181);  /* PDO invalid to valid    */
+    TS_ASSERT(CO_ERR_NONE == result);
+
+    COTPdoTrigObj(node.TPdo, obj_b);                  /* trigger previously mapped object         */
+    CHK_NOCAN(&frm);                                  /* check for no CAN frame                   */
+
+    COTPdoTrigObj(node.TPdo, obj_c);                  /* trigger newly mapped object              */
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 1);                         /* check PDO #0 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x92);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TC27
+*
+*          This testcase will check the principle transmission of:
+*          - PDO #0 (mapped object entry is moved by inserting and removing an object entry in
+*            front of it in the linked dynamic object dictionary)
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_TPdo_DictDynMove)
+{
+    CO_OBJ        arena[64];
+    CO_DICT_DYN   dyn;
+    CO_NODE_SPEC  spec;
+    CO_OBJ       *obj;
+    CO_IF_FRM     frm;
+    CO_NODE       node;
+    CO_ERR        result;
+    uint32_t      tpdo_id      = 0x40000180;
+    uint32_t      tpdo_map     = 0x25000C08;
+    uint8_t       tpdo_type    = 254;
+    uint16_t      tpdo_inhibit = 0;
+    uint16_t      tpdo_evtime  = 0;
+    uint8_t       tpdo_len     = 1;
+    uint8_t       data8_b      = 0x91;
+    uint8_t       data8_c      = 0x92;
+
+    TS_CreateMandatoryDir();
+    TS_CreateTPdoCom(0, &tpdo_id, &tpdo_type, &tpdo_inhibit, &tpdo_evtime);
+    TS_CreateTPdoMap(0, &tpdo_map, &tpdo_len);
+    TS_ODAdd(CO_KEY(0x2500, 0x0C, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8_c));
+    TS_CreateSpec(&node, &spec, 0);
+
+    (void)CODictDynInit(&dyn, &arena[0], sizeof(arena));  /* copy dictionary into dynamic dictionary */
+    for (obj = spec.Dict; obj->Key != 0; obj++) {
+        result = CODictDynAdd(&dyn, obj->Key, obj->Type, obj->Data);
+        TS_ASSERT(CO_ERR_NONE == result);
+    }
+    result = CODictDynBuild(&dyn);
+    TS_ASSERT(CO_ERR_NONE == result);
+    CODictDynSetSpec(&dyn, &spec);
+    CONodeInit(&node, &spec);
+    CONodeStart(&node);
+    result = CODictDynLink(&dyn, &node.Dict);
+    TS_ASSERT(CO_ERR_NONE == result);
+    CONmtSetMode(&node.Nmt, CO_OPERATIONAL);
+    SimCanFlush();
+
+    result = CODictDynInsert(&dyn, CO_KEY(0x2500, 0x0B, CO_OBJ____PRW), CO_TUNSIGNED8, (CO_DATA)(&data8_b));
+    TS_ASSERT(CO_ERR_NONE == result);
+
+    COTPdoTrigPdo(node.TPdo, 0);                      /* trigger PDO via PDO number               */
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 1);                         /* check PDO #0 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x92);
+
+    obj = CODictFind(&node.Dict, CO_DEV(0x2500,0x0B));  /* trigger inserted object                  */
+    COTPdoTrigObj(node.TPdo, obj);
+    CHK_NOCAN(&frm);                                  /* check for no CAN frame                   */
+
+    obj = CODictFind(&node.Dict, CO_DEV(0x2500,0x0C));  /* trigger moved mapped object              */
+    COTPdoTrigObj(node.TPdo, obj);
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 1);                         /* check PDO #0 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x92);
+
+    result = CODictDynRemove(&dyn, CO_DEV(0x2500, 0x0B));
+    TS_ASSERT(CO_ERR_NONE == result);
+
+    obj = CODictFind(&node.Dict, CO_DEV(0x2500,0x0C));  /* trigger moved mapped object              */
+    COTPdoTrigObj(node.TPdo, obj);
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_PDO0 (frm, 0x181, 1);                         /* check PDO #0 (Id and DLC)                */
+    CHK_BYTE (frm, 0, 0x92);
+    CHK_NOCAN(&frm);                                  /* check for no further CAN frame           */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -1141,6 +1395,8 @@ SUITE_PDO_TX()
     TS_RUNNER(TS_TPdo_2x4Byte);
     TS_RUNNER(TS_TPdo_1_2_4Byte);
     TS_RUNNER(TS_TPdo_24Bit);
+    TS_RUNNER(TS_TPdo_64Bit);
+    TS_RUNNER(TS_TPdo_40Bit);
     TS_RUNNER(TS_TPdo_NoData);
     TS_RUNNER(TS_TPdo_After3Sync);
     TS_RUNNER(TS_TPdo_After240Sync);
@@ -1160,6 +1416,9 @@ SUITE_PDO_TX()
     TS_RUNNER(TS_TPdo_SetEventTime);
     TS_RUNNER(TS_TPdo_SetEventTimeAndReset);
     TS_RUNNER(TS_TPdo_ChangeAsyncProperty);
+    TS_RUNNER(TS_TPdo_TrigObjMultiPdo);
+    TS_RUNNER(TS_TPdo_TrigObjRemap);
+    TS_RUNNER(TS_TPdo_DictDynMove);
 
     TS_End();
 }
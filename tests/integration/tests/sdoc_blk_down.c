@@ -0,0 +1,446 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \addtogroup csdo_blk_down
+* \details    This test suite checks the protocol for SDO block download
+*             (e.g. SDO client writes data to SDO server).
+* @{
+*/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+
+#if USE_CSDO
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static TS_CALLBACK CSdoBlkDownCb;
+static uint8_t     CSdoBlkDownData[1000];
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static uint16_t CSdoBlkDownCrcRef(uint16_t crc, const uint8_t *buf, uint32_t len)
+{
+    uint8_t bit;
+
+    while (len > 0) {
+        crc ^= (uint16_t)(*buf << 8);
+        for (bit = 0; bit < 8; bit++) {
+            if ((crc & 0x8000) != 0) {
+                crc = (uint16_t)((crc << 1) ^ 0x1021);
+            } else {
+                crc = (uint16_t)(crc << 1);
+            }
+        }
+        buf++;
+        len--;
+    }
+    return (crc);
+}
+
+static void CSdoBlkDownChkSeg(uint8_t cmd, uint8_t *data, uint8_t len)
+{
+    CO_IF_FRM frm;
+    uint8_t   n;
+
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, cmd);
+    for (n = 0; n < 7; n++) {
+        if (n < len) {
+            CHK_BYTE(frm, n + 1, data[n]);
+        } else {
+            CHK_BYTE(frm, n + 1, 0);
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Check the CRC calculation of the SDO block transfer
+*
+*           The CRC-16-CCITT of the standard check string is calculated
+*           in a single step and in multiple steps.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdo_BlkCrc)
+{
+    uint8_t val[9] = { '1','2','3','4','5','6','7','8','9' };
+    uint16_t crc;
+
+    crc = COSdoCrc(0, &val[0], 9);
+    TS_ASSERT(crc == 0x31C3);
+
+    crc = COSdoCrc(0, &val[0], 4);
+    crc = COSdoCrc(crc, &val[4], 5);
+    TS_ASSERT(crc == 0x31C3);
+
+    crc = COSdoCrc(0, &val[0], 0);
+    TS_ASSERT(crc == 0);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Check the CRC calculation of long data
+*
+*           The CRC of data with different lengths and alignments is
+*           calculated in a single step and in two steps and is compared
+*           with a bitwise calculation.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdo_BlkCrcLong)
+{
+    uint32_t n;
+    uint32_t len;
+    uint32_t off;
+    uint16_t crc;
+    uint16_t ref;
+
+    for (n = 0; n < sizeof(CSdoBlkDownData); n++) {
+        CSdoBlkDownData[n] = (uint8_t)((n * 7u) ^ (n >> 3));
+    }
+
+    for (off = 0; off < 4; off++) {
+        for (len = 0; len < (sizeof(CSdoBlkDownData) - off); len += 13) {
+            ref = CSdoBlkDownCrcRef(0x1D0F, &CSdoBlkDownData[off], len);
+
+            crc = COSdoCrc(0x1D0F, &CSdoBlkDownData[off], len);
+            TS_ASSERT(crc == ref);
+
+            crc = COSdoCrc(0x1D0F, &CSdoBlkDownData[off], len / 3);
+            crc = COSdoCrc(crc, &CSdoBlkDownData[off + len / 3], len - len / 3);
+            TS_ASSERT(crc == ref);
+        }
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to write a 64 byte domain with block download
+*
+*           The SDO client #0 is used on testing node with Node-Id 1 to send
+*           64 bytes to the SDO server #0 on device with Node-Id 5. The
+*           server uses the CRC and a block size of 4 for the first block.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoWr_Blk64ByteDomain)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[64];
+    uint8_t   n;
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    for (n = 0; n < 64; n++) {
+        val[n] = n + 1;
+    }
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestDownload(csdo,
+                                CO_DEV(idx, sub),
+                                &val[0], 64,
+                                TS_AppCSdoCallback,
+                                timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO BLOCK INIT REQUEST: CRC, SIZE -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xC6);
+    CHK_MLTPX(frm, idx, sub);
+    CHK_DATA (frm, 64);
+
+    /* -- SERVER INIT RESPONSE: CRC, BLKSIZE=4 -- */
+    TS_SDO5_SEND (0xA4, idx, sub, 4);
+
+    /* -- CHECK BLOCK #1 -- */
+    CSdoBlkDownChkSeg(0x01, &val[0],  7);
+    CSdoBlkDownChkSeg(0x02, &val[7],  7);
+    CSdoBlkDownChkSeg(0x03, &val[14], 7);
+    CSdoBlkDownChkSeg(0x04, &val[21], 7);
+    CHK_NOCAN(&frm);
+
+    /* -- SERVER BLOCK RESPONSE: ACKSEQ=4, BLKSIZE=127 -- */
+    TS_SEG5_SEND (0xA2, 0x00007F04, 0x000000);
+
+    /* -- CHECK BLOCK #2 (LAST) -- */
+    CSdoBlkDownChkSeg(0x01, &val[28], 7);
+    CSdoBlkDownChkSeg(0x02, &val[35], 7);
+    CSdoBlkDownChkSeg(0x03, &val[42], 7);
+    CSdoBlkDownChkSeg(0x04, &val[49], 7);
+    CSdoBlkDownChkSeg(0x05, &val[56], 7);
+    CSdoBlkDownChkSeg(0x86, &val[63], 1);
+    CHK_NOCAN(&frm);
+
+    /* -- SERVER BLOCK RESPONSE: ACKSEQ=6, BLKSIZE=127 -- */
+    TS_SEG5_SEND (0xA2, 0x00007F06, 0x000000);
+
+    /* -- CHECK END REQUEST: N=6, CRC -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xD9);
+    CHK_WORD (frm, 1, COSdoCrc(0, &val[0], 64));
+
+    /* -- SERVER END RESPONSE -- */
+    TS_SEG5_SEND (0xA1, 0x00000000, 0x000000);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkDownCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkDownCb, 0);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to repeat the not confirmed segments
+*
+*           The SDO client #0 is used on testing node with Node-Id 1 to send
+*           64 bytes to the SDO server #0 on device with Node-Id 5. The
+*           server confirms only 2 segments of the first block and does not
+*           support the CRC.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoWr_BlkRepeat)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[64];
+    uint8_t   n;
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    for (n = 0; n < 64; n++) {
+        val[n] = n + 1;
+    }
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestDownload(csdo,
+                                CO_DEV(idx, sub),
+                                &val[0], 64,
+                                TS_AppCSdoCallback,
+                                timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xC6);
+
+    /* -- SERVER INIT RESPONSE: NO CRC, BLKSIZE=4 -- */
+    TS_SDO5_SEND (0xA0, idx, sub, 4);
+
+    CSdoBlkDownChkSeg(0x01, &val[0],  7);
+    CSdoBlkDownChkSeg(0x02, &val[7],  7);
+    CSdoBlkDownChkSeg(0x03, &val[14], 7);
+    CSdoBlkDownChkSeg(0x04, &val[21], 7);
+
+    /* -- SERVER BLOCK RESPONSE: ACKSEQ=2, BLKSIZE=8 -- */
+    TS_SEG5_SEND (0xA2, 0x00000802, 0x000000);
+
+    /* -- CHECK REPEATED BLOCK (LAST) -- */
+    CSdoBlkDownChkSeg(0x01, &val[14], 7);
+    CSdoBlkDownChkSeg(0x02, &val[21], 7);
+    CSdoBlkDownChkSeg(0x03, &val[28], 7);
+    CSdoBlkDownChkSeg(0x04, &val[35], 7);
+    CSdoBlkDownChkSeg(0x05, &val[42], 7);
+    CSdoBlkDownChkSeg(0x06, &val[49], 7);
+    CSdoBlkDownChkSeg(0x07, &val[56], 7);
+    CSdoBlkDownChkSeg(0x88, &val[63], 1);
+    CHK_NOCAN(&frm);
+
+    /* -- SERVER BLOCK RESPONSE: ACKSEQ=8, BLKSIZE=127 -- */
+    TS_SEG5_SEND (0xA2, 0x00007F08, 0x000000);
+
+    /* -- CHECK END REQUEST: N=6, NO CRC -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xD9);
+    CHK_WORD (frm, 1, 0);
+
+    /* -- SERVER END RESPONSE -- */
+    TS_SEG5_SEND (0xA1, 0x00000000, 0x000000);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkDownCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkDownCb, 0);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to handle an invalid block acknowledge
+*
+*           The SDO client #0 is used on testing node with Node-Id 1 to try
+*           to send 64 bytes to the SDO server #0 on device with Node-Id 5,
+*           but the server acknowledges a segment, which is not sent.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoWr_BlkBadSeq)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[64] = { 0 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestDownload(csdo,
+                                CO_DEV(idx, sub),
+                                &val[0], 64,
+                                TS_AppCSdoCallback,
+                                timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xC6);
+
+    /* -- SERVER INIT RESPONSE: BLKSIZE=2 -- */
+    TS_SDO5_SEND (0xA4, idx, sub, 2);
+    CHK_CAN  (&frm);
+    CHK_CAN  (&frm);
+
+    /* -- SERVER BLOCK RESPONSE: ACKSEQ=3 -- */
+    TS_SEG5_SEND (0xA2, 0x00007F03, 0x000000);
+
+    /* -- CHECK ABORT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x80);
+    CHK_MLTPX(frm, idx, sub);
+    CHK_DATA (frm, 0x05040003);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkDownCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkDownCb, 0x05040003);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to handle an abort response
+*
+*           The SDO client #0 is used on testing node with Node-Id 1 to try
+*           to send 64 bytes to the SDO server #0 on device with Node-Id 5,
+*           but an abort response is sent.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoWr_BlkAbort)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint32_t  timeout = 1000;
+    uint8_t   val[64] = { 0 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestDownload(csdo,
+                                CO_DEV(idx, sub),
+                                &val[0], 64,
+                                TS_AppCSdoCallback,
+                                timeout);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xC6);
+
+    /* -- SERVER INIT RESPONSE: ABORT CODE -- */
+    TS_SDO5_SEND (0x80, idx, sub, 0x06020000);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkDownCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkDownCb, 0x06020000);
+    CHK_NOCAN(&frm);
+
+    CHK_NO_ERR(&node);
+}
+
+static void CSdoBlkDownSetup(void)
+{
+    TS_CallbackInit(&CSdoBlkDownCb);
+}
+
+static void CSdoBlkDownCleanup(void)
+{
+    TS_CallbackDeInit();
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_CSDO_BLK_DOWN()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(CSdoBlkDownSetup, CSdoBlkDownCleanup);
+
+    TS_RUNNER(TS_CSdo_BlkCrc);
+    TS_RUNNER(TS_CSdo_BlkCrcLong);
+    TS_RUNNER(TS_CSdoWr_Blk64ByteDomain);
+    TS_RUNNER(TS_CSdoWr_BlkRepeat);
+
+    TS_RUNNER(TS_CSdoWr_BlkBadSeq);
+    TS_RUNNER(TS_CSdoWr_BlkAbort);
+
+    TS_End();
+}
+
+#endif
+
+/*! @} */
@@ -0,0 +1,455 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \addtogroup csdo_blk_up
+* \details    This test suite checks the protocol for SDO block upload
+*             (e.g. SDO client reads data from SDO server).
+* @{
+*/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+
+#if USE_CSDO
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static TS_CALLBACK CSdoBlkUpCb;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void CSdoBlkUpSendSeg(uint8_t cmd, uint8_t *data, uint8_t len)
+{
+    uint8_t b[7] = { 0 };
+    uint8_t n;
+
+    for (n = 0; n < len; n++) {
+        b[n] = data[n];
+    }
+    SimCanSetFrm(0x605, 8, cmd, b[0], b[1], b[2], b[3], b[4], b[5], b[6]);
+    SimCanRun();
+}
+
+static void CSdoBlkUpInit(CO_CSDO *csdo, uint8_t *buf, uint32_t size, uint8_t crc)
+{
+    CO_IF_FRM frm;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    CO_ERR    err;
+
+    err = COCSdoRequestUpload(csdo,
+                              CO_DEV(idx, sub),
+                              buf, size,
+                              TS_AppCSdoCallback,
+                              1000);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK SDO BLOCK INIT REQUEST: CRC, BLKSIZE -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA4);
+    CHK_MLTPX(frm, idx, sub);
+    CHK_DATA (frm, CO_CSDO_BLK_SIZE);
+
+    /* -- SERVER INIT RESPONSE: SIZE -- */
+    TS_SDO5_SEND ((crc != 0) ? 0xC6 : 0xC2, idx, sub, size);
+
+    /* -- CHECK START UPLOAD REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA3);
+    CHK_ZERO (frm);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to read a 64 byte domain with block upload
+*
+*           The SDO client #0 is used on testing node with Node-Id 1 to read
+*           64 bytes from the SDO server #0 on device with Node-Id 5. The
+*           server uses the CRC.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_Blk64ByteDomain)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint8_t   src[64];
+    uint8_t   val[64] = { 0 };
+    uint8_t   n;
+
+    /* -- PREPARATION -- */
+    for (n = 0; n < 64; n++) {
+        src[n] = n + 1;
+    }
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    CSdoBlkUpInit(csdo, &val[0], 64, 1);
+
+    /* -- SERVER BLOCK (LAST) -- */
+    for (n = 1; n < 10; n++) {
+        CSdoBlkUpSendSeg(n, &src[(n - 1) * 7], 7);
+        CHK_NOCAN(&frm);
+    }
+    CSdoBlkUpSendSeg(0x8A, &src[63], 1);
+
+    /* -- CHECK BLOCK RESPONSE: ACKSEQ=10 -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA2);
+    CHK_ACKSEQ(frm, 10);
+    CHK_BYTE (frm, 2, CO_CSDO_BLK_SIZE);
+
+    /* -- SERVER END REQUEST: N=6, CRC -- */
+    TS_SEG5_SEND (0xD9, COSdoCrc(0, &src[0], 64), 0x000000);
+
+    /* -- CHECK END RESPONSE -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA1);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, 0);
+    for (n = 0; n < 64; n++) {
+        TS_ASSERT(val[n] == src[n]);
+    }
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to request the repetition of lost segments
+*
+*           The SDO client #0 is used on testing node with Node-Id 1 to read
+*           64 bytes from the SDO server #0 on device with Node-Id 5. The
+*           third segment is lost and the server repeats the block starting
+*           with this segment.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_BlkLostSegment)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint8_t   src[64];
+    uint8_t   val[64] = { 0 };
+    uint8_t   n;
+
+    /* -- PREPARATION -- */
+    for (n = 0; n < 64; n++) {
+        src[n] = n + 1;
+    }
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    CSdoBlkUpInit(csdo, &val[0], 64, 1);
+
+    /* -- SERVER BLOCK: SEGMENT #3 IS LOST -- */
+    for (n = 1; n < 10; n++) {
+        if (n != 3) {
+            CSdoBlkUpSendSeg(n, &src[(n - 1) * 7], 7);
+        }
+    }
+    CSdoBlkUpSendSeg(0x8A, &src[63], 1);
+
+    /* -- CHECK BLOCK RESPONSE: ACKSEQ=2 -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA2);
+    CHK_ACKSEQ(frm, 2);
+    CHK_NOCAN(&frm);
+
+    /* -- SERVER REPEATS THE BLOCK -- */
+    for (n = 1; n < 8; n++) {
+        CSdoBlkUpSendSeg(n, &src[(n + 1) * 7], 7);
+    }
+    CSdoBlkUpSendSeg(0x88, &src[63], 1);
+
+    /* -- CHECK BLOCK RESPONSE: ACKSEQ=8 -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA2);
+    CHK_ACKSEQ(frm, 8);
+
+    /* -- SERVER END REQUEST: N=6, CRC -- */
+    TS_SEG5_SEND (0xD9, COSdoCrc(0, &src[0], 64), 0x000000);
+
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA1);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, 0);
+    for (n = 0; n < 64; n++) {
+        TS_ASSERT(val[n] == src[n]);
+    }
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to handle a bad CRC
+*
+*           The SDO client #0 is used on testing node with Node-Id 1 to read
+*           64 bytes from the SDO server #0 on device with Node-Id 5, but
+*           the CRC of the server does not match the received data.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_BlkBadCrc)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint8_t   src[64];
+    uint8_t   val[64] = { 0 };
+    uint16_t  crc;
+    uint8_t   n;
+
+    /* -- PREPARATION -- */
+    for (n = 0; n < 64; n++) {
+        src[n] = n + 1;
+    }
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    CSdoBlkUpInit(csdo, &val[0], 64, 1);
+    for (n = 1; n < 10; n++) {
+        CSdoBlkUpSendSeg(n, &src[(n - 1) * 7], 7);
+    }
+    CSdoBlkUpSendSeg(0x8A, &src[63], 1);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA2);
+
+    /* -- SERVER END REQUEST: N=6, BAD CRC -- */
+    crc = COSdoCrc(0, &src[0], 64) ^ 0x0001;
+    TS_SEG5_SEND (0xD9, crc, 0x000000);
+
+    /* -- CHECK ABORT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x80);
+    CHK_MLTPX(frm, 0x2000, 0x01);
+    CHK_DATA (frm, 0x05040004);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, 0x05040004);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to ignore the CRC of a server without CRC
+*
+*           The SDO client #0 is used on testing node with Node-Id 1 to read
+*           64 bytes from the SDO server #0 on device with Node-Id 5. The
+*           server does not support the CRC.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_BlkNoCrc)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint8_t   src[64];
+    uint8_t   val[64] = { 0 };
+    uint8_t   n;
+
+    /* -- PREPARATION -- */
+    for (n = 0; n < 64; n++) {
+        src[n] = n + 1;
+    }
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    CSdoBlkUpInit(csdo, &val[0], 64, 0);
+    for (n = 1; n < 10; n++) {
+        CSdoBlkUpSendSeg(n, &src[(n - 1) * 7], 7);
+    }
+    CSdoBlkUpSendSeg(0x8A, &src[63], 1);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA2);
+
+    /* -- SERVER END REQUEST: N=6, NO CRC -- */
+    TS_SEG5_SEND (0xD9, 0x0000, 0x000000);
+
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA1);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, 0);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to handle a bad buffer size
+*
+*           The SDO client #0 is used on testing node with Node-Id 1 to read
+*           64 bytes from the SDO server #0 on device with Node-Id 5, but
+*           the server indicates a different size.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_BlkBadSize)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint32_t  idx = 0x2000;
+    uint8_t   sub = 0x01;
+    uint8_t   val[64] = { 0 };
+    CO_ERR    err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    err = COCSdoRequestUpload(csdo,
+                              CO_DEV(idx, sub),
+                              &val[0], 64,
+                              TS_AppCSdoCallback,
+                              1000);
+    TS_ASSERT(err == CO_ERR_NONE);
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0xA4);
+
+    /* -- SERVER INIT RESPONSE: WITH A SIZE UNEQUAL BUFFER SIZE -- */
+    TS_SDO5_SEND (0xC6, idx, sub, 100);
+
+    /* -- CHECK ABORT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x80);
+    CHK_DATA (frm, 0x06070010);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, 0x06070010);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Use SDO client to handle a timeout
+*
+*           The SDO client #0 is used on testing node with Node-Id 1 to read
+*           64 bytes from the SDO server #0 on device with Node-Id 5, but
+*           the server stops sending segments.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoRd_BlkTimeout)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    CO_CSDO  *csdo;
+    uint8_t   serverId = 5;
+    uint8_t   src[64];
+    uint8_t   val[64] = { 0 };
+    uint8_t   n;
+
+    /* -- PREPARATION -- */
+    for (n = 0; n < 64; n++) {
+        src[n] = n + 1;
+    }
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node, 0);
+    csdo = COCSdoFind(&node, 0);
+
+    /* -- TEST -- */
+    CSdoBlkUpInit(csdo, &val[0], 64, 1);
+    CSdoBlkUpSendSeg(1, &src[0], 7);
+
+    /* -- NO FURTHER SEGMENTS -- */
+    TS_Wait(&node, 900);
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 0);
+    TS_Wait(&node, 200);
+
+    /* -- CHECK ABORT REQUEST -- */
+    CHK_CAN  (&frm);
+    CHK_SDO5 (frm, 0x80);
+    CHK_DATA (frm, 0x05040000);
+
+    /* -- CHECK TRANSFER FINISHED -- */
+    CHK_CB_CSDO_FINISHED(&CSdoBlkUpCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoBlkUpCb, 0x05040000);
+
+    CHK_NO_ERR(&node);
+}
+
+static void CSdoBlkUpSetup(void)
+{
+    TS_CallbackInit(&CSdoBlkUpCb);
+}
+
+static void CSdoBlkUpCleanup(void)
+{
+    TS_CallbackDeInit();
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_CSDO_BLK_UP()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(CSdoBlkUpSetup, CSdoBlkUpCleanup);
+
+    TS_RUNNER(TS_CSdoRd_Blk64ByteDomain);
+    TS_RUNNER(TS_CSdoRd_BlkLostSegment);
+    TS_RUNNER(TS_CSdoRd_BlkNoCrc);
+
+    TS_RUNNER(TS_CSdoRd_BlkBadCrc);
+    TS_RUNNER(TS_CSdoRd_BlkBadSize);
+    TS_RUNNER(TS_CSdoRd_BlkTimeout);
+
+    TS_End();
+}
+
+#endif
+
+/*! @} */
@@ -0,0 +1,358 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \addtogroup csdo_queue
+* \details    This test suite checks the request queue of the SDO client
+*             (e.g. SDO client executes queued transfers to several servers).
+* @{
+*/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "def_suite.h"
+
+#if USE_CSDO
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static TS_CALLBACK CSdoQueueCb;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void CSdoQueueSend(uint8_t serverId, uint8_t cmd, uint16_t idx, uint8_t sub, uint32_t data)
+{
+    SimCanSetFrm(0x600u + serverId, 8,
+                 cmd,
+                 (uint8_t)(idx),
+                 (uint8_t)(idx >> 8),
+                 sub,
+                 (uint8_t)(data),
+                 (uint8_t)(data >> 8),
+                 (uint8_t)(data >> 16),
+                 (uint8_t)(data >> 24));
+    SimCanRun();
+}
+
+static void CSdoQueueChkReq(uint8_t serverId, uint16_t idx, uint8_t sub)
+{
+    CO_IF_FRM frm;
+
+    CHK_CAN  (&frm);
+    TS_ASSERT(0x580u + serverId == frm.Identifier);
+    TS_ASSERT(0x40 == BYTE(frm, 0));
+    CHK_MLTPX(frm, idx, sub);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Execute queued uploads in the order of the queue
+*
+*           The requests to the SDO server with Node-Id 5 are executed one
+*           after the other; the SDO client #0 is re-addressed to the SDO
+*           server with Node-Id 6 for the last request.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoQueue_Order)
+{
+    CO_IF_FRM          frm;
+    CO_NODE            node;
+    CO_CSDO_QUEUE      queue;
+    CO_CSDO_REQ        mem[4];
+    CO_CSDO_QUEUE_STAT stat;
+    uint8_t            serverId = 5;
+    uint32_t           val[3]   = { 0 };
+    uint8_t            n;
+    CO_ERR             err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node,0);
+    COCSdoQueueInit(&queue, &node, &mem[0], 4);
+
+    /* -- TEST -- */
+    err = COCSdoQueueUpload(&queue, 5, CO_DEV(0x2000, 1), (uint8_t *)&val[0], 4,
+                            TS_AppCSdoCallback, 1000);
+    TS_ASSERT(err == CO_ERR_NONE);
+    err = COCSdoQueueUpload(&queue, 5, CO_DEV(0x2000, 2), (uint8_t *)&val[1], 4,
+                            TS_AppCSdoCallback, 1000);
+    TS_ASSERT(err == CO_ERR_NONE);
+    err = COCSdoQueueUpload(&queue, 6, CO_DEV(0x2000, 3), (uint8_t *)&val[2], 4,
+                            TS_AppCSdoCallback, 1000);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    /* -- CHECK REQUESTS -- */
+    for (n = 0; n < 3; n++) {
+        CSdoQueueChkReq((n < 2) ? 5 : 6, 0x2000, n + 1);
+        CHK_NOCAN(&frm);
+        CHK_CB_CSDO_FINISHED(&CSdoQueueCb, n);
+
+        CSdoQueueSend((n < 2) ? 5 : 6, 0x43, 0x2000, n + 1, 0x11223344 + n);
+        CHK_CB_CSDO_FINISHED(&CSdoQueueCb, n + 1);
+        CHK_CB_CSDO_CODE(&CSdoQueueCb, 0);
+        TS_ASSERT(val[n] == 0x11223344u + n);
+    }
+    CHK_NOCAN(&frm);
+
+    COCSdoQueueGetStat(&queue, &stat, 0);
+    TS_ASSERT(stat.Done      ==  3);
+    TS_ASSERT(stat.Abort     ==  0);
+    TS_ASSERT(stat.Bytes     == 12);
+    TS_ASSERT(stat.Wait      ==  0);
+    TS_ASSERT(stat.Active    ==  0);
+    TS_ASSERT(stat.MaxActive ==  1);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Reject requests, when the request memory is exhausted
+*
+*           The request memory of the queue is released with the end of a
+*           transfer, therefore a new request is accepted afterwards.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoQueue_Full)
+{
+    CO_IF_FRM          frm;
+    CO_NODE            node;
+    CO_CSDO_QUEUE      queue;
+    CO_CSDO_REQ        mem[2];
+    uint8_t            serverId = 5;
+    uint8_t            val = 0;
+    CO_ERR             err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node,0);
+    COCSdoQueueInit(&queue, &node, &mem[0], 2);
+
+    /* -- TEST -- */
+    err = COCSdoQueueUpload(&queue, 5, CO_DEV(0x2000, 1), &val, 1,
+                            TS_AppCSdoCallback, 1000);
+    TS_ASSERT(err == CO_ERR_NONE);
+    err = COCSdoQueueUpload(&queue, 5, CO_DEV(0x2000, 2), &val, 1,
+                            TS_AppCSdoCallback, 1000);
+    TS_ASSERT(err == CO_ERR_NONE);
+    err = COCSdoQueueUpload(&queue, 5, CO_DEV(0x2000, 3), &val, 1,
+                            TS_AppCSdoCallback, 1000);
+    TS_ASSERT(err == CO_ERR_CSDO_QUEUE);
+    err = COCSdoQueueUpload(&queue, 0, CO_DEV(0x2000, 3), &val, 1,
+                            TS_AppCSdoCallback, 1000);
+    TS_ASSERT(err == CO_ERR_BAD_ARG);
+
+    CSdoQueueChkReq(5, 0x2000, 1);
+    CSdoQueueSend(5, 0x4F, 0x2000, 1, 0x22);
+    CHK_CB_CSDO_FINISHED(&CSdoQueueCb, 1);
+
+    /* -- CHECK REQUEST MEMORY IS RELEASED -- */
+    err = COCSdoQueueUpload(&queue, 5, CO_DEV(0x2000, 3), &val, 1,
+                            TS_AppCSdoCallback, 1000);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    CSdoQueueChkReq(5, 0x2000, 2);
+    CHK_NOCAN(&frm);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Continue with the next request after an abort
+*
+*           The aborted transfer is counted in the statistics and the next
+*           request to the same SDO server is started.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoQueue_Abort)
+{
+    CO_NODE            node;
+    CO_CSDO_QUEUE      queue;
+    CO_CSDO_REQ        mem[2];
+    CO_CSDO_QUEUE_STAT stat;
+    uint8_t            serverId = 5;
+    uint8_t            val = 0;
+    CO_ERR             err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node,0);
+    COCSdoQueueInit(&queue, &node, &mem[0], 2);
+
+    /* -- TEST -- */
+    err = COCSdoQueueUpload(&queue, 5, CO_DEV(0x2000, 1), &val, 1,
+                            TS_AppCSdoCallback, 1000);
+    TS_ASSERT(err == CO_ERR_NONE);
+    err = COCSdoQueueUpload(&queue, 5, CO_DEV(0x2000, 2), &val, 1,
+                            TS_AppCSdoCallback, 1000);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    CSdoQueueChkReq(5, 0x2000, 1);
+    CSdoQueueSend(5, 0x80, 0x2000, 1, 0x06020000);
+    CHK_CB_CSDO_FINISHED(&CSdoQueueCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoQueueCb, 0x06020000);
+
+    CSdoQueueChkReq(5, 0x2000, 2);
+    CSdoQueueSend(5, 0x4F, 0x2000, 2, 0x33);
+    CHK_CB_CSDO_FINISHED(&CSdoQueueCb, 2);
+    CHK_CB_CSDO_CODE(&CSdoQueueCb, 0);
+    TS_ASSERT(val == 0x33);
+
+    COCSdoQueueGetStat(&queue, &stat, 1);
+    TS_ASSERT(stat.Done  == 1);
+    TS_ASSERT(stat.Abort == 1);
+    TS_ASSERT(stat.Bytes == 1);
+    COCSdoQueueGetStat(&queue, &stat, 0);
+    TS_ASSERT(stat.Done  == 0);
+    TS_ASSERT(stat.Abort == 0);
+    TS_ASSERT(stat.Bytes == 0);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Start the next request without the timeout of the previous one
+*
+*           The timeout of a finished transfer is stopped, so the next
+*           transfer of the SDO client is aborted with its own timeout only.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoQueue_Timeout)
+{
+    CO_NODE            node;
+    CO_CSDO_QUEUE      queue;
+    CO_CSDO_REQ        mem[2];
+    uint8_t            serverId = 5;
+    uint8_t            val = 0;
+    CO_ERR             err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node,0);
+    COCSdoQueueInit(&queue, &node, &mem[0], 2);
+
+    /* -- TEST -- */
+    err = COCSdoQueueUpload(&queue, 5, CO_DEV(0x2000, 1), &val, 1,
+                            TS_AppCSdoCallback, 100);
+    TS_ASSERT(err == CO_ERR_NONE);
+    err = COCSdoQueueUpload(&queue, 5, CO_DEV(0x2000, 2), &val, 1,
+                            TS_AppCSdoCallback, 100);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    CSdoQueueChkReq(5, 0x2000, 1);
+    TS_Wait(&node, 60);
+    CSdoQueueSend(5, 0x4F, 0x2000, 1, 0x22);
+    CHK_CB_CSDO_FINISHED(&CSdoQueueCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoQueueCb, 0);
+    CSdoQueueChkReq(5, 0x2000, 2);
+
+    /* -- CHECK TIMEOUT OF FIRST TRANSFER IS STOPPED -- */
+    TS_Wait(&node, 60);
+    CHK_CB_CSDO_FINISHED(&CSdoQueueCb, 1);
+
+    TS_Wait(&node, 60);
+    CHK_CB_CSDO_FINISHED(&CSdoQueueCb, 2);
+    CHK_CB_CSDO_CODE(&CSdoQueueCb, 0x05040000);
+
+    CHK_NO_ERR(&node);
+}
+
+/*---------------------------------------------------------------------------*/
+/*!
+* \brief    Count the received bytes of a short expedited upload
+*
+*           The SDO server responds with less bytes than the request buffer
+*           provides; the statistics count the received bytes only.
+*/
+/*---------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_CSdoQueue_Bytes)
+{
+    CO_NODE            node;
+    CO_CSDO_QUEUE      queue;
+    CO_CSDO_REQ        mem[1];
+    CO_CSDO_QUEUE_STAT stat;
+    uint8_t            serverId = 5;
+    uint32_t           val = 0;
+    CO_ERR             err;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_CreateCSdoCom(0, &serverId);
+    TS_CreateNode(&node,0);
+    COCSdoQueueInit(&queue, &node, &mem[0], 1);
+
+    /* -- TEST -- */
+    err = COCSdoQueueUpload(&queue, 5, CO_DEV(0x2000, 1), (uint8_t *)&val, 4,
+                            TS_AppCSdoCallback, 1000);
+    TS_ASSERT(err == CO_ERR_NONE);
+
+    CSdoQueueChkReq(5, 0x2000, 1);
+    CSdoQueueSend(5, 0x4B, 0x2000, 1, 0x1234);
+    CHK_CB_CSDO_FINISHED(&CSdoQueueCb, 1);
+    CHK_CB_CSDO_CODE(&CSdoQueueCb, 0);
+
+    COCSdoQueueGetStat(&queue, &stat, 0);
+    TS_ASSERT(stat.Done  == 1);
+    TS_ASSERT(stat.Abort == 0);
+    TS_ASSERT(stat.Bytes == 2);
+
+    CHK_NO_ERR(&node);
+}
+
+static void CSdoQueueSetup(void)
+{
+    TS_CallbackInit(&CSdoQueueCb);
+}
+
+static void CSdoQueueCleanup(void)
+{
+    TS_CallbackDeInit();
+}
+
+/******************************************************************************
+* PUBLIC FUNCTIONS
+******************************************************************************/
+
+SUITE_CSDO_QUEUE()
+{
+    TS_Begin(__FILE__);
+    TS_SetupCase(CSdoQueueSetup, CSdoQueueCleanup);
+
+    TS_RUNNER(TS_CSdoQueue_Order);
+    TS_RUNNER(TS_CSdoQueue_Full);
+    TS_RUNNER(TS_CSdoQueue_Abort);
+    TS_RUNNER(TS_CSdoQueue_Timeout);
+    TS_RUNNER(TS_CSdoQueue_Bytes);
+
+    TS_End();
+}
+
+#endif
+
+/*! @} */
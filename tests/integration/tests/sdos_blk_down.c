@@ -666,6 +666,185 @@ TS_DEF_MAIN(TS_BlkWr_LostSeg)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*          This testcase will check the block download of an array with size = 994 Bytes and
+*          loosing one segment in the first block, followed by a complete block
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkWr_LostSegFullBlk)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint32_t    size = 994;
+    uint16_t    idx  = 0x2100;
+    uint8_t     sub  = 1;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT BLOCK DOWNLOAD ================*/
+    TS_SDO_SEND (0xC2, idx, sub, size);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA0);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_BLKSIZE (frm, CO_SDO_BUF_SEG);                /* check block size                         */
+
+                                                      /*===== BLOCK DOWNLOAD =====================*/
+    TS_SendBlk(0x00, 127, 0, 3);                      /* transmit segments in block; 3 is lost    */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 2);                             /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, CO_SDO_BUF_SEG);                /* check next block size                    */
+
+                                                      /*===== RE-SEND FAILED BLOCK DOWNLOAD ======*/
+    TS_SendBlk(0x0E, 127, 0, 0);                      /* transmit complete block from segment 3   */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 127);                           /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, CO_SDO_BUF_SEG);                /* check next block size                    */
+
+    TS_SendBlk(0x87, 13, 1, 0);                       /* cont. transmit segments to (last) block  */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 13);                            /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, CO_SDO_BUF_SEG);                /* check next block size                    */
+
+                                                      /*===== END BLOCK DOWNLOAD =================*/
+    TS_EBLK_SEND(0xC1, 0x00000000);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA1);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+    CHK_DOM_FULL(dom, 0);                             /* check content of domain                  */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*          This testcase will check the block download of an array with size = 994 Bytes with
+*          CRC, including the repetition of a block
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkWr_Crc)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint32_t    size = 994;
+    uint16_t    idx  = 0x2100;
+    uint8_t     sub  = 1;
+    uint16_t    crc  = 0;
+    uint32_t    n;
+    uint8_t     val;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    TS_CreateNode(&node,0);
+
+    for (n = 0; n < size; n++) {
+        val = (uint8_t)n;
+        crc = COSdoCrc(crc, &val, 1);
+    }
+                                                      /*===== INIT BLOCK DOWNLOAD ================*/
+    TS_SDO_SEND (0xC6, idx, sub, size);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA4);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_BLKSIZE (frm, CO_SDO_BUF_SEG);                /* check block size                         */
+
+                                                      /*===== BLOCK DOWNLOAD =====================*/
+    TS_SendBlk(0x00, 127, 0, 3);                      /* transmit segments in block; 3 is lost    */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 2);                             /* check acknowledged sequence number       */
+
+    TS_SendBlk(0x0E, 127, 0, 0);                      /* transmit complete block from segment 3   */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 127);                           /* check acknowledged sequence number       */
+
+    TS_SendBlk(0x87, 13, 1, 0);                       /* cont. transmit segments to (last) block  */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 13);                            /* check acknowledged sequence number       */
+
+                                                      /*===== END BLOCK DOWNLOAD =================*/
+    TS_EBLK_SEND(0xC1, crc);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA1);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+    CHK_DOM_FULL(dom, 0);                             /* check content of domain                  */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*      This testcase will check the Abort code "CRC error (block mode only)"
+*                                   Abort code 0x05040004
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkWr_CrcBad)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    uint32_t    size = 42;
+    uint16_t    idx  = 0x2100;
+    uint8_t     sub  = 1;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    DomCreate(idx, sub, CO_OBJ_____RW, size);
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT BLOCK DOWNLOAD ================*/
+    TS_SDO_SEND (0xC6, idx, sub, size);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA4);                          /* check SDO #0 response (Id and DLC)       */
+
+                                                      /*===== BLOCK DOWNLOAD =====================*/
+    TS_SendBlk(0x00, 6, 1, 0);                        /* transmit segments in block               */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 6);                             /* check acknowledged sequence number       */
+
+                                                      /*===== END BLOCK DOWNLOAD =================*/
+    TS_EBLK_SEND(0xC1, 0x1234);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0x80);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, 0x05040004);                    /* check abort code                         */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief TESTCASE DESCRIPTION
 *
@@ -1413,6 +1592,251 @@ TS_DEF_MAIN(TS_BlkWr_ExpWrAfter43ByteDomain)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*          This testcase will check the protocol timeout of the SDO server during a block
+*          download with missing segments: the transfer is aborted and a following expedited
+*          download is executed.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkWr_Timeout)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    uint32_t    size = 42;
+    uint16_t    idx  = 0x2100;
+    uint8_t     sub  = 1;
+    uint32_t    val  = 0;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    (void)DomCreate(idx, sub, CO_OBJ_____RW, size);
+    TS_ODAdd(CO_KEY(0x2510, 3, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+                                                      /*===== INIT BLOCK DOWNLOAD ================*/
+    TS_SDO_SEND (0xC2, idx, sub, size);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA0);                          /* check SDO #0 response (Id and DLC)       */
+
+                                                      /*===== INCOMPLETE BLOCK DOWNLOAD ==========*/
+    TS_SendBlk(0x00, 3, 0, 0);                        /* transmit first segments of the block     */
+    CHK_NOCAN   (&frm);                               /* check for no CAN frame                   */
+
+                                                      /*===== WAIT FOR PROTOCOL TIMEOUT ==========*/
+    TS_Wait(&node, CO_SSDO_TMO + 10);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0x80);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, 0x05040000);                    /* check abort code                         */
+
+                                                      /*===== EXPEDITED DOWNLOAD =================*/
+    TS_SDO_SEND (0x23, 0x2510, 3, 0x12345678);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0x60);                          /* check SDO #0 response (Id and DLC)       */
+    TS_ASSERT(0x12345678 == val);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block download with a configured block size of the SDO
+*         server
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkWr_BlkSize)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint32_t    size = 42;
+    uint16_t    idx  = 0x2100;
+    uint8_t     sub  = 1;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    TS_CreateNode(&node,0);
+    TS_ASSERT(CO_ERR_BAD_ARG == COSdoSetBlock(&node.Sdo[0], 0, 0));
+    TS_ASSERT(CO_ERR_BAD_ARG == COSdoSetBlock(&node.Sdo[0], 128, 0));
+    TS_ASSERT(CO_ERR_NONE    == COSdoSetBlock(&node.Sdo[0], 5, 0));
+                                                      /*===== INIT BLOCK DOWNLOAD ================*/
+    TS_SDO_SEND (0xC2, idx, sub, size);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA0);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_BLKSIZE (frm, 5);                             /* check block size                         */
+    TS_ASSERT(CO_ERR_SDO_BUSY == COSdoSetBlock(&node.Sdo[0], 7, 0));
+
+                                                      /*===== BLOCK DOWNLOAD =====================*/
+    TS_SendBlk(0x00, 5, 0, 0);                        /* transmit segments in block               */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 5);                             /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, 5);                             /* check next block size                    */
+
+    TS_SendBlk(0x23, 1, 1, 0);                        /* cont. transmit segment in (last) block   */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 1);                             /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, 5);                             /* check next block size                    */
+
+                                                      /*===== END BLOCK DOWNLOAD =================*/
+    TS_EBLK_SEND(0xC1, 0x00000000);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA1);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    CHK_DOM_FULL(dom, 0);                             /* check content of domain                  */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block download with deferred write: a block is acknowledged
+*         before it is written, the acknowledge of the next block is held back until the previous
+*         block is written.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkWr_Defer)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint32_t    size = 42;
+    uint16_t    idx  = 0x2100;
+    uint8_t     sub  = 1;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    TS_CreateNode(&node,0);
+    TS_ASSERT(CO_ERR_NONE == COSdoSetBlock(&node.Sdo[0], 2, 1));
+                                                      /*===== INIT BLOCK DOWNLOAD ================*/
+    TS_SDO_SEND (0xC2, idx, sub, size);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA0);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_BLKSIZE (frm, 2);                             /* check block size                         */
+
+                                                      /*===== FIRST BLOCK: ACK BEFORE WRITE ======*/
+    TS_SendBlk(0x00, 2, 0, 0);                        /* transmit segments in block               */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 2);                             /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, 2);                             /* check next block size                    */
+    TS_ASSERT(0xFF == dom->Start[0]);                 /* check block is not written yet           */
+
+                                                      /*===== SECOND BLOCK: ACK IS HELD BACK =====*/
+    TS_SendBlk(0x0E, 2, 0, 0);                        /* cont. transmit segments in block         */
+    CHK_NOCAN   (&frm);                               /* check for no CAN frame                   */
+
+    TS_Wait(&node, 2);                                /* first block is written                   */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 2);                             /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, 2);                             /* check next block size                    */
+    TS_ASSERT(0x00 == dom->Start[0]);                 /* check first block is written             */
+    TS_ASSERT(0x0D == dom->Start[13]);
+    TS_ASSERT(0xFF == dom->Start[14]);                /* check second block is not written yet    */
+
+                                                      /*===== LAST BLOCK =========================*/
+    TS_SendBlk(0x1C, 2, 1, 0);                        /* cont. transmit segments in (last) block  */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 2);                             /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, 2);                             /* check next block size                    */
+
+                                                      /*===== END BLOCK DOWNLOAD =================*/
+    TS_EBLK_SEND(0xC1, 0x00000000);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA1);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    CHK_DOM_FULL(dom, 0);                             /* check content of domain                  */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block download of an UNSIGNED64 entry with block size 1:
+*         the entry is written once with the end of the transfer.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkWr_64BitBlkSize1)
+{
+    CO_IF_FRM  frm;
+    CO_NODE    node;
+    uint16_t   idx  = 0x2540;
+    uint8_t    sub  = 1;
+    uint64_t   val  = 0;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), CO_TUNSIGNED64, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+    TS_ASSERT(CO_ERR_NONE == COSdoSetBlock(&node.Sdo[0], 1, 0));
+                                                      /*===== INIT BLOCK DOWNLOAD ================*/
+    TS_SDO_SEND (0xC2, idx, sub, 8);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA0);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_BLKSIZE (frm, 1);                             /* check block size                         */
+
+                                                      /*===== FIRST BLOCK ========================*/
+    TS_SendBlk(0x00, 1, 0, 0);                        /* transmit segment in block                */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 1);                             /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, 1);                             /* check next block size                    */
+    TS_ASSERT(0 == val);                              /* check entry is not written yet           */
+
+                                                      /*===== LAST BLOCK =========================*/
+    TS_SendBlk(0x07, 1, 1, 0);                        /* transmit segment in (last) block         */
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ACKSEQ  (frm, 1);                             /* check acknowledged sequence number       */
+    CHK_NEXTBLK (frm, 1);                             /* check next block size                    */
+
+                                                      /*===== END BLOCK DOWNLOAD =================*/
+    TS_EBLK_SEND(0xD9, 0x00000000);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xA1);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+    TS_ASSERT(0x0706050403020100 == val);             /* check written entry                      */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -1435,6 +1859,9 @@ SUITE_BLK_DOWN()
     TS_RUNNER(TS_BlkWr_41ByteDomain_NoLen);
     TS_RUNNER(TS_BlkWr_1000ByteDomain_NoLen);
     TS_RUNNER(TS_BlkWr_LostSeg);
+    TS_RUNNER(TS_BlkWr_LostSegFullBlk);
+    TS_RUNNER(TS_BlkWr_Crc);
+    TS_RUNNER(TS_BlkWr_CrcBad);
     TS_RUNNER(TS_BlkWr_890ByteDomain);
     TS_RUNNER(TS_BlkWr_889ByteDomain);
     TS_RUNNER(TS_BlkWr_46ByteDomain);
@@ -1451,6 +1878,10 @@ SUITE_BLK_DOWN()
     TS_RUNNER(TS_BlkWr_42ByteDomain_49Byte);
     TS_RUNNER(TS_BlkWr_42ByteDomain_49Byte_NoLen);
     TS_RUNNER(TS_BlkWr_ExpWrAfter43ByteDomain);
+    TS_RUNNER(TS_BlkWr_Timeout);
+    TS_RUNNER(TS_BlkWr_BlkSize);
+    TS_RUNNER(TS_BlkWr_Defer);
+    TS_RUNNER(TS_BlkWr_64BitBlkSize1);
 
 //    CanDiagnosticOff(0);
 
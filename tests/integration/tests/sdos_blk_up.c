@@ -103,6 +103,160 @@ TS_DEF_MAIN(TS_BlkRd_Basic)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block upload of an UNSIGNED64 entry
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_64BitValue)
+{
+    CO_IF_FRM  frm;
+    CO_NODE    node;
+    uint16_t   idx  = 0x2540;
+    uint8_t    sub  = 1;
+    uint64_t   val  = 0x0706050403020100;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____R_), CO_TUNSIGNED64, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+                                                      /*===== INIT BLOCK UPLOAD (PHASE I) ========*/
+    TS_SDO_SEND (0xA0, idx, sub, CO_SDO_BUF_SEG);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, 8);                             /* check block size                         */
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE II) =======*/
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+
+                                                      /*===== BLOCK UPLOAD =======================*/
+    TS_ChkBlk(0x00, 2, 1, 1);                         /* check received block                     */
+
+                                                      /*===== ACKNOWLEDGE BLOCK ==================*/
+    TS_ACKBLK_SEND(0xA2, 2, CO_SDO_BUF_SEG);
+
+                                                      /*===== END BLOCK UPLOAD ===================*/
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xD9);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    TS_EBLK_SEND(0xA1, 0x00000000);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block upload of an UNSIGNED64 entry with block size 1
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_64BitBlkSize1)
+{
+    CO_IF_FRM  frm;
+    CO_NODE    node;
+    uint16_t   idx  = 0x2540;
+    uint8_t    sub  = 1;
+    uint64_t   val  = 0x0706050403020100;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____R_), CO_TUNSIGNED64, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+                                                      /*===== INIT BLOCK UPLOAD (PHASE I) ========*/
+    TS_SDO_SEND (0xA0, idx, sub, 1);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, 8);                             /* check block size                         */
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE II) =======*/
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+
+                                                      /*===== FIRST BLOCK UPLOAD =================*/
+    TS_ChkBlk(0x00, 1, 0, 7);                         /* check received block                     */
+    TS_ACKBLK_SEND(0xA2, 1, 1);
+
+                                                      /*===== LAST BLOCK UPLOAD ==================*/
+    TS_ChkBlk(0x07, 1, 1, 1);                         /* check received block                     */
+    TS_ACKBLK_SEND(0xA2, 1, 1);
+
+                                                      /*===== END BLOCK UPLOAD ===================*/
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xD9);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    TS_EBLK_SEND(0xA1, 0x00000000);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the block upload of a SIGNED40 entry
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_40BitSigned)
+{
+    CO_IF_FRM  frm;
+    CO_NODE    node;
+    uint16_t   idx  = 0x2540;
+    uint8_t    sub  = 2;
+    int64_t    val  = -2;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____R_), CO_TSIGNED40, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+                                                      /*===== INIT BLOCK UPLOAD (PHASE I) ========*/
+    TS_SDO_SEND (0xA0, idx, sub, CO_SDO_BUF_SEG);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, 5);                             /* check block size                         */
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE II) =======*/
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+
+                                                      /*===== BLOCK UPLOAD =======================*/
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    TS_ASSERT(0x81 == BYTE(frm,0));
+    TS_ASSERT(0xFE == BYTE(frm,1));
+    TS_ASSERT(0xFF == BYTE(frm,2));
+    TS_ASSERT(0xFF == BYTE(frm,3));
+    TS_ASSERT(0xFF == BYTE(frm,4));
+    TS_ASSERT(0xFF == BYTE(frm,5));
+    TS_ASSERT(0x00 == BYTE(frm,6));
+    TS_ASSERT(0x00 == BYTE(frm,7));
+
+                                                      /*===== ACKNOWLEDGE BLOCK ==================*/
+    TS_ACKBLK_SEND(0xA2, 1, CO_SDO_BUF_SEG);
+
+                                                      /*===== END BLOCK UPLOAD ===================*/
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC9);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    TS_EBLK_SEND(0xA1, 0x00000000);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief TESTCASE DESCRIPTION
 *
@@ -725,6 +879,124 @@ TS_DEF_MAIN(TS_BlkRd_LostFirstSeg)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*          This testcase will check the block upload of an array with size = 994 Bytes and
+*          loosing one segment in the first block. The repeated block is refilled with the
+*          following data of the domain (Go-Back-N ARQ)
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_LostSegRefill)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom ;
+    uint32_t    size = 994;
+    uint16_t    idx  = 0x2520;
+    uint8_t     sub  = 6;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    DomFill(dom, 0);
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE I) ========*/
+    TS_SDO_SEND (0xA0, idx, sub, CO_SDO_BUF_SEG);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC2);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, size);                          /* check block size                         */
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE II) =======*/
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+
+                                                      /*===== BLOCK UPLOAD =======================*/
+    TS_ChkBlk  (0x00, 127, 0, 7);                     /* check received block                     */
+    TS_ACKBLK_SEND(0xA2,   2, CO_SDO_BUF_SEG);        /* ack for segment 1-2 (segment 3: lost)    */
+
+    TS_ChkBlk  (0x0E, 127, 0, 7);                     /* check repeated and refilled block        */
+    TS_ACKBLK_SEND(0xA2, 127, CO_SDO_BUF_SEG);
+
+    TS_ChkBlk  (0x87,  13, 1, 7);                     /* check received block                     */
+    TS_ACKBLK_SEND(0xA2,  13, CO_SDO_BUF_SEG);
+
+                                                      /*===== END BLOCK UPLOAD ===================*/
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC1);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO    (frm);                                /* check cleared data area                  */
+
+    TS_EBLK_SEND(0xA1, 0x00000000);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*          This testcase will check the block upload of an array with size = 995 Bytes with
+*          CRC, including the repetition of a block
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_BlkRd_Crc)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom ;
+    uint32_t    size = 995;
+    uint16_t    idx  = 0x2520;
+    uint8_t     sub  = 6;
+    uint16_t    crc  = 0;
+    uint32_t    n;
+    uint8_t     val;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    DomFill(dom, 0);
+    TS_CreateNode(&node,0);
+
+    for (n = 0; n < size; n++) {
+        val = (uint8_t)n;
+        crc = COSdoCrc(crc, &val, 1);
+    }
+                                                      /*===== INIT BLOCK UPLOAD (PHASE I) ========*/
+    TS_SDO_SEND (0xA4, idx, sub, CO_SDO_BUF_SEG);
+
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xC6);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX   (frm, idx, sub);                      /* check multiplexer                        */
+    CHK_DATA    (frm, size);                          /* check block size                         */
+
+                                                      /*===== INIT BLOCK UPLOAD (PHASE II) =======*/
+    TS_SDO_SEND (0xA3, 0x0000, 0, 0);
+
+                                                      /*===== BLOCK UPLOAD =======================*/
+    TS_ChkBlk  (0x00, 127, 0, 7);                     /* check received block                     */
+    TS_ACKBLK_SEND(0xA2,   2, CO_SDO_BUF_SEG);        /* ack for segment 1-2 (segment 3: lost)    */
+
+    TS_ChkBlk  (0x0E, 127, 0, 7);                     /* check repeated and refilled block        */
+    TS_ACKBLK_SEND(0xA2, 127, CO_SDO_BUF_SEG);
+
+    TS_ChkBlk  (0x87,  14, 1, 1);                     /* check received block                     */
+    TS_ACKBLK_SEND(0xA2,  14, CO_SDO_BUF_SEG);
+
+                                                      /*===== END BLOCK UPLOAD ===================*/
+    CHK_CAN     (&frm);                               /* check for a CAN frame                    */
+    CHK_SDO0    (frm, 0xD9);                          /* check SDO #0 response (Id and DLC)       */
+    CHK_WORD    (frm, 1, crc);                        /* check CRC                                */
+
+    TS_EBLK_SEND(0xA1, 0x00000000);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /*! \brief TESTCASE DESCRIPTION
 *
@@ -1344,6 +1616,9 @@ SUITE_BLK_UP()
 //    CanDiagnosticOn(0);
 
     TS_RUNNER(TS_BlkRd_Basic);
+    TS_RUNNER(TS_BlkRd_64BitValue);
+    TS_RUNNER(TS_BlkRd_64BitBlkSize1);
+    TS_RUNNER(TS_BlkRd_40BitSigned);
     TS_RUNNER(TS_BlkRd_42ByteDomain);
     TS_RUNNER(TS_BlkRd_43ByteDomain);
     TS_RUNNER(TS_BlkRd_41ByteDomain);
@@ -1356,6 +1631,8 @@ SUITE_BLK_UP()
     TS_RUNNER(TS_BlkRd_LostMiddleSeg);
     TS_RUNNER(TS_BlkRd_LostLastSeg);
     TS_RUNNER(TS_BlkRd_LostFirstSeg);
+    TS_RUNNER(TS_BlkRd_LostSegRefill);
+    TS_RUNNER(TS_BlkRd_Crc);
     TS_RUNNER(TS_BlkRd_BadCmd);
     TS_RUNNER(TS_BlkRd_ObjNotExist);
     TS_RUNNER(TS_BlkRd_SubIdxNotExist);
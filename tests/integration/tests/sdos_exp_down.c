@@ -32,6 +32,7 @@
 *   - byte   : object value is a byte
 *   - word   : object value is a word
 *   - long   : object value is a long
+*   - 3byte  : object value is a 24bit value
 *   - no-data: object data reference is invalid (NULL)
 *   - small  : written size is smaller than object size
 *   - large  : written size is larger than object size
@@ -52,6 +53,7 @@
 * \ref TS_ExpWr_1ByteVar         | var    | byte    | none    | ok     | F
 * \ref TS_ExpWr_2ByteVar         | var    | word    | none    | ok     | F
 * \ref TS_ExpWr_4ByteVar         | var    | long    | none    | ok     | F
+* \ref TS_ExpWr_3ByteVar         | var    | 3byte   | none    | ok     | F
 * \ref TS_ExpWr_2ByteVar_NoLen   | const  | long    | none    | ok     | F
 * \ref TS_ExpWr_BadCmd           | --     | --      | --      | badcmd | R
 * \ref TS_ExpWr_ObjNotExist      | badidx | --      | --      | ok     | R
@@ -347,6 +349,48 @@ TS_DEF_MAIN(TS_ExpWr_4ByteVar)
     CHK_NO_ERR(&node);
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Write a variable SIGNED24 to object dictionary
+*
+* \details  This test checks, that the expedited download of a negative "SIGNED24/RW" variable
+*           is working.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including a variable of type SIGNED24/RW.
+*
+* ####      Test Steps
+*           1. Send SDO expedited download request with 3 data bytes
+*
+* ####      Test Checks
+*           1. Check, that SDO server response is correct
+*           2. Check, that value is written sign extended in object dictionary
+*           3. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ExpWr_3ByteVar)
+{
+    CO_NODE  node;
+    uint16_t idx  = 0x2500;
+    uint8_t  sub  = 4;
+    int32_t  val  = 0;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ____PRW), CO_TSIGNED24, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+
+    /* -- TEST -- */
+    TS_SDO_SEND (0x27, idx, sub, 0x55800000);
+
+    /* -- CHECK -- */
+    CHK_SDO0_OK(idx, sub);
+
+    TS_ASSERT(-8388608 == val);
+
+    CHK_NO_ERR(&node);
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /*!
 * \brief    Write a variable word to object dictionary
@@ -722,6 +766,7 @@ SUITE_EXP_DOWN()
     TS_RUNNER(TS_ExpWr_1ByteVar);
     TS_RUNNER(TS_ExpWr_2ByteVar);
     TS_RUNNER(TS_ExpWr_4ByteVar);
+    TS_RUNNER(TS_ExpWr_3ByteVar);
     TS_RUNNER(TS_ExpWr_2ByteVar_NoLen);
 
     TS_RUNNER(TS_ExpWr_BadCmd);
@@ -32,6 +32,7 @@
 *   - byte   : object value is a byte
 *   - word   : object value is a word
 *   - long   : object value is a long
+*   - 3byte  : object value is a 24bit value
 *   - nodata : object data reference is invalid (NULL)
 * + prop: object entry property
 *   - none   : no special property set
@@ -51,6 +52,7 @@
 * \ref TS_ExpRd_1ByteVar         | var    | byte    | none    | ok     | F
 * \ref TS_ExpRd_2ByteVar         | var    | word    | none    | ok     | F
 * \ref TS_ExpRd_4ByteVar         | var    | long    | none    | ok     | F
+* \ref TS_ExpRd_3ByteVar         | var    | 3byte   | none    | ok     | F
 * \ref TS_ExpRd_4ByteConst       | const  | long    | none    | ok     | F
 * \ref TS_ExpRd_4ByteConstNodeId | const  | long    | node-id | ok     | F
 * \ref TS_ExpRd_2ByteParaNodeId  | para   | word    | node-id | ok     | F
@@ -363,6 +365,51 @@ TS_DEF_MAIN(TS_ExpRd_4ByteVar)
     CHK_NO_ERR(&node);
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*!
+* \brief    Read a variable SIGNED24 from object dictionary
+*
+* \details  This test checks, that the expedited Upload of a negative "SIGNED24/RW" variable
+*           is working.
+*
+* ####      Test Preparation
+*           1. Prepare object dictionary including a variable of type SIGNED24/RW.
+*
+* ####      Test Steps
+*           1. Send SDO expedited upload request
+*
+* ####      Test Checks
+*           1. Check, that SDO server send a response
+*           2. Check, that SDO server response contains 3 data bytes
+*           3. Check, that CANopen stack executes this error free
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_ExpRd_3ByteVar)
+{
+    CO_IF_FRM frm;
+    CO_NODE   node;
+    uint16_t  idx  = 0x2500;
+    uint8_t   sub  = 4;
+    int32_t   val  = -2;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ____PRW), CO_TSIGNED24, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+
+    /* -- TEST -- */
+    TS_SDO_SEND (0x40, idx, sub, 0x00000000);
+
+    /* -- CHECK -- */
+    CHK_CAN  (&frm);
+
+    CHK_SDO0 (frm, 0x47);
+    CHK_MLTPX(frm, idx, sub);
+    CHK_DATA (frm, 0x00FFFFFE);
+
+    CHK_NO_ERR(&node);
+}
+
 /*------------------------------------------------------------------------------------------------*/
 /*!
 * \brief    Read a constant long from object dictionary
@@ -784,6 +831,7 @@ SUITE_EXP_UP()
     TS_RUNNER(TS_ExpRd_1ByteVar);
     TS_RUNNER(TS_ExpRd_2ByteVar);
     TS_RUNNER(TS_ExpRd_4ByteVar);
+    TS_RUNNER(TS_ExpRd_3ByteVar);
     TS_RUNNER(TS_ExpRd_4ByteConst);
     TS_RUNNER(TS_ExpRd_4ByteConstNodeId);
     TS_RUNNER(TS_ExpRd_2ByteParaNodeId);
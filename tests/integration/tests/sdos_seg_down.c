@@ -718,6 +718,159 @@ TS_DEF_MAIN(TS_SegWr_RestartTransfer)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*         This testcase will check the segmented download of a concise DCF, which is shorter
+*         than the buffer of the concise DCF object. Both records are written with the last
+*         segment.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SegWr_ConciseDcf)
+{
+    CO_IF_FRM   frm;
+    uint8_t     tgl;
+    CO_NODE     node;
+    CO_OBJ_CDCF cdcf = { 0 };
+    uint8_t     buf[64];
+    uint8_t     undo[8];
+    uint8_t     val8  = 0;
+    uint32_t    val32 = 0;
+    uint8_t     dcf[28] = { 0x02, 0x00, 0x00, 0x00,
+                            0x10, 0x25, 0x01, 0x01, 0x00, 0x00, 0x00, 0x5A,
+                            0x10, 0x25, 0x02, 0x04, 0x00, 0x00, 0x00, 0x04, 0x03, 0x02, 0x01 };
+    uint32_t    size = 23;
+    uint16_t    idx  = 0x2600;
+    uint8_t     sub  = 0;
+    uint8_t     id;
+                                                      /*------------------------------------------*/
+    cdcf.Size     = sizeof(buf);
+    cdcf.Start    = &buf[0];
+    cdcf.Undo     = &undo[0];
+    cdcf.UndoSize = sizeof(undo);
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(0x2510, 1, CO_OBJ_____RW), CO_TUNSIGNED8 , (CO_DATA)(&val8));
+    TS_ODAdd(CO_KEY(0x2510, 2, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&val32));
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), CO_TCDCF, (CO_DATA)(&cdcf));
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT SEGMENTED DOWNLOAD  ===========*/
+    TS_SDO_SEND (0x21, idx, sub, size);
+
+    CHK_SDO0_OK(idx, sub);
+
+                                                      /*===== SEGMENTED DOWNLOAD  ================*/
+    tgl = 0x00;                                       /* start with toggle bit 0                  */
+    for (id = 0; id < (size-7); id += 7) {
+        SimCanSetFrm(0x601, 8, tgl, dcf[id], dcf[id+1], dcf[id+2], dcf[id+3],
+                     dcf[id+4], dcf[id+5], dcf[id+6]);
+        SimCanRun();
+
+        CHK_CAN  (&frm);                              /* check for a CAN frame                    */
+        CHK_SDO0 (frm, (0x20 | tgl));                 /* check SDO #0 response (Id and DLC)       */
+        CHK_ZERO (frm);                               /* check data area                          */
+                                                      /*------------------------------------------*/
+        tgl ^= 0x10;                                  /* prepare the toggle bit for next request  */
+    }
+    TS_ASSERT(0 == val8);                             /* nothing written before last segment     */
+
+                                                      /*===== LAST SEGMENTED DOWNLOAD  ===========*/
+    SimCanSetFrm(0x601, 8, (0x0B | tgl), dcf[id], dcf[id+1], 0, 0, 0, 0, 0);
+    SimCanRun();
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_SDO0 (frm, (0x20 | tgl));                     /* check SDO #0 response (Id and DLC)       */
+    CHK_ZERO (frm);                                   /* check data area                          */
+
+    TS_ASSERT(0x5A == val8);
+    TS_ASSERT(0x01020304 == val32);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*          This testcase will check the segmented download of an UNSIGNED64 entry
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SegWr_64BitValue)
+{
+    CO_IF_FRM  frm;
+    CO_NODE    node;
+    uint16_t   idx  = 0x2540;
+    uint8_t    sub  = 1;
+    uint64_t   val  = 0;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), CO_TUNSIGNED64, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+                                                      /*===== INIT SEGMENTED DOWNLOAD  ===========*/
+    TS_SDO_SEND (0x21, idx, sub, 8);
+
+    CHK_SDO0_OK(idx, sub);
+                                                      /*===== SEGMENTED DOWNLOAD  ================*/
+    TS_SEG_SEND(0x00, 0);
+
+    CHK_CAN  (&frm);
+    CHK_SDO0 (frm, 0x20);
+    CHK_ZERO (frm);
+
+    TS_ASSERT(0 == val);                              /* entry is written with the last segment   */
+                                                      /*===== LAST SEGMENTED DOWNLOAD  ===========*/
+    TS_SEG_SEND(0x1D, 7);
+
+    CHK_CAN  (&frm);
+    CHK_SDO0 (frm, 0x30);
+    CHK_ZERO (frm);
+
+    TS_ASSERT(0x0706050403020100 == val);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*          This testcase will check the sign extension of a segmented download to a SIGNED56 entry
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SegWr_56BitSigned)
+{
+    CO_IF_FRM  frm;
+    CO_NODE    node;
+    uint16_t   idx  = 0x2540;
+    uint8_t    sub  = 2;
+    int64_t    val  = 0;
+
+    /* -- PREPARATION -- */
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____RW), CO_TSIGNED56, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+                                                      /*===== INIT SEGMENTED DOWNLOAD  ===========*/
+    TS_SDO_SEND (0x21, idx, sub, 7);
+
+    CHK_SDO0_OK(idx, sub);
+                                                      /*===== LAST SEGMENTED DOWNLOAD  ===========*/
+    TS_SEG_SEND(0x01, 0xF9);
+
+    CHK_CAN  (&frm);
+    CHK_SDO0 (frm, 0x20);
+    CHK_ZERO (frm);
+
+    TS_ASSERT((int64_t)0xFFFFFEFDFCFBFAF9 == val);
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -730,6 +883,8 @@ SUITE_SEG_DOWN()
 
     TS_RUNNER(TS_SegWr_Basic);
     TS_RUNNER(TS_SegWr_Basic_Bad);
+    TS_RUNNER(TS_SegWr_64BitValue);
+    TS_RUNNER(TS_SegWr_56BitSigned);
     TS_RUNNER(TS_SegWr_42ByteDomain);
     TS_RUNNER(TS_SegWr_43ByteDomain);
     TS_RUNNER(TS_SegWr_41ByteDomain);
@@ -744,6 +899,7 @@ SUITE_SEG_DOWN()
     TS_RUNNER(TS_SegWr_DomainNullPtr);
     TS_RUNNER(TS_SegWr_BadToggleBit);
     TS_RUNNER(TS_SegWr_RestartTransfer);
+    TS_RUNNER(TS_SegWr_ConciseDcf);
 
 //    CanDiagnosticOff(0);
 
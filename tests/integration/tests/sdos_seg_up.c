@@ -24,6 +24,7 @@
 *
 * + obj: object entry type
 *   - dom    : object is a domain
+*   - u64    : object is an UNSIGNED64 entry
 *   - badidx : index of the object is not existing in object dictionary
 *   - badsub : subindex of the object is not existing in object dictionary
 * + size: object entry size
@@ -31,6 +32,7 @@
 *   - 6seg+1 : object value contains 6 segments plus 1 byte (=6 x 7 + 1 bytes)
 *   - 6seg-1 : object value contains 6 segments minus 1 byte (=6 x 7 - 1 bytes)
 *   - 3seg+2 : object value contains 3 segments plus 2 bytes (=3 x 7 + 2 bytes)
+*   - 1seg+1 : object value contains 1 segment plus 1 byte (=1 x 7 + 1 bytes)
 *   - no-data: object data reference is invalid (NULL)
 * + prop: object entry property
 *   - none   : no special property set
@@ -40,6 +42,7 @@
 *   - badcmd : bad SDO command in request
 *   - tgl1   : bad first toggle bit
 *   - tgl2   : bad second toggle bit
+*   - tmo    : no request within the SDO server timeout
 *
 * #### Test Definition
 *
@@ -49,6 +52,7 @@
 * \ref TS_SegRd_43ByteDomain    | dom    | 6seg+1  | none    | ok     | F
 * \ref TS_SegRd_41ByteDomain    | dom    | 6seg-1  | none    | ok     | F
 * \ref TS_SegRd_23ByteString    | dom    | 3seg+2  | none    | ok     | F
+* \ref TS_SegRd_64BitValue      | u64    | 1seg+1  | none    | ok     | F
 * \ref TS_SegRd_BadCmd          | --     | --      | --      | badcmd | R
 * \ref TS_SegRd_ObjNotExist     | badidx | --      | --      | ok     | R
 * \ref TS_SegRd_SubIdxNotExist  | badsub | --      | --      | ok     | R
@@ -56,6 +60,7 @@
 * \ref TS_SegRd_DomainNullPtr   | dom    | no-data | none    | ok     | R
 * \ref TS_SegRd_Bad1stToggleBit | dom    | 6seg    | none    | tgl1   | R
 * \ref TS_SegRd_Bad2ndToggleBit | dom    | 6seg    | none    | tgl2   | R
+* \ref TS_SegRd_Timeout         | dom    | 6seg    | none    | tmo    | R
 *
 * Type Legend: R = Robustness Test, F = Functional Test
 * @{
@@ -573,6 +578,110 @@ TS_DEF_MAIN(TS_SegRd_Bad2ndToggleBit)
     CHK_NO_ERR(&node);                                /* check error free stack execution         */
 }
 
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*          This testcase will check the protocol timeout of the SDO server during a segmented
+*          upload: the transfer is aborted and the next segment request is rejected.
+*
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SegRd_Timeout)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    CO_OBJ_DOM *dom;
+    uint32_t    size = 42;
+    uint16_t    idx  = 0x2520;
+    uint8_t     sub  = 2;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    dom = DomCreate(idx, sub, CO_OBJ_____RW, size);
+    DomFill(dom, 0);
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT SEGMENTED UPLOAD ==============*/
+    TS_SDO_SEND (0x40, idx, sub, size);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_SDO0 (frm, 0x41);                             /* check SDO #0 response (Id and DLC)       */
+
+                                                      /*===== FIRST SEGMENTED UPLOAD =============*/
+    TS_SDO_SEND(0x60, 0, 0, 0);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_SDO0 (frm, 0x00);                             /* check SDO #0 response (Id and DLC)       */
+    CHK_SEG  (frm, 0, 7);                             /* check segment data                       */
+
+                                                      /*===== WAIT FOR PROTOCOL TIMEOUT ==========*/
+    TS_Wait(&node, CO_SSDO_TMO / 2);
+    CHK_NOCAN(&frm);                                  /* check for no CAN frame                   */
+
+    TS_Wait(&node, CO_SSDO_TMO);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_SDO0 (frm, 0x80);                             /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX(frm, idx, sub);                         /* check multiplexer                        */
+    CHK_DATA (frm, 0x05040000);                       /* check abort code                         */
+
+                                                      /*===== SECOND SEGMENTED UPLOAD ============*/
+    TS_SDO_SEND(0x70, 0, 0, 0);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_SDO0 (frm, 0x80);                             /* check SDO #0 response (Id and DLC)       */
+    CHK_DATA (frm, 0x05040001);                       /* check abort code                         */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
+/*------------------------------------------------------------------------------------------------*/
+/*! \brief TESTCASE DESCRIPTION
+*
+* \ingroup TS_CO
+*
+*          This testcase will check the segmented upload of an UNSIGNED64 entry
+*/
+/*------------------------------------------------------------------------------------------------*/
+TS_DEF_MAIN(TS_SegRd_64BitValue)
+{
+    CO_IF_FRM   frm;
+    CO_NODE     node;
+    uint32_t    size = 8;
+    uint16_t    idx  = 0x2540;
+    uint8_t     sub  = 1;
+    uint64_t    val  = 0x0706050403020100;
+                                                      /*------------------------------------------*/
+    TS_CreateMandatoryDir();
+    TS_ODAdd(CO_KEY(idx, sub, CO_OBJ_____R_), CO_TUNSIGNED64, (CO_DATA)(&val));
+    TS_CreateNode(&node,0);
+
+                                                      /*===== INIT SEGMENTED UPLOAD ==============*/
+    TS_SDO_SEND (0x40, idx, sub, 0);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_SDO0 (frm, 0x41);                             /* check SDO #0 response (Id and DLC)       */
+    CHK_MLTPX(frm, idx, sub);                         /* check multiplexer                        */
+    CHK_DATA (frm, size);                             /* check data area                          */
+
+                                                      /*===== FIRST SEGMENTED UPLOAD =============*/
+    TS_SDO_SEND(0x60, 0, 0, 0);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_SDO0 (frm, 0x00);                             /* check SDO #0 response (Id and DLC)       */
+    CHK_SEG  (frm, 0, 7);                             /* check segment data                       */
+
+                                                      /*===== LAST SEGMENTED UPLOAD ==============*/
+    TS_SDO_SEND(0x70, 0, 0, 0);
+
+    CHK_CAN  (&frm);                                  /* check for a CAN frame                    */
+    CHK_SDO0 (frm, 0x1D);                             /* check SDO #0 response (Id and DLC)       */
+    CHK_SEG  (frm, 7, 1);                             /* check segment data                       */
+
+    CHK_NO_ERR(&node);                                /* check error free stack execution         */
+}
+
 /******************************************************************************
 * PUBLIC FUNCTIONS
 ******************************************************************************/
@@ -587,6 +696,7 @@ SUITE_SEG_UP()
     TS_RUNNER(TS_SegRd_43ByteDomain);
     TS_RUNNER(TS_SegRd_41ByteDomain);
     TS_RUNNER(TS_SegRd_23ByteString);
+    TS_RUNNER(TS_SegRd_64BitValue);
     TS_RUNNER(TS_SegRd_BadCmd);
     TS_RUNNER(TS_SegRd_ObjNotExist);
     TS_RUNNER(TS_SegRd_SubIdxNotExist);
@@ -594,6 +704,7 @@ SUITE_SEG_UP()
     TS_RUNNER(TS_SegRd_DomainNullPtr);
     TS_RUNNER(TS_SegRd_Bad1stToggleBit);
     TS_RUNNER(TS_SegRd_Bad2ndToggleBit);
+    TS_RUNNER(TS_SegRd_Timeout);
 
 //    CanDiagnosticOff(0);
 
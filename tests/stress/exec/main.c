@@ -0,0 +1,330 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L      /* nanosleep() and sched_yield()        */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "co_core.h"
+#include "drv_can_sim.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define ST_OBJ_N      16u            /* object dictionary length of a node   */
+#define ST_TMR_N      8u             /* number of timer actions of a node    */
+#define ST_HB_TIME    10u            /* heartbeat producer time in ms        */
+#define ST_HB_MIN     3u             /* expected heartbeats of each node     */
+#define ST_TIMEOUT    30u            /* maximal test duration in seconds     */
+
+#define ST_LOAD(v)    __atomic_load_n(&(v), __ATOMIC_ACQUIRE)
+#define ST_STORE(v,n) __atomic_store_n(&(v), (n), __ATOMIC_RELEASE)
+
+/******************************************************************************
+* PRIVATE TYPES
+******************************************************************************/
+
+typedef struct ST_NODE_T {
+    CO_NODE         Node;
+    CO_OBJ          Dict[ST_OBJ_N];
+    CO_TMR_MEM      TmrMem[ST_TMR_N];
+    uint8_t         SdoBuf[CO_SSDO_N * CO_SDO_BUF_BYTE];
+    uint8_t         Obj1001;
+    uint16_t        Obj1017;
+    uint32_t        Obj2100;
+    CO_EXEC_WORKER *Worker;
+    pthread_t       Thread;
+    uint32_t        Pdo;             /* received PDOs (written by bus thread) */
+    uint32_t        PdoErr;          /* PDOs with unexpected value            */
+    uint32_t        Hb;              /* received heartbeats                   */
+} ST_NODE;
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static const uint32_t StObj1014 = 0x80;
+static const uint32_t StObj1800 = CO_COBID_TPDO_DEFAULT(0);
+static const uint32_t StObj1A00 = CO_LINK(0x2100, 0x01, 32);
+
+static CO_EXEC  StExec;
+static ST_NODE  StNode[CO_EXEC_NODE_N];
+static uint32_t StNodeNum;
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* The shared bus uses the CAN simulation. Each sent frame is taken from the
+ * simulated bus immediately and checked within the bus thread.
+ */
+static void StCanInit(CO_IF *cif)
+{
+    SimCanDriver.Init(cif);
+}
+
+static void StCanEnable(CO_IF *cif, uint32_t baudrate)
+{
+    SimCanDriver.Enable(cif, baudrate);
+}
+
+static int16_t StCanRead(CO_IF *cif, CO_IF_FRM *frm)
+{
+    return (SimCanDriver.Read(cif, frm));
+}
+
+static int16_t StCanSend(CO_IF *cif, CO_IF_FRM *frm)
+{
+    CO_IF_FRM rx;
+    ST_NODE  *sn;
+    uint32_t  id;
+    uint32_t  val;
+    int16_t   result;
+
+    result = SimCanDriver.Send(cif, frm);
+    while (SimCanGetFrm((uint8_t *)&rx, sizeof(CO_IF_FRM)) > 0) {
+        id = rx.Identifier & 0x7Fu;
+        if ((id == 0u) || (id > StNodeNum)) {
+            continue;
+        }
+        sn = &StNode[id - 1u];
+        if ((rx.Identifier & ~0x7Fu) == 0x180u) {
+            val = (uint32_t)rx.Data[0]         |
+                  ((uint32_t)rx.Data[1] <<  8) |
+                  ((uint32_t)rx.Data[2] << 16) |
+                  ((uint32_t)rx.Data[3] << 24);
+            if (val != (sn->Pdo + 1u)) {
+                ST_STORE(sn->PdoErr, sn->PdoErr + 1u);
+            }
+            ST_STORE(sn->Pdo, sn->Pdo + 1u);
+        } else if ((rx.Identifier & ~0x7Fu) == 0x700u) {
+            ST_STORE(sn->Hb, sn->Hb + 1u);
+        }
+    }
+    return (result);
+}
+
+static void StNvmInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint32_t StNvmRead(CO_IF *cif, uint32_t start, uint8_t *buf, uint32_t size)
+{
+    (void)cif;
+    (void)start;
+    (void)buf;
+    (void)size;
+    return (0);
+}
+
+static uint32_t StNvmWrite(CO_IF *cif, uint32_t start, uint8_t *buf, uint32_t size)
+{
+    (void)cif;
+    (void)start;
+    (void)buf;
+    (void)size;
+    return (0);
+}
+
+static const CO_IF_CAN_DRV StCan = {
+    StCanInit, StCanEnable, StCanRead, StCanSend, 0, 0, 0, 0
+};
+static CO_IF_DRV StBus = { &StCan, 0, 0, 0 };
+static const CO_IF_NVM_DRV StNvm = { StNvmInit, StNvmRead, StNvmWrite };
+static CO_IF_DRV StDrv = { 0, 0, &StNvm, 0 };
+
+void COExecIdle(CO_EXEC *exec)
+{
+    (void)exec;
+    (void)sched_yield();
+}
+
+static void StSleep(void)
+{
+    struct timespec ts = { 0, 1000000L };
+
+    (void)nanosleep(&ts, NULL);
+}
+
+static void *StBusThread(void *arg)
+{
+    COExecBusRun((CO_EXEC *)arg);
+    return (NULL);
+}
+
+static void *StWorkerThread(void *arg)
+{
+    COExecWorkerRun((CO_EXEC_WORKER *)arg);
+    return (NULL);
+}
+
+/* The timer thread clocks all nodes with approximately 1kHz. */
+static void *StTickThread(void *arg)
+{
+    CO_EXEC *exec = (CO_EXEC *)arg;
+
+    while (ST_LOAD(exec->Stop) == 0u) {
+        StSleep();
+        COExecTick(exec);
+    }
+    return (NULL);
+}
+
+static void StSetup(ST_NODE *sn, uint8_t nodeId)
+{
+    CO_OBJ od[] = {
+        {CO_KEY(0x1001, 0, CO_OBJ_____R_), CO_TUNSIGNED8 , (CO_DATA)(&sn->Obj1001)},
+        {CO_KEY(0x1014, 0, CO_OBJ_____R_), CO_TEMCY_ID,    (CO_DATA)(&StObj1014)  },
+        {CO_KEY(0x1017, 0, CO_OBJ_____RW), CO_THB_PROD,    (CO_DATA)(&sn->Obj1017)},
+        {CO_KEY(0x1800, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(2)           },
+        {CO_KEY(0x1800, 1, CO_OBJ__N__R_), CO_TUNSIGNED32, (CO_DATA)(&StObj1800)  },
+        {CO_KEY(0x1800, 2, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(254)         },
+        {CO_KEY(0x1A00, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(1)           },
+        {CO_KEY(0x1A00, 1, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&StObj1A00)  },
+        {CO_KEY(0x2100, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(1)           },
+        {CO_KEY(0x2100, 1, CO_OBJ___APRW), CO_TUNSIGNED32, (CO_DATA)(&sn->Obj2100)},
+        CO_OBJ_DICT_ENDMARK
+    };
+    CO_NODE_SPEC spec;
+    uint32_t     n;
+
+    for (n = 0; n < ST_OBJ_N; n++) {
+        sn->Dict[n] = (CO_OBJ)CO_OBJ_DICT_ENDMARK;
+    }
+    for (n = 0; n < sizeof(od) / sizeof(CO_OBJ); n++) {
+        sn->Dict[n] = od[n];
+    }
+    sn->Obj1017 = ST_HB_TIME;
+
+    spec.NodeId   = nodeId;
+    spec.Baudrate = 250000;
+    spec.Dict     = &sn->Dict[0];
+    spec.DictLen  = ST_OBJ_N;
+    spec.EmcyCode = NULL;
+    spec.TmrMem   = &sn->TmrMem[0];
+    spec.TmrNum   = ST_TMR_N;
+    spec.TmrFreq  = 1000;
+    spec.Drv      = &StDrv;
+    spec.SdoBuf   = &sn->SdoBuf[0];
+    sn->Worker    = COExecAdd(&StExec, &sn->Node, &spec);
+    CONodeStart(&sn->Node);
+    CONmtSetMode(&sn->Node.Nmt, CO_OPERATIONAL);
+}
+
+static uint8_t StFinished(uint32_t writes)
+{
+    uint32_t n;
+
+    for (n = 0; n < StNodeNum; n++) {
+        if ((ST_LOAD(StNode[n].Pdo) < writes) ||
+            (ST_LOAD(StNode[n].Hb)  < ST_HB_MIN)) {
+            return (0u);
+        }
+    }
+    return (1u);
+}
+
+/******************************************************************************
+* MAIN
+******************************************************************************/
+
+/* Stress test of the node executor: each node is executed in its own worker
+ * thread, a bus thread and a timer thread are running concurrently, and the
+ * main thread posts object writes into all nodes. Each write triggers an
+ * asynchronous TPDO, which must arrive complete and in order on the bus.
+ */
+int main(int argc, char *argv[])
+{
+    pthread_t bus;
+    pthread_t tick;
+    ST_NODE  *sn;
+    time_t    end;
+    uint32_t  writes = 1000;
+    uint32_t  val;
+    uint32_t  ovr    = 0;
+    uint32_t  fail   = 0;
+    uint32_t  n;
+
+    StNodeNum = CO_EXEC_NODE_N;
+    if (argc > 1) {
+        StNodeNum = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+    if (argc > 2) {
+        writes = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+    if ((StNodeNum == 0) || (StNodeNum > CO_EXEC_NODE_N) || (writes == 0)) {
+        printf("usage: %s [nodes <= %u] [writes > 0]\n", argv[0], CO_EXEC_NODE_N);
+        return (1);
+    }
+
+    COExecInit(&StExec, &StBus, 250000);
+    for (n = 0; n < StNodeNum; n++) {
+        StSetup(&StNode[n], (uint8_t)(n + 1u));
+    }
+
+    (void)pthread_create(&bus, NULL, StBusThread, &StExec);
+    (void)pthread_create(&tick, NULL, StTickThread, &StExec);
+    for (n = 0; n < StNodeNum; n++) {
+        (void)pthread_create(&StNode[n].Thread, NULL, StWorkerThread, StNode[n].Worker);
+    }
+
+    for (val = 1; val <= writes; val++) {
+        for (n = 0; n < StNodeNum; n++) {
+            while (COExecPost(StNode[n].Worker, CO_DEV(0x2100, 1), val) != CO_ERR_NONE) {
+                (void)sched_yield();
+            }
+        }
+    }
+
+    end = time(NULL) + ST_TIMEOUT;
+    while ((StFinished(writes) == 0u) && (time(NULL) < end)) {
+        StSleep();
+    }
+
+    COExecStop(&StExec);
+    (void)pthread_join(bus, NULL);
+    (void)pthread_join(tick, NULL);
+    for (n = 0; n < StNodeNum; n++) {
+        (void)pthread_join(StNode[n].Thread, NULL);
+    }
+
+    for (n = 0; n < StNodeNum; n++) {
+        sn = &StNode[n];
+        ovr += sn->Worker->RxOvr;
+        if ((sn->Pdo != writes) || (sn->PdoErr != 0) || (sn->Hb < ST_HB_MIN) ||
+            (sn->Obj2100 != writes) || (CONodeGetErr(&sn->Node) != CO_ERR_NONE)) {
+            printf("node %u: pdo=%u err=%u hb=%u val=%u node-err=%d\n",
+                   n + 1u, sn->Pdo, sn->PdoErr, sn->Hb, sn->Obj2100,
+                   (int)CONodeGetErr(&sn->Node));
+            fail++;
+        }
+    }
+    printf("nodes=%u writes=%u ticks=%u dropped=%u failed=%u\n",
+           StNodeNum, writes, StExec.Tick, ovr, fail);
+
+    return ((fail == 0) ? 0 : 1);
+}
@@ -0,0 +1,207 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* TEST CASES - INDEX DIRECTORY
+******************************************************************************/
+
+void test_build(void)
+{
+    CO_NODE  node = { 0 };
+    int16_t  num;
+    CO_OBJ   obj[6] = {
+        { CO_KEY(0x1000, 0x00, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(0) },
+        { CO_KEY(0x2000, 0x00, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(2) },
+        { CO_KEY(0x2000, 0x01, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(1) },
+        { CO_KEY(0x2000, 0x02, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(2) },
+        { CO_KEY(0x2001, 0x03, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(3) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    num = CODictInit(&node.Dict, &node, &obj[0], 6);
+
+    TEST_CHECK(num == 5);
+    TEST_CHECK(node.Dict.DirNum == 3);
+    TEST_CHECK(node.Dict.Dir[1].Index == 0x2000);
+    TEST_CHECK(node.Dict.Dir[1].First == 1);
+    TEST_CHECK(node.Dict.Dir[1].Num   == 3);
+    TEST_CHECK(node.Dict.Dir[1].Sub   == 0);
+    TEST_CHECK(node.Dict.Dir[1].Dense == 1);
+    TEST_CHECK(node.Dict.Dir[2].Index == 0x2001);
+    TEST_CHECK(node.Dict.Dir[2].First == 4);
+    TEST_CHECK(node.Dict.Dir[2].Sub   == 3);
+}
+
+void test_dense(void)
+{
+    CO_NODE  node = { 0 };
+    CO_OBJ   obj[6] = {
+        { CO_KEY(0x1000, 0x00, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(0) },
+        { CO_KEY(0x2000, 0x00, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(2) },
+        { CO_KEY(0x2000, 0x01, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(1) },
+        { CO_KEY(0x2000, 0x02, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(2) },
+        { CO_KEY(0x2001, 0x03, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(3) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 6);
+
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x1000, 0x00)) == &obj[0]);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x00)) == &obj[1]);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x01)) == &obj[2]);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x02)) == &obj[3]);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2001, 0x03)) == &obj[4]);
+}
+
+void test_gaps(void)
+{
+    CO_NODE  node = { 0 };
+    CO_OBJ   obj[4] = {
+        { CO_KEY(0x2000, 0x00, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(5) },
+        { CO_KEY(0x2000, 0x02, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(1) },
+        { CO_KEY(0x2000, 0x05, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(2) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 4);
+
+    TEST_CHECK(node.Dict.Dir[0].Dense == 0);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x00)) == &obj[0]);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x02)) == &obj[1]);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x05)) == &obj[2]);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x01)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x03)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x06)) == NULL);
+}
+
+void test_outside(void)
+{
+    CO_NODE  node = { 0 };
+    CO_OBJ   obj[4] = {
+        { CO_KEY(0x2000, 0x01, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(1) },
+        { CO_KEY(0x2000, 0x02, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(2) },
+        { CO_KEY(0x2000, 0x03, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(3) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 4);
+
+    TEST_CHECK(node.Dict.Dir[0].Dense == 1);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x00)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x04)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0xFF)) == NULL);
+}
+
+void test_not_found(void)
+{
+    CO_NODE  node = { 0 };
+    CO_OBJ   obj[4] = {
+        { CO_KEY(0x1234, 0x56, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(0) },
+        { CO_KEY(0x2345, 0x67, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(1) },
+        { CO_KEY(0x3456, 0x78, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(2) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 4);
+
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x1000, 0x00)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2346, 0x67)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x5678, 0x90)) == NULL);
+}
+
+void test_overflow(void)
+{
+    CO_NODE  node = { 0 };
+    CO_OBJ   obj[CO_DICT_DIR_N + 2];
+    uint16_t n;
+
+    for (n = 0; n < CO_DICT_DIR_N + 1; n++) {
+        obj[n] = (CO_OBJ){ CO_KEY(0x2000 + n, 0x00, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(0) };
+    }
+    obj[n] = (CO_OBJ)CO_OBJ_DICT_ENDMARK;
+    CODictInit(&node.Dict, &node, &obj[0], CO_DICT_DIR_N + 2);
+
+    TEST_CHECK(node.Dict.DirNum == 0);
+    for (n = 0; n < CO_DICT_DIR_N + 1; n++) {
+        TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000 + n, 0x00)) == &obj[n]);
+    }
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x01)) == NULL);
+}
+
+/******************************************************************************
+* TEST CASES - LOOKUP CACHE
+******************************************************************************/
+
+void test_cache(void)
+{
+    CO_NODE  node = { 0 };
+    CO_OBJ  *result;
+    CO_OBJ   obj[3] = {
+        { CO_KEY(0x2000, 0x01, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(1) },
+        { CO_KEY(0x2000, 0x02, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(2) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 3);
+
+    result = CODictFind(&node.Dict, CO_KEY(0x2000, 0x02, CO_OBJ_D___RW));
+
+    TEST_CHECK(result == &obj[1]);
+
+    /* the cache is used, even if the directory is lost */
+    node.Dict.DirNum = 0;
+    node.Dict.Num    = 0;
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x02)) == &obj[1]);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2001, 0x02)) == NULL);
+}
+
+void test_reindex(void)
+{
+    CO_NODE  node = { 0 };
+    uint16_t num;
+    CO_OBJ   obj[4] = {
+        { CO_KEY(0x2000, 0x01, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(1) },
+        { CO_KEY(0x2000, 0x03, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(3) },
+        CO_OBJ_DICT_ENDMARK,
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 4);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x03)) == &obj[1]);
+
+    /* insert entry 2000h:02 in front of the cached entry 2000h:03 */
+    obj[2] = obj[1];
+    obj[1] = (CO_OBJ){ CO_KEY(0x2000, 0x02, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(2) };
+    num = CODictReindex(&node.Dict);
+
+    TEST_CHECK(num == 3);
+    TEST_CHECK(node.Dict.Dir[0].Dense == 1);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x02)) == &obj[1]);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x03)) == &obj[2]);
+}
+
+TEST_LIST = {
+    { "build",         test_build         },
+    { "dense",         test_dense         },
+    { "gaps",          test_gaps          },
+    { "outside",       test_outside       },
+    { "not_found",     test_not_found     },
+    { "overflow",      test_overflow      },
+    { "cache",         test_cache         },
+    { "reindex",       test_reindex       },
+    { NULL, NULL }
+};
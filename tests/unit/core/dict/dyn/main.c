@@ -0,0 +1,376 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define UT_OBJ_N   8u                     /* object entries in arena         */
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static CO_OBJ  Arena[UT_OBJ_N];
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+static void UtAdd(CO_DICT_DYN *dyn, uint16_t idx, uint8_t sub)
+{
+    CO_ERR err;
+
+    err = CODictDynAdd(dyn, CO_KEY(idx, sub, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(sub));
+    TEST_CHECK(err == CO_ERR_NONE);
+}
+
+static void UtCheckOrder(CO_DICT_DYN *dyn)
+{
+    uint16_t n;
+
+    for (n = 1; n < dyn->Num; n++) {
+        TEST_CHECK(CO_GET_DEV(dyn->Root[n - 1].Key) < CO_GET_DEV(dyn->Root[n].Key));
+    }
+    TEST_CHECK(dyn->Root[dyn->Num].Key == 0);
+}
+
+/******************************************************************************
+* TEST CASES - ARENA
+******************************************************************************/
+
+void test_init(void)
+{
+    CO_DICT_DYN dyn;
+    CO_ERR      err;
+
+    err = CODictDynInit(&dyn, &Arena[0], sizeof(Arena));
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(dyn.Root == &Arena[0]);
+    TEST_CHECK(dyn.Num == 0);
+    TEST_CHECK(dyn.Sorted == 0);
+    TEST_CHECK(Arena[0].Key == 0);
+}
+
+void test_init_small(void)
+{
+    CO_DICT_DYN dyn;
+    CO_ERR      err;
+
+    err = CODictDynInit(&dyn, &Arena[0], sizeof(CO_OBJ) - 1u);
+
+    TEST_CHECK(err == CO_ERR_BAD_ARG);
+}
+
+void test_alloc(void)
+{
+    CO_DICT_DYN dyn;
+    uint8_t    *a;
+    uint8_t    *b;
+
+    (void)CODictDynInit(&dyn, &Arena[0], sizeof(Arena));
+    a = CODictDynAlloc(&dyn, 1);
+    b = CODictDynAlloc(&dyn, 4);
+
+    TEST_CHECK(a != NULL);
+    TEST_CHECK(b != NULL);
+    TEST_CHECK(((uintptr_t)a % 8u) == 0);
+    TEST_CHECK(((uintptr_t)b % 8u) == 0);
+    TEST_CHECK((b + 4) <= a);
+    TEST_CHECK(a < (uint8_t *)&Arena[UT_OBJ_N]);
+    TEST_CHECK(*a == 0);
+}
+
+void test_alloc_full(void)
+{
+    CO_DICT_DYN dyn;
+    uint16_t    n;
+
+    (void)CODictDynInit(&dyn, &Arena[0], sizeof(Arena));
+    UtAdd(&dyn, 0x2000, 1);
+    UtAdd(&dyn, 0x2000, 2);
+
+    /* the entries and the end marker are kept */
+    TEST_CHECK(CODictDynAlloc(&dyn, (UT_OBJ_N - 3u) * sizeof(CO_OBJ) + 1u) == NULL);
+    TEST_CHECK(CODictDynAlloc(&dyn, (UT_OBJ_N - 3u) * sizeof(CO_OBJ)) != NULL);
+    TEST_CHECK(CODictDynAlloc(&dyn, 1) == NULL);
+    TEST_CHECK(CODictDynAdd(&dyn, CO_KEY(0x2000, 3, CO_OBJ_D___RW), CO_TUNSIGNED8, 0) == CO_ERR_BAD_ARG);
+    for (n = 0; n < 2; n++) {
+        TEST_CHECK(CO_GET_IDX(Arena[n].Key) == 0x2000);
+    }
+    TEST_CHECK(Arena[2].Key == 0);
+}
+
+/******************************************************************************
+* TEST CASES - BULK BUILD
+******************************************************************************/
+
+void test_add_build(void)
+{
+    CO_DICT_DYN dyn;
+    CO_ERR      err;
+
+    (void)CODictDynInit(&dyn, &Arena[0], sizeof(Arena));
+    UtAdd(&dyn, 0x2000, 3);
+    UtAdd(&dyn, 0x1000, 0);
+    UtAdd(&dyn, 0x2000, 1);
+    UtAdd(&dyn, 0x6000, 0);
+    UtAdd(&dyn, 0x2000, 2);
+    UtAdd(&dyn, 0x1018, 4);
+
+    err = CODictDynBuild(&dyn);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(dyn.Num == 6);
+    TEST_CHECK(dyn.Sorted == 1);
+    UtCheckOrder(&dyn);
+    TEST_CHECK(Arena[0].Key == CO_KEY(0x1000, 0, CO_OBJ_D___RW));
+    TEST_CHECK(Arena[5].Key == CO_KEY(0x6000, 0, CO_OBJ_D___RW));
+    TEST_CHECK(Arena[3].Data == 2);
+}
+
+void test_add_sorted(void)
+{
+    CO_DICT_DYN dyn;
+    CO_ERR      err;
+
+    (void)CODictDynInit(&dyn, &Arena[0], sizeof(Arena));
+    UtAdd(&dyn, 0x1000, 0);
+    UtAdd(&dyn, 0x2000, 1);
+    UtAdd(&dyn, 0x2000, 2);
+
+    err = CODictDynBuild(&dyn);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(Arena[1].Data == 1);
+    UtCheckOrder(&dyn);
+}
+
+void test_add_after_build(void)
+{
+    CO_DICT_DYN dyn;
+    CO_ERR      err;
+
+    (void)CODictDynInit(&dyn, &Arena[0], sizeof(Arena));
+    UtAdd(&dyn, 0x1000, 0);
+    (void)CODictDynBuild(&dyn);
+
+    err = CODictDynAdd(&dyn, CO_KEY(0x2000, 1, CO_OBJ_D___RW), CO_TUNSIGNED8, 0);
+
+    TEST_CHECK(err == CO_ERR_DICT_INIT);
+    TEST_CHECK(dyn.Num == 1);
+}
+
+void test_duplicate(void)
+{
+    CO_DICT_DYN dyn;
+    CO_ERR      err;
+
+    (void)CODictDynInit(&dyn, &Arena[0], sizeof(Arena));
+    UtAdd(&dyn, 0x2000, 1);
+    UtAdd(&dyn, 0x1000, 0);
+    UtAdd(&dyn, 0x2000, 1);
+
+    err = CODictDynBuild(&dyn);
+
+    TEST_CHECK(err == CO_ERR_DICT_INIT);
+    TEST_CHECK(dyn.Sorted == 0);
+}
+
+/******************************************************************************
+* TEST CASES - INSERT AND REMOVE
+******************************************************************************/
+
+void test_insert(void)
+{
+    CO_DICT_DYN dyn;
+    CO_ERR      err;
+
+    (void)CODictDynInit(&dyn, &Arena[0], sizeof(Arena));
+    UtAdd(&dyn, 0x2000, 2);
+    (void)CODictDynBuild(&dyn);
+
+    err = CODictDynInsert(&dyn, CO_KEY(0x2000, 4, CO_OBJ_D___RW), CO_TUNSIGNED8, 4);
+    TEST_CHECK(err == CO_ERR_NONE);
+    err = CODictDynInsert(&dyn, CO_KEY(0x1000, 0, CO_OBJ_D___RW), CO_TUNSIGNED8, 0);
+    TEST_CHECK(err == CO_ERR_NONE);
+    err = CODictDynInsert(&dyn, CO_KEY(0x2000, 3, CO_OBJ_D___RW), CO_TUNSIGNED8, 3);
+    TEST_CHECK(err == CO_ERR_NONE);
+
+    TEST_CHECK(dyn.Num == 4);
+    UtCheckOrder(&dyn);
+    TEST_CHECK(Arena[0].Data == 0);
+    TEST_CHECK(Arena[1].Data == 2);
+    TEST_CHECK(Arena[2].Data == 3);
+    TEST_CHECK(Arena[3].Data == 4);
+}
+
+void test_insert_update(void)
+{
+    CO_DICT_DYN dyn;
+    CO_ERR      err;
+
+    (void)CODictDynInit(&dyn, &Arena[0], sizeof(Arena));
+    UtAdd(&dyn, 0x2000, 1);
+    UtAdd(&dyn, 0x2000, 2);
+    (void)CODictDynBuild(&dyn);
+
+    err = CODictDynInsert(&dyn, CO_KEY(0x2000, 1, CO_OBJ_____R_), CO_TUNSIGNED32, 7);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(dyn.Num == 2);
+    TEST_CHECK(Arena[0].Key  == CO_KEY(0x2000, 1, CO_OBJ_____R_));
+    TEST_CHECK(Arena[0].Type == CO_TUNSIGNED32);
+    TEST_CHECK(Arena[0].Data == 7);
+}
+
+void test_insert_unbuilt(void)
+{
+    CO_DICT_DYN dyn;
+    CO_ERR      err;
+
+    (void)CODictDynInit(&dyn, &Arena[0], sizeof(Arena));
+
+    err = CODictDynInsert(&dyn, CO_KEY(0x2000, 1, CO_OBJ_D___RW), CO_TUNSIGNED8, 0);
+    TEST_CHECK(err == CO_ERR_DICT_INIT);
+    err = CODictDynRemove(&dyn, CO_DEV(0x2000, 1));
+    TEST_CHECK(err == CO_ERR_DICT_INIT);
+}
+
+void test_insert_full(void)
+{
+    CO_DICT_DYN dyn;
+    CO_ERR      err;
+    uint8_t     n;
+
+    (void)CODictDynInit(&dyn, &Arena[0], sizeof(Arena));
+    (void)CODictDynBuild(&dyn);
+    for (n = 0; n < (UT_OBJ_N - 1u); n++) {
+        err = CODictDynInsert(&dyn, CO_KEY(0x2000, 10 - n, CO_OBJ_D___RW), CO_TUNSIGNED8, n);
+        TEST_CHECK(err == CO_ERR_NONE);
+    }
+
+    err = CODictDynInsert(&dyn, CO_KEY(0x1000, 0, CO_OBJ_D___RW), CO_TUNSIGNED8, 0);
+
+    TEST_CHECK(err == CO_ERR_BAD_ARG);
+    TEST_CHECK(dyn.Num == UT_OBJ_N - 1u);
+    UtCheckOrder(&dyn);
+}
+
+void test_remove(void)
+{
+    CO_DICT_DYN dyn;
+    CO_ERR      err;
+
+    (void)CODictDynInit(&dyn, &Arena[0], sizeof(Arena));
+    UtAdd(&dyn, 0x2000, 1);
+    UtAdd(&dyn, 0x2000, 2);
+    UtAdd(&dyn, 0x2000, 3);
+    (void)CODictDynBuild(&dyn);
+
+    err = CODictDynRemove(&dyn, CO_DEV(0x2000, 2));
+    TEST_CHECK(err == CO_ERR_NONE);
+    err = CODictDynRemove(&dyn, CO_DEV(0x2000, 3));
+    TEST_CHECK(err == CO_ERR_NONE);
+
+    TEST_CHECK(dyn.Num == 1);
+    TEST_CHECK(Arena[0].Data == 1);
+    UtCheckOrder(&dyn);
+}
+
+void test_remove_missing(void)
+{
+    CO_DICT_DYN dyn;
+    CO_ERR      err;
+
+    (void)CODictDynInit(&dyn, &Arena[0], sizeof(Arena));
+    UtAdd(&dyn, 0x2000, 1);
+    UtAdd(&dyn, 0x2000, 3);
+    (void)CODictDynBuild(&dyn);
+
+    err = CODictDynRemove(&dyn, CO_DEV(0x2000, 2));
+    TEST_CHECK(err == CO_ERR_OBJ_NOT_FOUND);
+    err = CODictDynRemove(&dyn, CO_DEV(0x3000, 0));
+    TEST_CHECK(err == CO_ERR_OBJ_NOT_FOUND);
+    TEST_CHECK(dyn.Num == 2);
+}
+
+/******************************************************************************
+* TEST CASES - LINKED OBJECT DICTIONARY
+******************************************************************************/
+
+void test_link(void)
+{
+    CO_NODE       node = { 0 };
+    CO_NODE_SPEC  spec = { 0 };
+    CO_DICT_DYN   dyn;
+    CO_ERR        err;
+    uint8_t       val = 0;
+
+    (void)CODictDynInit(&dyn, &Arena[0], sizeof(Arena));
+    UtAdd(&dyn, 0x2000, 1);
+    UtAdd(&dyn, 0x1000, 0);
+    (void)CODictDynBuild(&dyn);
+    CODictDynSetSpec(&dyn, &spec);
+    TEST_CHECK(spec.Dict == &Arena[0]);
+    TEST_CHECK(spec.DictLen == UT_OBJ_N);
+
+    (void)CODictInit(&node.Dict, &node, spec.Dict, spec.DictLen);
+    err = CODictDynLink(&dyn, &node.Dict);
+    TEST_CHECK(err == CO_ERR_NONE);
+
+    err = CODictDynInsert(&dyn, CO_KEY(0x1001, 0, CO_OBJ_D___RW), CO_TUNSIGNED8, 5);
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(node.Dict.Num == 3);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x1001, 0)) == &Arena[1]);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 1)) == &Arena[2]);
+    TEST_CHECK(CODictRdByte(&node.Dict, CO_DEV(0x1001, 0), &val) == CO_ERR_NONE);
+    TEST_CHECK(val == 5);
+
+    err = CODictDynRemove(&dyn, CO_DEV(0x1000, 0));
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(node.Dict.Num == 2);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x1000, 0)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 1)) == &Arena[1]);
+}
+
+TEST_LIST = {
+    { "init",                test_init              },
+    { "init_small",          test_init_small        },
+    { "alloc",               test_alloc             },
+    { "alloc_full",          test_alloc_full        },
+    { "add_build",           test_add_build         },
+    { "add_sorted",          test_add_sorted        },
+    { "add_after_build",     test_add_after_build   },
+    { "duplicate",           test_duplicate         },
+    { "insert",              test_insert            },
+    { "insert_update",       test_insert_update     },
+    { "insert_unbuilt",      test_insert_unbuilt    },
+    { "insert_full",         test_insert_full       },
+    { "remove",              test_remove            },
+    { "remove_missing",      test_remove_missing    },
+    { "link",                test_link              },
+    { NULL, NULL }
+};
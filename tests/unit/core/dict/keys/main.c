@@ -0,0 +1,204 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* PRIVATE DEFINES
+******************************************************************************/
+
+#define UT_OBJ_N   100
+
+/******************************************************************************
+* PRIVATE FUNCTIONS
+******************************************************************************/
+
+/* Prepare the indices 2000h..2018h with the subindex entries 0, 1, 2 and 4,
+ * so the dictionary holds more entries than a compared block of keys.
+ */
+static void UtPrepare(CO_OBJ *obj)
+{
+    uint16_t n;
+
+    for (n = 0; n < UT_OBJ_N; n++) {
+        obj[n] = (CO_OBJ){ CO_KEY(0x2000 + (n / 4), (n % 4 == 3) ? 4 : (n % 4), CO_OBJ_D___RW),
+                           CO_TUNSIGNED8, (CO_DATA)(n & 0xFF) };
+    }
+    obj[n] = (CO_OBJ)CO_OBJ_DICT_ENDMARK;
+}
+
+/******************************************************************************
+* TEST CASES - DENSE KEY ARRAY
+******************************************************************************/
+
+void test_build(void)
+{
+    CO_NODE  node = { 0 };
+    uint32_t key[4];
+    CO_ERR   err;
+    CO_OBJ   obj[4] = {
+        { CO_KEY(0x1000, 0x00, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(0) },
+        { CO_KEY(0x2000, 0x01, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(1) },
+        { CO_KEY(0x2001, 0x03, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(3) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 4);
+    TEST_CHECK(node.Dict.Key == NULL);
+
+    err = CODictUseKeys(&node.Dict, &key[0], 4);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(node.Dict.Key == &key[0]);
+    TEST_CHECK(key[0] == CO_DEV(0x1000, 0x00));
+    TEST_CHECK(key[1] == CO_DEV(0x2000, 0x01));
+    TEST_CHECK(key[2] == CO_DEV(0x2001, 0x03));
+}
+
+void test_find(void)
+{
+    CO_NODE  node = { 0 };
+    uint32_t key[UT_OBJ_N];
+    CO_OBJ   obj[UT_OBJ_N + 1];
+    uint16_t n;
+
+    UtPrepare(&obj[0]);
+    CODictInit(&node.Dict, &node, &obj[0], UT_OBJ_N + 1);
+    TEST_CHECK(CODictUseKeys(&node.Dict, &key[0], UT_OBJ_N) == CO_ERR_NONE);
+
+    for (n = 0; n < UT_OBJ_N; n++) {
+        TEST_CHECK(CODictFind(&node.Dict, obj[n].Key) == &obj[n]);
+    }
+}
+
+void test_not_found(void)
+{
+    CO_NODE  node = { 0 };
+    uint32_t key[UT_OBJ_N];
+    CO_OBJ   obj[UT_OBJ_N + 1];
+
+    UtPrepare(&obj[0]);
+    CODictInit(&node.Dict, &node, &obj[0], UT_OBJ_N + 1);
+    TEST_CHECK(CODictUseKeys(&node.Dict, &key[0], UT_OBJ_N) == CO_ERR_NONE);
+
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x1000, 0x00)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x03)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2010, 0x03)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2018, 0x05)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2019, 0x00)) == NULL);
+}
+
+void test_too_small(void)
+{
+    CO_NODE  node = { 0 };
+    uint32_t key[2];
+    CO_ERR   err;
+    CO_OBJ   obj[4] = {
+        { CO_KEY(0x2000, 0x01, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(1) },
+        { CO_KEY(0x2000, 0x02, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(2) },
+        { CO_KEY(0x2000, 0x03, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(3) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 4);
+
+    err = CODictUseKeys(&node.Dict, &key[0], 2);
+
+    TEST_CHECK(err == CO_ERR_BAD_ARG);
+    TEST_CHECK(node.Dict.Key == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x03)) == &obj[2]);
+}
+
+void test_release(void)
+{
+    CO_NODE  node = { 0 };
+    uint32_t key[2];
+    CO_ERR   err;
+    CO_OBJ   obj[3] = {
+        { CO_KEY(0x2000, 0x01, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(1) },
+        { CO_KEY(0x2000, 0x02, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(2) },
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 3);
+    CODictUseKeys(&node.Dict, &key[0], 2);
+
+    err = CODictUseKeys(&node.Dict, NULL, 0);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(node.Dict.Key == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x02)) == &obj[1]);
+}
+
+void test_reindex(void)
+{
+    CO_NODE  node = { 0 };
+    uint32_t key[3];
+    CO_OBJ   obj[4] = {
+        { CO_KEY(0x2000, 0x01, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(1) },
+        { CO_KEY(0x2000, 0x03, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(3) },
+        CO_OBJ_DICT_ENDMARK,
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 4);
+    CODictUseKeys(&node.Dict, &key[0], 3);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x03)) == &obj[1]);
+
+    /* insert entry 2000h:02 in front of entry 2000h:03 */
+    obj[2] = obj[1];
+    obj[1] = (CO_OBJ){ CO_KEY(0x2000, 0x02, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(2) };
+    CODictReindex(&node.Dict);
+
+    TEST_CHECK(node.Dict.Key == &key[0]);
+    TEST_CHECK(key[1] == CO_DEV(0x2000, 0x02));
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x02)) == &obj[1]);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x03)) == &obj[2]);
+}
+
+void test_overflow(void)
+{
+    CO_NODE  node = { 0 };
+    uint32_t key[2];
+    CO_OBJ   obj[4] = {
+        { CO_KEY(0x2000, 0x01, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(1) },
+        { CO_KEY(0x2000, 0x03, CO_OBJ_D___RW), CO_TUNSIGNED8,  (CO_DATA)(3) },
+        CO_OBJ_DICT_ENDMARK,
+        CO_OBJ_DICT_ENDMARK
+    };
+    CODictInit(&node.Dict, &node, &obj[0], 4);
+    CODictUseKeys(&node.Dict, &key[0], 2);
+
+    /* the third entry doesn't fit into the key array */
+    obj[2] = (CO_OBJ){ CO_KEY(0x2000, 0x04, CO_OBJ_D___RW), CO_TUNSIGNED8, (CO_DATA)(4) };
+    CODictReindex(&node.Dict);
+
+    TEST_CHECK(node.Dict.Key == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x04)) == &obj[2]);
+}
+
+TEST_LIST = {
+    { "build",         test_build         },
+    { "find",          test_find          },
+    { "not_found",     test_not_found     },
+    { "too_small",     test_too_small     },
+    { "release",       test_release       },
+    { "reindex",       test_reindex       },
+    { "overflow",      test_overflow      },
+    { NULL, NULL }
+};
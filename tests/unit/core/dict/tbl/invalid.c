@@ -14,12 +14,6 @@
    limitations under the License.
 ******************************************************************************/
 
-#ifndef APP_DICT_H_
-#define APP_DICT_H_
-
-#ifdef __cplusplus               /* for compatibility with C++ environments  */
-extern "C" {
-#endif
 
 /******************************************************************************
 * INCLUDES
@@ -28,25 +22,27 @@ extern "C" {
 #include "co_core.h"
 
 /******************************************************************************
-* PUBLIC TYPEDEF
+* PRIVATE VARIABLES
 ******************************************************************************/
 
-typedef struct {
-    CO_OBJ   *Root;
-    uint32_t  Length;
-    uint32_t  Used;
-} OD_DYN;
+static CO_OBJ UtUnsortedDict[4] = {
+    { CO_KEY(0x1000, 0x00, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0) },
+    { CO_KEY(0x2000, 0x02, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0) },
+    { CO_KEY(0x2000, 0x01, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0) },
+    CO_OBJ_DICT_ENDMARK
+};
+
+static CO_OBJ UtDuplicateDict[4] = {
+    { CO_KEY(0x1000, 0x00, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0) },
+    { CO_KEY(0x2000, 0x02, CO_OBJ_D___R_), CO_TUNSIGNED32, (CO_DATA)(0) },
+    { CO_KEY(0x2000, 0x02, CO_OBJ_D___RW), CO_TUNSIGNED32, (CO_DATA)(0) },
+    CO_OBJ_DICT_ENDMARK
+};
 
 /******************************************************************************
-* PUBLIC FUNCTIONS
+* PUBLIC VARIABLES
 ******************************************************************************/
 
-void ODInit(OD_DYN *self, CO_OBJ *root, uint32_t length);
-void ODAddUpdate(OD_DYN *self, uint32_t key, const CO_OBJ_TYPE *type, CO_DATA data);
-void ODSetSpec(OD_DYN *self, CO_NODE_SPEC *spec);
-
-#ifdef __cplusplus               /* for compatibility with C++ environments  */
-}
-#endif
-
-#endif /* APP_DICT_H_ */
+/* The generator must reject these dictionaries. */
+struct CO_NODE_SPEC_T UtUnsorted  = { 1, 250000, &UtUnsortedDict[0],  4, NULL, NULL, 0, 1000, NULL, NULL };
+struct CO_NODE_SPEC_T UtDuplicate = { 1, 250000, &UtDuplicateDict[0], 4, NULL, NULL, 0, 1000, NULL, NULL };
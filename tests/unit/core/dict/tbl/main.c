@@ -0,0 +1,119 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* EXTERNAL SYMBOLS
+******************************************************************************/
+
+extern struct CO_NODE_SPEC_T UtSpec;
+extern const CO_DICT_TBL UtTbl;
+
+/******************************************************************************
+* TEST CASES - GENERATED LOOKUP TABLE
+******************************************************************************/
+
+void test_all(void)
+{
+    CO_NODE  node = { 0 };
+    CO_ERR   err;
+    uint16_t n;
+
+    CODictInit(&node.Dict, &node, UtSpec.Dict, UtSpec.DictLen);
+    err = CODictUseTbl(&node.Dict, &UtTbl);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(node.Dict.Tbl == &UtTbl);
+    TEST_CHECK(UtTbl.Num == 14);
+    for (n = 0; n < node.Dict.Num; n++) {
+        TEST_CHECK(CODictFind(&node.Dict, CO_GET_DEV(UtSpec.Dict[n].Key)) == &UtSpec.Dict[n]);
+    }
+}
+
+void test_not_found(void)
+{
+    CO_NODE  node = { 0 };
+
+    CODictInit(&node.Dict, &node, UtSpec.Dict, UtSpec.DictLen);
+    (void)CODictUseTbl(&node.Dict, &UtTbl);
+
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x0FFF, 0xFF)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x1018, 0x05)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x01)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x07)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x3000, 0x00)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x6000, 0x02)) == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0xFFFF, 0xFF)) == NULL);
+}
+
+void test_flags(void)
+{
+    CO_NODE  node = { 0 };
+
+    CODictInit(&node.Dict, &node, UtSpec.Dict, UtSpec.DictLen);
+    (void)CODictUseTbl(&node.Dict, &UtTbl);
+
+    TEST_CHECK(CODictFind(&node.Dict, CO_KEY(0x2000, 0x04, CO_OBJ_____RW)) == &UtSpec.Dict[9]);
+}
+
+void test_mismatch(void)
+{
+    CO_NODE     node = { 0 };
+    CO_DICT_TBL tbl;
+    CO_ERR      err;
+
+    CODictInit(&node.Dict, &node, UtSpec.Dict, UtSpec.DictLen);
+    tbl     = UtTbl;
+    tbl.Num = UtTbl.Num - 1;
+
+    err = CODictUseTbl(&node.Dict, &tbl);
+
+    TEST_CHECK(err == CO_ERR_BAD_ARG);
+    TEST_CHECK(node.Dict.Tbl == NULL);
+}
+
+void test_release(void)
+{
+    CO_NODE  node = { 0 };
+
+    CODictInit(&node.Dict, &node, UtSpec.Dict, UtSpec.DictLen);
+    (void)CODictUseTbl(&node.Dict, &UtTbl);
+    (void)CODictReindex(&node.Dict);
+
+    TEST_CHECK(node.Dict.Tbl == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x2000, 0x08)) == &UtSpec.Dict[10]);
+
+    (void)CODictUseTbl(&node.Dict, &UtTbl);
+    TEST_CHECK(CODictUseTbl(&node.Dict, NULL) == CO_ERR_NONE);
+    TEST_CHECK(node.Dict.Tbl == NULL);
+    TEST_CHECK(CODictFind(&node.Dict, CO_DEV(0x6000, 0x01)) == &UtSpec.Dict[13]);
+}
+
+TEST_LIST = {
+    { "all",           test_all           },
+    { "not_found",     test_not_found     },
+    { "flags",         test_flags         },
+    { "mismatch",      test_mismatch      },
+    { "release",       test_release       },
+    { NULL, NULL }
+};
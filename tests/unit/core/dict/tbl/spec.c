@@ -0,0 +1,67 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+/******************************************************************************
+* PRIVATE VARIABLES
+******************************************************************************/
+
+static uint32_t UtVal = 0;
+
+/* object dictionary with gaps in the subindex entries and a single entry
+ * per index; the lookup table is generated from this dictionary.
+ */
+static CO_OBJ UtDict[16] = {
+    { CO_KEY(0x1000, 0x00, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&UtVal) },
+    { CO_KEY(0x1001, 0x00, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&UtVal) },
+    { CO_KEY(0x1018, 0x00, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(4)      },
+    { CO_KEY(0x1018, 0x01, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&UtVal) },
+    { CO_KEY(0x1018, 0x02, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&UtVal) },
+    { CO_KEY(0x1018, 0x03, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&UtVal) },
+    { CO_KEY(0x1018, 0x04, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&UtVal) },
+    { CO_KEY(0x2000, 0x00, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(8)      },
+    { CO_KEY(0x2000, 0x02, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&UtVal) },
+    { CO_KEY(0x2000, 0x04, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&UtVal) },
+    { CO_KEY(0x2000, 0x08, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&UtVal) },
+    { CO_KEY(0x2100, 0x00, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&UtVal) },
+    { CO_KEY(0x6000, 0x00, CO_OBJ_D___R_), CO_TUNSIGNED8,  (CO_DATA)(1)      },
+    { CO_KEY(0x6000, 0x01, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&UtVal) },
+    CO_OBJ_DICT_ENDMARK,
+    CO_OBJ_DICT_ENDMARK
+};
+
+/******************************************************************************
+* PUBLIC VARIABLES
+******************************************************************************/
+
+struct CO_NODE_SPEC_T UtSpec = {
+    1,                       /* default Node-Id                */
+    250000,                  /* default Baudrate               */
+    &UtDict[0],              /* pointer to object dictionary   */
+    16,                      /* object dictionary max length   */
+    NULL,                    /* EMCY code & register bit table */
+    NULL,                    /* pointer to timer memory blocks */
+    0,                       /* number of timer memory blocks  */
+    1000,                    /* timer clock frequency in Hz    */
+    NULL,                    /* select drivers for application */
+    NULL                     /* SDO Transfer Buffer Memory     */
+};
@@ -0,0 +1,323 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* TEST HELPER
+******************************************************************************/
+
+static void SetupNode(CO_NODE *node)
+{
+    uint32_t n;
+
+    for (n = 0; n < CO_SSDO_N; n++) {
+        node->Sdo[n].RxId = CO_SDO_ID_OFF;
+    }
+    node->Sync.Node  = node;
+    node->Sync.CobId = 0x80;
+    CODispInit(&node->Disp, node);
+}
+
+static CO_DISP_SLOT *Lookup(CO_NODE *node, uint32_t id)
+{
+    CO_DISP_IDX slot = node->Disp.Std[id];
+
+    if (slot == 0) {
+        return (NULL);
+    }
+    return (&node->Disp.Slot[slot - 1]);
+}
+
+/******************************************************************************
+* TEST CASES - BUILD
+******************************************************************************/
+
+void test_nmt(void)
+{
+    CO_NODE       node = { 0 };
+    CO_DISP_SLOT *slot;
+
+    SetupNode(&node);
+    CODispBuild(&node.Disp);
+
+    slot = Lookup(&node, 0);
+    TEST_CHECK(slot != NULL);
+    TEST_CHECK(slot->Type == CO_DISP_NMT);
+    TEST_CHECK(slot->Obj  == &node.Nmt);
+    TEST_CHECK(node.Disp.Dirty    == 0);
+    TEST_CHECK(node.Disp.Overflow == 0);
+}
+
+void test_ssdo(void)
+{
+    CO_NODE       node = { 0 };
+    CO_DISP_SLOT *slot;
+
+    SetupNode(&node);
+    node.Sdo[0].RxId = 0x601;
+    CODispBuild(&node.Disp);
+
+    slot = Lookup(&node, 0x601);
+    TEST_CHECK(slot != NULL);
+    TEST_CHECK(slot->Type == CO_DISP_SSDO);
+    TEST_CHECK(slot->Obj  == &node.Sdo[0]);
+}
+
+void test_rpdo(void)
+{
+    CO_NODE       node = { 0 };
+    CO_DISP_SLOT *slot;
+
+    SetupNode(&node);
+    node.RPdo[1].Identifier = 0x281;
+    node.RPdo[1].Flag       = CO_RPDO_FLG__E;
+    CODispBuild(&node.Disp);
+
+    slot = Lookup(&node, 0x281);
+    TEST_CHECK(slot != NULL);
+    TEST_CHECK(slot->Type == CO_DISP_RPDO);
+    TEST_CHECK(slot->Obj  == &node.RPdo[1]);
+}
+
+void test_rpdo_off(void)
+{
+    CO_NODE       node = { 0 };
+
+    SetupNode(&node);
+    node.RPdo[1].Identifier = 0x281;
+    node.RPdo[1].Flag       = 0;
+    CODispBuild(&node.Disp);
+
+    TEST_CHECK(Lookup(&node, 0x281) == NULL);
+}
+
+void test_hbc(void)
+{
+    CO_NODE       node   = { 0 };
+    CO_HBCONS     hbc[2] = { 0 };
+    CO_DISP_SLOT *slot;
+
+    SetupNode(&node);
+    hbc[0].NodeId   = 5;
+    hbc[0].Next     = &hbc[1];
+    hbc[1].NodeId   = 7;
+    node.Nmt.HbCons = &hbc[0];
+    CODispBuild(&node.Disp);
+
+    slot = Lookup(&node, 0x705);
+    TEST_CHECK(slot != NULL);
+    TEST_CHECK(slot->Type == CO_DISP_HBC);
+    TEST_CHECK(slot->Obj  == &hbc[0]);
+    slot = Lookup(&node, 0x707);
+    TEST_CHECK(slot != NULL);
+    TEST_CHECK(slot->Type == CO_DISP_HBC);
+    TEST_CHECK(slot->Obj  == &hbc[1]);
+    TEST_CHECK(Lookup(&node, 0x706) == NULL);
+}
+
+void test_sync(void)
+{
+    CO_NODE       node = { 0 };
+    CO_DISP_SLOT *slot;
+
+    SetupNode(&node);
+    node.Sync.CobId = 0x40000081;
+    CODispBuild(&node.Disp);
+
+    slot = Lookup(&node, 0x81);
+    TEST_CHECK(slot != NULL);
+    TEST_CHECK(slot->Type == CO_DISP_SYNC);
+    TEST_CHECK(slot->Obj  == &node.Sync);
+}
+
+void test_first_wins(void)
+{
+    CO_NODE       node = { 0 };
+    CO_DISP_SLOT *slot;
+
+    SetupNode(&node);
+    node.Sdo[0].RxId        = 0x201;
+    node.RPdo[0].Identifier = 0x201;
+    node.RPdo[0].Flag       = CO_RPDO_FLG__E;
+    CODispBuild(&node.Disp);
+
+    slot = Lookup(&node, 0x201);
+    TEST_CHECK(slot != NULL);
+    TEST_CHECK(slot->Type == CO_DISP_SSDO);
+}
+
+void test_extended(void)
+{
+    CO_NODE       node = { 0 };
+    CO_IF_FRM     frm  = { 0 };
+    uint8_t       allowed;
+
+    SetupNode(&node);
+    node.Sync.CobId = 0x1ABCDE80;
+    CODispBuild(&node.Disp);
+
+    TEST_CHECK(node.Disp.Overflow == 0);
+
+    /* SYNC is not allowed: frame is found, but not consumed */
+    frm.Identifier = 0x1ABCDE80;
+    allowed = CODispProcess(&node.Disp, &frm, CO_NMT_ALLOWED);
+    TEST_CHECK(allowed == CO_NMT_ALLOWED);
+
+    /* SYNC is allowed: frame is consumed */
+    allowed = CODispProcess(&node.Disp, &frm, CO_SYNC_ALLOWED);
+    TEST_CHECK(allowed == 0);
+}
+
+void test_overflow(void)
+{
+    CO_NODE       node = { 0 };
+    CO_HBCONS     hbc[CO_DISP_SLOT_N] = { 0 };
+    uint32_t      n;
+
+    SetupNode(&node);
+    for (n = 0; n < CO_DISP_SLOT_N; n++) {
+        hbc[n].NodeId = (uint8_t)(n + 1);
+        if (n > 0) {
+            hbc[n - 1].Next = &hbc[n];
+        }
+    }
+    node.Nmt.HbCons = &hbc[0];
+    CODispBuild(&node.Disp);
+
+    TEST_CHECK(node.Disp.Overflow == 1);
+}
+
+void test_invalidate(void)
+{
+    CO_NODE       node = { 0 };
+    CO_IF_FRM     frm  = { 0 };
+
+    SetupNode(&node);
+    CODispBuild(&node.Disp);
+    TEST_CHECK(node.Disp.Dirty == 0);
+
+    node.RPdo[0].Identifier = 0x181;
+    node.RPdo[0].Flag       = CO_RPDO_FLG__E;
+    CO_DISP_INVALIDATE(&node);
+    TEST_CHECK(node.Disp.Dirty == 1);
+
+    frm.Identifier = 0x7FF;
+    (void)CODispProcess(&node.Disp, &frm, 0);
+    TEST_CHECK(node.Disp.Dirty == 0);
+    TEST_CHECK(Lookup(&node, 0x181) != NULL);
+}
+
+void test_not_found(void)
+{
+    CO_NODE       node = { 0 };
+    CO_IF_FRM     frm  = { 0 };
+    uint8_t       allowed;
+
+    SetupNode(&node);
+
+    frm.Identifier = 0x123;
+    allowed = CODispProcess(&node.Disp, &frm, CO_NMT_ALLOWED | CO_SDO_ALLOWED);
+
+    TEST_CHECK(allowed == (CO_NMT_ALLOWED | CO_SDO_ALLOWED));
+}
+
+void test_get_ids(void)
+{
+    CO_NODE       node   = { 0 };
+    CO_HBCONS     hbc[1] = { 0 };
+    uint32_t      id[8]  = { 0 };
+    uint16_t      num;
+
+    SetupNode(&node);
+    node.Sdo[0].RxId        = 0x601;
+    hbc[0].NodeId           = 5;
+    node.Nmt.HbCons         = &hbc[0];
+    node.RPdo[0].Identifier = 0x201;
+    node.RPdo[0].Flag       = CO_RPDO_FLG__E;
+    node.RPdo[1].Identifier = 0x301;
+    node.RPdo[1].Flag       = 0;
+
+    num = CODispGetIds(&node.Disp, &id[0], 8);
+    TEST_CHECK(num == 5 + USE_LSS);
+    TEST_CHECK(id[0] == 0x601);
+    TEST_CHECK(id[1] == 0x000);
+    TEST_CHECK(id[2] == 0x705);
+    TEST_CHECK(id[3] == 0x201);
+    TEST_CHECK(id[4] == 0x080);
+}
+
+void test_get_ids_limit(void)
+{
+    CO_NODE       node  = { 0 };
+    uint32_t      id[3] = { 0 };
+    uint16_t      num;
+
+    SetupNode(&node);
+    node.Sdo[0].RxId        = 0x201;
+    node.RPdo[0].Identifier = 0x201;
+    node.RPdo[0].Flag       = CO_RPDO_FLG__E;
+    node.RPdo[1].Identifier = 0x202;
+    node.RPdo[1].Flag       = CO_RPDO_FLG__E;
+
+    num = CODispGetIds(&node.Disp, &id[0], 2);
+    TEST_CHECK(num == 4 + USE_LSS);
+    TEST_CHECK(id[0] == 0x201);
+    TEST_CHECK(id[1] == 0x000);
+    TEST_CHECK(id[2] == 0);
+}
+
+void test_get_ids_lss(void)
+{
+    CO_NODE       node  = { 0 };
+    uint32_t      id[8] = { 0 };
+    uint16_t      num;
+    uint16_t      n;
+    uint16_t      lss = 0;
+
+    SetupNode(&node);
+
+    num = CODispGetIds(&node.Disp, &id[0], 8);
+    for (n = 0; n < num; n++) {
+        if (id[n] == 0x7E5) {
+            lss++;
+        }
+    }
+    TEST_CHECK(lss == USE_LSS);
+}
+
+TEST_LIST = {
+    { "nmt",           test_nmt           },
+    { "ssdo",          test_ssdo          },
+    { "rpdo",          test_rpdo          },
+    { "rpdo_off",      test_rpdo_off      },
+    { "hbc",           test_hbc           },
+    { "sync",          test_sync          },
+    { "first_wins",    test_first_wins    },
+    { "extended",      test_extended      },
+    { "overflow",      test_overflow      },
+    { "invalidate",    test_invalidate    },
+    { "not_found",     test_not_found     },
+    { "get_ids",       test_get_ids       },
+    { "get_ids_lss",   test_get_ids_lss   },
+    { "get_ids_limit", test_get_ids_limit },
+    { NULL, NULL }
+};
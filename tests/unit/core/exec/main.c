@@ -0,0 +1,395 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+void StubReset(void);
+#define TEST_INIT   StubReset()
+
+#include "acutest.h"
+
+/******************************************************************************
+* TEST CASES - STUB FUNCTIONS
+******************************************************************************/
+
+#define STUB_FRM_N   (CO_EXEC_MBX_N * 2)
+#define STUB_NODE_N  2
+#define STUB_OBJ_N   16
+#define STUB_TMR_N   8
+
+typedef struct STUB_NODE_T {
+    CO_NODE         Node;
+    CO_OBJ          Dict[STUB_OBJ_N];
+    CO_TMR_MEM      TmrMem[STUB_TMR_N];
+    uint8_t         SdoBuf[CO_SSDO_N * CO_SDO_BUF_BYTE];
+    uint8_t         Obj1001;
+    uint16_t        Obj1017;
+    uint32_t        Obj2100;
+    CO_EXEC_WORKER *Worker;
+} STUB_NODE;
+
+static const uint32_t StubObj1014   = 0x80;
+static const uint32_t StubObj1800   = CO_COBID_TPDO_DEFAULT(0);
+static const uint32_t StubObj1A00   = CO_LINK(0x2100, 0x01, 32);
+
+CO_IF_FRM  StubFrm[STUB_FRM_N];
+uint32_t   StubFrmNum   = 0;
+uint32_t   StubFrmRd    = 0;
+CO_IF_FRM  StubSent[STUB_FRM_N];
+uint32_t   StubSentNum  = 0;
+uint32_t   StubReceive[STUB_NODE_N];
+uint32_t   StubTimer    = 0;
+CO_EXEC    StubExec;
+STUB_NODE  StubNode[STUB_NODE_N];
+
+static int16_t StubRead(CO_IF *cif, CO_IF_FRM *frm)
+{
+    (void)cif;
+    if (StubFrmRd >= StubFrmNum) {
+        return (0);
+    }
+    *frm = StubFrm[StubFrmRd];
+    StubFrmRd++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static int16_t StubSend(CO_IF *cif, CO_IF_FRM *frm)
+{
+    (void)cif;
+    if (StubSentNum < STUB_FRM_N) {
+        StubSent[StubSentNum] = *frm;
+    }
+    StubSentNum++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static void StubInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static void StubEnable(CO_IF *cif, uint32_t baudrate)
+{
+    (void)cif;
+    (void)baudrate;
+}
+
+static void StubNvmInit(CO_IF *cif)
+{
+    (void)cif;
+}
+
+static uint32_t StubNvmRead(CO_IF *cif, uint32_t start, uint8_t *buf, uint32_t size)
+{
+    (void)cif;
+    (void)start;
+    (void)buf;
+    (void)size;
+    return (0);
+}
+
+static uint32_t StubNvmWrite(CO_IF *cif, uint32_t start, uint8_t *buf, uint32_t size)
+{
+    (void)cif;
+    (void)start;
+    (void)buf;
+    (void)size;
+    return (0);
+}
+
+void COIfCanReceive(CO_IF *cif, CO_IF_FRM *frm)
+{
+    uint32_t n;
+
+    (void)frm;
+    for (n = 0; n < STUB_NODE_N; n++) {
+        if (cif->Node == &StubNode[n].Node) {
+            StubReceive[n]++;
+        }
+    }
+}
+
+static void StubTimerFunc(void *arg)
+{
+    (void)arg;
+    StubTimer++;
+}
+
+static CO_IF_CAN_DRV StubCan = { StubInit, StubEnable, StubRead, StubSend, 0, 0, 0, 0 };
+static CO_IF_DRV     StubBus = { &StubCan, 0, 0, 0 };
+static CO_IF_NVM_DRV StubNvm = { StubNvmInit, StubNvmRead, StubNvmWrite };
+static CO_IF_DRV     StubDrv = { 0, 0, &StubNvm, 0 };
+
+static void StubDict(STUB_NODE *sn)
+{
+    CO_OBJ   od[] = {
+        {CO_KEY(0x1001, 0, CO_OBJ_____R_), CO_TUNSIGNED8 , (CO_DATA)(&sn->Obj1001)},
+        {CO_KEY(0x1014, 0, CO_OBJ_____R_), CO_TEMCY_ID,    (CO_DATA)(&StubObj1014)},
+        {CO_KEY(0x1017, 0, CO_OBJ_____RW), CO_THB_PROD,    (CO_DATA)(&sn->Obj1017)},
+        {CO_KEY(0x1800, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(2)           },
+        {CO_KEY(0x1800, 1, CO_OBJ__N__R_), CO_TUNSIGNED32, (CO_DATA)(&StubObj1800)},
+        {CO_KEY(0x1800, 2, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(254)         },
+        {CO_KEY(0x1A00, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(1)           },
+        {CO_KEY(0x1A00, 1, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&StubObj1A00)},
+        {CO_KEY(0x2100, 0, CO_OBJ_D___R_), CO_TUNSIGNED8 , (CO_DATA)(1)           },
+        {CO_KEY(0x2100, 1, CO_OBJ___APRW), CO_TUNSIGNED32, (CO_DATA)(&sn->Obj2100)},
+        CO_OBJ_DICT_ENDMARK
+    };
+    uint32_t n;
+
+    for (n = 0; n < STUB_OBJ_N; n++) {
+        sn->Dict[n] = (CO_OBJ)CO_OBJ_DICT_ENDMARK;
+    }
+    for (n = 0; n < sizeof(od) / sizeof(CO_OBJ); n++) {
+        sn->Dict[n] = od[n];
+    }
+}
+
+void StubReset(void)
+{
+    CO_NODE_SPEC spec;
+    STUB_NODE   *sn;
+    uint32_t     n;
+
+    memset(&StubExec, 0, sizeof(StubExec));
+    memset(&StubNode, 0, sizeof(StubNode));
+    for (n = 0; n < STUB_FRM_N; n++) {
+        StubFrm[n].Identifier = 0x700 + n;
+        StubFrm[n].DLC        = 8;
+    }
+    StubFrmNum  = 0;
+    StubFrmRd   = 0;
+    StubSentNum = 0;
+    StubTimer   = 0;
+
+    COExecInit(&StubExec, &StubBus, 250000);
+    for (n = 0; n < STUB_NODE_N; n++) {
+        sn = &StubNode[n];
+        StubDict(sn);
+        spec.NodeId   = (uint8_t)(n + 1);
+        spec.Baudrate = 250000;
+        spec.Dict     = &sn->Dict[0];
+        spec.DictLen  = STUB_OBJ_N;
+        spec.EmcyCode = NULL;
+        spec.TmrMem   = &sn->TmrMem[0];
+        spec.TmrNum   = STUB_TMR_N;
+        spec.TmrFreq  = 1000;
+        spec.Drv      = &StubDrv;
+        spec.SdoBuf   = &sn->SdoBuf[0];
+        sn->Worker    = COExecAdd(&StubExec, &sn->Node, &spec);
+        CONodeStart(&sn->Node);
+        CONmtSetMode(&sn->Node.Nmt, CO_OPERATIONAL);
+    }
+
+    /* discard the boot-up messages */
+    (void)COExecBusProcess(&StubExec);
+    for (n = 0; n < STUB_NODE_N; n++) {
+        (void)COExecWorkerProcess(StubNode[n].Worker);
+        StubReceive[n] = 0;
+    }
+    StubSentNum = 0;
+}
+
+/******************************************************************************
+* TEST CASES - NODE EXECUTOR
+******************************************************************************/
+
+void test_add(void)
+{
+    uint32_t n;
+
+    TEST_CHECK(StubExec.Num == STUB_NODE_N);
+    for (n = 0; n < STUB_NODE_N; n++) {
+        TEST_CHECK(StubNode[n].Worker == &StubExec.Worker[n]);
+        TEST_CHECK(StubNode[n].Node.If.Drv == &StubExec.Worker[n].Drv);
+        TEST_CHECK(CO_IF_CTX(&StubNode[n].Node.If) == StubNode[n].Worker);
+        TEST_CHECK(CONodeGetErr(&StubNode[n].Node) == CO_ERR_NONE);
+    }
+}
+
+void test_post(void)
+{
+    STUB_NODE *sn = &StubNode[0];
+    CO_ERR     err;
+
+    err = COExecPost(sn->Worker, CO_DEV(0x2100, 1), 0x12345678);
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(sn->Obj2100 == 0);
+
+    (void)COExecWorkerProcess(sn->Worker);
+    TEST_CHECK(sn->Obj2100 == 0x12345678);
+    TEST_CHECK(CONodeGetErr(&sn->Node) == CO_ERR_NONE);
+
+    /* the asynchronous PDO is sent to the bus and the other node */
+    (void)COExecBusProcess(&StubExec);
+    TEST_CHECK(StubSentNum == 1);
+    TEST_CHECK(StubSent[0].Identifier == 0x181);
+    TEST_CHECK(StubSent[0].Data[0] == 0x78);
+    TEST_CHECK(StubSent[0].Data[3] == 0x12);
+    (void)COExecWorkerProcess(StubNode[1].Worker);
+    TEST_CHECK(StubReceive[1] == 1);
+}
+
+void test_post_full(void)
+{
+    STUB_NODE *sn = &StubNode[0];
+    CO_ERR     err;
+    uint32_t   n;
+
+    for (n = 0; n < CO_EXEC_REQ_N; n++) {
+        err = COExecPost(sn->Worker, CO_DEV(0x2100, 1), n + 1);
+        TEST_CHECK(err == CO_ERR_NONE);
+    }
+    err = COExecPost(sn->Worker, CO_DEV(0x2100, 1), 0);
+    TEST_CHECK(err == CO_ERR_EXEC_FULL);
+
+    (void)COExecWorkerProcess(sn->Worker);
+    TEST_CHECK(sn->Obj2100 == CO_EXEC_REQ_N);
+
+    err = COExecPost(sn->Worker, CO_DEV(0x2100, 1), 0);
+    TEST_CHECK(err == CO_ERR_NONE);
+}
+
+void test_post_error(void)
+{
+    STUB_NODE *sn = &StubNode[0];
+    CO_ERR     err;
+
+    err = COExecPost(sn->Worker, CO_DEV(0x2200, 1), 1);
+    TEST_CHECK(err == CO_ERR_NONE);
+
+    (void)COExecWorkerProcess(sn->Worker);
+    TEST_CHECK(CONodeGetErr(&sn->Node) == CO_ERR_OBJ_NOT_FOUND);
+}
+
+void test_bus_deliver(void)
+{
+    uint16_t num;
+
+    StubFrmNum = 3;
+    num = COExecBusProcess(&StubExec);
+    TEST_CHECK(num == 3);
+    TEST_CHECK(StubSentNum == 0);
+
+    num = COExecWorkerProcess(StubNode[0].Worker);
+    TEST_CHECK(num == 3);
+    num = COExecWorkerProcess(StubNode[1].Worker);
+    TEST_CHECK(num == 3);
+    TEST_CHECK(StubReceive[0] == 3);
+    TEST_CHECK(StubReceive[1] == 3);
+}
+
+void test_loopback(void)
+{
+    CO_IF_FRM frm = { 0x321, { 0x11, 0x22 }, 2 };
+    int16_t   err;
+
+    err = COIfCanSend(&StubNode[0].Node.If, &frm);
+    TEST_CHECK(err == (int16_t)sizeof(CO_IF_FRM));
+    TEST_CHECK(StubSentNum == 0);
+
+    (void)COExecBusProcess(&StubExec);
+    TEST_CHECK(StubSentNum == 1);
+    TEST_CHECK(StubSent[0].Identifier == 0x321);
+
+    (void)COExecWorkerProcess(StubNode[0].Worker);
+    (void)COExecWorkerProcess(StubNode[1].Worker);
+    TEST_CHECK(StubReceive[0] == 0);
+    TEST_CHECK(StubReceive[1] == 1);
+}
+
+void test_rx_overflow(void)
+{
+    StubFrmNum = CO_EXEC_MBX_N + 5;
+    (void)COExecBusProcess(&StubExec);
+    (void)COExecBusProcess(&StubExec);
+    TEST_CHECK(StubFrmRd == CO_EXEC_MBX_N + 5);
+    TEST_CHECK(StubExec.Worker[0].RxOvr == 5);
+    TEST_CHECK(StubExec.Worker[1].RxOvr == 5);
+
+    (void)COExecWorkerProcess(StubNode[0].Worker);
+    TEST_CHECK(StubReceive[0] == CO_EXEC_MBX_N);
+}
+
+void test_tx_stop(void)
+{
+    CO_IF_FRM frm = { 0x321, { 0 }, 0 };
+    int16_t   err = 0;
+    uint32_t  n;
+
+    COExecStop(&StubExec);
+    for (n = 0; n < CO_EXEC_MBX_N; n++) {
+        err = COIfCanSend(&StubNode[0].Node.If, &frm);
+        TEST_CHECK(err == (int16_t)sizeof(CO_IF_FRM));
+    }
+    err = COIfCanSend(&StubNode[0].Node.If, &frm);
+    TEST_CHECK(err < 0);
+    TEST_CHECK(CONodeGetErr(&StubNode[0].Node) == CO_ERR_IF_CAN_SEND);
+}
+
+void test_tick(void)
+{
+    STUB_NODE *sn = &StubNode[0];
+    int16_t    id;
+
+    id = COTmrCreate(&sn->Node.Tmr, 3, 0, StubTimerFunc, NULL);
+    TEST_CHECK(id >= 0);
+
+    COExecTick(&StubExec);
+    COExecTick(&StubExec);
+    (void)COExecWorkerProcess(sn->Worker);
+    TEST_CHECK(StubTimer == 0);
+
+    COExecTick(&StubExec);
+    (void)COExecWorkerProcess(sn->Worker);
+    TEST_CHECK(StubTimer == 1);
+
+    /* the other node is clocked independently */
+    (void)COExecWorkerProcess(StubNode[1].Worker);
+    TEST_CHECK(StubNode[1].Worker->Tick == 3);
+}
+
+void test_tick_missed(void)
+{
+    STUB_NODE *sn = &StubNode[0];
+    uint32_t   n;
+
+    (void)COTmrCreate(&sn->Node.Tmr, 2, 2, StubTimerFunc, NULL);
+
+    for (n = 0; n < 10; n++) {
+        COExecTick(&StubExec);
+    }
+    (void)COExecWorkerProcess(sn->Worker);
+    TEST_CHECK(StubTimer == 5);
+}
+
+TEST_LIST = {
+    { "add",         test_add         },
+    { "post",        test_post        },
+    { "post_full",   test_post_full   },
+    { "post_error",  test_post_error  },
+    { "bus_deliver", test_bus_deliver },
+    { "loopback",    test_loopback    },
+    { "rx_overflow", test_rx_overflow },
+    { "tx_stop",     test_tx_stop     },
+    { "tick",        test_tick        },
+    { "tick_missed", test_tick_missed },
+    { NULL, NULL }
+};
@@ -0,0 +1,211 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+void StubReset(void);
+#define TEST_INIT   StubReset()
+
+#include "acutest.h"
+
+/******************************************************************************
+* TEST CASES - STUB FUNCTIONS
+******************************************************************************/
+
+#define STUB_FRM_N  64
+
+CO_IF_FRM StubFrm[STUB_FRM_N];
+uint32_t  StubFrmNum   = 0;
+uint32_t  StubFrmRd    = 0;
+int16_t   StubReadErr  = 0;
+uint32_t  StubReadCall = 0;
+uint32_t  StubBatchCall = 0;
+uint32_t  StubReceive  = 0;
+
+static int16_t StubRead(CO_IF *cif, CO_IF_FRM *frm)
+{
+    (void)cif;
+    StubReadCall++;
+    if (StubReadErr != 0) {
+        return (StubReadErr);
+    }
+    if (StubFrmRd >= StubFrmNum) {
+        return (0);
+    }
+    *frm = StubFrm[StubFrmRd];
+    StubFrmRd++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static int16_t StubReadBatch(CO_IF *cif, CO_IF_FRM *frm, uint16_t max)
+{
+    int16_t num = 0;
+
+    (void)cif;
+    StubBatchCall++;
+    while ((num < (int16_t)max) && (StubFrmRd < StubFrmNum)) {
+        frm[num] = StubFrm[StubFrmRd];
+        StubFrmRd++;
+        num++;
+    }
+    return (num);
+}
+
+void COIfCanReceive(CO_IF *cif, CO_IF_FRM *frm)
+{
+    (void)cif;
+    (void)frm;
+    StubReceive++;
+}
+
+static CO_IF_CAN_DRV StubCanRead = { 0, 0, StubRead, 0, 0, 0, 0, 0 };
+static CO_IF_CAN_DRV StubCanBatch = { 0, 0, StubRead, 0, 0, 0, StubReadBatch, 0 };
+static CO_IF_DRV     StubDrv = { 0 };
+
+void StubReset(void)
+{
+    uint32_t n;
+
+    for (n = 0; n < STUB_FRM_N; n++) {
+        StubFrm[n].Identifier = 0x100 + n;
+        StubFrm[n].DLC        = 8;
+    }
+    StubFrmNum    = 0;
+    StubFrmRd     = 0;
+    StubReadErr   = 0;
+    StubReadCall  = 0;
+    StubBatchCall = 0;
+    StubReceive   = 0;
+}
+
+static void SetupNode(CO_NODE *node, CO_IF_CAN_DRV *can)
+{
+    uint32_t n;
+
+    StubDrv.Can   = can;
+    node->If.Drv  = &StubDrv;
+    node->If.Node = node;
+    for (n = 0; n < CO_SSDO_N; n++) {
+        node->Sdo[n].RxId = CO_SDO_ID_OFF;
+    }
+    CODispInit(&node->Disp, node);
+}
+
+/******************************************************************************
+* TEST CASES - BATCH PROCESSING
+******************************************************************************/
+
+void test_fallback(void)
+{
+    CO_NODE  node = { 0 };
+    uint16_t num;
+
+    SetupNode(&node, &StubCanRead);
+    StubFrmNum = 5;
+
+    num = CONodeProcessBatch(&node, 3);
+    TEST_CHECK(num == 3);
+    num = CONodeProcessBatch(&node, 3);
+    TEST_CHECK(num == 2);
+    num = CONodeProcessBatch(&node, 3);
+    TEST_CHECK(num == 0);
+    TEST_CHECK(StubFrmRd == 5);
+}
+
+void test_driver(void)
+{
+    CO_NODE  node = { 0 };
+    uint16_t num;
+
+    SetupNode(&node, &StubCanBatch);
+    StubFrmNum = 5;
+
+    num = CONodeProcessBatch(&node, 3);
+    TEST_CHECK(num == 3);
+    num = CONodeProcessBatch(&node, 3);
+    TEST_CHECK(num == 2);
+    TEST_CHECK(StubBatchCall == 2);
+    TEST_CHECK(StubReadCall  == 0);
+}
+
+void test_empty(void)
+{
+    CO_NODE  node = { 0 };
+    uint16_t num;
+
+    SetupNode(&node, &StubCanBatch);
+
+    num = CONodeProcessBatch(&node, 10);
+    TEST_CHECK(num == 0);
+    num = CONodeProcessBatch(&node, 0);
+    TEST_CHECK(num == 0);
+}
+
+void test_large(void)
+{
+    CO_NODE  node = { 0 };
+    uint16_t num;
+
+    SetupNode(&node, &StubCanBatch);
+    StubFrmNum = STUB_FRM_N;
+
+    num = CONodeProcessBatch(&node, STUB_FRM_N + 10);
+    TEST_CHECK(num == STUB_FRM_N);
+    TEST_CHECK(StubFrmRd == STUB_FRM_N);
+}
+
+void test_read_error(void)
+{
+    CO_NODE  node = { 0 };
+    uint16_t num;
+
+    SetupNode(&node, &StubCanRead);
+    StubFrmNum  = 5;
+    StubReadErr = -1;
+
+    num = CONodeProcessBatch(&node, 3);
+    TEST_CHECK(num == 0);
+    TEST_CHECK(CONodeGetErr(&node) == CO_ERR_IF_CAN_READ);
+}
+
+void test_dispatch(void)
+{
+    CO_NODE  node = { 0 };
+    uint16_t num;
+
+    SetupNode(&node, &StubCanBatch);
+    node.Nmt.Allowed = CO_NMT_ALLOWED;
+    StubFrmNum = 12;
+
+    num = CONodeProcessBatch(&node, 20);
+    TEST_CHECK(num == 12);
+    TEST_CHECK(StubReceive == 12);
+}
+
+
+TEST_LIST = {
+    { "fallback",      test_fallback      },
+    { "driver",        test_driver        },
+    { "empty",         test_empty         },
+    { "large",         test_large         },
+    { "read_error",    test_read_error    },
+    { "dispatch",      test_dispatch      },
+    { NULL, NULL }
+};
@@ -0,0 +1,354 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+void StubReset(void);
+#define TEST_INIT   StubReset()
+
+#include "acutest.h"
+
+/******************************************************************************
+* TEST CASES - STUB FUNCTIONS
+******************************************************************************/
+
+#define STUB_TMR_N   8
+#define STUB_LOG_N   64
+
+typedef struct STUB_ACT_T {
+    CO_NODE *Node;
+    uint8_t  Tag;
+    int16_t  Del;
+
+} STUB_ACT;
+
+uint32_t StubNow;
+uint32_t StubCounter;
+uint8_t  StubActive;
+uint8_t  StubFire;
+uint32_t StubLogNum;
+uint8_t  StubLogTag[STUB_LOG_N];
+uint32_t StubLogTime[STUB_LOG_N];
+
+static void     StubTmrInit  (CO_IF *cif, uint32_t freq) { (void)cif; (void)freq; }
+static void     StubTmrReload(CO_IF *cif, uint32_t reload) { (void)cif; StubCounter = reload; }
+static uint32_t StubTmrDelay (CO_IF *cif) { (void)cif; return (StubCounter); }
+static void     StubTmrStop  (CO_IF *cif) { (void)cif; StubCounter = 0; StubActive = 0; }
+static void     StubTmrStart (CO_IF *cif) { (void)cif; StubActive = 1; }
+static uint8_t  StubTmrUpdate(CO_IF *cif)
+{
+    uint8_t result = StubFire;
+
+    (void)cif;
+    StubFire = 0;
+    return (result);
+}
+
+static CO_IF_TIMER_DRV StubTimer = {
+    StubTmrInit, StubTmrReload, StubTmrDelay, StubTmrStop, StubTmrStart, StubTmrUpdate
+};
+static CO_IF_DRV  StubDrv = { 0 };
+static CO_TMR_MEM StubMem[STUB_TMR_N];
+
+void StubReset(void)
+{
+    StubNow     = 0;
+    StubCounter = 0;
+    StubActive  = 0;
+    StubFire    = 0;
+    StubLogNum  = 0;
+}
+
+static void StubFunc(void *parg)
+{
+    STUB_ACT *act = (STUB_ACT *)parg;
+
+    if (StubLogNum < STUB_LOG_N) {
+        StubLogTag[StubLogNum]  = act->Tag;
+        StubLogTime[StubLogNum] = StubNow;
+        StubLogNum++;
+    }
+    if (act->Del >= 0) {
+        (void)COTmrDelete(&act->Node->Tmr, act->Del);
+    }
+}
+
+static void SetupNode(CO_NODE *node)
+{
+    StubDrv.Timer = &StubTimer;
+    node->If.Drv  = &StubDrv;
+    node->If.Node = node;
+    COTmrInit(&node->Tmr, node, StubMem, STUB_TMR_N, 1000000u);
+}
+
+/* let the given number of ticks pass; the stub timer jumps to each event */
+static void StubRun(CO_NODE *node, uint32_t ticks)
+{
+    while ((StubActive != 0) && (StubCounter <= ticks)) {
+        ticks      -= StubCounter;
+        StubNow    += StubCounter;
+        StubCounter = 0;
+        StubFire    = 1;
+        if (COTmrService(&node->Tmr) > 0) {
+            COTmrProcess(&node->Tmr);
+        }
+    }
+    if (StubActive != 0) {
+        StubCounter -= ticks;
+    }
+    StubNow += ticks;
+}
+
+static int16_t Create(CO_NODE *node, STUB_ACT *act, uint8_t tag, uint32_t start, uint32_t cycle)
+{
+    act->Node = node;
+    act->Tag  = tag;
+    act->Del  = -1;
+    return (COTmrCreate(&node->Tmr, start, cycle, StubFunc, act));
+}
+
+/******************************************************************************
+* TEST CASES - TIMING WHEEL
+******************************************************************************/
+
+void test_create_ids(void)
+{
+    CO_NODE  node = { 0 };
+    STUB_ACT act[STUB_TMR_N + 1];
+    int16_t  id[STUB_TMR_N + 1];
+    uint8_t  n;
+    uint8_t  m;
+
+    SetupNode(&node);
+
+    for (n = 0; n < STUB_TMR_N; n++) {
+        id[n] = Create(&node, &act[n], n, 100u + n, 0);
+        TEST_CHECK(id[n] >= 0);
+        for (m = 0; m < n; m++) {
+            TEST_CHECK(id[m] != id[n]);
+        }
+    }
+    id[n] = Create(&node, &act[n], n, 100u, 0);
+
+    TEST_CHECK(id[n] == -1);
+    TEST_CHECK(CONodeGetErr(&node) == CO_ERR_TMR_NO_ACT);
+}
+
+void test_one_shot(void)
+{
+    CO_NODE  node = { 0 };
+    STUB_ACT act;
+    int16_t  id;
+
+    SetupNode(&node);
+
+    id = Create(&node, &act, 1, 10, 0);
+    TEST_CHECK(id >= 0);
+
+    StubRun(&node, 9);
+    TEST_CHECK(StubLogNum == 0);
+
+    StubRun(&node, 1);
+    TEST_CHECK(StubLogNum     == 1);
+    TEST_CHECK(StubLogTime[0] == 10);
+    TEST_CHECK(StubActive     == 0);
+
+    /* action is released */
+    TEST_CHECK(COTmrDelete(&node.Tmr, id) == -1);
+}
+
+void test_levels(void)
+{
+    CO_NODE  node = { 0 };
+    STUB_ACT act[STUB_TMR_N];
+    uint32_t delay[STUB_TMR_N] = {
+        1u, 15u, 16u, 17u, 4097u, 70000u, 1048577u, 0x10000001u
+    };
+    uint8_t  n;
+
+    SetupNode(&node);
+
+    for (n = STUB_TMR_N; n > 0; n--) {
+        (void)Create(&node, &act[n - 1], n - 1, delay[n - 1], 0);
+    }
+    StubRun(&node, 0x10000001u);
+
+    TEST_CHECK(StubLogNum == STUB_TMR_N);
+    for (n = 0; n < STUB_TMR_N; n++) {
+        TEST_CHECK(StubLogTag[n]  == n);
+        TEST_CHECK(StubLogTime[n] == delay[n]);
+        TEST_MSG("timer %d: expected %u, fired %u", n, delay[n], StubLogTime[n]);
+    }
+    TEST_CHECK(StubActive == 0);
+}
+
+void test_running_insert(void)
+{
+    CO_NODE  node = { 0 };
+    STUB_ACT act[3];
+
+    SetupNode(&node);
+
+    (void)Create(&node, &act[0], 0, 1000, 0);
+    StubRun(&node, 333);
+    (void)Create(&node, &act[1], 1, 20, 0);
+    (void)Create(&node, &act[2], 2, 5000, 0);
+    StubRun(&node, 10000);
+
+    TEST_CHECK(StubLogNum     == 3);
+    TEST_CHECK(StubLogTag[0]  == 1);
+    TEST_CHECK(StubLogTime[0] == 353);
+    TEST_CHECK(StubLogTag[1]  == 0);
+    TEST_CHECK(StubLogTime[1] == 1000);
+    TEST_CHECK(StubLogTag[2]  == 2);
+    TEST_CHECK(StubLogTime[2] == 5333);
+}
+
+void test_same_expiry(void)
+{
+    CO_NODE  node = { 0 };
+    STUB_ACT act[3];
+
+    SetupNode(&node);
+
+    (void)Create(&node, &act[0], 0, 100, 0);
+    (void)Create(&node, &act[1], 1, 100, 0);
+    (void)Create(&node, &act[2], 2, 100, 0);
+    StubRun(&node, 100);
+
+    TEST_CHECK(StubLogNum    == 3);
+    TEST_CHECK(StubLogTag[0] == 0);
+    TEST_CHECK(StubLogTag[1] == 1);
+    TEST_CHECK(StubLogTag[2] == 2);
+}
+
+void test_cyclic(void)
+{
+    CO_NODE  node = { 0 };
+    STUB_ACT act;
+    int16_t  id;
+
+    SetupNode(&node);
+
+    id = Create(&node, &act, 7, 5, 300);
+    StubRun(&node, 905);
+
+    TEST_CHECK(StubLogNum     == 4);
+    TEST_CHECK(StubLogTime[0] == 5);
+    TEST_CHECK(StubLogTime[1] == 305);
+    TEST_CHECK(StubLogTime[2] == 605);
+    TEST_CHECK(StubLogTime[3] == 905);
+
+    TEST_CHECK(COTmrDelete(&node.Tmr, id) == 0);
+    StubRun(&node, 1000);
+    TEST_CHECK(StubLogNum == 4);
+}
+
+void test_delete(void)
+{
+    CO_NODE  node = { 0 };
+    STUB_ACT act[3];
+    int16_t  id[3];
+
+    SetupNode(&node);
+
+    id[0] = Create(&node, &act[0], 0, 10, 0);
+    id[1] = Create(&node, &act[1], 1, 10, 0);
+    id[2] = Create(&node, &act[2], 2, 20000, 0);
+
+    TEST_CHECK(COTmrDelete(&node.Tmr, id[1]) ==  0);
+    TEST_CHECK(COTmrDelete(&node.Tmr, id[1]) == -1);
+    TEST_CHECK(COTmrDelete(&node.Tmr, -1)         == -1);
+    TEST_CHECK(COTmrDelete(&node.Tmr, STUB_TMR_N) == -1);
+    TEST_CHECK(COTmrDelete(&node.Tmr, id[2]) ==  0);
+    StubRun(&node, 30000);
+
+    TEST_CHECK(StubLogNum    == 1);
+    TEST_CHECK(StubLogTag[0] == 0);
+    TEST_CHECK(StubActive    == 0);
+}
+
+void test_delete_elapsed(void)
+{
+    CO_NODE  node = { 0 };
+    STUB_ACT act[2];
+    int16_t  id;
+
+    SetupNode(&node);
+
+    (void)Create(&node, &act[0], 0, 50, 0);
+    id = Create(&node, &act[1], 1, 50, 0);
+    act[0].Del = id;
+    StubRun(&node, 50);
+
+    TEST_CHECK(StubLogNum    == 1);
+    TEST_CHECK(StubLogTag[0] == 0);
+}
+
+void test_wrap(void)
+{
+    CO_NODE  node = { 0 };
+    STUB_ACT act[3];
+
+    SetupNode(&node);
+
+    (void)Create(&node, &act[0], 0, 0xFFFFFFF0u, 0);
+    StubRun(&node, 0xFFFFFFF0u);
+    (void)Create(&node, &act[1], 1, 0x20u, 0);
+    (void)Create(&node, &act[2], 2, 0x1000u, 0);
+    StubRun(&node, 0x1000u);
+
+    TEST_CHECK(StubLogNum     == 3);
+    TEST_CHECK(StubLogTime[0] == 0xFFFFFFF0u);
+    TEST_CHECK(StubLogTime[1] == 0x00000010u);
+    TEST_CHECK(StubLogTime[2] == 0x00000FF0u);
+}
+
+void test_full_rotation(void)
+{
+    CO_NODE  node = { 0 };
+    STUB_ACT act[2];
+
+    SetupNode(&node);
+
+    (void)Create(&node, &act[0], 0, 0x30000000u, 0);
+    StubRun(&node, 0x12345u);
+    (void)Create(&node, &act[1], 1, 0xFFFFFF00u, 0);
+    StubRun(&node, 0xFFFFFF00u);
+
+    TEST_CHECK(StubLogNum     == 2);
+    TEST_CHECK(StubLogTime[0] == 0x30000000u);
+    TEST_CHECK(StubLogTime[1] == 0x00012245u);
+}
+
+
+TEST_LIST = {
+    { "create_ids",      test_create_ids      },
+    { "one_shot",        test_one_shot        },
+    { "levels",          test_levels          },
+    { "running_insert",  test_running_insert  },
+    { "same_expiry",     test_same_expiry     },
+    { "cyclic",          test_cyclic          },
+    { "delete",          test_delete          },
+    { "delete_elapsed",  test_delete_elapsed  },
+    { "wrap",            test_wrap            },
+    { "full_rotation",   test_full_rotation   },
+    { NULL, NULL }
+};
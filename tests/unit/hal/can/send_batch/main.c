@@ -0,0 +1,296 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+void StubReset(void);
+#define TEST_INIT   StubReset()
+
+#include "acutest.h"
+
+/******************************************************************************
+* TEST CASES - STUB FUNCTIONS
+******************************************************************************/
+
+#define STUB_FRM_N  64
+
+CO_IF_FRM StubTx[STUB_FRM_N];
+uint32_t  StubTxNum     = 0;
+int16_t   StubSendErr   = 0;
+uint32_t  StubSendCall  = 0;
+uint32_t  StubBatchCall = 0;
+uint32_t  StubResetCall = 0;
+CO_IF    *StubSendIf    = 0;
+
+static int16_t StubSend(CO_IF *cif, CO_IF_FRM *frm)
+{
+    StubSendIf = cif;
+    StubSendCall++;
+    if (StubSendErr != 0) {
+        return (StubSendErr);
+    }
+    StubTx[StubTxNum] = *frm;
+    StubTxNum++;
+    return ((int16_t)sizeof(CO_IF_FRM));
+}
+
+static int16_t StubSendBatch(CO_IF *cif, CO_IF_FRM *frm, uint16_t num)
+{
+    uint16_t n;
+
+    StubSendIf = cif;
+    StubBatchCall++;
+    for (n = 0; n < num; n++) {
+        StubTx[StubTxNum] = frm[n];
+        StubTxNum++;
+    }
+    return ((int16_t)num);
+}
+
+static void StubCanReset(CO_IF *cif)
+{
+    (void)cif;
+    StubResetCall++;
+}
+
+static CO_IF_CAN_DRV StubCanSend  = { 0, 0, 0, StubSend, StubCanReset, 0, 0, 0 };
+static CO_IF_CAN_DRV StubCanBatch = { 0, 0, 0, StubSend, StubCanReset, 0, 0, StubSendBatch };
+static CO_IF_DRV     StubDrv = { 0 };
+
+void StubReset(void)
+{
+    StubTxNum     = 0;
+    StubSendErr   = 0;
+    StubSendCall  = 0;
+    StubBatchCall = 0;
+    StubResetCall = 0;
+    StubSendIf    = 0;
+}
+
+static void SetupNode(CO_NODE *node, CO_IF_CAN_DRV *can)
+{
+    StubDrv.Can   = can;
+    node->If.Drv  = &StubDrv;
+    node->If.Node = node;
+}
+
+static void Send(CO_NODE *node, uint32_t id, uint8_t tag)
+{
+    CO_IF_FRM frm = { 0 };
+
+    frm.Identifier = id;
+    frm.DLC        = 1;
+    frm.Data[0]    = tag;
+    (void)COIfCanSend(&node->If, &frm);
+}
+
+/******************************************************************************
+* TEST CASES - DEFERRED TRANSMIT
+******************************************************************************/
+
+void test_direct(void)
+{
+    CO_NODE  node = { 0 };
+
+    SetupNode(&node, &StubCanBatch);
+
+    Send(&node, 0x181, 1);
+
+    TEST_CHECK(StubSendCall == 1);
+    TEST_CHECK(StubTxNum    == 1);
+}
+
+void test_order(void)
+{
+    CO_NODE  node = { 0 };
+    int16_t  result;
+
+    SetupNode(&node, &StubCanBatch);
+
+    COIfCanSendDefer(&node.If);
+    Send(&node, 0x183, 1);
+    Send(&node, 0x181, 2);
+    Send(&node, 0x182, 3);
+    TEST_CHECK(StubTxNum == 0);
+
+    result = COIfCanSendFlush(&node.If);
+
+    TEST_CHECK(result        == 3);
+    TEST_CHECK(StubBatchCall == 1);
+    TEST_CHECK(StubSendCall  == 0);
+    TEST_CHECK(StubTxNum     == 3);
+    TEST_CHECK(StubTx[0].Identifier == 0x181);
+    TEST_CHECK(StubTx[1].Identifier == 0x182);
+    TEST_CHECK(StubTx[2].Identifier == 0x183);
+    TEST_CHECK(node.If.TxNum == 0);
+}
+
+void test_same_id(void)
+{
+    CO_NODE  node = { 0 };
+
+    SetupNode(&node, &StubCanBatch);
+
+    COIfCanSendDefer(&node.If);
+    Send(&node, 0x281, 1);
+    Send(&node, 0x181, 2);
+    Send(&node, 0x281, 3);
+    (void)COIfCanSendFlush(&node.If);
+
+    TEST_CHECK(StubTxNum == 3);
+    TEST_CHECK(StubTx[0].Data[0] == 2);
+    TEST_CHECK(StubTx[1].Data[0] == 1);
+    TEST_CHECK(StubTx[2].Data[0] == 3);
+}
+
+void test_fallback(void)
+{
+    CO_NODE  node = { 0 };
+    int16_t  result;
+
+    SetupNode(&node, &StubCanSend);
+
+    COIfCanSendDefer(&node.If);
+    Send(&node, 0x182, 1);
+    Send(&node, 0x181, 2);
+    result = COIfCanSendFlush(&node.If);
+
+    TEST_CHECK(result       == 2);
+    TEST_CHECK(StubSendCall == 2);
+    TEST_CHECK(StubTx[0].Identifier == 0x181);
+    TEST_CHECK(StubTx[1].Identifier == 0x182);
+}
+
+void test_nested(void)
+{
+    CO_NODE  node = { 0 };
+    int16_t  result;
+
+    SetupNode(&node, &StubCanBatch);
+
+    COIfCanSendDefer(&node.If);
+    COIfCanSendDefer(&node.If);
+    Send(&node, 0x182, 1);
+    result = COIfCanSendFlush(&node.If);
+    TEST_CHECK(result    == 0);
+    TEST_CHECK(StubTxNum == 0);
+
+    Send(&node, 0x181, 2);
+    result = COIfCanSendFlush(&node.If);
+    TEST_CHECK(result    == 2);
+    TEST_CHECK(StubTxNum == 2);
+
+    Send(&node, 0x180, 3);
+    TEST_CHECK(StubTxNum == 3);
+}
+
+void test_queue_full(void)
+{
+    CO_NODE  node = { 0 };
+    uint32_t n;
+
+    SetupNode(&node, &StubCanBatch);
+
+    COIfCanSendDefer(&node.If);
+    for (n = 0; n < CO_IF_TX_BATCH_N + 1; n++) {
+        Send(&node, 0x200 - n, (uint8_t)n);
+    }
+    TEST_CHECK(StubBatchCall == 1);
+    TEST_CHECK(StubTxNum     == CO_IF_TX_BATCH_N);
+    TEST_CHECK(StubTx[0].Identifier == 0x200 - (CO_IF_TX_BATCH_N - 1));
+
+    (void)COIfCanSendFlush(&node.If);
+    TEST_CHECK(StubBatchCall == 2);
+    TEST_CHECK(StubTxNum     == CO_IF_TX_BATCH_N + 1);
+}
+
+void test_send_error(void)
+{
+    CO_NODE  node = { 0 };
+    int16_t  result;
+
+    SetupNode(&node, &StubCanSend);
+    StubSendErr = -1;
+
+    COIfCanSendDefer(&node.If);
+    Send(&node, 0x181, 1);
+    result = COIfCanSendFlush(&node.If);
+
+    TEST_CHECK(result < 0);
+    TEST_CHECK(CONodeGetErr(&node) == CO_ERR_IF_CAN_SEND);
+}
+
+void test_reset(void)
+{
+    CO_NODE  node = { 0 };
+    int16_t  result;
+
+    SetupNode(&node, &StubCanBatch);
+
+    COIfCanSendDefer(&node.If);
+    Send(&node, 0x181, 1);
+    COIfCanReset(&node.If);
+    result = COIfCanSendFlush(&node.If);
+
+    TEST_CHECK(result        == 0);
+    TEST_CHECK(StubResetCall == 1);
+    TEST_CHECK(StubTxNum     == 0);
+}
+
+/******************************************************************************
+* TEST CASES - DRIVER CONTEXT
+******************************************************************************/
+
+void test_context(void)
+{
+    CO_NODE   node1 = { 0 };
+    CO_NODE   node2 = { 0 };
+    CO_IF_DRV drv1  = { &StubCanSend, 0, 0, &node1 };
+    CO_IF_DRV drv2  = { &StubCanBatch, 0, 0, &node2 };
+
+    node1.If.Drv  = &drv1;
+    node1.If.Node = &node1;
+    node2.If.Drv  = &drv2;
+    node2.If.Node = &node2;
+
+    Send(&node1, 0x181, 1);
+    TEST_CHECK(StubSendIf              == &node1.If);
+    TEST_CHECK(CO_IF_CTX(StubSendIf)   == &node1);
+
+    COIfCanSendDefer(&node2.If);
+    Send(&node2, 0x182, 2);
+    (void)COIfCanSendFlush(&node2.If);
+    TEST_CHECK(StubSendIf              == &node2.If);
+    TEST_CHECK(CO_IF_CTX(StubSendIf)   == &node2);
+    TEST_CHECK(StubTxNum == 2);
+}
+
+TEST_LIST = {
+    { "direct",        test_direct        },
+    { "order",         test_order         },
+    { "same_id",       test_same_id       },
+    { "fallback",      test_fallback      },
+    { "nested",        test_nested        },
+    { "queue_full",    test_queue_full    },
+    { "send_error",    test_send_error    },
+    { "reset",         test_reset         },
+    { "context",       test_context       },
+    { NULL, NULL }
+};
@@ -0,0 +1,419 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* TEST ENVIRONMENT
+******************************************************************************/
+
+/* the test dictionary holds some basic entries, a read-only entry, an entry
+ * which refuses all writes and the concise DCF object */
+static uint8_t     ValU8;
+static uint16_t    ValU16;
+static uint32_t    ValU32;
+static uint32_t    ValRo;
+static uint32_t    ValFail;
+static uint8_t     Buf[64];
+static uint8_t     Undo[16];
+static const uint32_t Keys[3] = {
+    CO_DEV(0x2000, 1), CO_DEV(0x2000, 2), CO_DEV(0x2000, 3)
+};
+
+static uint32_t TestFailSize(struct CO_OBJ_T *obj, struct CO_NODE_T *node, uint32_t width)
+{
+    (void)obj;
+    (void)node;
+    (void)width;
+    return (4);
+}
+
+static CO_ERR TestFailRead(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    (void)node;
+    (void)size;
+    *(uint32_t *)buffer = *(uint32_t *)obj->Data;
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR TestFailWrite(struct CO_OBJ_T *obj, struct CO_NODE_T *node, void *buffer, uint32_t size)
+{
+    (void)obj;
+    (void)node;
+    (void)buffer;
+    (void)size;
+    return (CO_ERR_OBJ_RANGE);
+}
+
+static const CO_OBJ_TYPE TestFailType = { TestFailSize, 0, TestFailRead, TestFailWrite, 0 };
+
+static CO_NODE     AppNode;
+static CO_OBJ_CDCF Data;
+static CO_OBJ      Obj[6] = {
+    { CO_KEY(0x2000, 1, CO_OBJ_____RW), CO_TUNSIGNED8 , (CO_DATA)(&ValU8)   },
+    { CO_KEY(0x2000, 2, CO_OBJ_____RW), CO_TUNSIGNED16, (CO_DATA)(&ValU16)  },
+    { CO_KEY(0x2000, 3, CO_OBJ_____RW), CO_TUNSIGNED32, (CO_DATA)(&ValU32)  },
+    { CO_KEY(0x2001, 0, CO_OBJ_____R_), CO_TUNSIGNED32, (CO_DATA)(&ValRo)   },
+    { CO_KEY(0x2002, 0, CO_OBJ_____RW), &TestFailType , (CO_DATA)(&ValFail) },
+    { CO_KEY(0x2100, 0, CO_OBJ_____RW), CO_TCDCF      , (CO_DATA)(&Data)    }
+};
+
+static void TestSetup(const uint32_t *keys, uint16_t num, uint32_t undo)
+{
+    ValU8   = 0x11;
+    ValU16  = 0x2222;
+    ValU32  = 0x33333333;
+    ValRo   = 0x44444444;
+    ValFail = 0x55555555;
+    memset(&AppNode, 0, sizeof(AppNode));
+    memset(Buf, 0, sizeof(Buf));
+    Data.Offset   = 0;
+    Data.Size     = sizeof(Buf);
+    Data.Start    = &Buf[0];
+    Data.Keys     = keys;
+    Data.Num      = num;
+    Data.Undo     = &Undo[0];
+    Data.UndoSize = undo;
+    Data.Total    = 0;
+    (void)CODictInit(&AppNode.Dict, &AppNode, &Obj[0], 6);
+}
+
+/* append a record to the concise DCF in the given buffer */
+static uint32_t TestRec(uint8_t *dcf, uint32_t pos, uint16_t idx, uint8_t sub, uint32_t len, uint32_t val)
+{
+    uint32_t n;
+
+    dcf[pos++] = (uint8_t)idx;
+    dcf[pos++] = (uint8_t)(idx >> 8);
+    dcf[pos++] = sub;
+    for (n = 0; n < 4; n++) {
+        dcf[pos++] = (uint8_t)(len >> (n * 8));
+    }
+    for (n = 0; n < len; n++) {
+        dcf[pos++] = (uint8_t)(val >> (n * 8));
+    }
+    return (pos);
+}
+
+static uint32_t TestDcf(uint8_t *dcf, uint32_t num)
+{
+    dcf[0] = (uint8_t)num;
+    dcf[1] = 0;
+    dcf[2] = 0;
+    dcf[3] = 0;
+    return (4);
+}
+
+/******************************************************************************
+* TEST CASES - SIZE
+******************************************************************************/
+
+void test_size_write_only(void)
+{
+    uint32_t size;
+
+    TestSetup(0, 0, sizeof(Undo));
+    size = COObjGetSize(&Obj[5], &AppNode, 0);
+
+    TEST_CHECK(size == sizeof(Buf));
+}
+
+void test_size_snapshot(void)
+{
+    uint32_t size;
+
+    TestSetup(&Keys[0], 3, sizeof(Undo));
+    size = COObjGetSize(&Obj[5], &AppNode, 0);
+
+    TEST_CHECK(size == 4 + (7 + 1) + (7 + 2) + (7 + 4));
+}
+
+void test_size_download(void)
+{
+    uint32_t size;
+
+    TestSetup(&Keys[0], 3, sizeof(Undo));
+
+    size = COObjGetSize(&Obj[5], &AppNode, 11);
+    TEST_CHECK(size == 11);
+
+    size = COObjGetSize(&Obj[5], &AppNode, 100);
+    TEST_CHECK(size == sizeof(Buf));
+}
+
+/******************************************************************************
+* TEST CASES - READ
+******************************************************************************/
+
+void test_read_snapshot(void)
+{
+    uint8_t  exp[40];
+    uint8_t  var[40] = { 0 };
+    uint32_t len;
+    CO_ERR   err;
+
+    TestSetup(&Keys[0], 3, sizeof(Undo));
+    len = TestDcf(exp, 3);
+    len = TestRec(exp, len, 0x2000, 1, 1, 0x11);
+    len = TestRec(exp, len, 0x2000, 2, 2, 0x2222);
+    len = TestRec(exp, len, 0x2000, 3, 4, 0x33333333);
+
+    err = COObjRdBufStart(&Obj[5], &AppNode, &var[0], 0);
+    TEST_CHECK(err == CO_ERR_NONE);
+
+    err = COObjRdBufCont(&Obj[5], &AppNode, &var[0], 10);
+    TEST_CHECK(err == CO_ERR_NONE);
+    err = COObjRdBufCont(&Obj[5], &AppNode, &var[10], 30);
+    TEST_CHECK(err == CO_ERR_NONE);
+
+    TEST_CHECK(Data.Offset == len);
+    TEST_CHECK(memcmp(var, exp, len) == 0);
+    TEST_CHECK(var[len] == 0);
+}
+
+void test_read_write_only(void)
+{
+    uint8_t var[8] = { 0 };
+    CO_ERR  err;
+
+    TestSetup(0, 0, sizeof(Undo));
+    err = COObjRdBufStart(&Obj[5], &AppNode, &var[0], 8);
+
+    TEST_CHECK(err == CO_ERR_OBJ_ACC);
+}
+
+/******************************************************************************
+* TEST CASES - WRITE
+******************************************************************************/
+
+void test_write_apply(void)
+{
+    uint8_t  dcf[40];
+    uint32_t len;
+    CO_ERR   err;
+
+    TestSetup(0, 0, sizeof(Undo));
+    len = TestDcf(dcf, 3);
+    len = TestRec(dcf, len, 0x2000, 3, 4, 0xA1A2A3A4);
+    len = TestRec(dcf, len, 0x2000, 1, 1, 0xB1);
+    len = TestRec(dcf, len, 0x2000, 2, 2, 0xC1C2);
+
+    err = COObjWrBufStart(&Obj[5], &AppNode, &dcf[0], 9);
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(ValU32 == 0x33333333);
+
+    err = COObjWrBufCont(&Obj[5], &AppNode, &dcf[9], len - 9);
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(ValU32 == 0xA1A2A3A4);
+    TEST_CHECK(ValU8  == 0xB1);
+    TEST_CHECK(ValU16 == 0xC1C2);
+    TEST_CHECK(Data.Err == 0);
+    TEST_CHECK(Data.Offset == 0);
+}
+
+void test_write_incomplete(void)
+{
+    uint8_t  dcf[40];
+    uint32_t len;
+    CO_ERR   err;
+
+    TestSetup(0, 0, sizeof(Undo));
+    len = TestDcf(dcf, 2);
+    len = TestRec(dcf, len, 0x2000, 1, 1, 0xB1);
+    len = TestRec(dcf, len, 0x2000, 3, 4, 0xA1A2A3A4);
+
+    err = COObjWrBufStart(&Obj[5], &AppNode, &dcf[0], len - 1);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(ValU8  == 0x11);
+    TEST_CHECK(ValU32 == 0x33333333);
+}
+
+void test_write_truncated(void)
+{
+    uint8_t  dcf[40];
+    uint32_t len;
+    CO_ERR   err;
+
+    TestSetup(0, 0, sizeof(Undo));
+    len = TestDcf(dcf, 3);
+    len = TestRec(dcf, len, 0x2000, 1, 1, 0xB1);
+    len = TestRec(dcf, len, 0x2000, 3, 4, 0xA1A2A3A4);
+    TEST_CHECK(COObjGetSize(&Obj[5], &AppNode, len) == len);
+
+    err = COObjWrBufStart(&Obj[5], &AppNode, &dcf[0], 9);
+    TEST_CHECK(err == CO_ERR_NONE);
+    err = COObjWrBufCont(&Obj[5], &AppNode, &dcf[9], len - 9);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(ValU8  == 0x11);
+    TEST_CHECK(ValU32 == 0x33333333);
+    TEST_CHECK(Data.Offset == 0);
+}
+
+void test_write_no_entry(void)
+{
+    uint8_t  dcf[40];
+    uint32_t len;
+    CO_ERR   err;
+
+    TestSetup(0, 0, sizeof(Undo));
+    len = TestDcf(dcf, 2);
+    len = TestRec(dcf, len, 0x2000, 1, 1, 0xB1);
+    len = TestRec(dcf, len, 0x2000, 9, 4, 0xA1A2A3A4);
+
+    err = COObjWrBufStart(&Obj[5], &AppNode, &dcf[0], len);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(ValU8 == 0x11);
+    TEST_CHECK(Data.Err == CO_DEV(0x2000, 9));
+}
+
+void test_write_read_only(void)
+{
+    uint8_t  dcf[40];
+    uint32_t len;
+    CO_ERR   err;
+
+    TestSetup(0, 0, sizeof(Undo));
+    len = TestDcf(dcf, 2);
+    len = TestRec(dcf, len, 0x2000, 1, 1, 0xB1);
+    len = TestRec(dcf, len, 0x2001, 0, 4, 0xA1A2A3A4);
+
+    err = COObjWrBufStart(&Obj[5], &AppNode, &dcf[0], len);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(ValU8 == 0x11);
+    TEST_CHECK(ValRo == 0x44444444);
+    TEST_CHECK(Data.Err == CO_DEV(0x2001, 0));
+}
+
+void test_write_bad_size(void)
+{
+    uint8_t  dcf[40];
+    uint32_t len;
+    CO_ERR   err;
+
+    TestSetup(0, 0, sizeof(Undo));
+    len = TestDcf(dcf, 1);
+    len = TestRec(dcf, len, 0x2000, 2, 4, 0xA1A2A3A4);
+
+    err = COObjWrBufStart(&Obj[5], &AppNode, &dcf[0], len);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(ValU16 == 0x2222);
+    TEST_CHECK(Data.Err == CO_DEV(0x2000, 2));
+}
+
+void test_write_trailing(void)
+{
+    uint8_t  dcf[40];
+    uint32_t len;
+    CO_ERR   err;
+
+    TestSetup(0, 0, sizeof(Undo));
+    len = TestDcf(dcf, 1);
+    len = TestRec(dcf, len, 0x2000, 1, 1, 0xB1);
+    dcf[len++] = 0;
+
+    err = COObjWrBufStart(&Obj[5], &AppNode, &dcf[0], len);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(ValU8 == 0x11);
+}
+
+void test_write_undo_small(void)
+{
+    uint8_t  dcf[40];
+    uint32_t len;
+    CO_ERR   err;
+
+    TestSetup(0, 0, 4);
+    len = TestDcf(dcf, 2);
+    len = TestRec(dcf, len, 0x2000, 1, 1, 0xB1);
+    len = TestRec(dcf, len, 0x2000, 3, 4, 0xA1A2A3A4);
+
+    err = COObjWrBufStart(&Obj[5], &AppNode, &dcf[0], len);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(ValU8  == 0x11);
+    TEST_CHECK(ValU32 == 0x33333333);
+    TEST_CHECK(Data.Err == CO_DEV(0x2000, 3));
+}
+
+void test_write_rollback(void)
+{
+    uint8_t  dcf[48];
+    uint32_t len;
+    CO_ERR   err;
+
+    TestSetup(0, 0, sizeof(Undo));
+    len = TestDcf(dcf, 4);
+    len = TestRec(dcf, len, 0x2000, 3, 4, 0xA1A2A3A4);
+    len = TestRec(dcf, len, 0x2000, 1, 1, 0xB1);
+    len = TestRec(dcf, len, 0x2000, 3, 4, 0xD1D2D3D4);
+    len = TestRec(dcf, len, 0x2002, 0, 4, 0xE1E2E3E4);
+
+    err = COObjWrBufStart(&Obj[5], &AppNode, &dcf[0], len);
+
+    TEST_CHECK(err == CO_ERR_TYPE_WR);
+    TEST_CHECK(ValU8   == 0x11);
+    TEST_CHECK(ValU32  == 0x33333333);
+    TEST_CHECK(ValFail == 0x55555555);
+    TEST_CHECK(Data.Err == CO_DEV(0x2002, 0));
+}
+
+/******************************************************************************
+* TEST CASES - RESET
+******************************************************************************/
+
+void test_reset_offset(void)
+{
+    CO_ERR err;
+
+    TestSetup(0, 0, sizeof(Undo));
+    Data.Offset = 5;
+    err = COObjReset(&Obj[5], &AppNode, 0);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(Data.Offset == 0);
+}
+
+
+TEST_LIST = {
+    { "size_write_only",  test_size_write_only  },
+    { "size_snapshot",    test_size_snapshot    },
+    { "size_download",    test_size_download    },
+    { "read_snapshot",    test_read_snapshot    },
+    { "read_write_only",  test_read_write_only  },
+    { "write_apply",      test_write_apply      },
+    { "write_incomplete", test_write_incomplete },
+    { "write_truncated",  test_write_truncated  },
+    { "write_no_entry",   test_write_no_entry   },
+    { "write_read_only",  test_write_read_only  },
+    { "write_bad_size",   test_write_bad_size   },
+    { "write_trailing",   test_write_trailing   },
+    { "write_undo_small", test_write_undo_small },
+    { "write_rollback",   test_write_rollback   },
+    { "reset_offset",     test_reset_offset     },
+    { NULL, NULL }
+};
@@ -0,0 +1,115 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* TEST CASES - READ
+******************************************************************************/
+
+void test_read_negative(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint32_t data = 0xFFFFFFFE;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSIGNED24, (CO_DATA)(&data)};
+    uint8_t  buf[4] = { 0, 0, 0, 0 };
+    CO_ERR   err;
+
+    err = COObjRdValue(&Obj, &AppNode, &buf[0], 3);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(buf[0] == 0xFE);
+    TEST_CHECK(buf[1] == 0xFF);
+    TEST_CHECK(buf[2] == 0xFF);
+    TEST_CHECK(buf[3] == 0x00);
+}
+
+void test_read_direct(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ_D___RW), CO_TSIGNED24, (CO_DATA)(0x7FFFFF)};
+    uint8_t  buf[3] = { 0 };
+    CO_ERR   err;
+
+    err = COObjRdValue(&Obj, &AppNode, &buf[0], 3);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(buf[0] == 0xFF);
+    TEST_CHECK(buf[1] == 0xFF);
+    TEST_CHECK(buf[2] == 0x7F);
+}
+
+/******************************************************************************
+* TEST CASES - WRITE
+******************************************************************************/
+
+void test_write_negative(void)
+{
+    CO_NODE  AppNode = { 0 };
+    int32_t  data = 0;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSIGNED24, (CO_DATA)(&data)};
+    uint8_t  buf[3] = { 0x00, 0x00, 0x80 };
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &buf[0], 3);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data == -8388608);
+}
+
+void test_write_positive(void)
+{
+    CO_NODE  AppNode = { 0 };
+    int32_t  data = 0;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSIGNED24, (CO_DATA)(&data)};
+    uint8_t  buf[4] = { 0xFF, 0xFF, 0x7F, 0xFF };
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &buf[0], 3);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data == 0x7FFFFF);
+}
+
+void test_write_nodeid(void)
+{
+    CO_NODE  AppNode = { 0 };
+    int32_t  data = 0;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ__N__RW), CO_TSIGNED24, (CO_DATA)(&data)};
+    uint8_t  buf[3] = { 0x05, 0x00, 0x00 };
+    CO_ERR   err;
+
+    AppNode.NodeId = 7;
+    err = COObjWrValue(&Obj, &AppNode, &buf[0], 3);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data == -2);
+}
+
+
+TEST_LIST = {
+    { "read_negative",  test_read_negative  },
+    { "read_direct",    test_read_direct    },
+    { "write_negative", test_write_negative },
+    { "write_positive", test_write_positive },
+    { "write_nodeid",   test_write_nodeid   },
+    { NULL, NULL }
+};
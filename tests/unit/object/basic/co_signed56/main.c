@@ -0,0 +1,114 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* TEST CASES - SIZE
+******************************************************************************/
+
+void test_size_ref(void)
+{
+    CO_NODE  AppNode = { 0 };
+    int64_t  data = 0;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSIGNED56, (CO_DATA)(&data)};
+    uint32_t size;
+
+    size = COObjGetSize(&Obj, &AppNode, 0);
+
+    TEST_CHECK(size == 7);
+}
+
+/******************************************************************************
+* TEST CASES - READ
+******************************************************************************/
+
+void test_read_negative(void)
+{
+    CO_NODE  AppNode = { 0 };
+    int64_t  data = -2;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSIGNED56, (CO_DATA)(&data)};
+    uint8_t  buf[8] = { 0 };
+    CO_ERR   err;
+
+    err = COObjRdValue(&Obj, &AppNode, &buf[0], 7);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(buf[0] == 0xFE);
+    TEST_CHECK(buf[6] == 0xFF);
+    TEST_CHECK(buf[7] == 0x00);
+}
+
+/******************************************************************************
+* TEST CASES - WRITE
+******************************************************************************/
+
+void test_write_negative(void)
+{
+    CO_NODE  AppNode = { 0 };
+    int64_t  data = 0;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSIGNED56, (CO_DATA)(&data)};
+    uint8_t  buf[7] = { 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF };
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &buf[0], 7);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data == -2);
+}
+
+void test_write_positive(void)
+{
+    CO_NODE  AppNode = { 0 };
+    int64_t  data = -1;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSIGNED56, (CO_DATA)(&data)};
+    uint8_t  buf[7] = { 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F };
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &buf[0], 7);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data == 0x7FFFFFFFFFFFFF);
+}
+
+void test_write_bad_size(void)
+{
+    CO_NODE  AppNode = { 0 };
+    int64_t  data = 5;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSIGNED56, (CO_DATA)(&data)};
+    uint8_t  buf[8] = { 0 };
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &buf[0], 8);
+
+    TEST_CHECK(err == CO_ERR_BAD_ARG);
+    TEST_CHECK(data == 5);
+}
+
+
+TEST_LIST = {
+    { "size_ref",       test_size_ref       },
+    { "read_negative",  test_read_negative  },
+    { "write_negative", test_write_negative },
+    { "write_positive", test_write_positive },
+    { "write_bad_size", test_write_bad_size },
+    { NULL, NULL }
+};
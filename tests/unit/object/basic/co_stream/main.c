@@ -0,0 +1,292 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* TEST ENVIRONMENT
+******************************************************************************/
+
+/* the stream storage of the application is a RAM area, which records the
+ * offset of the last accessed chunk */
+static uint8_t  Mem[20];
+static uint32_t LastOffset;
+static uint32_t Calls;
+
+static CO_ERR TestRead(CO_OBJ_STREAM *stream, uint32_t offset, uint8_t *buf, uint32_t len)
+{
+    uint8_t *mem = (uint8_t *)stream->Ctx;
+
+    LastOffset = offset;
+    Calls++;
+    memcpy(buf, &mem[offset], len);
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR TestWrite(CO_OBJ_STREAM *stream, uint32_t offset, uint8_t *buf, uint32_t len)
+{
+    uint8_t *mem = (uint8_t *)stream->Ctx;
+
+    LastOffset = offset;
+    Calls++;
+    memcpy(&mem[offset], buf, len);
+    return (CO_ERR_NONE);
+}
+
+static CO_ERR TestFail(CO_OBJ_STREAM *stream, uint32_t offset, uint8_t *buf, uint32_t len)
+{
+    (void)stream;
+    (void)offset;
+    (void)buf;
+    (void)len;
+    return (CO_ERR_BAD_ARG);
+}
+
+static void TestSetup(void)
+{
+    for (int i=0; i<20; i++) {
+        Mem[i] = (uint8_t)(1+i);
+    }
+    LastOffset = 0xFFFFFFFF;
+    Calls      = 0;
+}
+
+/******************************************************************************
+* TEST CASES - SIZE
+******************************************************************************/
+
+void test_size_unknown(void)
+{
+    CO_NODE       AppNode = { 0 };
+    CO_OBJ_STREAM data = { 0, sizeof(Mem), TestRead, TestWrite, &Mem[0] };
+    CO_OBJ        Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTREAM, (CO_DATA)(&data)};
+    uint32_t      size;
+
+    size = COObjGetSize(&Obj, &AppNode, 0);
+
+    TEST_CHECK(size == 20);
+}
+
+void test_size_small(void)
+{
+    CO_NODE       AppNode = { 0 };
+    CO_OBJ_STREAM data = { 0, sizeof(Mem), TestRead, TestWrite, &Mem[0] };
+    CO_OBJ        Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTREAM, (CO_DATA)(&data)};
+    uint32_t      size;
+
+    size = COObjGetSize(&Obj, &AppNode, 5);
+
+    TEST_CHECK(size == 5);
+}
+
+void test_size_large(void)
+{
+    CO_NODE       AppNode = { 0 };
+    CO_OBJ_STREAM data = { 0, sizeof(Mem), TestRead, TestWrite, &Mem[0] };
+    CO_OBJ        Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTREAM, (CO_DATA)(&data)};
+    uint32_t      size;
+
+    size = COObjGetSize(&Obj, &AppNode, 32);
+
+    TEST_CHECK(size == 20);
+}
+
+/******************************************************************************
+* TEST CASES - READ
+******************************************************************************/
+
+void test_read_chunks(void)
+{
+    CO_NODE       AppNode = { 0 };
+    uint8_t       var[8] = { 0 };
+    CO_OBJ_STREAM data = { 0, sizeof(Mem), TestRead, TestWrite, &Mem[0] };
+    CO_OBJ        Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTREAM, (CO_DATA)(&data)};
+    CO_ERR        err;
+
+    TestSetup();
+    err = COObjRdBufStart(&Obj, &AppNode, &var[0], 0);
+    TEST_CHECK(err == CO_ERR_NONE);
+
+    err = COObjRdBufCont(&Obj, &AppNode, &var[0], 8);
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(LastOffset == 0);
+    TEST_CHECK(var[0] == 1);
+    TEST_CHECK(var[7] == 8);
+
+    err = COObjRdBufCont(&Obj, &AppNode, &var[0], 8);
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(LastOffset == 8);
+    TEST_CHECK(var[0] == 9);
+    TEST_CHECK(var[7] == 16);
+
+    memset(var, 0, sizeof(var));
+    err = COObjRdBufCont(&Obj, &AppNode, &var[0], 8);
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(LastOffset == 16);
+    TEST_CHECK(var[3] == 20);
+    TEST_CHECK(var[4] == 0);
+    TEST_CHECK(data.Offset == 20);
+    TEST_CHECK(Calls == 3);
+}
+
+void test_read_no_func(void)
+{
+    CO_NODE       AppNode = { 0 };
+    uint8_t       var[8] = { 0 };
+    CO_OBJ_STREAM data = { 0, sizeof(Mem), 0, TestWrite, &Mem[0] };
+    CO_OBJ        Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTREAM, (CO_DATA)(&data)};
+    CO_ERR        err;
+
+    TestSetup();
+    err = COObjRdBufCont(&Obj, &AppNode, &var[0], 8);
+
+    TEST_CHECK(err == CO_ERR_OBJ_ACC);
+    TEST_CHECK(data.Offset == 0);
+}
+
+void test_read_error(void)
+{
+    CO_NODE       AppNode = { 0 };
+    uint8_t       var[8] = { 0 };
+    CO_OBJ_STREAM data = { 0, sizeof(Mem), TestFail, TestWrite, &Mem[0] };
+    CO_OBJ        Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTREAM, (CO_DATA)(&data)};
+    CO_ERR        err;
+
+    TestSetup();
+    err = COObjRdBufCont(&Obj, &AppNode, &var[0], 8);
+
+    TEST_CHECK(err == CO_ERR_TYPE_RD);
+    TEST_CHECK(data.Offset == 0);
+}
+
+/******************************************************************************
+* TEST CASES - WRITE
+******************************************************************************/
+
+void test_write_chunks(void)
+{
+    CO_NODE       AppNode = { 0 };
+    uint8_t       var[8] = { 21,22,23,24,25,26,27,28 };
+    CO_OBJ_STREAM data = { 5, sizeof(Mem), TestRead, TestWrite, &Mem[0] };
+    CO_OBJ        Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTREAM, (CO_DATA)(&data)};
+    CO_ERR        err;
+
+    TestSetup();
+    err = COObjWrBufStart(&Obj, &AppNode, &var[0], 0);
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data.Offset == 0);
+
+    err = COObjWrBufCont(&Obj, &AppNode, &var[0], 8);
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(LastOffset == 0);
+
+    err = COObjWrBufCont(&Obj, &AppNode, &var[0], 8);
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(LastOffset == 8);
+
+    err = COObjWrBufCont(&Obj, &AppNode, &var[0], 8);
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(LastOffset == 16);
+    TEST_CHECK(data.Offset == 20);
+
+    for (int i=0; i<20; i++) {
+        TEST_CHECK(Mem[i] == 21 + (i % 8));
+    }
+}
+
+void test_write_no_func(void)
+{
+    CO_NODE       AppNode = { 0 };
+    uint8_t       var[8] = { 21,22,23,24,25,26,27,28 };
+    CO_OBJ_STREAM data = { 0, sizeof(Mem), TestRead, 0, &Mem[0] };
+    CO_OBJ        Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTREAM, (CO_DATA)(&data)};
+    CO_ERR        err;
+
+    TestSetup();
+    err = COObjWrBufCont(&Obj, &AppNode, &var[0], 8);
+
+    TEST_CHECK(err == CO_ERR_OBJ_ACC);
+    TEST_CHECK(Mem[0] == 1);
+}
+
+void test_write_bad_node(void)
+{
+    uint8_t       var[8] = { 21,22,23,24,25,26,27,28 };
+    CO_OBJ_STREAM data = { 0, sizeof(Mem), TestRead, TestWrite, &Mem[0] };
+    CO_OBJ        Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTREAM, (CO_DATA)(&data)};
+    CO_ERR        err;
+
+    TestSetup();
+    err = COObjWrValue(&Obj, NULL, &var, sizeof(var));
+
+    TEST_CHECK(err == CO_ERR_BAD_ARG);
+    TEST_CHECK(Calls == 0);
+}
+
+/******************************************************************************
+* TEST CASES - INIT
+******************************************************************************/
+
+void test_init_offset(void)
+{
+    CO_NODE       AppNode = { 0 };
+    CO_OBJ_STREAM data = { 4, sizeof(Mem), TestRead, TestWrite, &Mem[0] };
+    CO_OBJ        Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTREAM, (CO_DATA)(&data)};
+    CO_ERR        err;
+
+    err = COObjInit(&Obj, &AppNode);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data.Offset == 0);
+}
+
+/******************************************************************************
+* TEST CASES - RESET
+******************************************************************************/
+
+void test_reset_offset(void)
+{
+    CO_NODE       AppNode = { 0 };
+    CO_OBJ_STREAM data = { 4, sizeof(Mem), TestRead, TestWrite, &Mem[0] };
+    CO_OBJ        Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TSTREAM, (CO_DATA)(&data)};
+    CO_ERR        err;
+
+    err = COObjReset(&Obj, &AppNode, 7);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data.Offset == 7);
+}
+
+
+TEST_LIST = {
+    { "size_unknown",   test_size_unknown   },
+    { "size_small",     test_size_small     },
+    { "size_large",     test_size_large     },
+    { "read_chunks",    test_read_chunks    },
+    { "read_no_func",   test_read_no_func   },
+    { "read_error",     test_read_error     },
+    { "write_chunks",   test_write_chunks   },
+    { "write_no_func",  test_write_no_func  },
+    { "write_bad_node", test_write_bad_node },
+    { "init_offset",    test_init_offset    },
+    { "reset_offset",   test_reset_offset   },
+    { NULL, NULL }
+};
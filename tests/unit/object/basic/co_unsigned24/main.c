@@ -0,0 +1,194 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+void StubReset(void);
+#define TEST_INIT StubReset()
+
+#include "acutest.h"
+
+/******************************************************************************
+* TEST CASE - STUB FUNCTIONS
+******************************************************************************/
+
+uint32_t StubPdoTrigObj = 0;
+void COTPdoTrigObj(CO_TPDO *tpdo, CO_OBJ *obj)
+{
+    StubPdoTrigObj++;
+}
+
+void StubReset(void)
+{
+    StubPdoTrigObj = 0;
+}
+
+/******************************************************************************
+* TEST CASES - SIZE
+******************************************************************************/
+
+void test_size_ref(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint32_t data = 0x112233;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED24, (CO_DATA)(&data)};
+    uint32_t size;
+
+    size = COObjGetSize(&Obj, &AppNode, 0);
+
+    TEST_CHECK(size == 3);
+}
+
+void test_size_direct(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_D___RW), CO_TUNSIGNED24, (CO_DATA)(0x112233)};
+    uint32_t size;
+
+    size = COObjGetSize(&Obj, &AppNode, 4);
+
+    TEST_CHECK(size == 3);
+}
+
+/******************************************************************************
+* TEST CASES - READ
+******************************************************************************/
+
+void test_read_ref(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint32_t data = 0x112233;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED24, (CO_DATA)(&data)};
+    uint8_t  buf[4] = { 0, 0, 0, 0xAA };
+    CO_ERR   err;
+
+    err = COObjRdValue(&Obj, &AppNode, &buf[0], 3);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(buf[0] == 0x33);
+    TEST_CHECK(buf[1] == 0x22);
+    TEST_CHECK(buf[2] == 0x11);
+    TEST_CHECK(buf[3] == 0xAA);
+}
+
+void test_read_nodeid(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint32_t data = 0x112233;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ__N__RW), CO_TUNSIGNED24, (CO_DATA)(&data)};
+    uint8_t  buf[3] = { 0 };
+    CO_ERR   err;
+
+    AppNode.NodeId = 7;
+    err = COObjRdValue(&Obj, &AppNode, &buf[0], 3);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(buf[0] == 0x3A);
+    TEST_CHECK(buf[1] == 0x22);
+    TEST_CHECK(buf[2] == 0x11);
+}
+
+void test_read_bad_size(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint32_t data = 0x112233;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED24, (CO_DATA)(&data)};
+    uint8_t  buf[4] = { 0x44, 0x55, 0x66, 0x77 };
+    CO_ERR   err;
+
+    err = COObjRdValue(&Obj, &AppNode, &buf[0], 4);
+
+    TEST_CHECK(err == CO_ERR_BAD_ARG);
+    TEST_CHECK(buf[0] == 0x44);
+}
+
+/******************************************************************************
+* TEST CASES - WRITE
+******************************************************************************/
+
+void test_write_ref(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint32_t data = 0x112233;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED24, (CO_DATA)(&data)};
+    uint8_t  buf[4] = { 0x66, 0x55, 0x44, 0xAA };
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &buf[0], 3);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data == 0x445566);
+}
+
+void test_write_direct(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ_D___RW), CO_TUNSIGNED24, (CO_DATA)(0x112233)};
+    uint8_t  buf[3] = { 0xDD, 0xEE, 0xFF };
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &buf[0], 3);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK((uint32_t)Obj.Data == 0x00FFEEDD);
+}
+
+void test_write_pdo_async(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint32_t data = 0x112233;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ___APRW), CO_TUNSIGNED24, (CO_DATA)(&data)};
+    uint8_t  buf[3] = { 0x66, 0x55, 0x44 };
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &buf[0], 3);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data == 0x445566);
+    TEST_CHECK(StubPdoTrigObj == 1);
+}
+
+void test_write_bad_size(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint32_t data = 0x112233;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED24, (CO_DATA)(&data)};
+    uint8_t  buf[4] = { 0x66, 0x55, 0x44, 0x00 };
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &buf[0], 4);
+
+    TEST_CHECK(err == CO_ERR_BAD_ARG);
+    TEST_CHECK(data == 0x112233);
+}
+
+
+TEST_LIST = {
+    { "size_ref",        test_size_ref        },
+    { "size_direct",     test_size_direct     },
+    { "read_ref",        test_read_ref        },
+    { "read_nodeid",     test_read_nodeid     },
+    { "read_bad_size",   test_read_bad_size   },
+    { "write_ref",       test_write_ref       },
+    { "write_direct",    test_write_direct    },
+    { "write_pdo_async", test_write_pdo_async },
+    { "write_bad_size",  test_write_bad_size  },
+    { NULL, NULL }
+};
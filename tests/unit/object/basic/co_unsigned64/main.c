@@ -0,0 +1,183 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+
+void StubReset(void);
+#define TEST_INIT StubReset()
+
+#include "acutest.h"
+
+/******************************************************************************
+* TEST CASE - STUB FUNCTIONS
+******************************************************************************/
+
+uint32_t StubPdoTrigObj = 0;
+void COTPdoTrigObj(CO_TPDO *tpdo, CO_OBJ *obj)
+{
+    StubPdoTrigObj++;
+}
+
+void StubReset(void)
+{
+    StubPdoTrigObj = 0;
+}
+
+/******************************************************************************
+* TEST CASES - SIZE
+******************************************************************************/
+
+void test_size_ref(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint64_t data = 0x1122334455667788;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED64, (CO_DATA)(&data)};
+    uint32_t size;
+
+    size = COObjGetSize(&Obj, &AppNode, 0);
+
+    TEST_CHECK(size == 8);
+}
+
+void test_size_direct(void)
+{
+    CO_NODE  AppNode = { 0 };
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_D___RW), CO_TUNSIGNED64, (CO_DATA)(0x11223344)};
+    uint32_t size;
+
+    size = COObjGetSize(&Obj, &AppNode, 0);
+
+    TEST_CHECK(size == 0);
+}
+
+/******************************************************************************
+* TEST CASES - READ
+******************************************************************************/
+
+void test_read_ref(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint64_t data = 0x1122334455667788;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED64, (CO_DATA)(&data)};
+    uint8_t  buf[8] = { 0 };
+    CO_ERR   err;
+
+    err = COObjRdValue(&Obj, &AppNode, &buf[0], 8);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(buf[0] == 0x88);
+    TEST_CHECK(buf[3] == 0x55);
+    TEST_CHECK(buf[7] == 0x11);
+}
+
+void test_read_nodeid(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint64_t data = 0x11223344556677F8;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ__N__RW), CO_TUNSIGNED64, (CO_DATA)(&data)};
+    uint8_t  buf[8] = { 0 };
+    CO_ERR   err;
+
+    AppNode.NodeId = 0x10;
+    err = COObjRdValue(&Obj, &AppNode, &buf[0], 8);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(buf[0] == 0x08);
+    TEST_CHECK(buf[1] == 0x78);
+}
+
+void test_read_bad_size(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint64_t data = 0x1122334455667788;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED64, (CO_DATA)(&data)};
+    uint8_t  buf[8] = { 0 };
+    CO_ERR   err;
+
+    err = COObjRdValue(&Obj, &AppNode, &buf[0], 4);
+
+    TEST_CHECK(err == CO_ERR_BAD_ARG);
+    TEST_CHECK(buf[0] == 0);
+}
+
+/******************************************************************************
+* TEST CASES - WRITE
+******************************************************************************/
+
+void test_write_ref(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint64_t data = 0;
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TUNSIGNED64, (CO_DATA)(&data)};
+    uint8_t  buf[8] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &buf[0], 8);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data == 0x0706050403020100);
+}
+
+void test_write_pdo_async(void)
+{
+    CO_NODE  AppNode = { 0 };
+    uint64_t data = 0;
+    CO_OBJ   Obj = { CO_KEY(0, 0, CO_OBJ___APRW), CO_TUNSIGNED64, (CO_DATA)(&data)};
+    uint8_t  buf[8] = { 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07 };
+    CO_ERR   err;
+
+    err = COObjWrValue(&Obj, &AppNode, &buf[0], 8);
+    TEST_CHECK(err == CO_ERR_NONE);
+    err = COObjWrValue(&Obj, &AppNode, &buf[0], 8);
+    TEST_CHECK(err == CO_ERR_NONE);
+
+    TEST_CHECK(StubPdoTrigObj == 1);
+}
+
+void test_write_real64(void)
+{
+    CO_NODE  AppNode = { 0 };
+    double   data = 0.0;
+    double   var  = -1.5;
+    CO_OBJ   Src  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TREAL64, (CO_DATA)(&var)};
+    CO_OBJ   Obj  = { CO_KEY(0, 0, CO_OBJ_____RW), CO_TREAL64, (CO_DATA)(&data)};
+    uint8_t  buf[8];
+    CO_ERR   err;
+
+    err = COObjRdValue(&Src, &AppNode, &buf[0], 8);
+    TEST_CHECK(err == CO_ERR_NONE);
+    err = COObjWrValue(&Obj, &AppNode, &buf[0], 8);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(data == -1.5);
+}
+
+
+TEST_LIST = {
+    { "size_ref",        test_size_ref        },
+    { "size_direct",     test_size_direct     },
+    { "read_ref",        test_read_ref        },
+    { "read_nodeid",     test_read_nodeid     },
+    { "read_bad_size",   test_read_bad_size   },
+    { "write_ref",       test_write_ref       },
+    { "write_pdo_async", test_write_pdo_async },
+    { "write_real64",    test_write_real64    },
+    { NULL, NULL }
+};
@@ -0,0 +1,256 @@
+/******************************************************************************
+   Copyright 2020 Embedded Office GmbH & Co. KG
+
+   Licensed under the Apache License, Version 2.0 (the "License");
+   you may not use this file except in compliance with the License.
+   You may obtain a copy of the License at
+
+       http://www.apache.org/licenses/LICENSE-2.0
+
+   Unless required by applicable law or agreed to in writing, software
+   distributed under the License is distributed on an "AS IS" BASIS,
+   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+   See the License for the specific language governing permissions and
+   limitations under the License.
+******************************************************************************/
+
+
+
+/******************************************************************************
+* INCLUDES
+******************************************************************************/
+
+#include "co_core.h"
+#include "acutest.h"
+
+/******************************************************************************
+* TEST ENVIRONMENT
+******************************************************************************/
+
+/* the time of the statistics is set by the test cases */
+static uint32_t    TestTime;
+
+static CO_NODE     AppNode;
+static CO_SDO_STAT Stat;
+static CO_OBJ      Obj[4] = {
+    { CO_KEY(0x2F00,                     0, CO_OBJ_D___R_), CO_TUNSIGNED8, (CO_DATA)(CO_SDO_STAT_SUB_N - 1) },
+    { CO_KEY(0x2F00, CO_SDO_STAT_SUB_NUM,   CO_OBJ_____RW), CO_TSDO_STAT , (CO_DATA)(&Stat) },
+    { CO_KEY(0x2F00, CO_SDO_STAT_SUB_BYTES, CO_OBJ_____RW), CO_TSDO_STAT , (CO_DATA)(&Stat) },
+    { CO_KEY(0x2F00, CO_SDO_STAT_SUB_N,     CO_OBJ_____RW), CO_TSDO_STAT , (CO_DATA)(&Stat) }
+};
+
+static void TestSetup(void)
+{
+    TestTime = 0;
+    memset(&AppNode, 0, sizeof(AppNode));
+    memset(&Stat, 0, sizeof(Stat));
+}
+
+/* read the counter with the given subindex via the object type */
+static uint32_t TestRead(uint8_t sub)
+{
+    CO_OBJ   obj = { CO_KEY(0x2F00, sub, CO_OBJ_____R_), CO_TSDO_STAT, (CO_DATA)(&Stat) };
+    uint32_t val = 0xFFFFFFFF;
+    CO_ERR   err;
+
+    err = COObjRdValue(&obj, &AppNode, &val, 4);
+    TEST_CHECK(err == CO_ERR_NONE);
+    return (val);
+}
+
+/* count a finished transfer with the given duration */
+static void TestTransfer(uint8_t type, uint32_t size, uint32_t us, uint32_t code)
+{
+    COSdoStatStart(&Stat, type, size, TestTime);
+    TestTime += us;
+    COSdoStatEnd(&Stat, code, TestTime);
+}
+
+/******************************************************************************
+* TEST CASES - SIZE
+******************************************************************************/
+
+void test_size_counter(void)
+{
+    uint32_t size;
+
+    TestSetup();
+    size = COObjGetSize(&Obj[1], &AppNode, 0);
+    TEST_CHECK(size == 4);
+
+    size = COObjGetSize(&Obj[2], &AppNode, 4);
+    TEST_CHECK(size == 4);
+}
+
+void test_size_no_counter(void)
+{
+    CO_OBJ   obj = { CO_KEY(0x2F00, 1, CO_OBJ_____R_), CO_TSDO_STAT, (CO_DATA)(0) };
+    uint32_t size;
+
+    TestSetup();
+    size = COObjGetSize(&Obj[3], &AppNode, 0);
+    TEST_CHECK(size == 0);
+
+    size = COObjGetSize(&obj, &AppNode, 0);
+    TEST_CHECK(size == 0);
+}
+
+/******************************************************************************
+* TEST CASES - READ
+******************************************************************************/
+
+void test_read_counters(void)
+{
+    TestSetup();
+    TestTransfer(CO_SDO_STAT_EXP_UP,   4,   10, 0);
+    TestTransfer(CO_SDO_STAT_SEG_DOWN, 100, 10, 0);
+    TestTransfer(CO_SDO_STAT_SEG_DOWN, 50,  10, 0);
+    TestTransfer(CO_SDO_STAT_BLK_DOWN, 900, 10, CO_SDO_ERR_TIMEOUT);
+
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_NUM + CO_SDO_STAT_EXP_UP)   == 1);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_NUM + CO_SDO_STAT_EXP_DOWN) == 0);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_NUM + CO_SDO_STAT_SEG_DOWN) == 2);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_NUM + CO_SDO_STAT_BLK_DOWN) == 0);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_BYTES) == 154);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_ABORT) == 1);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_TMO)   == 1);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_OTHER) == 0);
+}
+
+void test_read_hist(void)
+{
+    TestSetup();
+    TestTransfer(CO_SDO_STAT_EXP_UP, 4, 0, 0);
+    TestTransfer(CO_SDO_STAT_EXP_UP, 4, CO_SDO_STAT_HIST_RES - 1, 0);
+    TestTransfer(CO_SDO_STAT_EXP_UP, 4, CO_SDO_STAT_HIST_RES, 0);
+    TestTransfer(CO_SDO_STAT_EXP_UP, 4, 4 * CO_SDO_STAT_HIST_RES, 0);
+    TestTransfer(CO_SDO_STAT_EXP_UP, 4, 0xFFFFFFFF, 0);
+
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_HIST + 0) == 2);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_HIST + 1) == 1);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_HIST + 2) == 0);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_HIST + 3) == 1);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_HIST + CO_SDO_STAT_HIST_N - 1) == 1);
+}
+
+void test_read_codes(void)
+{
+    TestSetup();
+    TestTransfer(CO_SDO_STAT_EXP_DOWN, 4, 0, CO_SDO_ERR_RANGE);
+    TestTransfer(CO_SDO_STAT_EXP_UP,   4, 0, CO_SDO_ERR_OBJ);
+    TestTransfer(CO_SDO_STAT_EXP_DOWN, 4, 0, CO_SDO_ERR_RANGE);
+
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_CODE + 0) == CO_SDO_ERR_RANGE);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_CODE + 1) == 2);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_CODE + 2) == CO_SDO_ERR_OBJ);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_CODE + 3) == 1);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_CODE + 4) == 0);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_ABORT)    == 3);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_TMO)      == 0);
+}
+
+/******************************************************************************
+* TEST CASES - WRITE
+******************************************************************************/
+
+void test_write_clear(void)
+{
+    uint32_t val = 0;
+    CO_ERR   err;
+
+    TestSetup();
+    TestTransfer(CO_SDO_STAT_EXP_UP,   4, 0, 0);
+    TestTransfer(CO_SDO_STAT_EXP_DOWN, 4, 0, CO_SDO_ERR_RANGE);
+    err = COObjWrValue(&Obj[2], &AppNode, &val, 4);
+
+    TEST_CHECK(err == CO_ERR_NONE);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_NUM)      == 0);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_BYTES)    == 0);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_ABORT)    == 0);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_HIST)     == 0);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_CODE)     == 0);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_CODE + 1) == 0);
+}
+
+void test_write_range(void)
+{
+    uint32_t val = 1;
+    CO_ERR   err;
+
+    TestSetup();
+    TestTransfer(CO_SDO_STAT_EXP_UP, 4, 0, 0);
+    err = COObjWrValue(&Obj[1], &AppNode, &val, 4);
+
+    TEST_CHECK(err == CO_ERR_OBJ_RANGE);
+    TEST_CHECK(TestRead(CO_SDO_STAT_SUB_NUM) == 1);
+}
+
+/******************************************************************************
+* TEST CASES - STATISTICS
+******************************************************************************/
+
+void test_count_finished(void)
+{
+    TestSetup();
+    COSdoStatStart(&Stat, CO_SDO_STAT_SEG_UP, 0, TestTime);
+    Stat.Size = 20;
+    TestTime  = 2 * CO_SDO_STAT_HIST_RES;
+    COSdoStatEnd(&Stat, 0, TestTime);
+
+    TEST_CHECK(Stat.Act   == 0);
+    TEST_CHECK(Stat.Num[CO_SDO_STAT_SEG_UP] == 1);
+    TEST_CHECK(Stat.Bytes == 20);
+    TEST_CHECK(Stat.Hist[2] == 1);
+}
+
+void test_count_inactive(void)
+{
+    TestSetup();
+    TestTransfer(CO_SDO_STAT_EXP_UP, 4, 0, 0);
+    COSdoStatEnd(&Stat, 0, TestTime);
+    COSdoStatEnd(&Stat, CO_SDO_ERR_TIMEOUT, TestTime);
+
+    TEST_CHECK(Stat.Num[CO_SDO_STAT_EXP_UP] == 1);
+    TEST_CHECK(Stat.Abort   == 0);
+    TEST_CHECK(Stat.Timeout == 0);
+}
+
+void test_count_other(void)
+{
+    uint32_t n;
+
+    TestSetup();
+    for (n = 0; n < CO_SDO_STAT_CODE_N; n++) {
+        TestTransfer(CO_SDO_STAT_EXP_UP, 4, 0, 0x06000000 + n);
+    }
+    TestTransfer(CO_SDO_STAT_EXP_UP, 4, 0, 0x07000000);
+    TestTransfer(CO_SDO_STAT_EXP_UP, 4, 0, 0x06000000);
+
+    TEST_CHECK(Stat.Abort == CO_SDO_STAT_CODE_N + 2);
+    TEST_CHECK(Stat.Other == 1);
+    TEST_CHECK(Stat.Code[0].Num == 2);
+    TEST_CHECK(Stat.Code[CO_SDO_STAT_CODE_N - 1].Code == 0x06000000 + CO_SDO_STAT_CODE_N - 1);
+}
+
+void test_limit_buckets(void)
+{
+    TEST_CHECK(COSdoStatLimit(0) == CO_SDO_STAT_HIST_RES);
+    TEST_CHECK(COSdoStatLimit(3) == 8 * CO_SDO_STAT_HIST_RES);
+    TEST_CHECK(COSdoStatLimit(CO_SDO_STAT_HIST_N - 1) == 0);
+}
+
+
+TEST_LIST = {
+    { "size_counter",    test_size_counter    },
+    { "size_no_counter", test_size_no_counter },
+    { "read_counters",   test_read_counters   },
+    { "read_hist",       test_read_hist       },
+    { "read_codes",      test_read_codes      },
+    { "write_clear",     test_write_clear     },
+    { "write_range",     test_write_range     },
+    { "count_finished",  test_count_finished  },
+    { "count_inactive",  test_count_inactive  },
+    { "count_other",     test_count_other     },
+    { "limit_buckets",   test_limit_buckets   },
+    { NULL, NULL }
+};